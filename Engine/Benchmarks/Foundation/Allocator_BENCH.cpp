@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+#include <Foundation/Memory/FreeListAllocator.h>
+#include <Foundation/Memory/LinearAllocator.h>
+#include <Foundation/Memory/PoolAllocator.h>
+#include <Foundation/Memory/StackAllocator.h>
+#include <memory>
+#include <vector>
+
+using namespace EngineCore::Foundation;
+
+namespace
+{
+constexpr size_t kArenaSize = 16 * 1024 * 1024;
+constexpr int kAllocsPerIteration = 1024;
+
+template <typename Allocator> std::unique_ptr<Allocator> MakeAllocator(void* memory, size_t blockSize)
+{
+    if constexpr (std::is_same_v<Allocator, PoolAllocator>)
+        return std::make_unique<PoolAllocator>(memory, kArenaSize, blockSize);
+    else
+        return std::make_unique<Allocator>(memory, kArenaSize);
+}
+
+/// Allocates a batch through the IAllocator interface, then frees it the way the allocator expects.
+template <typename Allocator> void BM_AllocatorBatch(benchmark::State& state)
+{
+    const size_t size = static_cast<size_t>(state.range(0));
+    auto memory       = std::make_unique<uint8_t[]>(kArenaSize);
+    auto allocator    = MakeAllocator<Allocator>(memory.get(), size);
+    IAllocator& base  = *allocator;
+    std::vector<void*> pointers(kAllocsPerIteration);
+
+    for (auto _ : state)
+    {
+        for (int i = 0; i < kAllocsPerIteration; ++i)
+            pointers[i] = base.allocate(size);
+        benchmark::DoNotOptimize(pointers.data());
+
+        if constexpr (std::is_same_v<Allocator, LinearAllocator>)
+        {
+            base.reset();
+        }
+        else
+        {
+            // Stack allocators free in LIFO order; the others accept any order.
+            for (int i = kAllocsPerIteration - 1; i >= 0; --i)
+                base.deallocate(pointers[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kAllocsPerIteration);
+}
+
+void BM_SystemMalloc(benchmark::State& state)
+{
+    const size_t size = static_cast<size_t>(state.range(0));
+    std::vector<void*> pointers(kAllocsPerIteration);
+    for (auto _ : state)
+    {
+        for (int i = 0; i < kAllocsPerIteration; ++i)
+            pointers[i] = ::operator new(size);
+        benchmark::DoNotOptimize(pointers.data());
+        for (int i = kAllocsPerIteration - 1; i >= 0; --i)
+            ::operator delete(pointers[i]);
+    }
+    state.SetItemsProcessed(state.iterations() * kAllocsPerIteration);
+}
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_AllocatorBatch, LinearAllocator)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_AllocatorBatch, StackAllocator)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_AllocatorBatch, PoolAllocator)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_AllocatorBatch, FreeListAllocator)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK(BM_SystemMalloc)->Arg(16)->Arg(256)->Arg(4096);
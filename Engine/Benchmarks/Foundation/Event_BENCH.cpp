@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+#include <Foundation/Event/Event.h>
+#include <Foundation/Event/EventBus.h>
+#include <vector>
+
+using namespace EngineCore::Foundation;
+
+namespace
+{
+struct BenchEvent
+{
+    int value = 0;
+};
+
+void BM_EventBusEmit(benchmark::State& state)
+{
+    EventBus bus;
+    int sum = 0;
+    std::vector<EventBus::Subscription<BenchEvent>> subscriptions;
+    for (int64_t i = 0; i < state.range(0); ++i)
+        subscriptions.push_back(bus.subscribe<BenchEvent>([&sum](const BenchEvent& e) { sum += e.value; }));
+
+    BenchEvent event{1};
+    for (auto _ : state)
+        bus.emit(event);
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_EventBusEmitNoSubscribers(benchmark::State& state)
+{
+    EventBus bus;
+    BenchEvent event{1};
+    for (auto _ : state)
+        bus.emit(event);
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_EventInvoke(benchmark::State& state)
+{
+    Event<int> event;
+    int sum = 0;
+    std::vector<Event<int>::Subscription> subscriptions;
+    for (int64_t i = 0; i < state.range(0); ++i)
+        subscriptions.push_back(event.subscribe([&sum](int value) { sum += value; }));
+
+    for (auto _ : state)
+        event(1);
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations());
+}
+} // namespace
+
+BENCHMARK(BM_EventBusEmit)->Arg(1)->Arg(8)->Arg(64);
+BENCHMARK(BM_EventBusEmitNoSubscribers);
+BENCHMARK(BM_EventInvoke)->Arg(1)->Arg(8)->Arg(64);
@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+#include <Foundation/JobSystem/JobSystem.h>
+#include <atomic>
+#include <vector>
+
+using namespace EngineCore::Foundation;
+
+namespace
+{
+// Worker counts to sweep; benchmark arg 0 is the worker count.
+void WorkerCounts(benchmark::internal::Benchmark* bench)
+{
+    for (int workers : {1, 2, 4, 8})
+        bench->Arg(workers);
+}
+
+class JobSystemFixture : public benchmark::Fixture
+{
+  public:
+    void SetUp(const benchmark::State& state) override
+    {
+        jobSystem.setWorkerCount(static_cast<size_t>(state.range(0)));
+        jobSystem.startup();
+    }
+
+    void TearDown(const benchmark::State&) override
+    {
+        jobSystem.shutdown();
+    }
+
+    JobSystem jobSystem;
+};
+} // namespace
+
+BENCHMARK_DEFINE_F(JobSystemFixture, SubmitAndWait)(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        JobHandle handle = jobSystem.submit([]() {});
+        jobSystem.wait(handle);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_REGISTER_F(JobSystemFixture, SubmitAndWait)->Apply(WorkerCounts)->UseRealTime();
+
+BENCHMARK_DEFINE_F(JobSystemFixture, SubmitBatch)(benchmark::State& state)
+{
+    constexpr int kBatch = 256;
+    std::atomic<int> counter{0};
+    for (auto _ : state)
+    {
+        JobHandle handle{};
+        for (int i = 0; i < kBatch; ++i)
+            jobSystem.submit([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); }, handle);
+        jobSystem.wait(handle);
+    }
+    state.SetItemsProcessed(state.iterations() * kBatch);
+}
+BENCHMARK_REGISTER_F(JobSystemFixture, SubmitBatch)->Apply(WorkerCounts)->UseRealTime();
+
+BENCHMARK_DEFINE_F(JobSystemFixture, ParallelFor)(benchmark::State& state)
+{
+    const size_t count = static_cast<size_t>(state.range(1));
+    std::vector<float> values(count, 1.0f);
+    for (auto _ : state)
+    {
+        jobSystem.parallel_for(0, count, [&values](size_t i) { values[i] = values[i] * 1.0001f + 0.5f; });
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK_REGISTER_F(JobSystemFixture, ParallelFor)
+    ->ArgsProduct({{1, 2, 4, 8}, {1 << 10, 1 << 16, 1 << 20}})
+    ->ArgNames({"workers", "count"})
+    ->UseRealTime();
@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+#include <Foundation/Math/TransformBatch.h>
+#include <Foundation/JobSystem/JobSystem.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace EngineCore::Foundation;
+
+namespace
+{
+// position xyz, quat xyzw, scale xyz
+constexpr size_t kStride = 10;
+
+struct Batch
+{
+    explicit Batch(size_t count) : records(count * kStride), matrices(count)
+    {
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> value(-10.0f, 10.0f);
+        for (size_t i = 0; i < count; ++i)
+        {
+            float* r = &records[i * kStride];
+            const Math::Quat q = glm::normalize(Math::Quat(value(rng), value(rng), value(rng), value(rng)));
+            r[0] = value(rng);
+            r[1] = value(rng);
+            r[2] = value(rng);
+            r[3] = q.x;
+            r[4] = q.y;
+            r[5] = q.z;
+            r[6] = q.w;
+            r[7] = r[8] = r[9] = 1.5f;
+        }
+    }
+
+    Math::TRSView view() const
+    {
+        return Math::TRSView::Interleaved(&records[0], kStride, &records[3], kStride, &records[7], kStride);
+    }
+
+    std::vector<float> records;
+    std::vector<Math::Mat4> matrices;
+};
+
+// The per-entity glm path the kernels replace
+void TRS_GlmProduct(benchmark::State& state)
+{
+    Batch batch(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < batch.matrices.size(); ++i)
+        {
+            const float* r = &batch.records[i * kStride];
+            batch.matrices[i] = glm::translate(Math::Mat4(1.0f), Math::Vec3(r[0], r[1], r[2])) *
+                                glm::mat4_cast(Math::Quat(r[6], r[3], r[4], r[5])) *
+                                glm::scale(Math::Mat4(1.0f), Math::Vec3(r[7], r[8], r[9]));
+        }
+        benchmark::DoNotOptimize(batch.matrices.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(TRS_GlmProduct)->Arg(1 << 10)->Arg(1 << 16);
+
+// arg 1 is the forced Math::SimdLevel
+void TRS_Batch(benchmark::State& state)
+{
+    Batch batch(static_cast<size_t>(state.range(0)));
+    const auto level = static_cast<Math::SimdLevel>(state.range(1));
+    state.SetLabel(Math::ToString(std::min(level, Math::ActiveSimdLevel())));
+    for (auto _ : state)
+    {
+        Math::ComposeTRS(batch.view(), 0, batch.matrices.size(), batch.matrices.data(), level);
+        benchmark::DoNotOptimize(batch.matrices.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(TRS_Batch)->ArgsProduct({{1 << 10, 1 << 16}, {0, 1, 2}})->ArgNames({"count", "level"});
+
+void TRS_BatchParallel(benchmark::State& state)
+{
+    JobSystem jobs;
+    jobs.setWorkerCount(static_cast<size_t>(state.range(1)));
+    jobs.startup();
+
+    Batch batch(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        Math::ComposeTRSParallel(&jobs, batch.view(), batch.matrices.size(), batch.matrices.data());
+        benchmark::DoNotOptimize(batch.matrices.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    jobs.shutdown();
+}
+BENCHMARK(TRS_BatchParallel)
+    ->ArgsProduct({{1 << 16, 1 << 20}, {1, 4, 8}})
+    ->ArgNames({"count", "workers"})
+    ->UseRealTime();
+} // namespace
@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+#include <Modules/ResourceModule/Asset/AssetID.h>
+#include <string>
+#include <vector>
+
+using namespace ResourceModule;
+
+namespace
+{
+std::vector<AssetID> MakeIds(size_t count)
+{
+    std::vector<AssetID> ids;
+    ids.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+        ids.push_back(MakeRandomAssetID());
+    return ids;
+}
+
+void BM_AssetIDHash(benchmark::State& state)
+{
+    const auto ids = MakeIds(1024);
+    AssetID::Hasher hasher;
+    size_t i = 0;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(hasher(ids[i++ & 1023]));
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_AssetIDParse(benchmark::State& state)
+{
+    std::vector<std::string> strings;
+    for (const auto& id : MakeIds(1024))
+        strings.push_back(id.str());
+
+    size_t i = 0;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(AssetID(strings[i++ & 1023]));
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_AssetIDToString(benchmark::State& state)
+{
+    const auto ids = MakeIds(1024);
+    size_t i = 0;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(ids[i++ & 1023].str());
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_AssetIDFromPath(benchmark::State& state)
+{
+    std::vector<std::string> paths;
+    for (int i = 0; i < 1024; ++i)
+        paths.push_back("Resources/Meshes/Environment/rock_" + std::to_string(i) + ".obj");
+
+    size_t i = 0;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(MakeDeterministicIDFromPath(paths[i++ & 1023]));
+    state.SetItemsProcessed(state.iterations());
+}
+} // namespace
+
+BENCHMARK(BM_AssetIDHash);
+BENCHMARK(BM_AssetIDParse);
+BENCHMARK(BM_AssetIDToString);
+BENCHMARK(BM_AssetIDFromPath);
@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+#include <Modules/ResourceModule/ResourceCache.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using namespace ResourceModule;
+
+namespace
+{
+struct BenchResource
+{
+    int payload = 0;
+};
+
+/// Shared between benchmark threads so ThreadRange measures lock contention on find().
+struct CacheData
+{
+    ResourceCache<BenchResource> cache;
+    std::vector<std::shared_ptr<BenchResource>> resources;
+    std::vector<AssetID> hits;
+    std::vector<AssetID> misses;
+};
+
+CacheData& SharedCache(size_t entries)
+{
+    static std::mutex mutex;
+    static std::map<size_t, std::unique_ptr<CacheData>> caches;
+
+    std::scoped_lock lock(mutex);
+    auto& data = caches[entries];
+    if (!data)
+    {
+        data = std::make_unique<CacheData>();
+        for (size_t i = 0; i < entries; ++i)
+        {
+            auto resource = std::make_shared<BenchResource>();
+            AssetID id    = MakeRandomAssetID();
+            data->cache.put(id, resource);
+            data->resources.push_back(resource);
+            data->hits.push_back(id);
+            data->misses.push_back(MakeRandomAssetID());
+        }
+    }
+    return *data;
+}
+
+void FindLoop(benchmark::State& state, bool hit)
+{
+    CacheData& data = SharedCache(static_cast<size_t>(state.range(0)));
+    const auto& ids = hit ? data.hits : data.misses;
+    size_t i        = static_cast<size_t>(state.thread_index()) * 7919;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(data.cache.find(ids[i++ % ids.size()]));
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_ResourceCacheFindHit(benchmark::State& state)
+{
+    FindLoop(state, true);
+}
+
+void BM_ResourceCacheFindMiss(benchmark::State& state)
+{
+    FindLoop(state, false);
+}
+} // namespace
+
+BENCHMARK(BM_ResourceCacheFindHit)->Arg(1024)->Arg(65536)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_ResourceCacheFindMiss)->Arg(1024)->Arg(65536)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,100 @@
+#include "HeadlessWorld.h"
+
+#include <Core/Core.h>
+#include <Foundation/Memory/MemorySystem.h>
+#include <Foundation/JobSystem/JobSystem.h>
+#include <Modules/ObjectCoreModule/ECS/EntityWorld.h>
+#include <Modules/ObjectCoreModule/ECS/FlecsJobBridge.h>
+#include <Modules/PhysicsModule/PhysicsContext/PhysicsContext.h>
+#include <Modules/PhysicsModule/PhysicsLocator.h>
+#include <Modules/PhysicsModule/PhysicsModule.h>
+#include <Modules/RenderModule/RenderContext.h>
+#include <Modules/ResourceModule/ResourceManager.h>
+#include <Modules/ScriptModule/LuaScriptModule.h>
+
+#include <stdexcept>
+
+namespace SceneBenchmarks
+{
+ScopedMemorySystem::ScopedMemorySystem()
+{
+    // 100k-entity scenes outgrow the 1MB/4MB the unit tests use.
+    EngineCore::Foundation::MemorySystem::startup(16 * 1024 * 1024, 64 * 1024 * 1024);
+}
+
+ScopedMemorySystem::~ScopedMemorySystem()
+{
+    EngineCore::Foundation::MemorySystem::shutdown();
+}
+
+HeadlessWorld::HeadlessWorld(bool withScripts, uint32_t ecsWorkers)
+{
+    // RenderContext and the script module resolve the ResourceManager through the CoreLocator.
+    m_resourceManager = std::make_shared<ResourceModule::ResourceManager>();
+    EngineCore::Base::Core::Register(m_resourceManager, 15);
+
+    m_renderContext  = std::make_unique<RenderModule::RenderContext>();
+    m_physicsContext = std::make_unique<PhysicsModule::PhysicsContext>(m_renderContext.get());
+    PhysicsModule::PhysicsLocator::Provide(m_physicsContext.get());
+
+    m_scriptModule  = std::make_shared<ScriptModule::LuaScriptModule>();
+    m_physicsModule = std::make_shared<PhysicsModule::PhysicsModule>();
+    if (withScripts)
+    {
+        m_scriptModule->startup();
+        m_scriptsStarted = true;
+    }
+
+    m_world = std::make_unique<EntityWorld>(m_resourceManager.get(), m_scriptModule.get(), m_physicsModule.get());
+    m_world->init();
+
+    if (ecsWorkers > 0)
+    {
+        m_jobs = std::make_unique<EngineCore::Foundation::JobSystem>();
+        m_jobs->setWorkerCount(ecsWorkers);
+        m_jobs->startup();
+        if (!ECSModule::FlecsJobBridge::Install(m_jobs.get()))
+            throw std::runtime_error("--ecs-workers needs a build with ENGINE_DISABLE_JOB_SYSTEM=0");
+        m_world->setTaskThreads(static_cast<int32_t>(ECSModule::FlecsJobBridge::StageCount()));
+    }
+}
+
+HeadlessWorld::~HeadlessWorld()
+{
+    if (m_world)
+    {
+        m_world->get().each([this](flecs::entity e) { m_physicsContext->destroyBodyForEntity(e); });
+    }
+    // Scripts are ended while the world is torn down, so the VMs have to outlive it.
+    m_world.reset();
+    if (m_jobs)
+    {
+        ECSModule::FlecsJobBridge::Uninstall();
+        m_jobs->shutdown();
+        m_jobs.reset();
+    }
+    if (m_scriptsStarted)
+        m_scriptModule->shutdown();
+
+    PhysicsModule::PhysicsLocator::Reset();
+    m_physicsModule.reset();
+    m_scriptModule.reset();
+    m_physicsContext.reset();
+    m_renderContext.reset();
+    m_resourceManager.reset();
+
+    EngineCore::Base::Core::ShutdownAll();
+}
+
+void HeadlessWorld::frame(StageRecorder& recorder, float dt)
+{
+    {
+        auto scope = recorder.time("ECS");
+        m_world->tick(dt);
+    }
+    {
+        auto scope = recorder.time("Physics");
+        m_physicsContext->step(dt);
+    }
+}
+} // namespace SceneBenchmarks
@@ -0,0 +1,90 @@
+#pragma once
+#include "SceneBenchmark.h"
+
+#include <memory>
+
+class EntityWorld;
+
+namespace EngineCore::Foundation
+{
+class JobSystem;
+}
+
+namespace ResourceModule
+{
+class ResourceManager;
+}
+namespace ScriptModule
+{
+class LuaScriptModule;
+}
+namespace PhysicsModule
+{
+class PhysicsModule;
+class PhysicsContext;
+} // namespace PhysicsModule
+namespace RenderModule
+{
+class RenderContext;
+}
+
+namespace SceneBenchmarks
+{
+/// Starts the MemorySystem for the lifetime of a scenario.
+class ScopedMemorySystem
+{
+  public:
+    ScopedMemorySystem();
+    ~ScopedMemorySystem();
+
+    ScopedMemorySystem(const ScopedMemorySystem&)            = delete;
+    ScopedMemorySystem& operator=(const ScopedMemorySystem&) = delete;
+};
+
+/**
+ * @brief EntityWorld with physics and scripting wired up, without a window or renderer
+ *
+ * Same setup as the ECSModule and PhysicsModule functional test fixtures, so the benchmarks
+ * exercise the systems the tests cover. A frame ticks the world ("ECS") and then steps
+ * physics ("Physics"), in the order Application::engineTick runs them. Needs a running
+ * MemorySystem (see ScopedMemorySystem).
+ *
+ * With @p ecsWorkers > 0 the world gets its own JobSystem and runs multi_threaded() systems
+ * on those workers plus the calling thread (needs a build with the job system enabled).
+ */
+class HeadlessWorld
+{
+  public:
+    /// @p withScripts starts the LuaScriptModule so ScriptComponents get a runtime VM.
+    explicit HeadlessWorld(bool withScripts = false, uint32_t ecsWorkers = 0);
+    ~HeadlessWorld();
+
+    HeadlessWorld(const HeadlessWorld&)            = delete;
+    HeadlessWorld& operator=(const HeadlessWorld&) = delete;
+
+    void frame(StageRecorder& recorder, float dt);
+
+    EntityWorld& world() noexcept
+    {
+        return *m_world;
+    }
+    ResourceModule::ResourceManager& resources() noexcept
+    {
+        return *m_resourceManager;
+    }
+    PhysicsModule::PhysicsContext& physics() noexcept
+    {
+        return *m_physicsContext;
+    }
+
+  private:
+    std::unique_ptr<EngineCore::Foundation::JobSystem> m_jobs;
+    std::shared_ptr<ResourceModule::ResourceManager> m_resourceManager;
+    std::shared_ptr<ScriptModule::LuaScriptModule> m_scriptModule;
+    std::shared_ptr<PhysicsModule::PhysicsModule> m_physicsModule;
+    std::unique_ptr<RenderModule::RenderContext> m_renderContext;
+    std::unique_ptr<PhysicsModule::PhysicsContext> m_physicsContext;
+    std::unique_ptr<EntityWorld> m_world;
+    bool m_scriptsStarted = false;
+};
+} // namespace SceneBenchmarks
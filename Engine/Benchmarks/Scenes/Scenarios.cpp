@@ -0,0 +1,224 @@
+#include "HeadlessWorld.h"
+#include "SceneBenchmark.h"
+
+#include "../../Tests/PhysicsModule/TestHelpers.h"
+#include "../../Tests/ResourceModule/TestHelpers.h"
+
+#include <Modules/ObjectCoreModule/ECS/Components/ECSComponents.h>
+#include <Modules/ObjectCoreModule/ECS/EntityWorld.h>
+#include <Modules/ObjectCoreModule/ECS/Systems/ECSLuaScriptsSystem.h>
+#include <Modules/PhysicsModule/Components/ColliderComponent.h>
+#include <Modules/PhysicsModule/Components/RigidBodyComponent.h>
+#include <Modules/ResourceModule/Asset/AssetDatabase.h>
+#include <Modules/ResourceModule/Asset/AssetManager.h>
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace SceneBenchmarks;
+
+namespace
+{
+constexpr uint32_t kTransformCount = 100'000;
+constexpr uint32_t kBodyCount      = 10'000;
+constexpr uint32_t kScriptCount    = 5'000;
+constexpr int kMeshGridSize        = 32;
+constexpr int kTextureSize         = 256;
+
+constexpr const char* kMoverScript = R"(
+local Mover = { angle = 0.0 }
+
+function Mover.OnStart()
+    Mover.angle = 0.0
+end
+
+function Mover.OnUpdate(dt)
+    Mover.angle = (Mover.angle + dt * 90.0) % 360.0
+    Mover.offset = math.sin(math.rad(Mover.angle)) * 2.0
+end
+
+return Mover
+)";
+
+void WriteFile(const std::filesystem::path& path, const std::string& content)
+{
+    std::filesystem::create_directories(path.parent_path());
+    std::ofstream file(path, std::ios::binary);
+    file << content;
+    if (!file)
+        throw std::runtime_error("Failed to write " + path.string());
+}
+
+std::string GridMesh(int size)
+{
+    std::vector<std::array<float, 3>> vertices;
+    std::vector<std::array<int, 3>> faces;
+    vertices.reserve(static_cast<size_t>(size * size));
+    for (int z = 0; z < size; ++z)
+    {
+        for (int x = 0; x < size; ++x)
+            vertices.push_back({static_cast<float>(x), std::sin(x * 0.3f) * std::cos(z * 0.3f), static_cast<float>(z)});
+    }
+    // OBJ indices are 1-based.
+    for (int z = 0; z + 1 < size; ++z)
+    {
+        for (int x = 0; x + 1 < size; ++x)
+        {
+            const int i = z * size + x + 1;
+            faces.push_back({i, i + 1, i + size});
+            faces.push_back({i + 1, i + size + 1, i + size});
+        }
+    }
+    return ResourceModuleTest::TestData::createOBJFile(vertices, faces);
+}
+
+void WriteTexture(const std::filesystem::path& path, int size, uint32_t seed)
+{
+    std::vector<uint8_t> pixels(static_cast<size_t>(size * size * 4));
+    for (int y = 0; y < size; ++y)
+    {
+        for (int x = 0; x < size; ++x)
+        {
+            uint8_t* pixel = &pixels[static_cast<size_t>((y * size + x) * 4)];
+            pixel[0]       = static_cast<uint8_t>(x ^ y ^ seed);
+            pixel[1]       = static_cast<uint8_t>(x * 3 + seed);
+            pixel[2]       = static_cast<uint8_t>(y * 5 + seed);
+            pixel[3]       = 255;
+        }
+    }
+    std::filesystem::create_directories(path.parent_path());
+    if (!stbi_write_png(path.string().c_str(), size, size, 4, pixels.data(), size * 4))
+        throw std::runtime_error("Failed to write " + path.string());
+}
+
+std::unique_ptr<ResourceModule::AssetManager> MakeAssetManager(const std::filesystem::path& resources,
+                                                                const std::filesystem::path& cache,
+                                                                const std::filesystem::path& database)
+{
+    auto assetManager = std::make_unique<ResourceModule::AssetManager>();
+    assetManager->setProjectResourcesRoot(resources);
+    assetManager->setEngineResourcesRoot(resources);
+    assetManager->setCacheRoot(cache);
+    assetManager->setDatabasePath(database);
+    assetManager->registerDefaultImporters();
+    return assetManager;
+}
+} // namespace
+
+LAMPY_SCENE_BENCHMARK(Transforms100k, "100k entities with a TransformComponent moved by an OnUpdate system")
+{
+    ScopedMemorySystem memory;
+    HeadlessWorld scene(false, config.ecsWorkers);
+    flecs::world& world = scene.world().get();
+
+    for (uint32_t i = 0; i < kTransformCount; ++i)
+    {
+        TransformComponent transform;
+        transform.position = {static_cast<float>(i % 316), 0.0f, static_cast<float>(i / 316)};
+        world.entity().set<TransformComponent>(transform);
+    }
+
+    world.system<TransformComponent>("SceneBenchDrift")
+        .kind(flecs::OnUpdate)
+        .multi_threaded()
+        .each([](flecs::iter& it, size_t index, TransformComponent& transform) {
+            const float dt = static_cast<float>(it.delta_time());
+            transform.position.y += dt;
+            transform.rotation.y = std::fmod(transform.rotation.y + dt * 45.0f, 360.0f);
+            it.entity(index).modified<TransformComponent>();
+        });
+
+    RunFrames(config, recorder, [&]() { scene.frame(recorder, config.dt); });
+}
+
+LAMPY_SCENE_BENCHMARK(RigidBodies10k, "10k dynamic boxes created by SyncToPhysics falling onto a static ground")
+{
+    ScopedMemorySystem memory;
+    HeadlessWorld scene(false, config.ecsWorkers);
+    flecs::world& world = scene.world().get();
+    PhysicsModuleTest::Helpers::CreateGround(world, scene.physics(), glm::vec3(0.0f, -0.5f, 0.0f),
+                                             glm::vec3(100.0f, 0.5f, 100.0f));
+
+    // 100x100 grid, staggered in height so the boxes land over several frames instead of all at once.
+    for (uint32_t i = 0; i < kBodyCount; ++i)
+    {
+        TransformComponent transform;
+        transform.position = {static_cast<float>(i % 100) * 1.5f - 75.0f, 2.0f + static_cast<float>(i % 7),
+                              static_cast<float>(i / 100) * 1.5f - 75.0f};
+
+        PhysicsModule::RigidBodyComponent body;
+        body.mass = 1.0f;
+        PhysicsModule::ColliderComponent collider;
+        collider.shapeDesc.type = PhysicsModule::PhysicsShapeType::Box;
+        collider.shapeDesc.size = glm::vec3(0.5f);
+
+        world.entity()
+            .set<TransformComponent>(transform)
+            .set<PhysicsModule::RigidBodyComponent>(body)
+            .set<PhysicsModule::ColliderComponent>(collider);
+    }
+
+    RunFrames(config, recorder, [&]() { scene.frame(recorder, config.dt); });
+}
+
+LAMPY_SCENE_BENCHMARK(ScriptedEntities5k, "5k entities running the same Lua OnUpdate on the runtime VM")
+{
+    ScopedMemorySystem memory;
+    ResourceModuleTest::TempDirectory project("LampySceneScripts");
+    const auto resources = project.createSubdir("Resources");
+    const auto scriptPath = resources / "Scripts" / "Mover.lua";
+    WriteFile(scriptPath, ResourceModuleTest::TestData::createLuaScript(kMoverScript));
+
+    auto assetManager = MakeAssetManager(resources, project.createSubdir("Cache"), project.path() / "assets.json");
+    assetManager->scanAndImportAllIn(resources);
+    auto scriptInfo = assetManager->getDatabase().findBySource("Scripts/Mover.lua");
+    if (!scriptInfo)
+        throw std::runtime_error("Mover.lua was not imported");
+
+    HeadlessWorld scene(true, config.ecsWorkers);
+    scene.resources().setDatabase(&assetManager->getDatabase());
+    scene.resources().setProjectResourcesRoot(resources);
+    scene.resources().setEngineResourcesRoot(resources);
+
+    flecs::world& world = scene.world().get();
+    for (uint32_t i = 0; i < kScriptCount; ++i)
+    {
+        TransformComponent transform;
+        transform.position = {static_cast<float>(i % 71), 0.0f, static_cast<float>(i / 71)};
+        ScriptComponent script;
+        script.scriptID = scriptInfo->guid;
+        world.entity().set<TransformComponent>(transform).set<ScriptComponent>(script);
+    }
+
+    RunFrames(config, recorder, [&]() { scene.frame(recorder, config.dt); });
+}
+
+LAMPY_SCENE_BENCHMARK(BulkAssetImport, "Cold import of K OBJ meshes and K PNG textures into an empty cache")
+{
+    ScopedMemorySystem memory;
+    ResourceModuleTest::TempDirectory project("LampySceneImport");
+    const auto resources = project.createSubdir("Resources");
+
+    const std::string mesh = GridMesh(kMeshGridSize);
+    for (uint32_t i = 0; i < config.assetCount; ++i)
+    {
+        WriteFile(resources / "Meshes" / ("grid_" + std::to_string(i) + ".obj"), mesh);
+        WriteTexture(resources / "Textures" / ("noise_" + std::to_string(i) + ".png"), kTextureSize, i);
+    }
+
+    // Every run starts from an empty cache and database so nothing is skipped as up to date.
+    for (uint32_t run = 0; run < config.importRuns; ++run)
+    {
+        const std::string suffix = std::to_string(run);
+        auto assetManager = MakeAssetManager(resources, project.createSubdir("Cache" + suffix),
+                                             project.path() / ("assets" + suffix + ".json"));
+        auto scope = recorder.time("Import");
+        assetManager->scanAndImportAllIn(resources);
+    }
+}
@@ -0,0 +1,146 @@
+#include "SceneBenchmark.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace SceneBenchmarks
+{
+namespace
+{
+double NearestRank(const std::vector<double>& sorted, double percentile)
+{
+    if (sorted.empty())
+        return 0.0;
+    const size_t rank = static_cast<size_t>(std::ceil(percentile / 100.0 * static_cast<double>(sorted.size())));
+    return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+void CheckMetric(const std::string& scenario, const std::string& stage, const char* metric,
+                 const nlohmann::json& expected, const nlohmann::json& measured, double tolerance, double minDeltaMs,
+                 std::vector<Regression>& regressions)
+{
+    if (!expected.contains(metric) || !measured.contains(metric))
+        return;
+
+    const double baselineMs = expected[metric].get<double>();
+    const double measuredMs = measured[metric].get<double>();
+    const double limitMs    = baselineMs * (1.0 + tolerance) + minDeltaMs;
+    if (measuredMs > limitMs)
+        regressions.push_back({scenario, stage, metric, baselineMs, measuredMs, limitMs});
+}
+} // namespace
+
+void StageRecorder::record(const std::string& stage, double elapsedMs)
+{
+    if (m_enabled)
+        m_samples[stage].push_back(elapsedMs);
+}
+
+std::map<std::string, StageSummary> StageRecorder::summarize() const
+{
+    std::map<std::string, StageSummary> summaries;
+    for (const auto& [stage, samples] : m_samples)
+    {
+        if (samples.empty())
+            continue;
+
+        std::vector<double> sorted = samples;
+        std::sort(sorted.begin(), sorted.end());
+        double total = 0.0;
+        for (double sample : sorted)
+            total += sample;
+
+        StageSummary& summary = summaries[stage];
+        summary.p50Ms         = NearestRank(sorted, 50.0);
+        summary.p95Ms         = NearestRank(sorted, 95.0);
+        summary.maxMs         = sorted.back();
+        summary.avgMs         = total / static_cast<double>(sorted.size());
+        summary.samples       = static_cast<uint32_t>(sorted.size());
+    }
+    return summaries;
+}
+
+std::vector<Scenario>& Registry()
+{
+    static std::vector<Scenario> scenarios;
+    return scenarios;
+}
+
+ScenarioRegistrar::ScenarioRegistrar(std::string name, std::string description,
+                                     std::function<void(const ScenarioConfig&, StageRecorder&)> run)
+{
+    Registry().push_back({std::move(name), std::move(description), std::move(run)});
+}
+
+void RunFrames(const ScenarioConfig& config, StageRecorder& recorder, const std::function<void()>& frame)
+{
+    recorder.setEnabled(false);
+    for (uint32_t i = 0; i < config.warmupFrames; ++i)
+        frame();
+
+    recorder.setEnabled(true);
+    for (uint32_t i = 0; i < config.frames; ++i)
+    {
+        auto scope = recorder.time("Frame");
+        frame();
+    }
+}
+
+std::vector<Regression> CompareToBaseline(const nlohmann::json& baseline, const nlohmann::json& results,
+                                          double tolerance, double minDeltaMs)
+{
+    std::vector<Regression> regressions;
+    if (!baseline.contains("scenarios") || !results.contains("scenarios"))
+        return regressions;
+
+    const nlohmann::json& expectedScenarios = baseline["scenarios"];
+    for (const auto& [scenario, stages] : results["scenarios"].items())
+    {
+        if (!expectedScenarios.contains(scenario))
+            continue;
+
+        const nlohmann::json& expectedStages = expectedScenarios[scenario];
+        for (const auto& [stage, measured] : stages.items())
+        {
+            if (!expectedStages.contains(stage))
+                continue;
+            CheckMetric(scenario, stage, "p50Ms", expectedStages[stage], measured, tolerance, minDeltaMs, regressions);
+            CheckMetric(scenario, stage, "p95Ms", expectedStages[stage], measured, tolerance, minDeltaMs, regressions);
+        }
+    }
+    return regressions;
+}
+
+std::vector<std::string> MissingFromBaseline(const nlohmann::json& baseline, const nlohmann::json& results)
+{
+    std::vector<std::string> missing;
+    if (!results.contains("scenarios"))
+        return missing;
+
+    const nlohmann::json empty = nlohmann::json::object();
+    const nlohmann::json& expectedScenarios = baseline.contains("scenarios") ? baseline["scenarios"] : empty;
+    for (const auto& [scenario, stages] : results["scenarios"].items())
+    {
+        for (const auto& [stage, measured] : stages.items())
+        {
+            if (!expectedScenarios.contains(scenario) || !expectedScenarios[scenario].contains(stage))
+                missing.push_back(scenario + "/" + stage);
+        }
+    }
+    return missing;
+}
+
+nlohmann::json ToJson(const std::map<std::string, StageSummary>& stages)
+{
+    nlohmann::json json = nlohmann::json::object();
+    for (const auto& [stage, summary] : stages)
+    {
+        json[stage] = {{"p50Ms", summary.p50Ms},
+                       {"p95Ms", summary.p95Ms},
+                       {"maxMs", summary.maxMs},
+                       {"avgMs", summary.avgMs},
+                       {"samples", summary.samples}};
+    }
+    return json;
+}
+} // namespace SceneBenchmarks
@@ -0,0 +1,137 @@
+#pragma once
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace SceneBenchmarks
+{
+/// Per-stage timing over the measured frames, in milliseconds.
+struct StageSummary
+{
+    double p50Ms     = 0.0;
+    double p95Ms     = 0.0;
+    double maxMs     = 0.0;
+    double avgMs     = 0.0;
+    uint32_t samples = 0;
+};
+
+/**
+ * @brief Collects named stage timings for one scenario run
+ *
+ * Disabled while the scenario warms up so one-off work (body creation, first script load)
+ * does not end up in the percentiles.
+ */
+class StageRecorder
+{
+  public:
+    class Scope
+    {
+      public:
+        Scope(StageRecorder& recorder, std::string stage)
+            : m_recorder(recorder), m_stage(std::move(stage)), m_start(std::chrono::steady_clock::now())
+        {
+        }
+
+        ~Scope()
+        {
+            const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - m_start;
+            m_recorder.record(m_stage, elapsed.count());
+        }
+
+        Scope(const Scope&)            = delete;
+        Scope& operator=(const Scope&) = delete;
+
+      private:
+        StageRecorder& m_recorder;
+        std::string m_stage;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    [[nodiscard]] Scope time(std::string stage)
+    {
+        return Scope(*this, std::move(stage));
+    }
+
+    void record(const std::string& stage, double elapsedMs);
+    void setEnabled(bool enabled) noexcept
+    {
+        m_enabled = enabled;
+    }
+
+    [[nodiscard]] std::map<std::string, StageSummary> summarize() const;
+
+  private:
+    std::map<std::string, std::vector<double>> m_samples;
+    bool m_enabled = true;
+};
+
+struct ScenarioConfig
+{
+    uint32_t frames       = 300;       ///< Measured frames per scenario
+    uint32_t warmupFrames = 10;        ///< Frames run before measuring
+    float dt              = 1.0f / 60; ///< Fixed simulation step
+    uint32_t assetCount   = 64;        ///< Meshes and textures (each) for the import scenario
+    uint32_t importRuns   = 5;         ///< Cold imports measured by the import scenario
+    uint32_t ecsWorkers   = 0;         ///< Job workers for multi_threaded() systems; 0 is single-threaded
+};
+
+struct Scenario
+{
+    std::string name;
+    std::string description;
+    std::function<void(const ScenarioConfig&, StageRecorder&)> run;
+};
+
+std::vector<Scenario>& Registry();
+
+struct ScenarioRegistrar
+{
+    ScenarioRegistrar(std::string name, std::string description,
+                      std::function<void(const ScenarioConfig&, StageRecorder&)> run);
+};
+
+/// Runs warmup frames unrecorded, then the measured frames; every frame is also timed as "Frame".
+void RunFrames(const ScenarioConfig& config, StageRecorder& recorder, const std::function<void()>& frame);
+
+struct Regression
+{
+    std::string scenario;
+    std::string stage;
+    std::string metric;
+    double baselineMs = 0.0;
+    double measuredMs = 0.0;
+    double limitMs    = 0.0;
+};
+
+/**
+ * @brief Compares results against a baseline of the same shape
+ *
+ * A stage regresses when its p50 or p95 exceeds baseline * (1 + tolerance) + minDeltaMs; the
+ * absolute slack keeps sub-millisecond stages from flapping. Stages missing from the baseline
+ * are not compared here; see MissingFromBaseline.
+ */
+std::vector<Regression> CompareToBaseline(const nlohmann::json& baseline, const nlohmann::json& results,
+                                          double tolerance, double minDeltaMs);
+
+/// "scenario/stage" for every measured stage the baseline has no numbers for.
+std::vector<std::string> MissingFromBaseline(const nlohmann::json& baseline, const nlohmann::json& results);
+
+nlohmann::json ToJson(const std::map<std::string, StageSummary>& stages);
+} // namespace SceneBenchmarks
+
+#define LAMPY_SCENE_CONCAT_INNER(a, b) a##b
+#define LAMPY_SCENE_CONCAT(a, b) LAMPY_SCENE_CONCAT_INNER(a, b)
+
+/// Registers a scenario at static-init time: LAMPY_SCENE_BENCHMARK(Name, "what it does") { ... }
+#define LAMPY_SCENE_BENCHMARK(Name, Description)                                                                      \
+    static void LampyScene_##Name(const ::SceneBenchmarks::ScenarioConfig& config,                                   \
+                                  ::SceneBenchmarks::StageRecorder& recorder);                                       \
+    static ::SceneBenchmarks::ScenarioRegistrar LAMPY_SCENE_CONCAT(s_lampySceneRegistrar_, Name)(#Name, Description, \
+                                                                                                 LampyScene_##Name); \
+    static void LampyScene_##Name(const ::SceneBenchmarks::ScenarioConfig& config,                                   \
+                                  ::SceneBenchmarks::StageRecorder& recorder)
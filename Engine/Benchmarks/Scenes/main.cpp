@@ -0,0 +1,243 @@
+// Runs the headless scene benchmarks and compares them against a stored baseline.
+//
+//   LampySceneBenchmarks [--frames N] [--warmup N] [--assets K] [--import-runs N] [--ecs-workers N]
+//                        [--scenario <name>]...
+//                        [--baseline <file>] [--tolerance <fraction>] [--min-delta-ms <ms>]
+//                        [--out <file>] [--update-baseline] [--allow-missing] [--list]
+//
+// --ecs-workers runs multi_threaded() systems on that many job workers; compare against a
+// single-threaded baseline to see how a scene scales.
+//
+// Exit code 1 means at least one stage regressed past the tolerance, a scenario failed, or a
+// measured stage has no baseline entry. --allow-missing only notes the missing entries, for
+// local runs of scenarios that were never recorded on the reference machine.
+
+#include "SceneBenchmark.h"
+
+#include <Foundation/Log/LogCategory.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace EngineCore::Foundation;
+using namespace SceneBenchmarks;
+
+namespace
+{
+struct Options
+{
+    ScenarioConfig config;
+    std::vector<std::string> scenarios;
+    std::string baselinePath;
+    std::string outPath;
+    double tolerance    = -1.0; ///< < 0: use the baseline's own tolerance
+    double minDeltaMs   = 0.05;
+    bool updateBaseline = false;
+    bool allowMissing   = false;
+    bool list           = false;
+};
+
+int PrintUsage()
+{
+    std::cerr << "Usage: LampySceneBenchmarks [--frames N] [--warmup N] [--assets K] [--import-runs N] [--ecs-workers N]\n"
+                 "                            [--scenario <name>]... [--baseline <file>] [--tolerance <fraction>]\n"
+                 "                            [--min-delta-ms <ms>] [--out <file>] [--update-baseline] [--allow-missing]\n"
+                 "                            [--list]\n";
+    return 2;
+}
+
+bool ParseOptions(int argc, char** argv, Options& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        auto value            = [&]() -> const char* { return i + 1 < argc ? argv[++i] : nullptr; };
+
+        if (arg == "--update-baseline")
+            options.updateBaseline = true;
+        else if (arg == "--allow-missing")
+            options.allowMissing = true;
+        else if (arg == "--list")
+            options.list = true;
+        else if (const char* v = (arg.rfind("--", 0) == 0) ? value() : nullptr)
+        {
+            if (arg == "--frames")
+                options.config.frames = static_cast<uint32_t>(std::stoul(v));
+            else if (arg == "--warmup")
+                options.config.warmupFrames = static_cast<uint32_t>(std::stoul(v));
+            else if (arg == "--assets")
+                options.config.assetCount = static_cast<uint32_t>(std::stoul(v));
+            else if (arg == "--import-runs")
+                options.config.importRuns = static_cast<uint32_t>(std::stoul(v));
+            else if (arg == "--ecs-workers")
+                options.config.ecsWorkers = static_cast<uint32_t>(std::stoul(v));
+            else if (arg == "--scenario")
+                options.scenarios.emplace_back(v);
+            else if (arg == "--baseline")
+                options.baselinePath = v;
+            else if (arg == "--tolerance")
+                options.tolerance = std::stod(v);
+            else if (arg == "--min-delta-ms")
+                options.minDeltaMs = std::stod(v);
+            else if (arg == "--out")
+                options.outPath = v;
+            else
+                return false;
+        }
+        else
+            return false;
+    }
+    return !(options.updateBaseline && options.baselinePath.empty());
+}
+
+bool Selected(const Options& options, const std::string& name)
+{
+    return options.scenarios.empty() ||
+           std::find(options.scenarios.begin(), options.scenarios.end(), name) != options.scenarios.end();
+}
+
+void PrintStages(const std::string& scenario, const nlohmann::json& stages)
+{
+    std::printf("%s\n", scenario.c_str());
+    for (const auto& [stage, summary] : stages.items())
+    {
+        std::printf("  %-10s p50 %9.3f ms  p95 %9.3f ms  max %9.3f ms  (%u samples)\n", stage.c_str(),
+                    summary["p50Ms"].get<double>(), summary["p95Ms"].get<double>(), summary["maxMs"].get<double>(),
+                    summary["samples"].get<uint32_t>());
+    }
+}
+
+bool WriteJson(const std::string& path, const nlohmann::json& json)
+{
+    std::error_code ec;
+    const std::filesystem::path target(path);
+    if (target.has_parent_path())
+        std::filesystem::create_directories(target.parent_path(), ec);
+    std::ofstream file(target);
+    file << json.dump(2) << '\n';
+    return file.good();
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    try
+    {
+        if (!ParseOptions(argc, argv, options))
+            return PrintUsage();
+    }
+    catch (const std::exception&)
+    {
+        return PrintUsage();
+    }
+
+    if (options.list)
+    {
+        for (const auto& scenario : Registry())
+            std::cout << scenario.name << " - " << scenario.description << '\n';
+        return 0;
+    }
+
+    // Import and script load spam would swamp the report.
+    LogCategoryRegistry::Instance().setDefaultLevel(LogVerbosity::Warning);
+
+    nlohmann::json baseline = nlohmann::json::object();
+    if (!options.baselinePath.empty() && std::filesystem::exists(options.baselinePath))
+    {
+        std::ifstream file(options.baselinePath);
+        baseline = nlohmann::json::parse(file, nullptr, false);
+        if (!baseline.is_object())
+        {
+            std::cerr << "Baseline " << options.baselinePath << " is not a JSON object\n";
+            return 2;
+        }
+    }
+    else if (!options.baselinePath.empty() && !options.updateBaseline)
+    {
+        std::cerr << "Baseline " << options.baselinePath << " not found; create it with --update-baseline\n";
+        return 2;
+    }
+    if (!baseline.contains("scenarios"))
+        baseline["scenarios"] = nlohmann::json::object();
+    const double tolerance = options.tolerance >= 0.0 ? options.tolerance : baseline.value("tolerance", 0.15);
+
+    nlohmann::json results = {{"frames", options.config.frames},
+                              {"assets", options.config.assetCount},
+                              {"ecsWorkers", options.config.ecsWorkers},
+                              {"tolerance", tolerance},
+                              {"scenarios", nlohmann::json::object()}};
+    bool failed = false;
+    for (const auto& scenario : Registry())
+    {
+        if (!Selected(options, scenario.name))
+            continue;
+
+        StageRecorder recorder;
+        try
+        {
+            scenario.run(options.config, recorder);
+        }
+        catch (const std::exception& ex)
+        {
+            std::cerr << scenario.name << " failed: " << ex.what() << '\n';
+            failed = true;
+            continue;
+        }
+        results["scenarios"][scenario.name] = ToJson(recorder.summarize());
+        PrintStages(scenario.name, results["scenarios"][scenario.name]);
+    }
+
+    if (!options.outPath.empty() && !WriteJson(options.outPath, results))
+        std::cerr << "Failed to write " << options.outPath << '\n';
+
+    if (options.updateBaseline)
+    {
+        // Keep stored entries for scenarios that were not run this time.
+        nlohmann::json updated = baseline;
+        updated["tolerance"]   = tolerance;
+        updated["frames"]      = options.config.frames;
+        updated["assets"]      = options.config.assetCount;
+        for (const auto& [name, stages] : results["scenarios"].items())
+            updated["scenarios"][name] = stages;
+        if (!WriteJson(options.baselinePath, updated))
+        {
+            std::cerr << "Failed to write " << options.baselinePath << '\n';
+            return 2;
+        }
+        std::cout << "Baseline updated: " << options.baselinePath << '\n';
+        return failed ? 1 : 0;
+    }
+
+    if (!options.baselinePath.empty())
+    {
+        // An empty or stale baseline must not let the gate pass without comparing anything.
+        const auto missing = MissingFromBaseline(baseline, results);
+        for (const auto& entry : missing)
+        {
+            if (options.allowMissing)
+                std::cout << "note: no baseline for " << entry << ", not compared\n";
+            else
+                std::printf("MISSING BASELINE %s: record it with --update-baseline on the reference machine\n",
+                            entry.c_str());
+        }
+        failed = failed || (!missing.empty() && !options.allowMissing);
+
+        const auto regressions = CompareToBaseline(baseline, results, tolerance, options.minDeltaMs);
+        for (const auto& regression : regressions)
+        {
+            std::printf("REGRESSION %s/%s %s: %.3f ms (baseline %.3f ms, limit %.3f ms)\n", regression.scenario.c_str(),
+                        regression.stage.c_str(), regression.metric.c_str(), regression.measuredMs,
+                        regression.baselineMs, regression.limitMs);
+        }
+        failed = failed || !regressions.empty();
+    }
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+#include <Modules/TimeModule/TimeScheduler.h>
+
+using namespace TimeModule;
+
+namespace
+{
+/// update() with N repeating tasks that all fire every tick.
+void BM_TimeSchedulerUpdateFiring(benchmark::State& state)
+{
+    TimeScheduler scheduler;
+    int fired = 0;
+    for (int64_t i = 0; i < state.range(0); ++i)
+        scheduler.scheduleRepeating([&fired]() { ++fired; }, 0.0);
+
+    double now = 0.0;
+    for (auto _ : state)
+    {
+        now += 1.0 / 60.0;
+        scheduler.update(now);
+    }
+    benchmark::DoNotOptimize(fired);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// update() with N pending tasks that are not due yet: the cost of scanning idle timers.
+void BM_TimeSchedulerUpdateIdle(benchmark::State& state)
+{
+    TimeScheduler scheduler;
+    for (int64_t i = 0; i < state.range(0); ++i)
+        scheduler.schedule([]() {}, 1.0e9);
+
+    double now = 0.0;
+    for (auto _ : state)
+    {
+        now += 1.0 / 60.0;
+        scheduler.update(now);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+} // namespace
+
+BENCHMARK(BM_TimeSchedulerUpdateFiring)->RangeMultiplier(8)->Range(8, 4096);
+BENCHMARK(BM_TimeSchedulerUpdateIdle)->RangeMultiplier(8)->Range(8, 4096);
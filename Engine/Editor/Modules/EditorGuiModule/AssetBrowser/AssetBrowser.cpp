@@ -176,6 +176,7 @@ void GUIAssetBrowser::applyFilters()
             case 4: selectedType = ResourceModule::AssetType::Audio; break;
             case 5: selectedType = ResourceModule::AssetType::Script; break;
             case 6: selectedType = ResourceModule::AssetType::World; break;
+            case 7: selectedType = ResourceModule::AssetType::Prefab; break;
         }
     }
     
@@ -210,6 +211,7 @@ std::string GUIAssetBrowser::getAssetTypeString(ResourceModule::AssetType type)
         case ResourceModule::AssetType::Audio: return "Audio";
         case ResourceModule::AssetType::Script: return "Script";
         case ResourceModule::AssetType::World: return "World";
+        case ResourceModule::AssetType::Prefab: return "Prefab";
         default: return "Unknown";
     }
 }
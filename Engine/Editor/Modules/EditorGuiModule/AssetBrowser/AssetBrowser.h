@@ -50,6 +50,7 @@ private:
         "Audio",
         "Script",
         "World",
+        "Prefab",
         "Scene"
     };
 };
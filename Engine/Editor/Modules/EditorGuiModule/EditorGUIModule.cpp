@@ -4,7 +4,9 @@
 #include "ContentBrowser/ContentBrowser.h"
 #include "EditorToolPanel.h"
 #include "EditorViewport.h"
+#include "FrameStatsPanel.h"
 #include "MainMenuBar.h"
+#include "MetricsPanel.h"
 #include "OutputLog.h"
 #include "WorldInspector/WorldInspector.h"
 
@@ -41,6 +43,20 @@ void EditorGUIModule::startup()
         m_windowNames.push_back("Console");
     }
 
+    auto metrics = m_imGuiModule->addObject(new GUIMetricsPanel());
+    if (auto ptr = metrics.lock()) {
+        ptr->setWindowName("Metrics");
+        m_windowObjects.push_back(metrics);
+        m_windowNames.push_back("Metrics");
+    }
+
+    auto frameStats = m_imGuiModule->addObject(new GUIFrameStatsPanel());
+    if (auto ptr = frameStats.lock()) {
+        ptr->setWindowName("Frame Stats");
+        m_windowObjects.push_back(frameStats);
+        m_windowNames.push_back("Frame Stats");
+    }
+
     auto contentBrowser = m_imGuiModule->addObject(new GUIContentBrowser());
     if (auto ptr = contentBrowser.lock()) {
         ptr->setWindowName("Content Browser");
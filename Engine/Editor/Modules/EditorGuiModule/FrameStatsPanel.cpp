@@ -0,0 +1,112 @@
+#include "FrameStatsPanel.h"
+
+#include <algorithm>
+#include <imgui.h>
+#include <string>
+
+using namespace EngineCore::Foundation;
+
+GUIFrameStatsPanel::GUIFrameStatsPanel() : GUIObject()
+{
+    for (size_t i = 0; i < FrameStats::kStageCount; ++i)
+        m_budgetInput[i] = static_cast<float>(FrameStats::Instance().getSummary(static_cast<FrameStage>(i)).budgetMs);
+}
+
+void GUIFrameStatsPanel::render(float deltaTime)
+{
+    ZoneScopedN("GUIObject::FrameStats");
+    if (!isVisible())
+        return;
+
+    bool windowOpen = true;
+    if (ImGui::Begin("Frame Stats", &windowOpen, ImGuiWindowFlags_None))
+    {
+        auto& stats = FrameStats::Instance();
+        ImGui::Text("Frames: %llu", static_cast<unsigned long long>(stats.getFrameCount()));
+        ImGui::SameLine();
+        if (ImGui::Button("Reset"))
+            stats.reset();
+
+        const std::string_view plotName = FrameStats::StageName(m_plotStage);
+        if (ImGui::BeginCombo("Plot", plotName.data()))
+        {
+            for (size_t i = 0; i < FrameStats::kStageCount; ++i)
+            {
+                const auto stage = static_cast<FrameStage>(i);
+                if (ImGui::Selectable(FrameStats::StageName(stage).data(), stage == m_plotStage))
+                    m_plotStage = stage;
+            }
+            ImGui::EndCombo();
+        }
+
+        const std::vector<float> history = stats.getHistory(m_plotStage);
+        const FrameStageSummary plotSummary = stats.getSummary(m_plotStage);
+        const float scaleMax = static_cast<float>(std::max(plotSummary.maxMs, plotSummary.budgetMs)) * 1.1f;
+        ImGui::PlotLines("##FrameStatsPlot", history.data(), static_cast<int>(history.size()), 0, nullptr, 0.0f,
+                         scaleMax > 0.0f ? scaleMax : 1.0f, ImVec2(-1.0f, 80.0f));
+
+        renderStageTable();
+    }
+
+    // Handle window close button
+    if (!windowOpen)
+    {
+        hide();
+    }
+
+    ImGui::End();
+}
+
+void GUIFrameStatsPanel::renderStageTable()
+{
+    constexpr ImGuiTableFlags tableFlags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp;
+    if (!ImGui::BeginTable("FrameStatsTable", 8, tableFlags))
+        return;
+
+    ImGui::TableSetupColumn("Stage");
+    ImGui::TableSetupColumn("Last");
+    ImGui::TableSetupColumn("p50");
+    ImGui::TableSetupColumn("p95");
+    ImGui::TableSetupColumn("p99");
+    ImGui::TableSetupColumn("Max");
+    ImGui::TableSetupColumn("Budget (ms)");
+    ImGui::TableSetupColumn("Over");
+    ImGui::TableHeadersRow();
+
+    auto& stats = FrameStats::Instance();
+    for (size_t i = 0; i < FrameStats::kStageCount; ++i)
+    {
+        const auto stage                = static_cast<FrameStage>(i);
+        const FrameStageSummary summary = stats.getSummary(stage);
+        const bool overBudget           = summary.budgetMs > 0.0 && summary.p99Ms > summary.budgetMs;
+
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(FrameStats::StageName(stage).data());
+        ImGui::TableNextColumn();
+        ImGui::Text("%.2f", summary.lastMs);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.2f", summary.p50Ms);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.2f", summary.p95Ms);
+        ImGui::TableNextColumn();
+        if (overBudget)
+            ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "%.2f", summary.p99Ms);
+        else
+            ImGui::Text("%.2f", summary.p99Ms);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.2f", summary.maxMs);
+
+        ImGui::TableNextColumn();
+        ImGui::PushID(static_cast<int>(i));
+        ImGui::SetNextItemWidth(-1.0f);
+        if (ImGui::InputFloat("##Budget", &m_budgetInput[i], 0.0f, 0.0f, "%.2f",
+                              ImGuiInputTextFlags_EnterReturnsTrue))
+            stats.setBudget(stage, m_budgetInput[i]);
+        ImGui::PopID();
+
+        ImGui::TableNextColumn();
+        ImGui::Text("%llu", static_cast<unsigned long long>(summary.overruns));
+    }
+    ImGui::EndTable();
+}
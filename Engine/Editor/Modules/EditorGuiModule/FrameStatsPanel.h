@@ -0,0 +1,25 @@
+#pragma once
+
+#include <EngineMinimal.h>
+#include <Foundation/Profiler/FrameStats.h>
+#include <Modules/ImGuiModule/GUIObject.h>
+
+#include <array>
+
+/// <summary>
+/// Shows FrameStats percentiles per engine tick stage and lets the user edit stage budgets.
+/// </summary>
+class GUIFrameStatsPanel : public ImGUIModule::GUIObject
+{
+    EngineCore::Foundation::FrameStage m_plotStage = EngineCore::Foundation::FrameStage::Frame; ///< Stage shown in the plot
+    std::array<float, EngineCore::Foundation::FrameStats::kStageCount> m_budgetInput{};           ///< Budget edit fields, ms
+
+  public:
+    GUIFrameStatsPanel();
+    ~GUIFrameStatsPanel() override = default;
+
+    void render(float deltaTime) override;
+
+  private:
+    void renderStageTable();
+};
@@ -0,0 +1,114 @@
+#include "MetricsPanel.h"
+
+#include <imgui.h>
+
+using namespace EngineCore::Foundation;
+
+GUIMetricsPanel::GUIMetricsPanel() : GUIObject()
+{
+}
+
+void GUIMetricsPanel::render(float deltaTime)
+{
+    ZoneScopedN("GUIObject::Metrics");
+    if (!isVisible())
+        return;
+
+    const auto now = std::chrono::steady_clock::now();
+    if (m_rows.empty() || std::chrono::duration<float>(now - m_lastSample).count() >= m_sampleInterval)
+        sample();
+
+    bool windowOpen = true;
+    if (ImGui::Begin("Metrics", &windowOpen, ImGuiWindowFlags_None))
+    {
+        ImGui::Text("Metrics: %zu", m_rows.size());
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(200.0f);
+        ImGui::InputTextWithHint("##MetricsFilter", "Filter", m_filter.data(), m_filter.size());
+        renderTable();
+    }
+
+    // Handle window close button
+    if (!windowOpen)
+    {
+        hide();
+    }
+
+    ImGui::End();
+}
+
+void GUIMetricsPanel::sample()
+{
+    const auto now       = std::chrono::steady_clock::now();
+    const double elapsed = m_lastSample.time_since_epoch().count() == 0
+                               ? 0.0
+                               : std::chrono::duration<double>(now - m_lastSample).count();
+    m_lastSample = now;
+
+    m_rows.clear();
+    MetricsRegistry::Instance().forEach([&](const Metric& metric) {
+        Row row{metric.name(), metric.help(), metric.type()};
+        switch (metric.type())
+        {
+        case MetricType::Counter: {
+            row.value           = static_cast<double>(static_cast<const Counter&>(metric).value());
+            auto [it, inserted] = m_previousTotals.try_emplace(metric.name(), row.value);
+            if (!inserted && elapsed > 0.0)
+                row.ratePerSecond = (row.value - it->second) / elapsed;
+            it->second = row.value;
+            break;
+        }
+        case MetricType::Gauge:
+            row.value = static_cast<const Gauge&>(metric).value();
+            break;
+        case MetricType::Histogram: {
+            const auto& histogram = static_cast<const Histogram&>(metric);
+            row.value             = static_cast<double>(histogram.count());
+            row.histogramSum      = histogram.sum();
+            break;
+        }
+        }
+        m_rows.push_back(std::move(row));
+    });
+}
+
+void GUIMetricsPanel::renderTable()
+{
+    constexpr ImGuiTableFlags tableFlags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg |
+                                           ImGuiTableFlags_SizingStretchProp | ImGuiTableFlags_ScrollY;
+    if (!ImGui::BeginTable("MetricsTable", 4, tableFlags))
+        return;
+
+    ImGui::TableSetupScrollFreeze(0, 1);
+    ImGui::TableSetupColumn("Name");
+    ImGui::TableSetupColumn("Type");
+    ImGui::TableSetupColumn("Value");
+    ImGui::TableSetupColumn("Rate / Mean");
+    ImGui::TableHeadersRow();
+
+    const std::string_view filter(m_filter.data());
+    for (const Row& row : m_rows)
+    {
+        if (!filter.empty() && row.name.find(filter) == std::string::npos)
+            continue;
+
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(row.name.c_str());
+        if (!row.help.empty() && ImGui::IsItemHovered())
+            ImGui::SetTooltip("%s", row.help.c_str());
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(MetricTypeName(row.type).data());
+        ImGui::TableNextColumn();
+        if (row.type == MetricType::Gauge)
+            ImGui::Text("%.3f", row.value);
+        else
+            ImGui::Text("%.0f", row.value);
+        ImGui::TableNextColumn();
+        if (row.type == MetricType::Counter)
+            ImGui::Text("%.1f/s", row.ratePerSecond);
+        else if (row.type == MetricType::Histogram && row.value > 0.0)
+            ImGui::Text("%.3f", row.histogramSum / row.value);
+    }
+    ImGui::EndTable();
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <EngineMinimal.h>
+#include <Foundation/Metrics/Metrics.h>
+#include <Modules/ImGuiModule/GUIObject.h>
+
+#include <array>
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// <summary>
+/// Lists every metric in the MetricsRegistry with its current value and, for counters, the rate per second.
+/// </summary>
+class GUIMetricsPanel : public ImGUIModule::GUIObject
+{
+    struct Row
+    {
+        std::string name;
+        std::string help;
+        EngineCore::Foundation::MetricType type;
+        double value         = 0.0; ///< Counter total, gauge level or histogram count
+        double histogramSum  = 0.0;
+        double ratePerSecond = 0.0;
+    };
+
+    std::array<char, 128> m_filter{};                         ///< Substring filter on metric names
+    std::vector<Row> m_rows;                                  ///< Last sampled values
+    std::unordered_map<std::string, double> m_previousTotals; ///< Counter totals at the previous sample
+    std::chrono::steady_clock::time_point m_lastSample{};
+    float m_sampleInterval = 0.5f;                            ///< Seconds between samples; keeps rates readable
+
+  public:
+    GUIMetricsPanel();
+    ~GUIMetricsPanel() override = default;
+
+    void render(float deltaTime) override;
+
+  private:
+    void sample();
+    void renderTable();
+};
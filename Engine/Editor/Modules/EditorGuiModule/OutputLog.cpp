@@ -29,9 +29,8 @@ GUIOutputLog::GUIOutputLog() : GUIObject(), m_luaScriptModule(GCM(ScriptModule::
 
 GUIOutputLog::~GUIOutputLog()
 {
-    // Note: We can't easily remove a sink from LTLogger as there's no removeSink method
-    // The sink will be destroyed automatically when shared_ptr count reaches 0
-    // In a production system, you'd want to add removeSink() method to LTLogger
+    // The async writer thread may still hold records for this sink; removeSink waits for it.
+    LTLogger::Instance().removeSink(m_logSink);
 }
 
 void GUIOutputLog::render(float deltaTime)
@@ -192,6 +192,7 @@ class TransformRenderer : public IComponentRenderer
                 {
                     auto& mutableTransform = EnsureTransformComponent(entity);
                     mutableTransform.position = {position[0], position[1], position[2]};
+                    entity.modified<TransformComponent>();
                 }
 
                 ImGui::TableNextRow();
@@ -205,6 +206,7 @@ class TransformRenderer : public IComponentRenderer
                     RotationComponent newRot;
                     newRot.fromEulerDegrees(glm::vec3(rotation[0], rotation[1], rotation[2]));
                     mutableTransform.rotation = newRot;
+                    entity.modified<TransformComponent>();
                 }
 
                 ImGui::TableNextRow();
@@ -216,6 +218,7 @@ class TransformRenderer : public IComponentRenderer
                 {
                     auto& mutableTransform = EnsureTransformComponent(entity);
                     mutableTransform.scale = {scale[0], scale[1], scale[2]};
+                    entity.modified<TransformComponent>();
                 }
                 endPropertyTable();
             }
@@ -48,7 +48,7 @@ void LogActiveThreads(const char* reason) noexcept
     CloseHandle(snapshot);
 
     const char* label = reason ? reason : "Thread snapshot";
-    LT_LOGI("ThreadDiag", std::format("{}: {} thread(s) alive", label, threadIds.size()));
+    LT_LOGFI("ThreadDiag", "{}: {} thread(s) alive", label, threadIds.size());
 
     if (threadIds.size() > 1)
     {
@@ -60,7 +60,7 @@ void LogActiveThreads(const char* reason) noexcept
                 list += ", ";
             list += std::to_string(threadIds[i]);
         }
-        LT_LOGW("ThreadDiag", std::format("Remaining thread IDs: {}", list));
+        LT_LOGFW("ThreadDiag", "Remaining thread IDs: {}", list);
     }
 #else
     (void)reason;
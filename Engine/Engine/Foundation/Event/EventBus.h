@@ -1,4 +1,5 @@
 #pragma once
+#include "Foundation/Profiler/HitchRecorder.h"
 #include "Foundation/Profiler/ProfileAllocator.h"
 
 #include <functional>
@@ -100,6 +101,7 @@ class EventBus
 
     template <typename T> void emit(const T& event)
     {
+        HitchRecorder::Count(HitchCounter::Events);
         std::vector<std::shared_ptr<BaseWrapper>, ProfileAllocator<std::shared_ptr<BaseWrapper>>> snapshot;
         {
             std::scoped_lock lock(m_mutex);
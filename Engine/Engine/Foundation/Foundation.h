@@ -17,6 +17,8 @@
 
 #include "JobSystem/JobSystem.h"
 
+#include "Metrics/MetricsMacros.h"
+
 #include "Memory/IAllocator.h"
 #include "Memory/MemorySystem.h"
 #include "Memory/MemoryMacros.h"
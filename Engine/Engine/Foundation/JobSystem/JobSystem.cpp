@@ -3,6 +3,8 @@
 #include <EngineMinimal.h>
 #include "../Log/LoggerMacro.h"
 #include "../Log/LogVerbosity.h"
+#include "../Profiler/HitchRecorder.h"
+#include <cstdio>
 #include <format>
 
 #ifdef TRACY_ENABLE
@@ -11,6 +13,16 @@
 
 using namespace EngineCore::Foundation;
 
+namespace
+{
+int64_t NowNs() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+} // namespace
+
 JobSystem::~JobSystem()
 {
     shutdown();
@@ -18,9 +30,7 @@ JobSystem::~JobSystem()
 
 void JobSystem::startup()
 {
-#ifdef TRACY_ENABLE
     ZoneScopedN("JobSystem::startup");
-#endif
 
     if (kJobSystemDisabled)
     {
@@ -33,7 +43,9 @@ void JobSystem::startup()
     LT_LOGI("JobSystem", "Initializing Job System...");
 
     m_running = true;
-    const size_t threadCount = std::max<size_t>(1, std::thread::hardware_concurrency() - 1);
+    const size_t threadCount = m_requestedWorkers > 0
+                                   ? m_requestedWorkers
+                                   : std::max<size_t>(1, std::thread::hardware_concurrency() - 1);
     m_workers.clear();
     m_workers.reserve(threadCount);
     for (size_t i = 0; i < threadCount; ++i)
@@ -44,23 +56,25 @@ void JobSystem::startup()
     for (size_t i = 0; i < threadCount; ++i)
     {
         m_workers[i].thread = std::thread([this, i]() {
-#ifdef TRACY_ENABLE
             char name[64];
             std::snprintf(name, sizeof(name), "JobWorker %zu", i);
+            CpuProfiler::SetThreadName(name);
+#ifdef TRACY_ENABLE
             tracy::SetThreadName(name);
 #endif
             workerLoop(i);
         });
     }
 
-    LT_LOGI("JobSystem", std::format("Started with {} worker threads", threadCount));
+    m_startedAtNs.store(NowNs(), std::memory_order_relaxed);
+    m_activeWorkers.store(threadCount, std::memory_order_relaxed);
+
+    LT_LOGFI("JobSystem", "Started with {} worker threads", threadCount);
 }
 
 void JobSystem::shutdown()
 {
-#ifdef TRACY_ENABLE
     ZoneScopedN("JobSystem::shutdown");
-#endif
 
     if (kJobSystemDisabled)
         return;
@@ -81,6 +95,7 @@ void JobSystem::shutdown()
             w.thread.join();
     }
 
+    m_activeWorkers.store(0, std::memory_order_relaxed);
     m_workers.clear();
 
     LT_LOGI("JobSystem", "Shutdown complete");
@@ -105,9 +120,11 @@ void JobSystem::submit(std::function<void()> job, JobHandle& handle)
 
 void JobSystem::submit(std::function<void()> job, JobHandle& handle, const char* jobName)
 {
+    HitchRecorder::Count(HitchCounter::Jobs);
     if (kJobSystemDisabled)
     {
         (void)jobName;
+        m_jobsInline.fetch_add(1, std::memory_order_relaxed);
         job();
         return;
     }
@@ -115,6 +132,7 @@ void JobSystem::submit(std::function<void()> job, JobHandle& handle, const char*
     if (m_workers.empty())
     {
         // If not started, execute immediately
+        m_jobsInline.fetch_add(1, std::memory_order_relaxed);
         job();
         return;
     }
@@ -125,6 +143,7 @@ void JobSystem::submit(std::function<void()> job, JobHandle& handle, const char*
     }
     
     handle.counter->fetch_add(1, std::memory_order_relaxed);
+    handle.owner = this;
 
     // Round-robin distribution
     static std::atomic<size_t> next{0};
@@ -136,9 +155,7 @@ void JobSystem::submit(std::function<void()> job, JobHandle& handle, const char*
         // Capture shared_ptr to counter to avoid lifetime issues with handle
         std::shared_ptr<std::atomic<uint32_t>> counterPtr = handle.counter;
         m_workers[idx].queue.emplace_back([job = std::move(job), counterPtr]() {
-#ifdef TRACY_ENABLE
             ZoneScopedN("JobExecute");
-#endif
             try {
                 job();
             } catch (...) {
@@ -156,6 +173,32 @@ void JobSystem::wait(const JobHandle& handle)
     handle.wait();
 }
 
+bool JobSystem::runQueuedJob() noexcept
+{
+    if (m_workers.empty())
+        return false;
+
+    // Oldest job first, starting at a different queue each call so waiters spread out
+    static std::atomic<size_t> nextQueue{0};
+    const size_t first = nextQueue.fetch_add(1, std::memory_order_relaxed);
+    for (size_t i = 0; i < m_workers.size(); ++i)
+    {
+        auto& worker = m_workers[(first + i) % m_workers.size()];
+        std::function<void()> job;
+        {
+            std::lock_guard lock(worker.queueMutex);
+            if (worker.queue.empty())
+                continue;
+            job = std::move(worker.queue.front());
+            worker.queue.pop_front();
+        }
+        job();
+        m_jobsExecuted.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
 void JobSystem::workerLoop(size_t index)
 {
     while (true)
@@ -188,7 +231,10 @@ void JobSystem::workerLoop(size_t index)
 
         if (hasJob && job)
         {
+            const int64_t start = NowNs();
             job();
+            m_busyNs.fetch_add(static_cast<uint64_t>(NowNs() - start), std::memory_order_relaxed);
+            m_jobsExecuted.fetch_add(1, std::memory_order_relaxed);
             continue;
         }
 
@@ -206,6 +252,18 @@ void JobSystem::workerLoop(size_t index)
     }
 }
 
+JobSystem::Statistics JobSystem::getStatistics() const noexcept
+{
+    Statistics stats;
+    stats.workers = m_activeWorkers.load(std::memory_order_relaxed);
+    stats.jobsExecuted = m_jobsExecuted.load(std::memory_order_relaxed);
+    stats.jobsInline = m_jobsInline.load(std::memory_order_relaxed);
+    stats.busyNs = m_busyNs.load(std::memory_order_relaxed);
+    if (stats.workers > 0)
+        stats.uptimeNs = static_cast<uint64_t>(NowNs() - m_startedAtNs.load(std::memory_order_relaxed));
+    return stats;
+}
+
 bool JobSystem::stealJob(size_t thiefIndex, std::function<void()>& job)
 {
     std::mt19937 rng(static_cast<unsigned int>(
@@ -21,9 +21,12 @@
 
 namespace EngineCore::Foundation
 {
+    class JobSystem;
+
     struct JobHandle
     {
         std::shared_ptr<std::atomic<uint32_t>> counter;
+        JobSystem* owner = nullptr; // System the jobs were queued on; wait() helps run its queue
         
         // Default constructor - explicitly initialize counter
         JobHandle() noexcept : counter(std::make_shared<std::atomic<uint32_t>>(0)) {}
@@ -35,6 +38,7 @@ namespace EngineCore::Foundation
         // Allow move (share the counter)
         JobHandle(JobHandle&& other) noexcept 
             : counter(std::move(other.counter))
+            , owner(other.owner)
         {
             if (!counter)
             {
@@ -49,6 +53,7 @@ namespace EngineCore::Foundation
             if (this != &other)
             {
                 counter = std::move(other.counter);
+                owner = other.owner;
                 if (!counter)
                 {
                     counter = std::make_shared<std::atomic<uint32_t>>(0);
@@ -59,16 +64,15 @@ namespace EngineCore::Foundation
             return *this;
         }
         
-        void wait() const noexcept
+        // True once every job submitted with this handle has finished; does not block
+        bool isDone() const noexcept
         {
-            if (!counter)
-                return;
-            // Active wait (workers continue stealing)
-            while (counter->load(std::memory_order_acquire) > 0)
-            {
-                std::this_thread::yield();
-            }
+            return !counter || counter->load(std::memory_order_acquire) == 0;
         }
+
+        // Runs queued jobs of the owning system on the calling thread until these are done, so a
+        // job may wait on jobs it submitted. The owning system must outlive the wait.
+        void wait() const noexcept;
     };
 
     class JobSystem final : public EngineCore::Base::IModule
@@ -97,6 +101,9 @@ namespace EngineCore::Foundation
         // Wait for completion
         void wait(const JobHandle& handle);
 
+        // Runs one queued job on the calling thread; false if every queue was empty
+        bool runQueuedJob() noexcept;
+
         // Parallel for (range-based)
         template<typename Fn>
         void parallel_for(size_t begin, size_t end, Fn&& fn, size_t grain = 64);
@@ -104,6 +111,21 @@ namespace EngineCore::Foundation
         // For debugging
         size_t getWorkerCount() const noexcept { return m_workers.size(); }
 
+        // Worker count for the next startup(); 0 = hardware_concurrency - 1
+        void setWorkerCount(size_t count) noexcept { m_requestedWorkers = count; }
+
+        struct Statistics
+        {
+            size_t workers = 0;
+            uint64_t jobsExecuted = 0; // Run from the queues, by workers or by threads waiting on a handle
+            uint64_t jobsInline = 0;   // Run on the submitting thread (disabled or not started)
+            uint64_t busyNs = 0;       // Time spent in jobs, summed over workers
+            uint64_t uptimeNs = 0;     // Time since startup(); busyNs / (uptimeNs * workers) is utilization
+        };
+
+        // Safe to call from any thread, including while the system starts or shuts down
+        Statistics getStatistics() const noexcept;
+
     private:
         struct Worker
         {
@@ -140,14 +162,33 @@ namespace EngineCore::Foundation
         };
 
         std::vector<Worker> m_workers;
+        size_t m_requestedWorkers = 0;
         std::atomic<bool> m_running{false};
         std::condition_variable m_cv;
         std::mutex m_cvMutex;
 
+        // Kept outside Worker so getStatistics() never touches m_workers
+        std::atomic<size_t> m_activeWorkers{0};
+        std::atomic<uint64_t> m_jobsExecuted{0};
+        std::atomic<uint64_t> m_jobsInline{0};
+        std::atomic<uint64_t> m_busyNs{0};
+        std::atomic<int64_t> m_startedAtNs{0};
+
         void workerLoop(size_t index);
         bool stealJob(size_t thiefIndex, std::function<void()>& job);
     };
 
+    inline void JobHandle::wait() const noexcept
+    {
+        if (!counter)
+            return;
+        while (counter->load(std::memory_order_acquire) > 0)
+        {
+            if (!owner || !owner->runQueuedJob())
+                std::this_thread::yield();
+        }
+    }
+
     // Implementation of parallel_for (in header for templates)
     template<typename Fn>
     inline void JobSystem::parallel_for(size_t begin, size_t end, Fn&& fn, size_t grain)
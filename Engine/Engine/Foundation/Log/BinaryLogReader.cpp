@@ -0,0 +1,229 @@
+#include "BinaryLogReader.h"
+#include "BinaryLogSink.h"
+
+#include <ctime>
+#include <fstream>
+#include <iterator>
+#include <unordered_map>
+
+using namespace EngineCore::Foundation;
+
+namespace
+{
+const char* const kVerbosityNames[] = {"Verbose", "Debug", "Info", "Warning", "Error", "Fatal"};
+
+template <typename T> bool Read(std::string_view& data, T& value) noexcept
+{
+    if (data.size() < sizeof(T))
+        return false;
+    std::memcpy(&value, data.data(), sizeof(T));
+    data.remove_prefix(sizeof(T));
+    return true;
+}
+
+bool ReadBytes(std::string_view& data, size_t length, std::string_view& out) noexcept
+{
+    if (data.size() < length)
+        return false;
+    out = data.substr(0, length);
+    data.remove_prefix(length);
+    return true;
+}
+
+void AppendJsonString(std::string& out, std::string_view text)
+{
+    out += '"';
+    for (char c : text)
+    {
+        switch (c)
+        {
+        case '"':
+            out += "\\\"";
+            break;
+        case '\\':
+            out += "\\\\";
+            break;
+        case '\n':
+            out += "\\n";
+            break;
+        case '\r':
+            out += "\\r";
+            break;
+        case '\t':
+            out += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+                out += std::format("\\u{:04x}", static_cast<unsigned>(c));
+            else
+                out += c;
+        }
+    }
+    out += '"';
+}
+
+void AppendJsonValue(std::string& out, const LogArgValue& value)
+{
+    std::visit(
+        [&out](const auto& v) {
+            using T = std::decay_t<decltype(v)>;
+            if constexpr (std::is_same_v<T, bool>)
+                out += v ? "true" : "false";
+            else if constexpr (std::is_same_v<T, char>)
+                AppendJsonString(out, std::string_view(&v, 1));
+            else if constexpr (std::is_same_v<T, std::string>)
+                AppendJsonString(out, v);
+            else if constexpr (std::is_same_v<T, const void*>)
+                AppendJsonString(out, std::format("{}", v));
+            else
+                out += std::format("{}", v);
+        },
+        value);
+}
+} // namespace
+
+bool BinaryLogReader::ReadFile(const std::string& path, std::vector<BinaryLogEntry>& out, std::string* error)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        if (error)
+            *error = "cannot open " + path;
+        return false;
+    }
+    const std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return Parse(data, out, error);
+}
+
+bool BinaryLogReader::Parse(std::string_view data, std::vector<BinaryLogEntry>& out, std::string* error)
+{
+    auto fail = [error](const char* message) {
+        if (error)
+            *error = message;
+        return false;
+    };
+
+    if (data.size() < BinaryLog::kHeaderSize ||
+        data.substr(0, sizeof(BinaryLog::kMagic)) != std::string_view(BinaryLog::kMagic, sizeof(BinaryLog::kMagic)))
+        return fail("not a binary log segment");
+
+    uint32_t version = 0;
+    std::memcpy(&version, data.data() + sizeof(BinaryLog::kMagic), sizeof(version));
+    if (version != BinaryLog::kVersion)
+        return fail("unsupported binary log version");
+    data.remove_prefix(BinaryLog::kHeaderSize);
+
+    std::unordered_map<uint32_t, std::string> formats;
+    std::unordered_map<uint16_t, std::string> categories;
+
+    while (!data.empty())
+    {
+        uint8_t chunk = 0;
+        Read(data, chunk);
+
+        switch (static_cast<BinaryLog::Chunk>(chunk))
+        {
+        case BinaryLog::Chunk::End:
+            return true;
+        case BinaryLog::Chunk::Format:
+        {
+            uint32_t id     = 0;
+            uint16_t length = 0;
+            std::string_view text;
+            if (!Read(data, id) || !Read(data, length) || !ReadBytes(data, length, text))
+                return true;
+            formats[id] = std::string(text);
+            break;
+        }
+        case BinaryLog::Chunk::Category:
+        {
+            uint16_t id    = 0;
+            uint8_t length = 0;
+            std::string_view text;
+            if (!Read(data, id) || !Read(data, length) || !ReadBytes(data, length, text))
+                return true;
+            categories[id] = std::string(text);
+            break;
+        }
+        case BinaryLog::Chunk::Record:
+        {
+            uint8_t level       = 0;
+            uint16_t categoryId = 0;
+            uint16_t length     = 0;
+            BinaryLogEntry entry;
+            std::string_view payload;
+            if (!Read(data, level) || !Read(data, categoryId) || !Read(data, entry.threadId) ||
+                !Read(data, entry.timestampNs) || !Read(data, entry.formatId) || !Read(data, length) ||
+                !ReadBytes(data, length, payload))
+                return true;
+
+            entry.level = static_cast<LogVerbosity>(std::min<uint8_t>(level, static_cast<uint8_t>(LogVerbosity::Fatal)));
+            if (auto it = categories.find(categoryId); it != categories.end())
+                entry.category = it->second;
+
+            if (entry.formatId == 0)
+            {
+                entry.message = std::string(payload);
+            }
+            else
+            {
+                if (auto it = formats.find(entry.formatId); it != formats.end())
+                    entry.format = it->second;
+                if (!DecodeLogArgs(payload, entry.args))
+                    entry.args.clear();
+                entry.message = FormatLogArgs(entry.format, entry.args);
+            }
+            out.push_back(std::move(entry));
+            break;
+        }
+        default:
+            return fail("corrupt chunk in binary log segment");
+        }
+    }
+    return true;
+}
+
+std::string BinaryLogReader::ToText(const BinaryLogEntry& entry)
+{
+    const auto seconds = static_cast<std::time_t>(entry.timestampNs / 1'000'000'000ull);
+    const auto micros  = static_cast<unsigned>((entry.timestampNs / 1'000ull) % 1'000'000ull);
+    std::tm tm{};
+#ifdef _WIN32
+    localtime_s(&tm, &seconds);
+#else
+    localtime_r(&seconds, &tm);
+#endif
+    char time[32];
+    std::strftime(time, sizeof(time), "%Y-%m-%d %H:%M:%S", &tm);
+
+    return std::format("{}.{:06} [T{}] [{}] [{}] {}", time, micros, entry.threadId,
+                       kVerbosityNames[static_cast<int>(entry.level)], entry.category, entry.message);
+}
+
+std::string BinaryLogReader::ToJson(const BinaryLogEntry& entry)
+{
+    std::string out;
+    out.reserve(entry.message.size() + entry.category.size() + 96);
+    out += std::format("{{\"timestampNs\":{},\"thread\":{},\"level\":", entry.timestampNs, entry.threadId);
+    AppendJsonString(out, kVerbosityNames[static_cast<int>(entry.level)]);
+    out += ",\"category\":";
+    AppendJsonString(out, entry.category);
+    out += ",\"message\":";
+    AppendJsonString(out, entry.message);
+
+    if (entry.formatId != 0)
+    {
+        out += ",\"format\":";
+        AppendJsonString(out, entry.format);
+        out += ",\"args\":[";
+        for (size_t i = 0; i < entry.args.size(); ++i)
+        {
+            if (i > 0)
+                out += ',';
+            AppendJsonValue(out, entry.args[i]);
+        }
+        out += ']';
+    }
+    out += '}';
+    return out;
+}
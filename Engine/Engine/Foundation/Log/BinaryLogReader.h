@@ -0,0 +1,39 @@
+#pragma once
+#include "LogFormat.h"
+#include "LogVerbosity.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace EngineCore::Foundation
+{
+struct BinaryLogEntry
+{
+    uint64_t timestampNs = 0;
+    uint32_t threadId    = 0;
+    LogVerbosity level   = LogVerbosity::Info;
+    std::string category;
+    std::string message;            ///< Rendered text
+    uint32_t formatId = 0;          ///< 0 for plain text records
+    std::string format;             ///< Format string of structured records
+    std::vector<LogArgValue> args;  ///< Decoded arguments of structured records
+};
+
+/**
+ * @brief Decodes .ltlog segments written by BinaryLogSink
+ * A zero-filled or truncated tail (process killed mid-write) ends the segment without error.
+ */
+class BinaryLogReader
+{
+  public:
+    static bool ReadFile(const std::string& path, std::vector<BinaryLogEntry>& out, std::string* error = nullptr);
+    static bool Parse(std::string_view data, std::vector<BinaryLogEntry>& out, std::string* error = nullptr);
+
+    /// "2026-01-31 12:00:00.123456 [T3] [Info] [Category] message"
+    static std::string ToText(const BinaryLogEntry& entry);
+    /// One JSON object per entry (suitable for JSON Lines output).
+    static std::string ToJson(const BinaryLogEntry& entry);
+};
+} // namespace EngineCore::Foundation
@@ -0,0 +1,359 @@
+#include "BinaryLogSink.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using namespace EngineCore::Foundation;
+namespace fs = std::filesystem;
+
+namespace EngineCore::Foundation
+{
+/// Fixed-size read/write file mapping; the file is trimmed to the used length on close.
+class MappedLogFile
+{
+  public:
+    static std::unique_ptr<MappedLogFile> Create(const std::string& path, size_t size)
+    {
+        auto file = std::unique_ptr<MappedLogFile>(new MappedLogFile());
+        if (!file->open(path, size))
+            return nullptr;
+        return file;
+    }
+
+    ~MappedLogFile()
+    {
+        close(m_size);
+    }
+
+    char* data() const noexcept
+    {
+        return m_data;
+    }
+
+    size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    void flush() noexcept
+    {
+        if (!m_data)
+            return;
+#ifdef _WIN32
+        FlushViewOfFile(m_data, 0);
+#else
+        msync(m_data, m_size, MS_ASYNC);
+#endif
+    }
+
+    void close(size_t usedBytes) noexcept
+    {
+        if (!m_data)
+            return;
+#ifdef _WIN32
+        FlushViewOfFile(m_data, 0);
+        UnmapViewOfFile(m_data);
+        CloseHandle(m_mapping);
+        LARGE_INTEGER length;
+        length.QuadPart = static_cast<LONGLONG>(usedBytes);
+        SetFilePointerEx(m_handle, length, nullptr, FILE_BEGIN);
+        SetEndOfFile(m_handle);
+        CloseHandle(m_handle);
+        m_mapping = nullptr;
+        m_handle  = INVALID_HANDLE_VALUE;
+#else
+        munmap(m_data, m_size);
+        if (ftruncate(m_fd, static_cast<off_t>(usedBytes)) != 0)
+        {
+            // Keeping the zero-filled tail is harmless: readers stop at the End chunk.
+        }
+        ::close(m_fd);
+        m_fd = -1;
+#endif
+        m_data = nullptr;
+    }
+
+  private:
+    MappedLogFile() = default;
+
+    bool open(const std::string& path, size_t size)
+    {
+        m_size = size;
+#ifdef _WIN32
+        m_handle = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS,
+                               FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (m_handle == INVALID_HANDLE_VALUE)
+            return false;
+
+        const DWORD high = static_cast<DWORD>(static_cast<uint64_t>(size) >> 32);
+        const DWORD low  = static_cast<DWORD>(static_cast<uint64_t>(size) & 0xFFFFFFFFu);
+        m_mapping        = CreateFileMappingA(m_handle, nullptr, PAGE_READWRITE, high, low, nullptr);
+        if (!m_mapping)
+        {
+            CloseHandle(m_handle);
+            return false;
+        }
+        m_data = static_cast<char*>(MapViewOfFile(m_mapping, FILE_MAP_WRITE, 0, 0, size));
+        if (!m_data)
+        {
+            CloseHandle(m_mapping);
+            CloseHandle(m_handle);
+            return false;
+        }
+#else
+        m_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (m_fd < 0)
+            return false;
+        if (ftruncate(m_fd, static_cast<off_t>(size)) != 0)
+        {
+            ::close(m_fd);
+            return false;
+        }
+        void* mapped = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+        if (mapped == MAP_FAILED)
+        {
+            ::close(m_fd);
+            return false;
+        }
+        m_data = static_cast<char*>(mapped);
+#endif
+        return true;
+    }
+
+    char* m_data  = nullptr;
+    size_t m_size = 0;
+#ifdef _WIN32
+    HANDLE m_handle  = INVALID_HANDLE_VALUE;
+    HANDLE m_mapping = nullptr;
+#else
+    int m_fd = -1;
+#endif
+};
+} // namespace EngineCore::Foundation
+
+namespace
+{
+uint64_t NowNs() noexcept
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::system_clock::now().time_since_epoch())
+                                     .count());
+}
+
+/// Parses "<base>_<index>.ltlog"; returns false for unrelated files.
+bool ParseSegmentIndex(const std::string& fileName, const std::string& baseName, uint64_t& index)
+{
+    const std::string prefix = baseName + "_";
+    const std::string_view ext(BinaryLog::kExtension);
+    if (fileName.size() <= prefix.size() + ext.size() || fileName.compare(0, prefix.size(), prefix) != 0 ||
+        fileName.compare(fileName.size() - ext.size(), ext.size(), ext) != 0)
+        return false;
+
+    const std::string digits = fileName.substr(prefix.size(), fileName.size() - prefix.size() - ext.size());
+    if (!std::all_of(digits.begin(), digits.end(), [](char c) { return c >= '0' && c <= '9'; }))
+        return false;
+    index = std::stoull(digits);
+    return true;
+}
+
+std::vector<std::pair<uint64_t, fs::path>> ListSegments(const BinaryLogSinkConfig& config)
+{
+    std::vector<std::pair<uint64_t, fs::path>> segments;
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(config.directory, ec))
+    {
+        uint64_t index = 0;
+        if (entry.is_regular_file(ec) && ParseSegmentIndex(entry.path().filename().string(), config.baseName, index))
+            segments.emplace_back(index, entry.path());
+    }
+    std::sort(segments.begin(), segments.end());
+    return segments;
+}
+} // namespace
+
+BinaryLogSink::BinaryLogSink(BinaryLogSinkConfig config) : m_config(std::move(config))
+{
+    m_config.segmentBytes = std::max<size_t>(m_config.segmentBytes, 64 * 1024);
+    m_config.maxSegments  = std::max<uint32_t>(m_config.maxSegments, 1);
+
+    std::error_code ec;
+    fs::create_directories(m_config.directory, ec);
+
+    // Continue numbering after previous runs so their logs survive until rotated out.
+    const auto existing = ListSegments(m_config);
+    m_segmentIndex      = existing.empty() ? 0 : existing.back().first + 1;
+    openSegment();
+}
+
+BinaryLogSink::~BinaryLogSink()
+{
+    closeSegment();
+}
+
+bool BinaryLogSink::isOpen() const noexcept
+{
+    return m_file != nullptr;
+}
+
+void BinaryLogSink::write(LogVerbosity level, const std::string& category, const std::string& message)
+{
+    LogRecord record;
+    record.assign(level, category, message, NowNs(), CurrentLogThreadId());
+    write(record);
+}
+
+void BinaryLogSink::write(const LogRecord& record)
+{
+    if (!m_file)
+        return;
+
+    const std::string_view format =
+        record.isStructured() ? LogFormatRegistry::Instance().lookup(record.formatId) : std::string_view{};
+    const size_t recordBytes = BinaryLog::kRecordHeader + record.messageLength;
+
+    // Keep one byte for the End marker so readers never run past the mapping.
+    if (m_offset + definitionBytes(record, format) + recordBytes + 1 > m_file->size())
+    {
+        closeSegment();
+        ++m_segmentIndex;
+        if (!openSegment() || m_offset + definitionBytes(record, format) + recordBytes + 1 > m_file->size())
+            return;
+    }
+
+    const uint16_t categoryId = writeDefinitions(record, format);
+
+    const auto chunk       = static_cast<uint8_t>(BinaryLog::Chunk::Record);
+    const auto level       = static_cast<uint8_t>(record.level);
+    const uint16_t length  = record.messageLength;
+    append(&chunk, 1);
+    append(&level, 1);
+    append(&categoryId, sizeof(categoryId));
+    append(&record.threadId, sizeof(record.threadId));
+    append(&record.timestampNs, sizeof(record.timestampNs));
+    append(&record.formatId, sizeof(record.formatId));
+    append(&length, sizeof(length));
+    append(record.message, length);
+}
+
+void BinaryLogSink::flush()
+{
+    if (m_file)
+        m_file->flush();
+}
+
+size_t BinaryLogSink::definitionBytes(const LogRecord& record, std::string_view format) const
+{
+    size_t bytes = 0;
+    if (!m_categoryIds.contains(record.categoryView()))
+        bytes += 1 + 2 + 1 + record.categoryLength;
+    if (record.isStructured() && (record.formatId >= m_formatWritten.size() || !m_formatWritten[record.formatId]))
+        bytes += 1 + 4 + 2 + std::min<size_t>(format.size(), 0xFFFF);
+    return bytes;
+}
+
+uint16_t BinaryLogSink::writeDefinitions(const LogRecord& record, std::string_view format)
+{
+    uint16_t categoryId = 0;
+    if (auto it = m_categoryIds.find(record.categoryView()); it != m_categoryIds.end())
+    {
+        categoryId = it->second;
+    }
+    else
+    {
+        categoryId            = static_cast<uint16_t>(m_categoryIds.size());
+        const auto chunk      = static_cast<uint8_t>(BinaryLog::Chunk::Category);
+        const uint8_t length  = record.categoryLength;
+        append(&chunk, 1);
+        append(&categoryId, sizeof(categoryId));
+        append(&length, 1);
+        append(record.category, length);
+        m_categoryIds.emplace(std::string(record.categoryView()), categoryId);
+    }
+
+    if (record.isStructured() && (record.formatId >= m_formatWritten.size() || !m_formatWritten[record.formatId]))
+    {
+        if (record.formatId >= m_formatWritten.size())
+            m_formatWritten.resize(record.formatId + 1, false);
+        m_formatWritten[record.formatId] = true;
+
+        const auto chunk      = static_cast<uint8_t>(BinaryLog::Chunk::Format);
+        const auto length     = static_cast<uint16_t>(std::min<size_t>(format.size(), 0xFFFF));
+        append(&chunk, 1);
+        append(&record.formatId, sizeof(record.formatId));
+        append(&length, sizeof(length));
+        append(format.data(), length);
+    }
+    return categoryId;
+}
+
+bool BinaryLogSink::openSegment()
+{
+    char name[32];
+    std::snprintf(name, sizeof(name), "_%06llu", static_cast<unsigned long long>(m_segmentIndex));
+    const fs::path path = fs::path(m_config.directory) / (m_config.baseName + name + BinaryLog::kExtension);
+
+    m_file = MappedLogFile::Create(path.string(), m_config.segmentBytes);
+    if (!m_file)
+        return false;
+
+    m_currentPath = path.string();
+    m_offset      = 0;
+    m_categoryIds.clear();
+    m_formatWritten.clear();
+
+    const uint32_t reserved = 0;
+    const uint64_t created  = NowNs();
+    append(BinaryLog::kMagic, sizeof(BinaryLog::kMagic));
+    append(&BinaryLog::kVersion, sizeof(BinaryLog::kVersion));
+    append(&reserved, sizeof(reserved));
+    append(&m_segmentIndex, sizeof(m_segmentIndex));
+    append(&created, sizeof(created));
+
+    pruneSegments();
+    return true;
+}
+
+void BinaryLogSink::closeSegment()
+{
+    if (!m_file)
+        return;
+
+    // Explicit End marker; the trimmed file no longer has a zero tail to stop readers.
+    const auto end = static_cast<uint8_t>(BinaryLog::Chunk::End);
+    append(&end, 1);
+    m_file->close(m_offset);
+    m_file.reset();
+}
+
+void BinaryLogSink::pruneSegments()
+{
+    auto segments = ListSegments(m_config);
+    if (segments.size() <= m_config.maxSegments)
+        return;
+
+    std::error_code ec;
+    const size_t excess = segments.size() - m_config.maxSegments;
+    for (size_t i = 0; i < excess; ++i)
+        fs::remove(segments[i].second, ec);
+}
+
+void BinaryLogSink::append(const void* data, size_t size) noexcept
+{
+    std::memcpy(m_file->data() + m_offset, data, size);
+    m_offset += size;
+}
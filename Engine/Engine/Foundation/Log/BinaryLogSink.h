@@ -0,0 +1,105 @@
+#pragma once
+#include "Logger.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace EngineCore::Foundation
+{
+/**
+ * @brief On-disk layout of .ltlog segments (little-endian, unaligned)
+ *
+ * Header: magic[8] "LTBLOG01", u32 version, u32 reserved, u64 segment index, u64 creation time (ns).
+ * Then chunks, each starting with a BinaryLogChunk byte:
+ *  - Format:   u32 id, u16 length, bytes     (emitted before the first record using the id)
+ *  - Category: u16 id, u8 length, bytes
+ *  - Record:   u8 level, u16 category id, u32 thread id, u64 timestamp (ns), u32 format id,
+ *              u16 payload length, payload   (format id 0: payload is text, else EncodeLogArgs bytes)
+ * A zero byte (End) terminates the segment; a crashed process leaves a zero-filled tail.
+ * Every segment carries its own definitions, so it can be decoded without its predecessors.
+ */
+namespace BinaryLog
+{
+constexpr char kMagic[8]        = {'L', 'T', 'B', 'L', 'O', 'G', '0', '1'};
+constexpr uint32_t kVersion     = 1;
+constexpr size_t kHeaderSize    = 32;
+constexpr size_t kRecordHeader  = 22;
+constexpr const char* kExtension = ".ltlog";
+
+enum class Chunk : uint8_t
+{
+    End      = 0,
+    Format   = 1,
+    Category = 2,
+    Record   = 3
+};
+} // namespace BinaryLog
+
+struct BinaryLogSinkConfig
+{
+    std::string directory = "Logs";
+    std::string baseName  = "lampy";
+    size_t segmentBytes   = 16 * 1024 * 1024; ///< Size of each memory-mapped segment
+    uint32_t maxSegments  = 8;                ///< Older segments are deleted on rotation
+};
+
+class MappedLogFile;
+
+/**
+ * @brief Writes log records to rotating memory-mapped .ltlog files
+ * Structured records (LT_LOGS*) are stored as format id + raw arguments, so no text is
+ * produced at runtime. Decode with the LampyLogDecoder tool or BinaryLogReader.
+ */
+class BinaryLogSink final : public ILogSink
+{
+  public:
+    explicit BinaryLogSink(BinaryLogSinkConfig config = {});
+    ~BinaryLogSink() override;
+
+    void write(LogVerbosity level, const std::string& category, const std::string& message) override;
+    void write(const LogRecord& record) override;
+    void flush() override;
+
+    bool acceptsStructured() const override
+    {
+        return true;
+    }
+
+    [[nodiscard]] bool isOpen() const noexcept;
+    [[nodiscard]] const std::string& currentPath() const noexcept
+    {
+        return m_currentPath;
+    }
+
+  private:
+    bool openSegment();
+    void closeSegment();
+    void pruneSegments();
+    void append(const void* data, size_t size) noexcept;
+    size_t definitionBytes(const LogRecord& record, std::string_view format) const;
+    uint16_t writeDefinitions(const LogRecord& record, std::string_view format);
+
+    BinaryLogSinkConfig m_config;
+    std::unique_ptr<MappedLogFile> m_file;
+    std::string m_currentPath;
+    size_t m_offset          = 0;
+    uint64_t m_segmentIndex  = 0;
+
+    struct NameHash
+    {
+        using is_transparent = void;
+        size_t operator()(std::string_view name) const noexcept
+        {
+            return std::hash<std::string_view>{}(name);
+        }
+    };
+
+    // Per-segment definition state (reset on rotation)
+    std::unordered_map<std::string, uint16_t, NameHash, std::equal_to<>> m_categoryIds;
+    std::vector<bool> m_formatWritten;
+};
+} // namespace EngineCore::Foundation
@@ -1,4 +1,5 @@
 #pragma once
 #include "LogVerbosity.h"
+#include "LogCategory.h"
 #include "Logger.h"
 #include "LoggerMacro.h"
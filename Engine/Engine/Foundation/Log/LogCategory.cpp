@@ -0,0 +1,140 @@
+#include "LogCategory.h"
+
+#include <algorithm>
+#include <cctype>
+
+using namespace EngineCore::Foundation;
+
+namespace
+{
+std::string_view Trim(std::string_view text) noexcept
+{
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front())))
+        text.remove_prefix(1);
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back())))
+        text.remove_suffix(1);
+    return text;
+}
+
+bool EqualsIgnoreCase(std::string_view a, std::string_view b) noexcept
+{
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char l, char r) {
+               return std::tolower(static_cast<unsigned char>(l)) == std::tolower(static_cast<unsigned char>(r));
+           });
+}
+} // namespace
+
+LogCategoryRegistry& LogCategoryRegistry::Instance()
+{
+    // Intentionally leaked: call sites cache category references and may log during static destruction.
+    static LogCategoryRegistry* instance = new LogCategoryRegistry();
+    return *instance;
+}
+
+LogCategory& LogCategoryRegistry::get(std::string_view name)
+{
+    std::scoped_lock lock(m_mutex);
+    auto it = m_categories.find(std::string(name));
+    if (it != m_categories.end())
+        return *it->second;
+
+    auto category = std::make_unique<LogCategory>(std::string(name), m_defaultLevel);
+    LogCategory& ref = *category;
+    m_categories.emplace(std::string(name), std::move(category));
+    return ref;
+}
+
+void LogCategoryRegistry::setLevel(std::string_view name, LogVerbosity level)
+{
+    LogCategory& category = get(name);
+    std::scoped_lock lock(m_mutex);
+    category.m_overridden = true;
+    category.m_level.store(level, std::memory_order_relaxed);
+}
+
+void LogCategoryRegistry::setDefaultLevel(LogVerbosity level)
+{
+    std::scoped_lock lock(m_mutex);
+    m_defaultLevel = level;
+    for (auto& [_, category] : m_categories)
+    {
+        if (!category->m_overridden)
+            category->m_level.store(level, std::memory_order_relaxed);
+    }
+}
+
+LogVerbosity LogCategoryRegistry::getDefaultLevel() const noexcept
+{
+    std::scoped_lock lock(m_mutex);
+    return m_defaultLevel;
+}
+
+bool LogCategoryRegistry::configure(std::string_view spec)
+{
+    bool ok = true;
+    while (!spec.empty())
+    {
+        const size_t comma     = spec.find(',');
+        std::string_view entry = Trim(spec.substr(0, comma));
+        spec = comma == std::string_view::npos ? std::string_view{} : spec.substr(comma + 1);
+
+        if (entry.empty())
+            continue;
+
+        const size_t eq = entry.find('=');
+        LogVerbosity level{};
+        if (eq == std::string_view::npos || !ParseVerbosity(Trim(entry.substr(eq + 1)), level))
+        {
+            ok = false;
+            continue;
+        }
+
+        const std::string_view name = Trim(entry.substr(0, eq));
+        if (name == "*")
+            setDefaultLevel(level);
+        else if (!name.empty())
+            setLevel(name, level);
+        else
+            ok = false;
+    }
+    return ok;
+}
+
+std::vector<std::pair<std::string, uint64_t>> LogCategoryRegistry::getSuppressedCounts() const
+{
+    std::vector<std::pair<std::string, uint64_t>> counts;
+    std::scoped_lock lock(m_mutex);
+    for (const auto& [name, category] : m_categories)
+    {
+        if (const uint64_t suppressed = category->getSuppressed())
+            counts.emplace_back(name, suppressed);
+    }
+    std::sort(counts.begin(), counts.end(), [](const auto& a, const auto& b) { return a.second > b.second; });
+    return counts;
+}
+
+uint64_t LogCategoryRegistry::getSuppressedTotal() const
+{
+    uint64_t total = 0;
+    std::scoped_lock lock(m_mutex);
+    for (const auto& [_, category] : m_categories)
+        total += category->getSuppressed();
+    return total;
+}
+
+bool LogCategoryRegistry::ParseVerbosity(std::string_view text, LogVerbosity& out) noexcept
+{
+    static constexpr std::pair<std::string_view, LogVerbosity> kNames[] = {
+        {"Verbose", LogVerbosity::Verbose}, {"Debug", LogVerbosity::Debug}, {"Info", LogVerbosity::Info},
+        {"Warning", LogVerbosity::Warning}, {"Error", LogVerbosity::Error}, {"Fatal", LogVerbosity::Fatal}};
+
+    for (const auto& [name, level] : kNames)
+    {
+        if (EqualsIgnoreCase(text, name))
+        {
+            out = level;
+            return true;
+        }
+    }
+    return false;
+}
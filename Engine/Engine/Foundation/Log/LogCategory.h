@@ -0,0 +1,90 @@
+#pragma once
+#include "LogVerbosity.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace EngineCore::Foundation
+{
+/**
+ * @brief Runtime verbosity threshold for one log category
+ * Instances live for the whole process, so call sites may cache references to them.
+ */
+class LogCategory
+{
+  public:
+    explicit LogCategory(std::string name, LogVerbosity level) : m_name(std::move(name)), m_level(level)
+    {
+    }
+
+    [[nodiscard]] bool isEnabled(LogVerbosity level) const noexcept
+    {
+        return level >= m_level.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] LogVerbosity getLevel() const noexcept
+    {
+        return m_level.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] const std::string& name() const noexcept
+    {
+        return m_name;
+    }
+
+    /// Records calls dropped by rate-limited or deduplicated call sites of this category.
+    void addSuppressed(uint64_t count) noexcept
+    {
+        m_suppressed.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t getSuppressed() const noexcept
+    {
+        return m_suppressed.load(std::memory_order_relaxed);
+    }
+
+  private:
+    friend class LogCategoryRegistry;
+
+    std::string m_name;
+    std::atomic<LogVerbosity> m_level;
+    std::atomic<uint64_t> m_suppressed{0};
+    bool m_overridden = false; ///< Level set explicitly; not affected by setDefaultLevel
+};
+
+class LogCategoryRegistry
+{
+  public:
+    static LogCategoryRegistry& Instance();
+
+    /// Returns the category, creating it at the default level on first use.
+    LogCategory& get(std::string_view name);
+
+    void setLevel(std::string_view name, LogVerbosity level);
+    void setDefaultLevel(LogVerbosity level);
+    [[nodiscard]] LogVerbosity getDefaultLevel() const noexcept;
+
+    /// Applies a spec such as "Renderer=Warning,ResourceManager=Error,*=Info".
+    /// Returns false if any entry could not be parsed (valid entries are still applied).
+    bool configure(std::string_view spec);
+
+    /// Categories with at least one suppressed call, and their totals.
+    [[nodiscard]] std::vector<std::pair<std::string, uint64_t>> getSuppressedCounts() const;
+    [[nodiscard]] uint64_t getSuppressedTotal() const;
+
+    [[nodiscard]] static bool ParseVerbosity(std::string_view text, LogVerbosity& out) noexcept;
+
+  private:
+    LogCategoryRegistry() = default;
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::string, std::unique_ptr<LogCategory>> m_categories;
+    LogVerbosity m_defaultLevel = LogVerbosity::Verbose;
+};
+} // namespace EngineCore::Foundation
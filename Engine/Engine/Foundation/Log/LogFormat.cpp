@@ -0,0 +1,203 @@
+#include "LogFormat.h"
+
+using namespace EngineCore::Foundation;
+
+namespace
+{
+template <typename T> bool Read(std::string_view& bytes, T& value) noexcept
+{
+    if (bytes.size() < sizeof(T))
+        return false;
+    std::memcpy(&value, bytes.data(), sizeof(T));
+    bytes.remove_prefix(sizeof(T));
+    return true;
+}
+
+std::string FormatOne(std::string_view spec, const LogArgValue& value)
+{
+    std::string pattern;
+    pattern.reserve(spec.size() + 3);
+    pattern += "{:";
+    pattern += spec;
+    pattern += '}';
+
+    return std::visit(
+        [&pattern](const auto& v) -> std::string {
+            try
+            {
+                return std::vformat(pattern, std::make_format_args(v));
+            }
+            catch (const std::format_error&)
+            {
+                return "{?}";
+            }
+        },
+        value);
+}
+} // namespace
+
+LogFormatRegistry& LogFormatRegistry::Instance()
+{
+    // Leaked for the same reason as LogCategoryRegistry: call sites cache ids in statics.
+    static LogFormatRegistry* instance = new LogFormatRegistry();
+    return *instance;
+}
+
+uint32_t LogFormatRegistry::intern(std::string_view format)
+{
+    std::scoped_lock lock(m_mutex);
+    if (auto it = m_ids.find(format); it != m_ids.end())
+        return it->second;
+
+    const std::string& stored = m_formats.emplace_back(format);
+    const auto id             = static_cast<uint32_t>(m_formats.size());
+    m_ids.emplace(std::string_view(stored), id);
+    return id;
+}
+
+std::string_view LogFormatRegistry::lookup(uint32_t id) const
+{
+    std::scoped_lock lock(m_mutex);
+    if (id == 0 || id > m_formats.size())
+        return {};
+    return m_formats[id - 1];
+}
+
+bool EngineCore::Foundation::DecodeLogArgs(std::string_view bytes, std::vector<LogArgValue>& out)
+{
+    out.clear();
+    uint8_t count = 0;
+    if (!Read(bytes, count))
+        return bytes.empty();
+
+    for (uint8_t i = 0; i < count; ++i)
+    {
+        uint8_t type = 0;
+        if (!Read(bytes, type))
+            return false;
+
+        switch (static_cast<LogArgType>(type))
+        {
+        case LogArgType::Bool:
+        {
+            uint8_t v = 0;
+            if (!Read(bytes, v))
+                return false;
+            out.emplace_back(v != 0);
+            break;
+        }
+        case LogArgType::Char:
+        {
+            char v = 0;
+            if (!Read(bytes, v))
+                return false;
+            out.emplace_back(v);
+            break;
+        }
+        case LogArgType::Int64:
+        {
+            int64_t v = 0;
+            if (!Read(bytes, v))
+                return false;
+            out.emplace_back(v);
+            break;
+        }
+        case LogArgType::UInt64:
+        {
+            uint64_t v = 0;
+            if (!Read(bytes, v))
+                return false;
+            out.emplace_back(v);
+            break;
+        }
+        case LogArgType::Double:
+        {
+            double v = 0.0;
+            if (!Read(bytes, v))
+                return false;
+            out.emplace_back(v);
+            break;
+        }
+        case LogArgType::String:
+        {
+            uint16_t length = 0;
+            if (!Read(bytes, length) || bytes.size() < length)
+                return false;
+            out.emplace_back(std::string(bytes.substr(0, length)));
+            bytes.remove_prefix(length);
+            break;
+        }
+        case LogArgType::Pointer:
+        {
+            uint64_t v = 0;
+            if (!Read(bytes, v))
+                return false;
+            out.emplace_back(reinterpret_cast<const void*>(static_cast<uintptr_t>(v)));
+            break;
+        }
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string EngineCore::Foundation::FormatLogArgs(std::string_view format, const std::vector<LogArgValue>& args)
+{
+    std::string result;
+    result.reserve(format.size() + args.size() * 8);
+
+    size_t nextArg = 0;
+    for (size_t i = 0; i < format.size(); ++i)
+    {
+        const char c = format[i];
+        if (c == '}' && i + 1 < format.size() && format[i + 1] == '}')
+        {
+            result += '}';
+            ++i;
+            continue;
+        }
+        if (c != '{')
+        {
+            result += c;
+            continue;
+        }
+        if (i + 1 < format.size() && format[i + 1] == '{')
+        {
+            result += '{';
+            ++i;
+            continue;
+        }
+
+        const size_t close = format.find('}', i + 1);
+        if (close == std::string_view::npos)
+        {
+            result.append(format.substr(i));
+            break;
+        }
+
+        const std::string_view field = format.substr(i + 1, close - i - 1);
+        const size_t colon           = field.find(':');
+        const std::string_view index = field.substr(0, colon);
+        const std::string_view spec  = colon == std::string_view::npos ? std::string_view{} : field.substr(colon + 1);
+
+        size_t argIndex = nextArg++;
+        if (!index.empty())
+        {
+            argIndex = 0;
+            for (char d : index)
+            {
+                if (d < '0' || d > '9')
+                {
+                    argIndex = args.size();
+                    break;
+                }
+                argIndex = argIndex * 10 + static_cast<size_t>(d - '0');
+            }
+        }
+
+        result += argIndex < args.size() ? FormatOne(spec, args[argIndex]) : "{?}";
+        i = close;
+    }
+    return result;
+}
@@ -0,0 +1,137 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <format>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace EngineCore::Foundation
+{
+/**
+ * @brief Interns the format strings of structured (LT_LOGS*) call sites
+ * Ids are process-local and start at 1; 0 means "plain text record". Sinks that persist
+ * structured records write the string next to its id the first time they see it.
+ */
+class LogFormatRegistry
+{
+  public:
+    static LogFormatRegistry& Instance();
+
+    uint32_t intern(std::string_view format);
+    /// Empty view for unknown ids. The returned view stays valid for the process lifetime.
+    [[nodiscard]] std::string_view lookup(uint32_t id) const;
+
+  private:
+    LogFormatRegistry() = default;
+
+    mutable std::mutex m_mutex;
+    std::deque<std::string> m_formats; ///< Index id - 1; deque keeps views stable
+    std::unordered_map<std::string_view, uint32_t> m_ids;
+};
+
+/// Wire type of one encoded log argument.
+enum class LogArgType : uint8_t
+{
+    Bool = 1,
+    Char,
+    Int64,
+    UInt64,
+    Double,
+    String,
+    Pointer
+};
+
+using LogArgValue = std::variant<bool, char, int64_t, uint64_t, double, std::string, const void*>;
+
+namespace LogArgEncoding
+{
+inline bool Put(char*& out, const char* end, const void* data, size_t size) noexcept
+{
+    if (static_cast<size_t>(end - out) < size)
+        return false;
+    std::memcpy(out, data, size);
+    out += size;
+    return true;
+}
+
+inline bool PutString(char*& out, const char* end, std::string_view text) noexcept
+{
+    const size_t room = static_cast<size_t>(end - out);
+    if (room < 3)
+        return false;
+    const uint16_t length = static_cast<uint16_t>(std::min<size_t>({text.size(), room - 3, 0xFFFFu}));
+    const auto type       = static_cast<uint8_t>(LogArgType::String);
+    Put(out, end, &type, 1);
+    Put(out, end, &length, sizeof(length));
+    return Put(out, end, text.data(), length);
+}
+
+template <typename T> bool PutValue(char*& out, const char* end, LogArgType type, T value) noexcept
+{
+    if (static_cast<size_t>(end - out) < 1 + sizeof(T))
+        return false;
+    const auto tag = static_cast<uint8_t>(type);
+    Put(out, end, &tag, 1);
+    return Put(out, end, &value, sizeof(T));
+}
+
+template <typename T> bool Encode(char*& out, const char* end, const T& arg)
+{
+    using U = std::remove_cvref_t<T>;
+    if constexpr (std::is_same_v<U, bool>)
+        return PutValue<uint8_t>(out, end, LogArgType::Bool, arg ? 1 : 0);
+    else if constexpr (std::is_same_v<U, char>)
+        return PutValue<char>(out, end, LogArgType::Char, arg);
+    else if constexpr (std::is_enum_v<U>)
+        return PutValue<int64_t>(out, end, LogArgType::Int64, static_cast<int64_t>(arg));
+    else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>)
+        return PutValue<int64_t>(out, end, LogArgType::Int64, static_cast<int64_t>(arg));
+    else if constexpr (std::is_integral_v<U>)
+        return PutValue<uint64_t>(out, end, LogArgType::UInt64, static_cast<uint64_t>(arg));
+    else if constexpr (std::is_floating_point_v<U>)
+        return PutValue<double>(out, end, LogArgType::Double, static_cast<double>(arg));
+    else if constexpr (std::is_convertible_v<const U&, std::string_view>)
+        return PutString(out, end, std::string_view(arg));
+    else if constexpr (std::is_pointer_v<U>)
+        return PutValue<uint64_t>(out, end, LogArgType::Pointer, reinterpret_cast<uint64_t>(arg));
+    else
+        // Types with a custom formatter are rendered here; their format spec is applied to the text.
+        return PutString(out, end, std::format("{}", arg));
+}
+} // namespace LogArgEncoding
+
+/**
+ * @brief Packs arguments as [count][type, payload]... without formatting them
+ * Arguments that do not fit are dropped (the count reflects what was written).
+ * @return Bytes written to @p out
+ */
+template <typename... Args> size_t EncodeLogArgs(char* out, size_t capacity, const Args&... args)
+{
+    if (capacity == 0)
+        return 0;
+
+    char* cursor     = out + 1;
+    const char* end  = out + capacity;
+    uint8_t count    = 0;
+    bool fits        = true;
+    ((fits = fits && LogArgEncoding::Encode(cursor, end, args), count += fits ? 1 : 0), ...);
+    out[0] = static_cast<char>(count);
+    return static_cast<size_t>(cursor - out);
+}
+
+/// Inverse of EncodeLogArgs. Returns false on malformed input.
+bool DecodeLogArgs(std::string_view bytes, std::vector<LogArgValue>& out);
+
+/**
+ * @brief Renders a std::format-style string with decoded arguments
+ * Supports "{}", "{N}", "{:spec}" and "{N:spec}"; missing or mismatched arguments render as "{?}".
+ */
+std::string FormatLogArgs(std::string_view format, const std::vector<LogArgValue>& args);
+} // namespace EngineCore::Foundation
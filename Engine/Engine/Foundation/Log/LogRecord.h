@@ -0,0 +1,85 @@
+#pragma once
+#include "LogVerbosity.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace EngineCore::Foundation
+{
+/// What a producer does when the async log ring has no free slot.
+enum class LogOverflowPolicy : uint8_t
+{
+    Drop,  ///< Discard the record silently (still counted in getDroppedCount()).
+    Block, ///< Spin until the writer thread frees a slot.
+    Count  ///< Discard the record and have the writer report the dropped total.
+};
+
+/**
+ * @brief Fixed-size log record stored inline in a ring slot
+ * Category and message are copied and truncated, so producers never allocate.
+ */
+struct LogRecord
+{
+    static constexpr size_t kMaxCategoryLength = 47;
+    static constexpr size_t kMaxMessageLength  = 927;
+
+    uint64_t timestampNs    = 0; ///< system_clock time since epoch
+    uint32_t threadId       = 0; ///< Logical engine thread index (see CurrentLogThreadId)
+    uint32_t formatId       = 0; ///< 0: message is text; otherwise LogFormatRegistry id and message holds encoded args
+    LogVerbosity level      = LogVerbosity::Info;
+    uint8_t categoryLength  = 0;
+    uint16_t messageLength  = 0;
+    char category[kMaxCategoryLength + 1];
+    char message[kMaxMessageLength + 1];
+
+    void assign(LogVerbosity lvl, std::string_view cat, std::string_view msg, uint64_t timeNs,
+                uint32_t thread) noexcept
+    {
+        level       = lvl;
+        timestampNs = timeNs;
+        threadId    = thread;
+        formatId    = 0;
+
+        categoryLength = static_cast<uint8_t>(std::min(cat.size(), kMaxCategoryLength));
+        std::memcpy(category, cat.data(), categoryLength);
+        category[categoryLength] = '\0';
+
+        messageLength = static_cast<uint16_t>(std::min(msg.size(), kMaxMessageLength));
+        std::memcpy(message, msg.data(), messageLength);
+        if (msg.size() > kMaxMessageLength)
+            std::memcpy(message + kMaxMessageLength - 3, "...", 3);
+        message[messageLength] = '\0';
+    }
+
+    /// Stores pre-encoded arguments (see EncodeLogArgs); @p args must fit in kMaxMessageLength.
+    void assignStructured(LogVerbosity lvl, std::string_view cat, uint32_t format, std::string_view args,
+                          uint64_t timeNs, uint32_t thread) noexcept
+    {
+        assign(lvl, cat, {}, timeNs, thread);
+        formatId      = format;
+        messageLength = static_cast<uint16_t>(std::min(args.size(), kMaxMessageLength));
+        std::memcpy(message, args.data(), messageLength);
+    }
+
+    bool isStructured() const noexcept
+    {
+        return formatId != 0;
+    }
+
+    std::string_view categoryView() const noexcept
+    {
+        return {category, categoryLength};
+    }
+
+    std::string_view messageView() const noexcept
+    {
+        return {message, messageLength};
+    }
+};
+
+/// Small sequential id of the calling thread, stable for its lifetime.
+uint32_t CurrentLogThreadId() noexcept;
+} // namespace EngineCore::Foundation
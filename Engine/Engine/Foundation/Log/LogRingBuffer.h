@@ -0,0 +1,113 @@
+#pragma once
+#include "LogRecord.h"
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+
+namespace EngineCore::Foundation
+{
+/**
+ * @brief Bounded lock-free queue of preallocated LogRecord slots
+ * Multi-producer / multi-consumer (per-slot sequence numbers), so the writer thread
+ * and a crash handler can both drain it safely. Records are filled and consumed in place.
+ */
+class LogRingBuffer
+{
+  public:
+    explicit LogRingBuffer(size_t capacity) :
+        m_capacity(std::bit_ceil(capacity < 2 ? size_t{2} : capacity)),
+        m_mask(m_capacity - 1),
+        m_cells(std::make_unique<Cell[]>(m_capacity))
+    {
+        for (size_t i = 0; i < m_capacity; ++i)
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    LogRingBuffer(const LogRingBuffer&)            = delete;
+    LogRingBuffer& operator=(const LogRingBuffer&) = delete;
+
+    /// Claims a slot and lets @p fill write the record. Returns false when full.
+    template <typename Fill> bool tryPush(Fill&& fill) noexcept
+    {
+        size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Cell& cell         = m_cells[pos & m_mask];
+            const size_t seq   = cell.sequence.load(std::memory_order_acquire);
+            const intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (dif == 0)
+            {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    fill(cell.record);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (dif < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Hands the oldest record to @p consume and releases its slot. Returns false when empty.
+    template <typename Consume> bool tryConsume(Consume&& consume)
+    {
+        size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Cell& cell         = m_cells[pos & m_mask];
+            const size_t seq   = cell.sequence.load(std::memory_order_acquire);
+            const intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (dif == 0)
+            {
+                if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    consume(static_cast<const LogRecord&>(cell.record));
+                    cell.sequence.store(pos + m_capacity, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (dif < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return m_dequeuePos.load(std::memory_order_acquire) >= m_enqueuePos.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] size_t capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+  private:
+    struct alignas(64) Cell
+    {
+        std::atomic<size_t> sequence{0};
+        LogRecord record;
+    };
+
+    const size_t m_capacity;
+    const size_t m_mask;
+    std::unique_ptr<Cell[]> m_cells;
+
+    alignas(64) std::atomic<size_t> m_enqueuePos{0};
+    alignas(64) std::atomic<size_t> m_dequeuePos{0};
+};
+} // namespace EngineCore::Foundation
@@ -0,0 +1,87 @@
+#include "LogThrottle.h"
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+
+using namespace EngineCore::Foundation;
+
+namespace
+{
+int64_t SteadyNowMs() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+} // namespace
+
+bool LogRateLimiter::tryAcquire(uint64_t& suppressed) noexcept
+{
+    const int64_t now = SteadyNowMs();
+    int64_t start     = m_windowStartMs.load(std::memory_order_relaxed);
+    if (start < 0 || now - start >= 1000)
+    {
+        if (m_windowStartMs.compare_exchange_strong(start, now, std::memory_order_relaxed))
+            m_used.store(0, std::memory_order_relaxed);
+    }
+
+    if (m_used.fetch_add(1, std::memory_order_relaxed) < m_perSecond)
+    {
+        suppressed = m_suppressed.exchange(0, std::memory_order_relaxed);
+        return true;
+    }
+
+    m_suppressed.fetch_add(1, std::memory_order_relaxed);
+    m_suppressedTotal.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+bool LogDeduplicator::shouldLog(std::string_view message, uint64_t& repeats) noexcept
+{
+    const uint64_t hash = std::hash<std::string_view>{}(message);
+    const int64_t now   = SteadyNowMs();
+
+    std::scoped_lock lock(m_mutex);
+    if (m_hasLast && hash == m_lastHash && now - m_lastEmitMs < m_repeatIntervalMs)
+    {
+        ++m_repeats;
+        m_suppressedTotal.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    repeats      = m_repeats;
+    m_repeats    = 0;
+    m_lastHash   = hash;
+    m_lastEmitMs = now;
+    m_hasLast    = true;
+    return true;
+}
+
+void EngineCore::Foundation::ReportSuppressedLogs(LogVerbosity level, std::string_view category,
+                                                  uint64_t count) noexcept
+{
+    char text[64];
+    const int len = std::snprintf(text, sizeof(text), "(%llu similar message(s) suppressed)",
+                                  static_cast<unsigned long long>(count));
+    LTLogger::Instance().submit(level, category, std::string_view(text, len > 0 ? len : 0));
+}
+
+void EngineCore::Foundation::SubmitDeduplicated(LogDeduplicator& dedup, LogCategory& site, LogVerbosity level,
+                                                std::string_view category, std::string_view message) noexcept
+{
+    uint64_t repeats = 0;
+    if (!dedup.shouldLog(message, repeats))
+    {
+        site.addSuppressed(1);
+        return;
+    }
+
+    if (repeats > 0)
+    {
+        char text[64];
+        const int len = std::snprintf(text, sizeof(text), "(previous message repeated %llu more time(s))",
+                                      static_cast<unsigned long long>(repeats));
+        LTLogger::Instance().submit(level, category, std::string_view(text, len > 0 ? len : 0));
+    }
+    LTLogger::Instance().submit(level, category, message);
+}
@@ -0,0 +1,108 @@
+#pragma once
+#include "LogCategory.h"
+#include "Logger.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+
+namespace EngineCore::Foundation
+{
+/**
+ * @brief Per-call-site budget of N records per second
+ * Lock-free; a race at a window boundary may let a few extra records through.
+ */
+class LogRateLimiter
+{
+  public:
+    explicit LogRateLimiter(uint32_t perSecond) noexcept : m_perSecond(perSecond)
+    {
+    }
+
+    /// True if the call may log. @p suppressed receives the calls skipped since the previous allowed one.
+    bool tryAcquire(uint64_t& suppressed) noexcept;
+
+    [[nodiscard]] uint64_t getSuppressedTotal() const noexcept
+    {
+        return m_suppressedTotal.load(std::memory_order_relaxed);
+    }
+
+  private:
+    const uint32_t m_perSecond;
+    std::atomic<int64_t> m_windowStartMs{-1}; ///< steady_clock ms; -1 before the first call
+    std::atomic<uint32_t> m_used{0};
+    std::atomic<uint64_t> m_suppressed{0};
+    std::atomic<uint64_t> m_suppressedTotal{0};
+};
+
+/**
+ * @brief Collapses identical consecutive messages from one call site
+ * A repeated message is re-emitted at most once per @p repeatIntervalMs so long floods stay visible.
+ */
+class LogDeduplicator
+{
+  public:
+    explicit LogDeduplicator(uint32_t repeatIntervalMs = 5000) noexcept : m_repeatIntervalMs(repeatIntervalMs)
+    {
+    }
+
+    /// True if @p message should be logged. @p repeats receives how often the previous message was collapsed.
+    bool shouldLog(std::string_view message, uint64_t& repeats) noexcept;
+
+    [[nodiscard]] uint64_t getSuppressedTotal() const noexcept
+    {
+        return m_suppressedTotal.load(std::memory_order_relaxed);
+    }
+
+  private:
+    const uint32_t m_repeatIntervalMs;
+    std::mutex m_mutex;
+    uint64_t m_lastHash   = 0;
+    int64_t m_lastEmitMs  = 0;
+    uint64_t m_repeats    = 0;
+    bool m_hasLast        = false;
+    std::atomic<uint64_t> m_suppressedTotal{0};
+};
+
+/// Emits "N similar message(s) suppressed" for a throttled call site.
+void ReportSuppressedLogs(LogVerbosity level, std::string_view category, uint64_t count) noexcept;
+
+/// Rate-limited submit used by LT_LOG*_LIMIT. Counts suppressed calls on @p site.
+template <typename Submit>
+void SubmitRateLimited(LogRateLimiter& limiter, LogCategory& site, LogVerbosity level, std::string_view category,
+                       Submit&& submit)
+{
+    uint64_t suppressed = 0;
+    if (!limiter.tryAcquire(suppressed))
+    {
+        site.addSuppressed(1);
+        return;
+    }
+    if (suppressed > 0)
+        ReportSuppressedLogs(level, category, suppressed);
+    submit();
+}
+
+/// Deduplicated submit used by LT_LOG*_DEDUP; the message is built before the comparison.
+void SubmitDeduplicated(LogDeduplicator& dedup, LogCategory& site, LogVerbosity level, std::string_view category,
+                        std::string_view message) noexcept;
+
+template <typename... Args>
+void SubmitDeduplicatedFormat(LogDeduplicator& dedup, LogCategory& site, LogVerbosity level,
+                              std::string_view category, std::format_string<Args...> fmt, Args&&... args) noexcept
+{
+    char buffer[LogRecord::kMaxMessageLength + 1];
+    size_t length = 0;
+    try
+    {
+        const auto result = std::format_to_n(buffer, sizeof(buffer), fmt, std::forward<Args>(args)...);
+        length = static_cast<size_t>(result.size) < sizeof(buffer) ? static_cast<size_t>(result.size) : sizeof(buffer);
+    }
+    catch (...)
+    {
+        return;
+    }
+    SubmitDeduplicated(dedup, site, level, category, std::string_view(buffer, length));
+}
+} // namespace EngineCore::Foundation
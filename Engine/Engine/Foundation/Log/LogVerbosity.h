@@ -1,6 +1,17 @@
 #pragma once 
 #include <cstdint>
 
+// Lowest verbosity compiled into the binary (0 = Verbose ... 5 = Fatal); set it with the
+// LAMPY_LOG_MIN_LEVEL CMake cache variable.
+// Gated LT_LOG* calls below this level produce no code and never evaluate their arguments.
+#ifndef LT_LOG_MIN_LEVEL
+#if defined(LT_RELEASE)
+#define LT_LOG_MIN_LEVEL 3
+#else
+#define LT_LOG_MIN_LEVEL 0
+#endif
+#endif
+
 namespace EngineCore::Foundation
 {
 	enum class LogVerbosity : uint8_t
@@ -12,4 +23,17 @@ namespace EngineCore::Foundation
 		Error,
 		Fatal
 	};
-}
\ No newline at end of file
+
+	static_assert(LT_LOG_MIN_LEVEL >= 0 && LT_LOG_MIN_LEVEL <= 5, "LT_LOG_MIN_LEVEL must be 0 (Verbose) ... 5 (Fatal)");
+
+	constexpr bool IsLogLevelCompiledIn(LogVerbosity level) noexcept
+	{
+#if LT_LOG_MIN_LEVEL > 0
+		return static_cast<int>(level) >= LT_LOG_MIN_LEVEL;
+#else
+		// Every level is compiled in; comparing an unsigned level against 0 would trip -Wtype-limits
+		(void)level;
+		return true;
+#endif
+	}
+}
@@ -1,9 +1,16 @@
 #include "Logger.h"
 #include <iostream>
+#include <algorithm>
+#include <bit>
 #include <chrono>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <exception>
 #include <iomanip>
 
 #ifdef _WIN32
+#include <io.h>
 #include <windows.h>
 #else
 #include <unistd.h>
@@ -11,20 +18,99 @@
 
 using namespace EngineCore::Foundation;
 
+namespace
+{
+// Set on the writer thread so sinks that log themselves never wait on their own queue.
+thread_local bool t_isLogWriter = false;
+
+uint64_t NowNs() noexcept
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::system_clock::now().time_since_epoch())
+                                     .count());
+}
+
+const char* const kVerbosityNames[] = {"Verbose", "Debug", "Info", "Warning", "Error", "Fatal"};
+
+#ifdef _WIN32
+constexpr int kStderr = 2;
+#else
+constexpr int kStderr = STDERR_FILENO;
+#endif
+
+// Async-signal-safe: write(2) only, retried on partial writes and EINTR.
+void WriteRaw(int fd, const char* data, size_t size) noexcept
+{
+    while (size > 0)
+    {
+#ifdef _WIN32
+        const int written = _write(fd, data, static_cast<unsigned>(size));
+#else
+        const ssize_t written = ::write(fd, data, size);
+#endif
+        if (written < 0 && errno == EINTR)
+            continue;
+        if (written <= 0)
+            return;
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+}
+
+// Appends into a fixed buffer without the C library, for the signal path.
+struct RawLine
+{
+    char data[LogRecord::kMaxCategoryLength + LogRecord::kMaxMessageLength + 64];
+    size_t size = 0;
+
+    void append(const char* text, size_t length) noexcept
+    {
+        for (size_t i = 0; i < length && size < sizeof(data); ++i)
+            data[size++] = text[i];
+    }
+    void append(const char* text) noexcept
+    {
+        while (*text && size < sizeof(data))
+            data[size++] = *text++;
+    }
+};
+} // namespace
+
+uint32_t EngineCore::Foundation::CurrentLogThreadId() noexcept
+{
+    static std::atomic<uint32_t> s_next{0};
+    thread_local const uint32_t id = s_next.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
 LTLogger& LTLogger::Instance()
 {
     static LTLogger instance;
-    if (instance.m_sinks.empty())
-        instance.m_sinks.push_back(std::make_shared<ConsoleSink>());
     return instance;
 }
 
+LTLogger::LTLogger()
+{
+    m_sinks.push_back(std::make_shared<ConsoleSink>());
+}
+
+LTLogger::~LTLogger()
+{
+    stopAsync();
+}
+
 void LTLogger::addSink(std::shared_ptr<ILogSink> sink)
 {
     std::scoped_lock lock(m_mutex);
     m_sinks.push_back(std::move(sink));
 }
 
+void LTLogger::removeSink(const std::shared_ptr<ILogSink>& sink)
+{
+    std::scoped_lock lock(m_mutex);
+    std::erase(m_sinks, sink);
+}
+
 void LTLogger::clearSinks()
 {
     std::scoped_lock lock(m_mutex);
@@ -33,9 +119,7 @@ void LTLogger::clearSinks()
 
 void LTLogger::log(LogVerbosity level, const std::string& category, const std::string& message)
 {
-    std::scoped_lock lock(m_mutex);
-    for (auto& sink : m_sinks)
-        sink->write(level, category, message);
+    submit(level, category, message);
 }
 
 void LTLogger::info(const std::string& cat, const std::string& msg)  { log(LogVerbosity::Info, cat, msg); }
@@ -43,19 +127,367 @@ void LTLogger::warn(const std::string& cat, const std::string& msg)  { log(LogVe
 void LTLogger::error(const std::string& cat, const std::string& msg) { log(LogVerbosity::Error, cat, msg); }
 void LTLogger::debug(const std::string& cat, const std::string& msg) { log(LogVerbosity::Debug, cat, msg); }
 
+void LTLogger::submit(LogVerbosity level, std::string_view category, std::string_view message) noexcept
+{
+    submitEncoded(level, category, 0, message);
+}
+
+void LTLogger::submitEncoded(LogVerbosity level, std::string_view category, uint32_t formatId,
+                             std::string_view payload) noexcept
+{
+    const uint64_t timeNs  = NowNs();
+    const uint32_t thread  = CurrentLogThreadId();
+    auto fill = [&](LogRecord& record) {
+        if (formatId == 0)
+            record.assign(level, category, payload, timeNs, thread);
+        else
+            record.assignStructured(level, category, formatId, payload, timeNs, thread);
+    };
+
+    auto writeNow = [&]() {
+        LogRecord record;
+        fill(record);
+        try
+        {
+            writeToSinks(record);
+        }
+        catch (...)
+        {
+        }
+    };
+
+    // Counted before the flag is read so stopAsync() can wait out producers that saw it set
+    // (both sides seq_cst: either stopAsync sees the count or the producer sees the flag clear).
+    m_producers.fetch_add(1, std::memory_order_seq_cst);
+    if (!m_asyncRunning.load(std::memory_order_seq_cst))
+    {
+        m_producers.fetch_sub(1, std::memory_order_release);
+        writeNow();
+        return;
+    }
+
+    bool pushed = m_ring->tryPush(fill);
+    if (!pushed && !t_isLogWriter && m_overflow.load(std::memory_order_relaxed) == LogOverflowPolicy::Block)
+    {
+        while (!pushed && m_asyncRunning.load(std::memory_order_acquire))
+        {
+            wakeWriter();
+            std::this_thread::yield();
+            pushed = m_ring->tryPush(fill);
+        }
+    }
+
+    if (!pushed && !m_asyncRunning.load(std::memory_order_acquire))
+    {
+        // stopAsync() ended the wait; the writer is draining, write this one directly
+        m_producers.fetch_sub(1, std::memory_order_release);
+        writeNow();
+        return;
+    }
+
+    if (!pushed)
+    {
+        m_producers.fetch_sub(1, std::memory_order_release);
+        m_droppedTotal.fetch_add(1, std::memory_order_relaxed);
+        if (m_overflow.load(std::memory_order_relaxed) == LogOverflowPolicy::Count)
+            m_droppedPending.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    m_submitted.fetch_add(1, std::memory_order_release);
+    m_producers.fetch_sub(1, std::memory_order_release);
+    wakeWriter();
+
+    if (level == LogVerbosity::Fatal && !t_isLogWriter)
+    {
+        try
+        {
+            flush();
+        }
+        catch (...)
+        {
+        }
+    }
+}
+
+void LTLogger::startAsync(const LoggerConfig& config)
+{
+    std::scoped_lock lifecycle(m_lifecycleMutex);
+    if (m_asyncRunning.load(std::memory_order_acquire))
+        return;
+
+    if (!m_ring || m_ring->capacity() != std::bit_ceil(std::max<size_t>(config.capacity, 2)))
+        m_ring = std::make_unique<LogRingBuffer>(config.capacity);
+    m_overflow.store(config.overflow, std::memory_order_relaxed);
+    m_submitted.store(0, std::memory_order_relaxed);
+    m_dispatched.store(0, std::memory_order_relaxed);
+    m_stopRequested.store(false, std::memory_order_relaxed);
+
+    m_writer = std::thread([this]() { writerLoop(); });
+    m_asyncRunning.store(true, std::memory_order_release);
+}
+
+void LTLogger::stopAsync()
+{
+    std::scoped_lock lifecycle(m_lifecycleMutex);
+    if (!m_asyncRunning.load(std::memory_order_acquire))
+        return;
+
+    // New records go through the synchronous path from here on. Producers that already saw the
+    // flag set finish their push first, so the final drain below picks up every queued record.
+    m_asyncRunning.store(false, std::memory_order_seq_cst);
+    while (m_producers.load(std::memory_order_acquire) != 0)
+        std::this_thread::yield();
+    {
+        std::scoped_lock lock(m_wakeMutex);
+        m_stopRequested.store(true, std::memory_order_release);
+    }
+    m_wakeCv.notify_one();
+
+    if (m_writer.joinable())
+        m_writer.join();
+
+    drain();
+    reportDropped();
+    flushSinks();
+}
+
+void LTLogger::flush()
+{
+    if (!m_asyncRunning.load(std::memory_order_acquire) || t_isLogWriter)
+    {
+        flushSinks();
+        return;
+    }
+
+    const uint64_t target = m_submitted.load(std::memory_order_acquire);
+    while (m_dispatched.load(std::memory_order_acquire) < target && m_asyncRunning.load(std::memory_order_acquire))
+    {
+        wakeWriter();
+        std::this_thread::yield();
+    }
+    flushSinks();
+}
+
+void LTLogger::flushOnCrash() noexcept
+{
+    // The writer may be the crashing thread or hold the sink mutex, so never wait on it indefinitely.
+    std::unique_lock lock(m_mutex, std::defer_lock);
+    for (int attempt = 0; attempt < 100 && !lock.try_lock(); ++attempt)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    if (!lock.owns_lock())
+        return;
+
+    try
+    {
+        if (m_ring)
+        {
+            while (m_ring->tryConsume([this](const LogRecord& record) { dispatch(record); }))
+            {
+                m_dispatched.fetch_add(1, std::memory_order_release);
+            }
+        }
+        for (auto& sink : m_sinks)
+            sink->flush();
+    }
+    catch (...)
+    {
+    }
+}
+
+void LTLogger::drainOnSignal(int fd) noexcept
+{
+    if (!m_ring)
+        return;
+
+    auto writeRecord = [fd](const LogRecord& record) noexcept {
+        RawLine line;
+        const auto level = static_cast<size_t>(record.level);
+        line.append("[");
+        line.append(level < std::size(kVerbosityNames) ? kVerbosityNames[level] : "?");
+        line.append("] [");
+        line.append(record.category, record.categoryLength);
+        line.append("] ");
+        // Structured records need the format registry and allocations to render
+        if (record.isStructured())
+            line.append("<structured record, not formatted after a fatal signal>");
+        else
+            line.append(record.message, record.messageLength);
+        line.append("\n");
+        WriteRaw(fd, line.data, line.size);
+    };
+    while (m_ring->tryConsume(writeRecord))
+        m_dispatched.fetch_add(1, std::memory_order_release);
+}
+
+void LTLogger::writeToSinks(const LogRecord& record)
+{
+    std::scoped_lock lock(m_mutex);
+    dispatch(record);
+}
+
+void LTLogger::dispatch(const LogRecord& record)
+{
+    // Structured records are rendered at most once, and only if some sink wants text.
+    const LogRecord* text = &record;
+    LogRecord rendered;
+    for (auto& sink : m_sinks)
+    {
+        try
+        {
+            if (record.isStructured() && !sink->acceptsStructured())
+            {
+                if (text == &record)
+                {
+                    std::vector<LogArgValue> args;
+                    DecodeLogArgs(record.messageView(), args);
+                    const std::string message =
+                        FormatLogArgs(LogFormatRegistry::Instance().lookup(record.formatId), args);
+                    rendered.assign(record.level, record.categoryView(), message, record.timestampNs,
+                                    record.threadId);
+                    text = &rendered;
+                }
+                sink->write(*text);
+            }
+            else
+            {
+                sink->write(record);
+            }
+        }
+        catch (...)
+        {
+        }
+    }
+}
+
+void LTLogger::flushSinks()
+{
+    std::scoped_lock lock(m_mutex);
+    for (auto& sink : m_sinks)
+        sink->flush();
+}
+
+void LTLogger::wakeWriter() noexcept
+{
+    if (m_writerSleeping.load(std::memory_order_acquire))
+        m_wakeCv.notify_one();
+}
+
+size_t LTLogger::drain()
+{
+    size_t count = 0;
+    std::scoped_lock lock(m_mutex);
+    while (m_ring->tryConsume([this](const LogRecord& record) { dispatch(record); }))
+    {
+        ++count;
+        m_dispatched.fetch_add(1, std::memory_order_release);
+    }
+    return count;
+}
+
+void LTLogger::reportDropped()
+{
+    const uint64_t dropped = m_droppedPending.exchange(0, std::memory_order_relaxed);
+    if (dropped == 0)
+        return;
+
+    char text[96];
+    const int len = std::snprintf(text, sizeof(text), "%llu log message(s) dropped: async queue full",
+                                  static_cast<unsigned long long>(dropped));
+    LogRecord record;
+    record.assign(LogVerbosity::Warning, "Logger", std::string_view(text, len > 0 ? len : 0), NowNs(),
+                  CurrentLogThreadId());
+    writeToSinks(record);
+}
+
+void LTLogger::writerLoop()
+{
+    t_isLogWriter = true;
+    while (true)
+    {
+        const size_t written = drain();
+        reportDropped();
+
+        if (written > 0)
+            continue;
+
+        flushSinks();
+
+        std::unique_lock lock(m_wakeMutex);
+        if (m_stopRequested.load(std::memory_order_acquire))
+            break;
+
+        m_writerSleeping.store(true, std::memory_order_release);
+        // Producers only notify while we sleep; the timeout covers a wake that races with this store.
+        m_wakeCv.wait_for(lock, std::chrono::milliseconds(5), [this]() {
+            return m_stopRequested.load(std::memory_order_acquire) || !m_ring->empty();
+        });
+        m_writerSleeping.store(false, std::memory_order_release);
+    }
+    t_isLogWriter = false;
+}
+
+namespace
+{
+std::terminate_handler g_previousTerminate = nullptr;
+
+void OnFatalSignal(int sig)
+{
+    // Sinks, formatting and locks are off limits in a signal handler; the queued records go
+    // straight to stderr instead.
+    static constexpr char kHeader[] = "Fatal signal, writing queued log records\n";
+    WriteRaw(kStderr, kHeader, sizeof(kHeader) - 1);
+    LTLogger::Instance().drainOnSignal(kStderr);
+    std::signal(sig, SIG_DFL);
+    std::raise(sig);
+}
+
+void OnTerminate()
+{
+    LTLogger::Instance().flushOnCrash();
+    if (g_previousTerminate)
+        g_previousTerminate();
+    std::abort();
+}
+} // namespace
+
+void EngineCore::Foundation::InstallLogCrashHandlers() noexcept
+{
+    static std::atomic<bool> s_installed{false};
+    if (s_installed.exchange(true))
+        return;
+
+    g_previousTerminate = std::set_terminate(OnTerminate);
+    for (int sig : {SIGSEGV, SIGABRT, SIGFPE, SIGILL})
+        std::signal(sig, OnFatalSignal);
+}
+
 void ConsoleSink::write(LogVerbosity level, const std::string& category, const std::string& message)
 {
-    static const char* names[] = {"Verbose", "Debug", "Info", "Warning", "Error", "Fatal"};
+    LogRecord record;
+    record.assign(level, category, message, NowNs(), CurrentLogThreadId());
+    write(record);
+}
 
-    auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-    std::tm tm{};
+void ConsoleSink::write(const LogRecord& record)
+{
+    const LogVerbosity level = record.level;
+
+    // localtime is comparatively expensive; records arrive in bursts within the same second.
+    const int64_t second = static_cast<int64_t>(record.timestampNs / 1'000'000'000ull);
+    if (second != m_cachedSecond)
+    {
+        m_cachedSecond  = second;
+        std::time_t now = static_cast<std::time_t>(second);
+        std::tm tm{};
 #ifdef _WIN32
-    localtime_s(&tm, &now);
+        localtime_s(&tm, &now);
 #else
-    localtime_r(&now, &tm);
+        localtime_r(&now, &tm);
 #endif
-    char timeBuf[32];
-    std::strftime(timeBuf, sizeof(timeBuf), "%H:%M:%S", &tm);
+        std::strftime(m_cachedTime, sizeof(m_cachedTime), "%H:%M:%S", &tm);
+    }
+    const char* timeBuf = m_cachedTime;
 
 #ifdef _WIN32
     HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
@@ -84,7 +516,8 @@ void ConsoleSink::write(LogVerbosity level, const std::string& category, const s
     }
 
     SetConsoleTextAttribute(hConsole, color);
-    std::cout << std::format("[{}] [{}] [{}] {}\n", timeBuf, names[(int) level], category, message);
+    std::cout << std::format("[{}] [{}] [{}] {}\n", timeBuf, kVerbosityNames[(int) level], record.categoryView(),
+                             record.messageView());
     SetConsoleTextAttribute(hConsole, 7); // reset
 #else
     const char* colorCode = "\033[0m"; // reset
@@ -110,6 +543,12 @@ void ConsoleSink::write(LogVerbosity level, const std::string& category, const s
         break; // Bold red
     }
 
-    std::cout << std::format("{}[{}] [{}] [{}] {}\033[0m\n", colorCode, timeBuf, names[(int) level], category, message);
+    std::cout << std::format("{}[{}] [{}] [{}] {}\033[0m\n", colorCode, timeBuf, kVerbosityNames[(int) level],
+                             record.categoryView(), record.messageView());
 #endif
 }
+
+void ConsoleSink::flush()
+{
+    std::cout.flush();
+}
@@ -1,11 +1,18 @@
 #pragma once
 #include "Foundation/Profiler/ProfileAllocator.h"
+#include "LogFormat.h"
+#include "LogRecord.h"
+#include "LogRingBuffer.h"
 #include "LogVerbosity.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <format>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 namespace EngineCore::Foundation
 {
@@ -14,12 +21,48 @@ class ILogSink
   public:
     virtual ~ILogSink()                                                                             = default;
     virtual void write(LogVerbosity level, const std::string& category, const std::string& message) = 0;
+
+    /// <summary>
+    /// Full record (timestamp, thread). Default forwards to the string overload.
+    /// </summary>
+    virtual void write(const LogRecord& record)
+    {
+        write(record.level, std::string(record.categoryView()), std::string(record.messageView()));
+    }
+
+    /// <summary>
+    /// Push buffered output to its destination (called on flush and on crash).
+    /// </summary>
+    virtual void flush()
+    {
+    }
+
+    /// <summary>
+    /// True if the sink stores structured records (LogRecord::isStructured) as-is.
+    /// Other sinks receive them already formatted to text on the writer thread.
+    /// </summary>
+    virtual bool acceptsStructured() const
+    {
+        return false;
+    }
 };
 
 class ConsoleSink final : public ILogSink
 {
   public:
     void write(LogVerbosity level, const std::string& category, const std::string& message) override;
+    void write(const LogRecord& record) override;
+    void flush() override;
+
+  private:
+    int64_t m_cachedSecond = -1;
+    char m_cachedTime[16]{};
+};
+
+struct LoggerConfig
+{
+    size_t capacity            = 4096; ///< Ring slots (rounded up to a power of two)
+    LogOverflowPolicy overflow = LogOverflowPolicy::Count;
 };
 
 class LTLogger
@@ -28,6 +71,7 @@ class LTLogger
     static LTLogger& Instance();
 
     void addSink(std::shared_ptr<ILogSink> sink);
+    void removeSink(const std::shared_ptr<ILogSink>& sink);
     void clearSinks();
 
     void log(LogVerbosity level, const std::string& category, const std::string& message);
@@ -36,10 +80,133 @@ class LTLogger
     void error(const std::string& cat, const std::string& msg);
     void debug(const std::string& cat, const std::string& msg);
 
+    /// <summary>
+    /// Non-allocating entry point used by log() and the LT_LOG* macros.
+    /// </summary>
+    void submit(LogVerbosity level, std::string_view category, std::string_view message) noexcept;
+
+    /// <summary>
+    /// Formats into a stack buffer (truncated to LogRecord::kMaxMessageLength) and submits.
+    /// </summary>
+    template <typename... Args>
+    void submitFormat(LogVerbosity level, std::string_view category, std::format_string<Args...> fmt,
+                      Args&&... args) noexcept
+    {
+        char buffer[LogRecord::kMaxMessageLength + 1];
+        size_t length = 0;
+        try
+        {
+            const auto result = std::format_to_n(buffer, sizeof(buffer), fmt, std::forward<Args>(args)...);
+            length = static_cast<size_t>(result.size) < sizeof(buffer) ? static_cast<size_t>(result.size)
+                                                                          : sizeof(buffer);
+        }
+        catch (...)
+        {
+            return;
+        }
+        submit(level, category, std::string_view(buffer, length));
+    }
+
+    /// <summary>
+    /// Copies the raw arguments into the record; formatting is deferred to the writer thread
+    /// (or skipped entirely by sinks that accept structured records). @p fmt is only type-checked.
+    /// </summary>
+    template <typename... Args>
+    void submitStructured(LogVerbosity level, std::string_view category, uint32_t formatId,
+                          std::format_string<Args...> fmt, Args&&... args) noexcept
+    {
+        (void)fmt;
+        char buffer[LogRecord::kMaxMessageLength];
+        size_t length = 0;
+        try
+        {
+            length = EncodeLogArgs(buffer, sizeof(buffer), args...);
+        }
+        catch (...)
+        {
+            return;
+        }
+        submitEncoded(level, category, formatId, std::string_view(buffer, length));
+    }
+
+    /// <summary>
+    /// Starts the background writer. Until then (and after stopAsync) log() writes synchronously.
+    /// </summary>
+    void startAsync(const LoggerConfig& config = {});
+    /// <summary>
+    /// Drains pending records and joins the writer thread.
+    /// </summary>
+    void stopAsync();
+    [[nodiscard]] bool isAsync() const noexcept
+    {
+        return m_asyncRunning.load(std::memory_order_acquire);
+    }
+
+    /// <summary>
+    /// Blocks until every record submitted before the call has reached the sinks.
+    /// </summary>
+    void flush();
+    /// <summary>
+    /// Best-effort drain from the current thread; used by crash handlers. Never blocks forever.
+    /// </summary>
+    void flushOnCrash() noexcept;
+    /// <summary>
+    /// Writes the queued records as "[Level] [Category] message" lines straight to @p fd with
+    /// write(2), bypassing sinks and locks; async-signal-safe, for fatal signal handlers.
+    /// Structured records are written without their arguments.
+    /// </summary>
+    void drainOnSignal(int fd) noexcept;
+
+    void setOverflowPolicy(LogOverflowPolicy policy) noexcept
+    {
+        m_overflow.store(policy, std::memory_order_relaxed);
+    }
+    [[nodiscard]] LogOverflowPolicy getOverflowPolicy() const noexcept
+    {
+        return m_overflow.load(std::memory_order_relaxed);
+    }
+    [[nodiscard]] uint64_t getDroppedCount() const noexcept
+    {
+        return m_droppedTotal.load(std::memory_order_relaxed);
+    }
+
   private:
-    LTLogger() = default;
+    LTLogger();
+    ~LTLogger();
+
+    void submitEncoded(LogVerbosity level, std::string_view category, uint32_t formatId,
+                       std::string_view payload) noexcept;
+    void writeToSinks(const LogRecord& record);
+    void dispatch(const LogRecord& record); ///< Caller holds m_mutex
+    void flushSinks();
+    void writerLoop();
+    size_t drain();
+    void reportDropped();
+    void wakeWriter() noexcept;
 
     std::vector<std::shared_ptr<ILogSink>, ProfileAllocator<std::shared_ptr<ILogSink>>> m_sinks;
-    std::mutex m_mutex;
+    std::mutex m_mutex; ///< Guards m_sinks and serializes sink writes
+
+    std::unique_ptr<LogRingBuffer> m_ring;
+    std::thread m_writer;
+    std::atomic<bool> m_asyncRunning{false};
+    std::atomic<uint32_t> m_producers{0}; ///< submitEncoded calls that may push to m_ring
+    std::atomic<bool> m_stopRequested{false};
+    std::atomic<bool> m_writerSleeping{false};
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wakeCv;
+    std::mutex m_lifecycleMutex;
+
+    std::atomic<LogOverflowPolicy> m_overflow{LogOverflowPolicy::Count};
+    std::atomic<uint64_t> m_submitted{0};
+    std::atomic<uint64_t> m_dispatched{0};
+    std::atomic<uint64_t> m_droppedTotal{0};
+    std::atomic<uint64_t> m_droppedPending{0};
 };
+
+/// <summary>
+/// Routes std::terminate through LTLogger::flushOnCrash and fatal signals through
+/// LTLogger::drainOnSignal to stderr before the process dies.
+/// </summary>
+void InstallLogCrashHandlers() noexcept;
 } // namespace EngineCore::Foundation
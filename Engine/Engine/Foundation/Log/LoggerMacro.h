@@ -1,5 +1,7 @@
 #pragma once
 #include "Logger.h"
+#include "LogCategory.h"
+#include "LogThrottle.h"
 #include "LogVerbosity.h"
 
 namespace EngineCore::Foundation
@@ -7,24 +9,127 @@ namespace EngineCore::Foundation
     inline LTLogger& GetLogger() noexcept { return LTLogger::Instance(); }
 } // namespace EngineCore::Foundation
 
-#define LT_LOG(level, category, message)                                          \
-    do {                                                                          \
-        ::EngineCore::Foundation::GetLogger().log((level), (category), (message));\
-    } while (0)
+// All macros below check the compile-time floor (LT_LOG_MIN_LEVEL) and the category's runtime
+// level before touching the message, so disabled calls never build strings.
+// The category must be the same at every execution of a call site: it is resolved once and cached.
 
+#define LT_LOG_CATEGORY_REF(category) ::EngineCore::Foundation::LogCategoryRegistry::Instance().get(category)
 
-#define LT_LOGI(category, message)                                          \
-    do {                                                                          \
-        ::EngineCore::Foundation::GetLogger().log(::EngineCore::Foundation::LogVerbosity::Info, (category), (message));\
+#define LT_LOG_GATED(level, category, ...)                                                                         \
+    do {                                                                                                           \
+        if constexpr (::EngineCore::Foundation::IsLogLevelCompiledIn(level)) {                                     \
+            static ::EngineCore::Foundation::LogCategory& lt_logCategory_ = LT_LOG_CATEGORY_REF(category);        \
+            if (lt_logCategory_.isEnabled(level)) {                                                                \
+                __VA_ARGS__;                                                                                       \
+            }                                                                                                      \
+        }                                                                                                          \
     } while (0)
 
-#define LT_LOGW(category, message)                                          \
+#define LT_LOG(level, category, message)                                          \
     do {                                                                          \
-        ::EngineCore::Foundation::GetLogger().log(::EngineCore::Foundation::LogVerbosity::Warning, (category), (message));\
+        static ::EngineCore::Foundation::LogCategory& lt_logCategory_ = LT_LOG_CATEGORY_REF(category); \
+        if (::EngineCore::Foundation::IsLogLevelCompiledIn(level) && lt_logCategory_.isEnabled(level)) \
+            ::EngineCore::Foundation::GetLogger().log((level), (category), (message));\
     } while (0)
 
-#define LT_LOGE(category, message)                                          \
-    do {                                                                          \
-        ::EngineCore::Foundation::GetLogger().log(::EngineCore::Foundation::LogVerbosity::Error, (category), (message));\
-    } while (0)
+#define LT_LOGV(category, message) \
+    LT_LOG_GATED(::EngineCore::Foundation::LogVerbosity::Verbose, category, \
+                 ::EngineCore::Foundation::GetLogger().log(::EngineCore::Foundation::LogVerbosity::Verbose, (category), (message)))
+
+#define LT_LOGD(category, message) \
+    LT_LOG_GATED(::EngineCore::Foundation::LogVerbosity::Debug, category, \
+                 ::EngineCore::Foundation::GetLogger().log(::EngineCore::Foundation::LogVerbosity::Debug, (category), (message)))
+
+#define LT_LOGI(category, message) \
+    LT_LOG_GATED(::EngineCore::Foundation::LogVerbosity::Info, category, \
+                 ::EngineCore::Foundation::GetLogger().log(::EngineCore::Foundation::LogVerbosity::Info, (category), (message)))
+
+#define LT_LOGW(category, message) \
+    LT_LOG_GATED(::EngineCore::Foundation::LogVerbosity::Warning, category, \
+                 ::EngineCore::Foundation::GetLogger().log(::EngineCore::Foundation::LogVerbosity::Warning, (category), (message)))
+
+#define LT_LOGE(category, message) \
+    LT_LOG_GATED(::EngineCore::Foundation::LogVerbosity::Error, category, \
+                 ::EngineCore::Foundation::GetLogger().log(::EngineCore::Foundation::LogVerbosity::Error, (category), (message)))
+
+// Lazy formatting: LT_LOGFI("Renderer", "Entity {} added", id) formats only if the call passes the gate,
+// directly into a stack buffer (no heap allocation).
+#define LT_LOGF(level, category, fmt, ...) \
+    LT_LOG_GATED(level, category, \
+                 ::EngineCore::Foundation::GetLogger().submitFormat((level), (category), fmt __VA_OPT__(,) __VA_ARGS__))
+
+#define LT_LOGFV(category, fmt, ...) LT_LOGF(::EngineCore::Foundation::LogVerbosity::Verbose, category, fmt __VA_OPT__(,) __VA_ARGS__)
+#define LT_LOGFD(category, fmt, ...) LT_LOGF(::EngineCore::Foundation::LogVerbosity::Debug, category, fmt __VA_OPT__(,) __VA_ARGS__)
+#define LT_LOGFI(category, fmt, ...) LT_LOGF(::EngineCore::Foundation::LogVerbosity::Info, category, fmt __VA_OPT__(,) __VA_ARGS__)
+#define LT_LOGFW(category, fmt, ...) LT_LOGF(::EngineCore::Foundation::LogVerbosity::Warning, category, fmt __VA_OPT__(,) __VA_ARGS__)
+#define LT_LOGFE(category, fmt, ...) LT_LOGF(::EngineCore::Foundation::LogVerbosity::Error, category, fmt __VA_OPT__(,) __VA_ARGS__)
+
+// Structured logging: like LT_LOGF*, but only the raw arguments are copied on the calling thread.
+// Text is produced later on the writer thread, and binary sinks store the arguments unformatted.
+#define LT_LOGS(level, category, fmt, ...)                                                                         \
+    LT_LOG_GATED(level, category,                                                                                  \
+                 static const uint32_t lt_logFormatId_ =                                                           \
+                     ::EngineCore::Foundation::LogFormatRegistry::Instance().intern(fmt);                          \
+                 ::EngineCore::Foundation::GetLogger().submitStructured((level), (category), lt_logFormatId_,     \
+                                                                        fmt __VA_OPT__(,) __VA_ARGS__))
+
+#define LT_LOGSV(category, fmt, ...) LT_LOGS(::EngineCore::Foundation::LogVerbosity::Verbose, category, fmt __VA_OPT__(,) __VA_ARGS__)
+#define LT_LOGSD(category, fmt, ...) LT_LOGS(::EngineCore::Foundation::LogVerbosity::Debug, category, fmt __VA_OPT__(,) __VA_ARGS__)
+#define LT_LOGSI(category, fmt, ...) LT_LOGS(::EngineCore::Foundation::LogVerbosity::Info, category, fmt __VA_OPT__(,) __VA_ARGS__)
+#define LT_LOGSW(category, fmt, ...) LT_LOGS(::EngineCore::Foundation::LogVerbosity::Warning, category, fmt __VA_OPT__(,) __VA_ARGS__)
+#define LT_LOGSE(category, fmt, ...) LT_LOGS(::EngineCore::Foundation::LogVerbosity::Error, category, fmt __VA_OPT__(,) __VA_ARGS__)
+
+// Hot-path throttling. Suppressed calls are counted on the category (LogCategoryRegistry::getSuppressedCounts)
+// and summarized in the next record that gets through.
+//  - *_LIMIT: at most perSecond records per second from this call site; the message is not built when limited.
+//    LT_LOGS*_LIMIT records structured arguments like LT_LOGS*.
+//  - *_DEDUP: identical consecutive messages from this call site collapse into "repeated N more time(s)".
+#define LT_LOG_LIMIT(level, category, perSecond, message)                                                         \
+    LT_LOG_GATED(level, category,                                                                                  \
+                 static ::EngineCore::Foundation::LogRateLimiter lt_logLimiter_(perSecond);                        \
+                 ::EngineCore::Foundation::SubmitRateLimited(lt_logLimiter_, lt_logCategory_, (level), (category), \
+                     [&]() { ::EngineCore::Foundation::GetLogger().log((level), (category), (message)); }))
+
+#define LT_LOGF_LIMIT(level, category, perSecond, fmt, ...)                                                       \
+    LT_LOG_GATED(level, category,                                                                                  \
+                 static ::EngineCore::Foundation::LogRateLimiter lt_logLimiter_(perSecond);                        \
+                 ::EngineCore::Foundation::SubmitRateLimited(lt_logLimiter_, lt_logCategory_, (level), (category), \
+                     [&]() { ::EngineCore::Foundation::GetLogger().submitFormat((level), (category),              \
+                                                                              fmt __VA_OPT__(,) __VA_ARGS__); }))
+
+#define LT_LOGS_LIMIT(level, category, perSecond, fmt, ...)                                                       \
+    LT_LOG_GATED(level, category,                                                                                  \
+                 static ::EngineCore::Foundation::LogRateLimiter lt_logLimiter_(perSecond);                        \
+                 static const uint32_t lt_logFormatId_ =                                                           \
+                     ::EngineCore::Foundation::LogFormatRegistry::Instance().intern(fmt);                          \
+                 ::EngineCore::Foundation::SubmitRateLimited(lt_logLimiter_, lt_logCategory_, (level), (category), \
+                     [&]() { ::EngineCore::Foundation::GetLogger().submitStructured((level), (category),          \
+                                 lt_logFormatId_, fmt __VA_OPT__(,) __VA_ARGS__); }))
+
+#define LT_LOG_DEDUP(level, category, message)                                                                     \
+    LT_LOG_GATED(level, category,                                                                                  \
+                 static ::EngineCore::Foundation::LogDeduplicator lt_logDedup_;                                    \
+                 ::EngineCore::Foundation::SubmitDeduplicated(lt_logDedup_, lt_logCategory_, (level), (category),  \
+                                                              (message)))
+
+#define LT_LOGF_DEDUP(level, category, fmt, ...)                                                                   \
+    LT_LOG_GATED(level, category,                                                                                  \
+                 static ::EngineCore::Foundation::LogDeduplicator lt_logDedup_;                                    \
+                 ::EngineCore::Foundation::SubmitDeduplicatedFormat(lt_logDedup_, lt_logCategory_, (level),        \
+                                                                    (category), fmt __VA_OPT__(,) __VA_ARGS__))
 
+#define LT_LOGI_LIMIT(category, perSecond, message) LT_LOG_LIMIT(::EngineCore::Foundation::LogVerbosity::Info, category, perSecond, message)
+#define LT_LOGW_LIMIT(category, perSecond, message) LT_LOG_LIMIT(::EngineCore::Foundation::LogVerbosity::Warning, category, perSecond, message)
+#define LT_LOGE_LIMIT(category, perSecond, message) LT_LOG_LIMIT(::EngineCore::Foundation::LogVerbosity::Error, category, perSecond, message)
+#define LT_LOGFI_LIMIT(category, perSecond, fmt, ...) LT_LOGF_LIMIT(::EngineCore::Foundation::LogVerbosity::Info, category, perSecond, fmt __VA_OPT__(,) __VA_ARGS__)
+#define LT_LOGFW_LIMIT(category, perSecond, fmt, ...) LT_LOGF_LIMIT(::EngineCore::Foundation::LogVerbosity::Warning, category, perSecond, fmt __VA_OPT__(,) __VA_ARGS__)
+#define LT_LOGFE_LIMIT(category, perSecond, fmt, ...) LT_LOGF_LIMIT(::EngineCore::Foundation::LogVerbosity::Error, category, perSecond, fmt __VA_OPT__(,) __VA_ARGS__)
+#define LT_LOGSI_LIMIT(category, perSecond, fmt, ...) LT_LOGS_LIMIT(::EngineCore::Foundation::LogVerbosity::Info, category, perSecond, fmt __VA_OPT__(,) __VA_ARGS__)
+#define LT_LOGSW_LIMIT(category, perSecond, fmt, ...) LT_LOGS_LIMIT(::EngineCore::Foundation::LogVerbosity::Warning, category, perSecond, fmt __VA_OPT__(,) __VA_ARGS__)
+#define LT_LOGSE_LIMIT(category, perSecond, fmt, ...) LT_LOGS_LIMIT(::EngineCore::Foundation::LogVerbosity::Error, category, perSecond, fmt __VA_OPT__(,) __VA_ARGS__)
+#define LT_LOGI_DEDUP(category, message) LT_LOG_DEDUP(::EngineCore::Foundation::LogVerbosity::Info, category, message)
+#define LT_LOGW_DEDUP(category, message) LT_LOG_DEDUP(::EngineCore::Foundation::LogVerbosity::Warning, category, message)
+#define LT_LOGE_DEDUP(category, message) LT_LOG_DEDUP(::EngineCore::Foundation::LogVerbosity::Error, category, message)
+#define LT_LOGFI_DEDUP(category, fmt, ...) LT_LOGF_DEDUP(::EngineCore::Foundation::LogVerbosity::Info, category, fmt __VA_OPT__(,) __VA_ARGS__)
+#define LT_LOGFW_DEDUP(category, fmt, ...) LT_LOGF_DEDUP(::EngineCore::Foundation::LogVerbosity::Warning, category, fmt __VA_OPT__(,) __VA_ARGS__)
+#define LT_LOGFE_DEDUP(category, fmt, ...) LT_LOGF_DEDUP(::EngineCore::Foundation::LogVerbosity::Error, category, fmt __VA_OPT__(,) __VA_ARGS__)
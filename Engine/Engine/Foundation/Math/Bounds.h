@@ -0,0 +1,108 @@
+#pragma once
+
+#include "Math.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace Math
+{
+    /// Axis-aligned box; empty while min > max.
+    struct AABB
+    {
+        Vec3 min = Vec3(std::numeric_limits<float>::max());
+        Vec3 max = Vec3(std::numeric_limits<float>::lowest());
+
+        AABB() = default;
+        AABB(const Vec3& lo, const Vec3& hi) : min(lo), max(hi) {}
+
+        static AABB FromCenterExtents(const Vec3& center, const Vec3& extents)
+        {
+            return AABB(center - extents, center + extents);
+        }
+
+        bool Empty() const { return min.x > max.x || min.y > max.y || min.z > max.z; }
+        Vec3 Center() const { return (min + max) * 0.5f; }
+        Vec3 Extents() const { return (max - min) * 0.5f; }
+
+        bool Intersects(const AABB& other) const
+        {
+            return min.x <= other.max.x && max.x >= other.min.x && min.y <= other.max.y && max.y >= other.min.y &&
+                   min.z <= other.max.z && max.z >= other.min.z;
+        }
+
+        bool Contains(const Vec3& point) const
+        {
+            return point.x >= min.x && point.x <= max.x && point.y >= min.y && point.y <= max.y &&
+                   point.z >= min.z && point.z <= max.z;
+        }
+
+        /// Box around this one after @p m (Arvo's method: the extents go through |m|).
+        AABB Transformed(const Mat4& m) const
+        {
+            const Vec3 center = Vec3(m * Vec4(Center(), 1.0f));
+            const Vec3 e = Extents();
+            const Vec3 extents = glm::abs(Vec3(m[0])) * e.x + glm::abs(Vec3(m[1])) * e.y + glm::abs(Vec3(m[2])) * e.z;
+            return FromCenterExtents(center, extents);
+        }
+    };
+
+    inline bool SphereIntersectsAABB(const Vec3& center, float radius, const AABB& box)
+    {
+        const Vec3 closest = glm::clamp(center, box.min, box.max);
+        const Vec3 d = closest - center;
+        return glm::dot(d, d) <= radius * radius;
+    }
+
+    /// Slab test. @p invDir is 1 / direction per axis (inf for 0). On a hit @p t is the entry
+    /// distance in units of direction, 0 when @p origin is inside.
+    inline bool RayIntersectsAABB(const Vec3& origin, const Vec3& invDir, const AABB& box, float maxT, float& t)
+    {
+        const Vec3 t0 = (box.min - origin) * invDir;
+        const Vec3 t1 = (box.max - origin) * invDir;
+        const Vec3 tNear = glm::min(t0, t1);
+        const Vec3 tFar = glm::max(t0, t1);
+        const float enter = std::max(std::max(tNear.x, tNear.y), std::max(tNear.z, 0.0f));
+        const float exit = std::min(std::min(tFar.x, tFar.y), std::min(tFar.z, maxT));
+        if (enter > exit)
+            return false;
+        t = enter;
+        return true;
+    }
+
+    /// <summary>
+    /// Six inward-facing planes (xyz normal, w distance) of a view-projection matrix, for
+    /// GLM_FORCE_DEPTH_ZERO_TO_ONE projections. Planes are not normalized; only signs are used.
+    /// </summary>
+    struct Frustum
+    {
+        Vec4 planes[6];
+
+        static Frustum FromMatrix(const Mat4& viewProjection)
+        {
+            const Mat4 m = glm::transpose(viewProjection);
+            Frustum f;
+            f.planes[0] = m[3] + m[0]; // left
+            f.planes[1] = m[3] - m[0]; // right
+            f.planes[2] = m[3] + m[1]; // bottom
+            f.planes[3] = m[3] - m[1]; // top
+            f.planes[4] = m[2];        // near, depth 0..1
+            f.planes[5] = m[3] - m[2]; // far
+            return f;
+        }
+
+        /// Conservative: boxes near the frustum corners may pass without touching it.
+        bool Intersects(const AABB& box) const
+        {
+            for (const Vec4& p : planes)
+            {
+                // Corner furthest along the plane normal
+                const Vec3 positive(p.x >= 0.0f ? box.max.x : box.min.x, p.y >= 0.0f ? box.max.y : box.min.y,
+                                    p.z >= 0.0f ? box.max.z : box.min.z);
+                if (glm::dot(Vec3(p), positive) + p.w < 0.0f)
+                    return false;
+            }
+            return true;
+        }
+    };
+}
@@ -35,11 +35,23 @@ namespace Math
     inline Vec3 Right  (const Quat& q) { return q * Vec3(1, 0, 0); }
     inline Vec3 Up     (const Quat& q) { return q * Vec3(0, 1, 0); }
 
+    // Same result as translate(pos) * toMat4(rot) * scale(scale) without the 4x4 products:
+    // the terms those add are all zero. Keep in sync with the batch kernels in TransformBatch.cpp.
     inline Mat4 TRS(const Vec3& pos, const Quat& rot, const Vec3& scale)
     {
-        return glm::translate(Mat4(1.0f), pos)
-             * glm::toMat4(rot)
-             * glm::scale(Mat4(1.0f), scale);
+        const float qxx = rot.x * rot.x, qyy = rot.y * rot.y, qzz = rot.z * rot.z;
+        const float qxz = rot.x * rot.z, qxy = rot.x * rot.y, qyz = rot.y * rot.z;
+        const float qwx = rot.w * rot.x, qwy = rot.w * rot.y, qwz = rot.w * rot.z;
+
+        Mat4 m;
+        m[0] = Vec4((1.0f - 2.0f * (qyy + qzz)) * scale.x, (2.0f * (qxy + qwz)) * scale.x,
+                    (2.0f * (qxz - qwy)) * scale.x, 0.0f);
+        m[1] = Vec4((2.0f * (qxy - qwz)) * scale.y, (1.0f - 2.0f * (qxx + qzz)) * scale.y,
+                    (2.0f * (qyz + qwx)) * scale.y, 0.0f);
+        m[2] = Vec4((2.0f * (qxz + qwy)) * scale.z, (2.0f * (qyz - qwx)) * scale.z,
+                    (1.0f - 2.0f * (qxx + qyy)) * scale.z, 0.0f);
+        m[3] = Vec4(pos, 1.0f);
+        return m;
     }
 
     inline Quat EulerToQuat(const Vec3& eulerDegrees)
@@ -71,4 +83,18 @@ namespace Math
     {
         return glm::slerp(a, b, Clamp01(t));
     }
+
+    // Blends two affine transforms through translation, rotation and scale, so a turning object
+    // keeps its size halfway. Shear is lost; mirrored matrices are only blended correctly when
+    // both ends are mirrored the same way.
+    inline Mat4 InterpolateTransform(const Mat4& a, const Mat4& b, float t)
+    {
+        const Vec3 scaleA(glm::length(Vec3(a[0])), glm::length(Vec3(a[1])), glm::length(Vec3(a[2])));
+        const Vec3 scaleB(glm::length(Vec3(b[0])), glm::length(Vec3(b[1])), glm::length(Vec3(b[2])));
+        const Vec3 divA = glm::max(scaleA, Vec3(1e-12f)); // zero scale keeps a valid rotation
+        const Vec3 divB = glm::max(scaleB, Vec3(1e-12f));
+        const Quat rotA = glm::quat_cast(Mat3(Vec3(a[0]) / divA.x, Vec3(a[1]) / divA.y, Vec3(a[2]) / divA.z));
+        const Quat rotB = glm::quat_cast(Mat3(Vec3(b[0]) / divB.x, Vec3(b[1]) / divB.y, Vec3(b[2]) / divB.z));
+        return TRS(Lerp(Vec3(a[3]), Vec3(b[3]), t), glm::normalize(Slerp(rotA, rotB, t)), Lerp(scaleA, scaleB, t));
+    }
 }
\ No newline at end of file
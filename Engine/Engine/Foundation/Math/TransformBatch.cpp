@@ -0,0 +1,238 @@
+#include "TransformBatch.h"
+
+#include "../JobSystem/JobSystem.h"
+
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define LT_TRS_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define LT_TARGET_AVX2
+#else
+#define LT_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#else
+#define LT_TRS_X86 0
+#endif
+
+namespace Math
+{
+namespace
+{
+// All kernels evaluate the expressions of Math::TRS in the same order and without FMA, which
+// is what keeps them bit-identical to it. AVX2 code is compiled with target("avx2") only.
+
+void ComposeScalar(const TRSView& t, size_t begin, size_t end, Mat4* out) noexcept
+{
+    for (size_t i = begin; i < end; ++i)
+    {
+        const size_t p = i * t.positionStride;
+        const size_t q = i * t.rotationStride;
+        const size_t s = i * t.scaleStride;
+        out[i] = TRS(Vec3(t.px[p], t.py[p], t.pz[p]), Quat(t.qw[q], t.qx[q], t.qy[q], t.qz[q]),
+                     Vec3(t.sx[s], t.sy[s], t.sz[s]));
+    }
+}
+
+#if LT_TRS_X86
+inline __m128 Load4(const float* base, size_t stride, size_t i) noexcept
+{
+    const float* p = base + i * stride;
+    if (stride == 1)
+        return _mm_loadu_ps(p);
+    return _mm_setr_ps(p[0], p[stride], p[2 * stride], p[3 * stride]);
+}
+
+/// Column @p column of four consecutive matrices, given as one register per row.
+inline void StoreColumn4(Mat4* out, int column, __m128 x, __m128 y, __m128 z, __m128 w) noexcept
+{
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+    _mm_storeu_ps(&out[0][column][0], x);
+    _mm_storeu_ps(&out[1][column][0], y);
+    _mm_storeu_ps(&out[2][column][0], z);
+    _mm_storeu_ps(&out[3][column][0], w);
+}
+
+size_t ComposeSse2(const TRSView& t, size_t begin, size_t end, Mat4* out) noexcept
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 two = _mm_set1_ps(2.0f);
+    const __m128 zero = _mm_setzero_ps();
+
+    size_t i = begin;
+    for (; i + 4 <= end; i += 4)
+    {
+        const __m128 qx = Load4(t.qx, t.rotationStride, i);
+        const __m128 qy = Load4(t.qy, t.rotationStride, i);
+        const __m128 qz = Load4(t.qz, t.rotationStride, i);
+        const __m128 qw = Load4(t.qw, t.rotationStride, i);
+
+        const __m128 qxx = _mm_mul_ps(qx, qx), qyy = _mm_mul_ps(qy, qy), qzz = _mm_mul_ps(qz, qz);
+        const __m128 qxz = _mm_mul_ps(qx, qz), qxy = _mm_mul_ps(qx, qy), qyz = _mm_mul_ps(qy, qz);
+        const __m128 qwx = _mm_mul_ps(qw, qx), qwy = _mm_mul_ps(qw, qy), qwz = _mm_mul_ps(qw, qz);
+
+        const __m128 sx = Load4(t.sx, t.scaleStride, i);
+        const __m128 sy = Load4(t.sy, t.scaleStride, i);
+        const __m128 sz = Load4(t.sz, t.scaleStride, i);
+
+        StoreColumn4(out + i, 0, _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(qyy, qzz))), sx),
+                     _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(qxy, qwz)), sx),
+                     _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(qxz, qwy)), sx), zero);
+        StoreColumn4(out + i, 1, _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(qxy, qwz)), sy),
+                     _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(qxx, qzz))), sy),
+                     _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(qyz, qwx)), sy), zero);
+        StoreColumn4(out + i, 2, _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(qxz, qwy)), sz),
+                     _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(qyz, qwx)), sz),
+                     _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(qxx, qyy))), sz), zero);
+        StoreColumn4(out + i, 3, Load4(t.px, t.positionStride, i), Load4(t.py, t.positionStride, i),
+                     Load4(t.pz, t.positionStride, i), one);
+    }
+    return i;
+}
+
+LT_TARGET_AVX2 inline __m256 Load8(const float* base, size_t stride, size_t i) noexcept
+{
+    const float* p = base + i * stride;
+    if (stride == 1)
+        return _mm256_loadu_ps(p);
+    return _mm256_setr_ps(p[0], p[stride], p[2 * stride], p[3 * stride], p[4 * stride], p[5 * stride],
+                          p[6 * stride], p[7 * stride]);
+}
+
+LT_TARGET_AVX2 inline void StoreColumn8(Mat4* out, int column, __m256 x, __m256 y, __m256 z, __m256 w) noexcept
+{
+    // In-lane 4x4 transposes: the low half holds matrices 0-3, the high half 4-7
+    const __m256 xy0 = _mm256_unpacklo_ps(x, y);
+    const __m256 xy1 = _mm256_unpackhi_ps(x, y);
+    const __m256 zw0 = _mm256_unpacklo_ps(z, w);
+    const __m256 zw1 = _mm256_unpackhi_ps(z, w);
+    const __m256 c0 = _mm256_shuffle_ps(xy0, zw0, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 c1 = _mm256_shuffle_ps(xy0, zw0, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 c2 = _mm256_shuffle_ps(xy1, zw1, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 c3 = _mm256_shuffle_ps(xy1, zw1, _MM_SHUFFLE(3, 2, 3, 2));
+    _mm_storeu_ps(&out[0][column][0], _mm256_castps256_ps128(c0));
+    _mm_storeu_ps(&out[1][column][0], _mm256_castps256_ps128(c1));
+    _mm_storeu_ps(&out[2][column][0], _mm256_castps256_ps128(c2));
+    _mm_storeu_ps(&out[3][column][0], _mm256_castps256_ps128(c3));
+    _mm_storeu_ps(&out[4][column][0], _mm256_extractf128_ps(c0, 1));
+    _mm_storeu_ps(&out[5][column][0], _mm256_extractf128_ps(c1, 1));
+    _mm_storeu_ps(&out[6][column][0], _mm256_extractf128_ps(c2, 1));
+    _mm_storeu_ps(&out[7][column][0], _mm256_extractf128_ps(c3, 1));
+}
+
+LT_TARGET_AVX2 size_t ComposeAvx2(const TRSView& t, size_t begin, size_t end, Mat4* out) noexcept
+{
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 two = _mm256_set1_ps(2.0f);
+    const __m256 zero = _mm256_setzero_ps();
+
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8)
+    {
+        const __m256 qx = Load8(t.qx, t.rotationStride, i);
+        const __m256 qy = Load8(t.qy, t.rotationStride, i);
+        const __m256 qz = Load8(t.qz, t.rotationStride, i);
+        const __m256 qw = Load8(t.qw, t.rotationStride, i);
+
+        const __m256 qxx = _mm256_mul_ps(qx, qx), qyy = _mm256_mul_ps(qy, qy), qzz = _mm256_mul_ps(qz, qz);
+        const __m256 qxz = _mm256_mul_ps(qx, qz), qxy = _mm256_mul_ps(qx, qy), qyz = _mm256_mul_ps(qy, qz);
+        const __m256 qwx = _mm256_mul_ps(qw, qx), qwy = _mm256_mul_ps(qw, qy), qwz = _mm256_mul_ps(qw, qz);
+
+        const __m256 sx = Load8(t.sx, t.scaleStride, i);
+        const __m256 sy = Load8(t.sy, t.scaleStride, i);
+        const __m256 sz = Load8(t.sz, t.scaleStride, i);
+
+        StoreColumn8(out + i, 0, _mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(qyy, qzz))), sx),
+                     _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(qxy, qwz)), sx),
+                     _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(qxz, qwy)), sx), zero);
+        StoreColumn8(out + i, 1, _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(qxy, qwz)), sy),
+                     _mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(qxx, qzz))), sy),
+                     _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(qyz, qwx)), sy), zero);
+        StoreColumn8(out + i, 2, _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(qxz, qwy)), sz),
+                     _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(qyz, qwx)), sz),
+                     _mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(qxx, qyy))), sz), zero);
+        StoreColumn8(out + i, 3, Load8(t.px, t.positionStride, i), Load8(t.py, t.positionStride, i),
+                     Load8(t.pz, t.positionStride, i), one);
+    }
+    // Leave AVX state clean before the SSE and scalar tails
+    _mm256_zeroupper();
+    return i;
+}
+#endif
+
+SimdLevel DetectSimdLevel() noexcept
+{
+#if LT_TRS_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return SimdLevel::Sse2;
+    __cpuidex(info, 1, 0);
+    const bool osAvx = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 0x6) == 0x6;
+    __cpuidex(info, 7, 0);
+    return osAvx && (info[1] & (1 << 5)) ? SimdLevel::Avx2 : SimdLevel::Sse2;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") ? SimdLevel::Avx2 : SimdLevel::Sse2;
+#endif
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+} // namespace
+
+SimdLevel ActiveSimdLevel() noexcept
+{
+    static const SimdLevel level = DetectSimdLevel();
+    return level;
+}
+
+const char* ToString(SimdLevel level) noexcept
+{
+    switch (level)
+    {
+    case SimdLevel::Scalar:
+        return "scalar";
+    case SimdLevel::Sse2:
+        return "sse2";
+    case SimdLevel::Avx2:
+        return "avx2";
+    }
+    return "unknown";
+}
+
+void ComposeTRS(const TRSView& trs, size_t begin, size_t end, Mat4* out, SimdLevel level) noexcept
+{
+    level = std::min(level, ActiveSimdLevel());
+    size_t i = begin;
+#if LT_TRS_X86
+    if (level >= SimdLevel::Avx2)
+        i = ComposeAvx2(trs, i, end, out);
+    if (level >= SimdLevel::Sse2)
+        i = ComposeSse2(trs, i, end, out);
+#endif
+    ComposeScalar(trs, i, end, out);
+}
+
+void ComposeTRSParallel(EngineCore::Foundation::JobSystem* jobs, const TRSView& trs, size_t count, Mat4* out,
+                        size_t grain)
+{
+    // Whole AVX2 steps per range
+    grain = std::max<size_t>((grain + 7) & ~size_t(7), 8);
+    if (!jobs || jobs->getWorkerCount() == 0 || count <= grain)
+    {
+        ComposeTRS(trs, 0, count, out);
+        return;
+    }
+
+    const SimdLevel level = ActiveSimdLevel();
+    auto composeRange = [&trs, out, count, grain, level](size_t range) {
+        const size_t begin = range * grain;
+        ComposeTRS(trs, begin, std::min(begin + grain, count), out, level);
+    };
+    jobs->parallel_for(0, (count + grain - 1) / grain, composeRange, 1);
+}
+} // namespace Math
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Math.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace EngineCore::Foundation
+{
+class JobSystem;
+}
+
+namespace Math
+{
+    /// <summary>
+    /// Read-only view of many translation/rotation/scale triples.
+    /// Every component has its own pointer and each group its own stride (in floats), so both
+    /// planar arrays (stride 1) and interleaved records such as TransformComponent can be read in
+    /// place. Rotations must be normalized quaternions.
+    /// </summary>
+    struct TRSView
+    {
+        const float* px = nullptr;
+        const float* py = nullptr;
+        const float* pz = nullptr;
+        const float* qx = nullptr;
+        const float* qy = nullptr;
+        const float* qz = nullptr;
+        const float* qw = nullptr;
+        const float* sx = nullptr;
+        const float* sy = nullptr;
+        const float* sz = nullptr;
+        size_t positionStride = 1;
+        size_t rotationStride = 1;
+        size_t scaleStride = 1;
+
+        /// Records of xyz positions, xyzw quaternions and xyz scales, @p *Stride floats apart.
+        static TRSView Interleaved(const float* position, size_t positionStride, const float* rotation,
+                                   size_t rotationStride, const float* scale, size_t scaleStride) noexcept
+        {
+            TRSView view;
+            view.px = position;
+            view.py = position + 1;
+            view.pz = position + 2;
+            view.qx = rotation;
+            view.qy = rotation + 1;
+            view.qz = rotation + 2;
+            view.qw = rotation + 3;
+            view.sx = scale;
+            view.sy = scale + 1;
+            view.sz = scale + 2;
+            view.positionStride = positionStride;
+            view.rotationStride = rotationStride;
+            view.scaleStride = scaleStride;
+            return view;
+        }
+    };
+
+    enum class SimdLevel : uint8_t
+    {
+        Scalar,
+        Sse2, ///< 4 transforms per step
+        Avx2, ///< 8 transforms per step
+    };
+
+    /// Best level this CPU supports, detected once.
+    SimdLevel ActiveSimdLevel() noexcept;
+    const char* ToString(SimdLevel level) noexcept;
+
+    /// <summary>
+    /// Writes TRS(position[i], rotation[i], scale[i]) to out[i] for i in [begin, end).
+    /// Bit-identical to Math::TRS for finite input on every level. @p level is clamped to
+    /// ActiveSimdLevel(), so tests can force the fallbacks.
+    /// </summary>
+    void ComposeTRS(const TRSView& trs, size_t begin, size_t end, Mat4* out,
+                    SimdLevel level = ActiveSimdLevel()) noexcept;
+
+    /// <summary>
+    /// ComposeTRS() split into @p grain sized ranges over JobSystem workers. Runs on the calling
+    /// thread when @p jobs is null or has no workers, or the batch fits in one range.
+    /// </summary>
+    void ComposeTRSParallel(EngineCore::Foundation::JobSystem* jobs, const TRSView& trs, size_t count, Mat4* out,
+                            size_t grain = 1024);
+}
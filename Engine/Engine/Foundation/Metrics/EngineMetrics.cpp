@@ -0,0 +1,149 @@
+#include "EngineMetrics.h"
+#include "MetricsExporter.h"
+#include "Foundation/JobSystem/JobSystem.h"
+#include "Foundation/Memory/MemorySystem.h"
+#include "Foundation/Profiler/FrameStats.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+
+using namespace EngineCore::Foundation;
+
+namespace
+{
+void WriteFrameStats(OpenMetricsWriter& writer)
+{
+    const FrameStats& stats = FrameStats::Instance();
+
+    writer.family("frames", "counter", "Frames recorded by FrameStats");
+    writer.sample("frames", "_total", {}, stats.getFrameCount());
+
+    std::array<FrameStageSummary, FrameStats::kStageCount> summaries;
+    for (size_t i = 0; i < summaries.size(); ++i)
+        summaries[i] = stats.getSummary(static_cast<FrameStage>(i));
+
+    writer.family("frame_stage_ms", "gauge", "Frame stage timings over the last FrameStats window");
+    for (size_t i = 0; i < summaries.size(); ++i)
+    {
+        const std::string_view stage = FrameStats::StageName(static_cast<FrameStage>(i));
+        const FrameStageSummary& summary = summaries[i];
+        if (summary.samples == 0)
+            continue;
+        writer.sample("frame_stage_ms", {{"stage", stage}, {"stat", "p50"}}, summary.p50Ms);
+        writer.sample("frame_stage_ms", {{"stage", stage}, {"stat", "p95"}}, summary.p95Ms);
+        writer.sample("frame_stage_ms", {{"stage", stage}, {"stat", "p99"}}, summary.p99Ms);
+        writer.sample("frame_stage_ms", {{"stage", stage}, {"stat", "max"}}, summary.maxMs);
+        writer.sample("frame_stage_ms", {{"stage", stage}, {"stat", "avg"}}, summary.avgMs);
+        writer.sample("frame_stage_ms", {{"stage", stage}, {"stat", "last"}}, summary.lastMs);
+    }
+
+    writer.family("frame_stage_budget_overruns", "counter", "Stage samples over their FrameStats budget");
+    for (size_t i = 0; i < summaries.size(); ++i)
+    {
+        if (summaries[i].budgetMs <= 0.0)
+            continue;
+        const MetricLabel label{"stage", FrameStats::StageName(static_cast<FrameStage>(i))};
+        writer.sample("frame_stage_budget_overruns", "_total", std::span<const MetricLabel>(&label, 1),
+                      summaries[i].overruns);
+    }
+}
+
+constexpr size_t kTagCount = static_cast<size_t>(MemoryTag::Count);
+
+/// Per-tag usage sampled by SampleEngineMetrics on the main thread, read by the exporter thread.
+struct MemorySample
+{
+    std::array<std::atomic<uint64_t>, kTagCount> usedBytes{};
+    std::array<std::atomic<uint64_t>, kTagCount> frameHighBytes{}; ///< Highest usedBytes sampled
+};
+
+MemorySample& Memory()
+{
+    static MemorySample sample;
+    return sample;
+}
+
+void WriteMemory(OpenMetricsWriter& writer)
+{
+    MemorySample& sample = Memory();
+
+    writer.family("memory_allocated_bytes", "gauge", "Bytes in use in MemorySystem allocators per tag at the last frame");
+    for (size_t i = 0; i < kTagCount; ++i)
+    {
+        writer.sample("memory_allocated_bytes", {{"tag", MemorySystem::getMemoryTagName(static_cast<MemoryTag>(i))}},
+                      sample.usedBytes[i].load(std::memory_order_relaxed));
+    }
+
+    writer.family("memory_frame_high_bytes", "gauge",
+                  "Highest per-tag MemorySystem usage seen at a frame boundary; peaks within a frame are not seen");
+    for (size_t i = 0; i < kTagCount; ++i)
+    {
+        writer.sample("memory_frame_high_bytes", {{"tag", MemorySystem::getMemoryTagName(static_cast<MemoryTag>(i))}},
+                      sample.frameHighBytes[i].load(std::memory_order_relaxed));
+    }
+}
+
+/// Utilization is reported over the time since the previous snapshot, not since startup.
+class JobSystemCollector
+{
+  public:
+    explicit JobSystemCollector(const JobSystem* jobSystem) : m_jobSystem(jobSystem)
+    {
+    }
+
+    void operator()(OpenMetricsWriter& writer)
+    {
+        const JobSystem::Statistics stats = m_jobSystem->getStatistics();
+
+        double utilization = 0.0;
+        if (stats.workers > 0 && stats.uptimeNs > m_lastUptimeNs && stats.busyNs >= m_lastBusyNs)
+        {
+            const double busy = static_cast<double>(stats.busyNs - m_lastBusyNs);
+            const double wall = static_cast<double>(stats.uptimeNs - m_lastUptimeNs) * static_cast<double>(stats.workers);
+            utilization       = std::min(busy / wall, 1.0);
+        }
+        m_lastBusyNs   = stats.busyNs;
+        m_lastUptimeNs = stats.uptimeNs;
+
+        writer.family("jobs_workers", "gauge", "JobSystem worker threads");
+        writer.sample("jobs_workers", {}, {}, static_cast<uint64_t>(stats.workers));
+        writer.family("jobs_utilization", "gauge", "Share of worker time spent in jobs since the previous snapshot");
+        writer.sample("jobs_utilization", {}, {}, utilization);
+        writer.family("jobs_executed", "counter", "Jobs run on JobSystem workers");
+        writer.sample("jobs_executed", "_total", {}, stats.jobsExecuted);
+        writer.family("jobs_inline", "counter", "Jobs run on the submitting thread");
+        writer.sample("jobs_inline", "_total", {}, stats.jobsInline);
+        writer.family("jobs_busy_seconds", "counter", "Time spent in jobs, summed over workers");
+        writer.sample("jobs_busy_seconds", "_total", {}, static_cast<double>(stats.busyNs) / 1e9);
+    }
+
+  private:
+    const JobSystem* m_jobSystem;
+    uint64_t m_lastBusyNs   = 0;
+    uint64_t m_lastUptimeNs = 0;
+};
+} // namespace
+
+void EngineCore::Foundation::SampleEngineMetrics() noexcept
+{
+    if (!MetricsExporter::IsRunning())
+        return;
+
+    MemorySample& sample = Memory();
+    for (size_t i = 0; i < kTagCount; ++i)
+    {
+        const auto used = static_cast<uint64_t>(MemorySystem::getStatistics(static_cast<MemoryTag>(i)).allocatedBytes);
+        sample.usedBytes[i].store(used, std::memory_order_relaxed);
+        if (used > sample.frameHighBytes[i].load(std::memory_order_relaxed))
+            sample.frameHighBytes[i].store(used, std::memory_order_relaxed);
+    }
+}
+
+void EngineCore::Foundation::AddEngineMetricCollectors(const JobSystem* jobSystem)
+{
+    MetricsExporter::AddCollector(WriteFrameStats);
+    MetricsExporter::AddCollector(WriteMemory);
+    if (jobSystem)
+        MetricsExporter::AddCollector(JobSystemCollector(jobSystem));
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+namespace EngineCore::Foundation
+{
+class JobSystem;
+
+/**
+ * @brief Registers MetricsExporter collectors for the engine's own statistics
+ *
+ * Frame stage timings (FrameStats), memory per MemoryTag (as of the last SampleEngineMetrics)
+ * and, when @p jobSystem is given, job system utilization. @p jobSystem must outlive the
+ * exporter; stop the exporter before shutting the job system down.
+ */
+void AddEngineMetricCollectors(const JobSystem* jobSystem);
+
+/**
+ * @brief Samples the statistics the collectors cannot read from the exporter thread
+ *
+ * MemorySystem allocators are not safe to query while other threads allocate, so their usage
+ * is copied here, once per frame on the main thread, and exported from the copy. No-op while
+ * the MetricsExporter is not running.
+ */
+void SampleEngineMetrics() noexcept;
+} // namespace EngineCore::Foundation
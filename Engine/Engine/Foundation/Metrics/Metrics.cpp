@@ -0,0 +1,108 @@
+#include "Metrics.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace EngineCore::Foundation;
+
+Histogram::Histogram(std::string name, std::string help, std::vector<double> bounds)
+    : Metric(std::move(name), std::move(help), MetricType::Histogram), m_bounds(std::move(bounds))
+{
+    std::sort(m_bounds.begin(), m_bounds.end());
+    m_bounds.erase(std::unique(m_bounds.begin(), m_bounds.end()), m_bounds.end());
+    m_buckets = std::make_unique<std::atomic<uint64_t>[]>(m_bounds.size() + 1);
+    for (size_t i = 0; i <= m_bounds.size(); ++i)
+        m_buckets[i].store(0, std::memory_order_relaxed);
+}
+
+void Histogram::observe(double value) noexcept
+{
+    // Bucket counts are kept non-cumulative so an observation touches a single bucket.
+    const size_t bucket = static_cast<size_t>(std::lower_bound(m_bounds.begin(), m_bounds.end(), value) -
+                                              m_bounds.begin());
+    m_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(value, std::memory_order_relaxed);
+}
+
+std::vector<double> Histogram::DefaultMillisecondBounds()
+{
+    return {0.1, 0.25, 0.5, 1.0, 2.5, 5.0, 10.0, 16.0, 33.0, 50.0, 100.0, 250.0, 500.0, 1000.0};
+}
+
+MetricsRegistry& MetricsRegistry::Instance()
+{
+    // Leaked: metrics are touched from static destructors and detached threads during shutdown.
+    static MetricsRegistry* instance = new MetricsRegistry();
+    return *instance;
+}
+
+template <typename T, typename... Args>
+T& MetricsRegistry::getOrCreate(std::string_view name, MetricType type, Args&&... args)
+{
+    std::scoped_lock lock(m_mutex);
+    if (auto it = m_byName.find(std::string(name)); it != m_byName.end())
+    {
+        if (it->second->type() != type)
+            throw std::logic_error("Metric '" + std::string(name) + "' is already registered as a " +
+                                   std::string(MetricTypeName(it->second->type())));
+        return static_cast<T&>(*it->second);
+    }
+
+    auto metric = std::make_unique<T>(std::string(name), std::forward<Args>(args)...);
+    T& ref      = *metric;
+    m_byName.emplace(ref.name(), &ref);
+    m_metrics.push_back(std::move(metric));
+    return ref;
+}
+
+Counter& MetricsRegistry::counter(std::string_view name, std::string_view help)
+{
+    return getOrCreate<Counter>(name, MetricType::Counter, std::string(help));
+}
+
+Gauge& MetricsRegistry::gauge(std::string_view name, std::string_view help)
+{
+    return getOrCreate<Gauge>(name, MetricType::Gauge, std::string(help));
+}
+
+Histogram& MetricsRegistry::histogram(std::string_view name, std::string_view help, std::vector<double> bounds)
+{
+    if (bounds.empty())
+        bounds = Histogram::DefaultMillisecondBounds();
+    return getOrCreate<Histogram>(name, MetricType::Histogram, std::string(help), std::move(bounds));
+}
+
+Metric* MetricsRegistry::find(std::string_view name) const
+{
+    std::scoped_lock lock(m_mutex);
+    auto it = m_byName.find(std::string(name));
+    return it != m_byName.end() ? it->second : nullptr;
+}
+
+size_t MetricsRegistry::size() const
+{
+    std::scoped_lock lock(m_mutex);
+    return m_metrics.size();
+}
+
+void MetricsRegistry::forEach(const std::function<void(const Metric&)>& visitor) const
+{
+    std::scoped_lock lock(m_mutex);
+    for (const auto& metric : m_metrics)
+        visitor(*metric);
+}
+
+std::string_view EngineCore::Foundation::MetricTypeName(MetricType type) noexcept
+{
+    switch (type)
+    {
+    case MetricType::Counter:
+        return "counter";
+    case MetricType::Gauge:
+        return "gauge";
+    case MetricType::Histogram:
+        return "histogram";
+    }
+    return "unknown";
+}
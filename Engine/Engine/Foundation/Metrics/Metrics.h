@@ -0,0 +1,180 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace EngineCore::Foundation
+{
+enum class MetricType : uint8_t
+{
+    Counter,   ///< Monotonic total (draw calls, cache misses, bytes loaded)
+    Gauge,     ///< Current level (entities alive, bodies in the world)
+    Histogram, ///< Distribution over fixed buckets (per-call durations, sizes)
+};
+
+/**
+ * @brief A named metric owned by the MetricsRegistry
+ *
+ * Metrics are never destroyed while the process runs, so call sites can keep references to
+ * them. Names follow the Prometheus convention ([a-zA-Z_:][a-zA-Z0-9_:]*, counters end in
+ * _total) so they can be exported as-is.
+ */
+class Metric
+{
+  public:
+    Metric(std::string name, std::string help, MetricType type)
+        : m_name(std::move(name)), m_help(std::move(help)), m_type(type)
+    {
+    }
+    virtual ~Metric() = default;
+
+    Metric(const Metric&)            = delete;
+    Metric& operator=(const Metric&) = delete;
+
+    [[nodiscard]] const std::string& name() const noexcept
+    {
+        return m_name;
+    }
+    [[nodiscard]] const std::string& help() const noexcept
+    {
+        return m_help;
+    }
+    [[nodiscard]] MetricType type() const noexcept
+    {
+        return m_type;
+    }
+
+  private:
+    std::string m_name;
+    std::string m_help;
+    MetricType m_type;
+};
+
+class Counter final : public Metric
+{
+  public:
+    Counter(std::string name, std::string help) : Metric(std::move(name), std::move(help), MetricType::Counter)
+    {
+    }
+
+    void add(uint64_t amount = 1) noexcept
+    {
+        m_value.fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t value() const noexcept
+    {
+        return m_value.load(std::memory_order_relaxed);
+    }
+
+  private:
+    alignas(64) std::atomic<uint64_t> m_value{0};
+};
+
+class Gauge final : public Metric
+{
+  public:
+    Gauge(std::string name, std::string help) : Metric(std::move(name), std::move(help), MetricType::Gauge)
+    {
+    }
+
+    void set(double value) noexcept
+    {
+        m_value.store(value, std::memory_order_relaxed);
+    }
+
+    void add(double delta) noexcept
+    {
+        m_value.fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] double value() const noexcept
+    {
+        return m_value.load(std::memory_order_relaxed);
+    }
+
+  private:
+    alignas(64) std::atomic<double> m_value{0.0};
+};
+
+class Histogram final : public Metric
+{
+  public:
+    /// @p bounds are inclusive upper bounds in ascending order; a +Inf bucket is implied.
+    Histogram(std::string name, std::string help, std::vector<double> bounds);
+
+    void observe(double value) noexcept;
+
+    [[nodiscard]] std::span<const double> bounds() const noexcept
+    {
+        return m_bounds;
+    }
+    /// Non-cumulative count of bucket @p index; index bounds().size() is the +Inf bucket.
+    [[nodiscard]] uint64_t bucketCount(size_t index) const noexcept
+    {
+        return m_buckets[index].load(std::memory_order_relaxed);
+    }
+    [[nodiscard]] uint64_t count() const noexcept
+    {
+        return m_count.load(std::memory_order_relaxed);
+    }
+    [[nodiscard]] double sum() const noexcept
+    {
+        return m_sum.load(std::memory_order_relaxed);
+    }
+
+    /// Milliseconds, from a tenth of a millisecond up to a second.
+    static std::vector<double> DefaultMillisecondBounds();
+
+  private:
+    std::vector<double> m_bounds;
+    std::unique_ptr<std::atomic<uint64_t>[]> m_buckets;
+    std::atomic<uint64_t> m_count{0};
+    std::atomic<double> m_sum{0.0};
+};
+
+/**
+ * @brief Process-wide registry of named counters, gauges and histograms
+ *
+ * Registration takes a lock and is meant to happen once per call site (the LT_METRIC_* macros
+ * cache the reference in a function-local static). Updates after that are a single relaxed
+ * atomic operation. Asking for an existing name returns the same metric; asking for it with
+ * a different type is a programming error and throws std::logic_error.
+ */
+class MetricsRegistry
+{
+  public:
+    static MetricsRegistry& Instance();
+
+    MetricsRegistry() = default;
+    MetricsRegistry(const MetricsRegistry&)            = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    Counter& counter(std::string_view name, std::string_view help = {});
+    Gauge& gauge(std::string_view name, std::string_view help = {});
+    /// Empty @p bounds uses Histogram::DefaultMillisecondBounds(). Bounds of an existing histogram are kept.
+    Histogram& histogram(std::string_view name, std::string_view help = {}, std::vector<double> bounds = {});
+
+    [[nodiscard]] Metric* find(std::string_view name) const;
+    [[nodiscard]] size_t size() const;
+
+    /// Visits every metric in registration order while holding the registry lock; do not register from @p visitor.
+    void forEach(const std::function<void(const Metric&)>& visitor) const;
+
+  private:
+    template <typename T, typename... Args> T& getOrCreate(std::string_view name, MetricType type, Args&&... args);
+
+    mutable std::mutex m_mutex;
+    std::vector<std::unique_ptr<Metric>> m_metrics;
+    std::unordered_map<std::string, Metric*> m_byName;
+};
+
+[[nodiscard]] std::string_view MetricTypeName(MetricType type) noexcept;
+} // namespace EngineCore::Foundation
@@ -0,0 +1,356 @@
+#include "MetricsExporter.h"
+#include "Metrics.h"
+#include "Foundation/Log/LoggerMacro.h"
+#include "Foundation/Profiler/CpuProfiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+using namespace EngineCore::Foundation;
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+/// Upper bound on how long a stop request waits for the socket poll to notice it.
+constexpr std::chrono::milliseconds kPollSlice{50};
+
+struct ExporterState
+{
+    std::mutex controlMutex; ///< Start / Stop
+    std::mutex collectMutex; ///< Collectors and their per-snapshot state
+    std::vector<MetricsCollector> collectors;
+
+    std::thread thread;
+    std::atomic<bool> running{false};
+    std::atomic<bool> stopRequested{false};
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+    std::atomic<uint64_t> snapshots{0};
+};
+
+ExporterState& State()
+{
+    // Leaked like the registry: collectors may capture objects that outlive static destruction order.
+    static ExporterState* state = new ExporterState();
+    return *state;
+}
+
+/// Everything owned by the exporter thread.
+class ExportWorker
+{
+  public:
+    explicit ExportWorker(MetricsExporterConfig config) : m_config(std::move(config))
+    {
+        m_config.intervalMs = std::max<uint32_t>(m_config.intervalMs, 1);
+        m_snapshot.reserve(m_config.reserveBytes);
+        m_exportMs = &MetricsRegistry::Instance().gauge("metrics_export_duration_ms",
+                                                        "Time the metrics exporter spent on its last snapshot");
+    }
+
+    ExportWorker(const ExportWorker&)            = delete;
+    ExportWorker& operator=(const ExportWorker&) = delete;
+
+    ~ExportWorker()
+    {
+        if (m_file)
+            std::fclose(m_file);
+#if !defined(_WIN32)
+        if (m_listenFd >= 0)
+        {
+            ::close(m_listenFd);
+            ::unlink(m_config.socketPath.c_str());
+        }
+#endif
+    }
+
+    bool open()
+    {
+        if (!m_config.filePath.empty())
+            openFile();
+        if (!m_config.socketPath.empty())
+            openSocket();
+        return m_file != nullptr || hasSocket();
+    }
+
+    void run()
+    {
+        CpuProfiler::SetThreadName("MetricsExporter");
+        ExporterState& state = State();
+        const auto interval  = std::chrono::milliseconds(m_config.intervalMs);
+
+        auto next = Clock::now();
+        while (!state.stopRequested.load(std::memory_order_acquire))
+        {
+            publish();
+
+            next += interval;
+            const auto now = Clock::now();
+            if (next < now)
+                next = now + interval; // Fell behind (debugger, suspended process): skip, don't burst.
+            waitUntil(next);
+        }
+        publish();
+    }
+
+  private:
+    void publish()
+    {
+        const auto start = Clock::now();
+        MetricsExporter::Serialize(m_snapshot);
+        writeFile();
+        m_exportMs->set(std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+        State().snapshots.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void waitUntil(Clock::time_point deadline)
+    {
+        ExporterState& state = State();
+        if (!hasSocket())
+        {
+            std::unique_lock lock(state.wakeMutex);
+            state.wake.wait_until(lock, deadline,
+                                  [&] { return state.stopRequested.load(std::memory_order_acquire); });
+            return;
+        }
+
+        for (auto now = Clock::now(); now < deadline && !state.stopRequested.load(std::memory_order_acquire);
+             now       = Clock::now())
+        {
+            const auto slice =
+                std::min(std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now), kPollSlice);
+            serveClients(static_cast<int>(std::max<int64_t>(slice.count(), 1)));
+        }
+    }
+
+    void openFile()
+    {
+        m_rotated.clear();
+        for (uint32_t i = 1; i <= m_config.fileKeep; ++i)
+            m_rotated.push_back(m_config.filePath + "." + std::to_string(i));
+
+        m_file = std::fopen(m_config.filePath.c_str(), "ab");
+        if (!m_file)
+        {
+            LT_LOGFW("Metrics", "Cannot open metrics file '{}'", m_config.filePath);
+            return;
+        }
+        std::fseek(m_file, 0, SEEK_END);
+        m_fileBytes = static_cast<size_t>(std::max<long>(std::ftell(m_file), 0));
+    }
+
+    void writeFile()
+    {
+        if (!m_file)
+            return;
+        if (m_fileBytes > 0 && m_fileBytes + m_snapshot.size() > m_config.fileMaxBytes)
+            rotate();
+        if (!m_file)
+            return;
+
+        std::fwrite(m_snapshot.data(), 1, m_snapshot.size(), m_file);
+        std::fflush(m_file);
+        m_fileBytes += m_snapshot.size();
+    }
+
+    void rotate()
+    {
+        std::fclose(m_file);
+        // <path>.N-1 -> <path>.N, ..., <path> -> <path>.1; the oldest falls off the end.
+        for (size_t i = m_rotated.size(); i > 0; --i)
+        {
+            const std::string& from = i > 1 ? m_rotated[i - 2] : m_config.filePath;
+            std::remove(m_rotated[i - 1].c_str());
+            std::rename(from.c_str(), m_rotated[i - 1].c_str());
+        }
+        m_file      = std::fopen(m_config.filePath.c_str(), "wb");
+        m_fileBytes = 0;
+        if (!m_file)
+            LT_LOGFW("Metrics", "Cannot reopen metrics file '{}' after rotation", m_config.filePath);
+    }
+
+    [[nodiscard]] bool hasSocket() const noexcept
+    {
+        return m_listenFd >= 0;
+    }
+
+#if defined(_WIN32)
+    void openSocket()
+    {
+        LT_LOGW("Metrics", "Metrics socket export is not supported on Windows; use the metrics file");
+    }
+
+    void serveClients(int)
+    {
+    }
+#else
+    void openSocket()
+    {
+        sockaddr_un address{};
+        if (m_config.socketPath.size() >= sizeof(address.sun_path))
+        {
+            LT_LOGFW("Metrics", "Metrics socket path '{}' is too long", m_config.socketPath);
+            return;
+        }
+        address.sun_family = AF_UNIX;
+        std::copy(m_config.socketPath.begin(), m_config.socketPath.end(), address.sun_path);
+
+        const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0)
+        {
+            LT_LOGFW("Metrics", "Cannot create metrics socket (errno {})", errno);
+            return;
+        }
+        ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+        ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+        // A previous run that crashed leaves the socket file behind.
+        ::unlink(m_config.socketPath.c_str());
+        if (::bind(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 || ::listen(fd, 8) != 0)
+        {
+            LT_LOGFW("Metrics", "Cannot listen on metrics socket '{}' (errno {})", m_config.socketPath, errno);
+            ::close(fd);
+            return;
+        }
+        m_listenFd = fd;
+    }
+
+    /// Waits up to @p timeoutMs for scrapers and sends each pending one the latest snapshot.
+    void serveClients(int timeoutMs)
+    {
+        pollfd listener{m_listenFd, POLLIN, 0};
+        if (::poll(&listener, 1, timeoutMs) <= 0)
+            return;
+
+        while (true)
+        {
+            const int client = ::accept(m_listenFd, nullptr, nullptr);
+            if (client < 0)
+                return; // EAGAIN: no more pending connections
+
+            // A stalled scraper must not hold up the exporter.
+            timeval timeout{0, 200'000};
+            ::setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+#if defined(SO_NOSIGPIPE)
+            int one = 1;
+            ::setsockopt(client, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+#if defined(MSG_NOSIGNAL)
+            constexpr int kSendFlags = MSG_NOSIGNAL;
+#else
+            constexpr int kSendFlags = 0;
+#endif
+            size_t sent = 0;
+            while (sent < m_snapshot.size())
+            {
+                const ssize_t written = ::send(client, m_snapshot.data() + sent, m_snapshot.size() - sent, kSendFlags);
+                if (written <= 0)
+                    break;
+                sent += static_cast<size_t>(written);
+            }
+            ::close(client);
+        }
+    }
+#endif
+
+    MetricsExporterConfig m_config;
+    std::string m_snapshot;
+    Gauge* m_exportMs = nullptr;
+
+    std::FILE* m_file  = nullptr;
+    size_t m_fileBytes = 0;
+    std::vector<std::string> m_rotated;
+
+    int m_listenFd = -1;
+};
+} // namespace
+
+bool MetricsExporter::Start(MetricsExporterConfig config)
+{
+    ExporterState& state = State();
+    std::scoped_lock lock(state.controlMutex);
+    if (state.running.load(std::memory_order_relaxed))
+        return false;
+
+    auto worker = std::make_unique<ExportWorker>(std::move(config));
+    if (!worker->open())
+    {
+        LT_LOGW("Metrics", "Metrics exporter has no usable output; not started");
+        return false;
+    }
+
+    state.stopRequested.store(false, std::memory_order_relaxed);
+    state.running.store(true, std::memory_order_release);
+    state.thread = std::thread([worker = std::move(worker)]() { worker->run(); });
+    LT_LOGI("Metrics", "Metrics exporter started");
+    return true;
+}
+
+void MetricsExporter::Stop()
+{
+    ExporterState& state = State();
+    std::scoped_lock lock(state.controlMutex);
+    if (!state.running.load(std::memory_order_relaxed))
+        return;
+
+    {
+        std::scoped_lock wakeLock(state.wakeMutex);
+        state.stopRequested.store(true, std::memory_order_release);
+    }
+    state.wake.notify_all();
+    if (state.thread.joinable())
+        state.thread.join();
+    state.running.store(false, std::memory_order_release);
+}
+
+bool MetricsExporter::IsRunning() noexcept
+{
+    return State().running.load(std::memory_order_acquire);
+}
+
+void MetricsExporter::AddCollector(MetricsCollector collector)
+{
+    ExporterState& state = State();
+    std::scoped_lock lock(state.collectMutex);
+    state.collectors.push_back(std::move(collector));
+}
+
+void MetricsExporter::ClearCollectors()
+{
+    ExporterState& state = State();
+    std::scoped_lock lock(state.collectMutex);
+    state.collectors.clear();
+}
+
+void MetricsExporter::Serialize(std::string& out)
+{
+    out.clear();
+    OpenMetricsWriter writer(out);
+    writer.registry(MetricsRegistry::Instance());
+    {
+        ExporterState& state = State();
+        std::scoped_lock lock(state.collectMutex);
+        for (const auto& collector : state.collectors)
+            collector(writer);
+    }
+    writer.eof();
+}
+
+uint64_t MetricsExporter::GetSnapshotCount() noexcept
+{
+    return State().snapshots.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include "OpenMetricsWriter.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace EngineCore::Foundation
+{
+struct MetricsExporterConfig
+{
+    uint32_t intervalMs   = 1000;             ///< Time between two snapshots
+    std::string filePath;                     ///< Snapshots are appended here; empty disables the file
+    size_t fileMaxBytes   = 4 * 1024 * 1024;  ///< Rotate to <filePath>.1 once the file would grow past this
+    uint32_t fileKeep     = 3;                ///< Rotated files kept (<filePath>.1 .. .N)
+    std::string socketPath;                   ///< Unix domain socket serving the latest snapshot; empty disables
+    size_t reserveBytes   = 64 * 1024;        ///< Initial snapshot buffer capacity
+};
+
+/// Appends one or more metric families; called on the exporter thread for every snapshot.
+using MetricsCollector = std::function<void(OpenMetricsWriter& writer)>;
+
+/**
+ * @brief Background thread that publishes the engine's metrics in the OpenMetrics text format
+ *
+ * Every interval the exporter serializes the MetricsRegistry and the registered collectors into
+ * a reused buffer, appends the snapshot to a size-rotated file and keeps it for scrapers that
+ * connect to the Unix domain socket (each connection receives the latest snapshot, then the
+ * socket is closed). Once the buffer has grown to fit a snapshot, exporting does not allocate.
+ *
+ * Snapshots in the file are complete expositions terminated by "# EOF"; a reader tailing the
+ * file should take the last complete one.
+ */
+class MetricsExporter
+{
+  public:
+    /// False if already running or neither a file nor a socket could be opened.
+    static bool Start(MetricsExporterConfig config);
+    /// Writes a final snapshot to the file, closes the socket and joins the thread.
+    static void Stop();
+    [[nodiscard]] static bool IsRunning() noexcept;
+
+    /// Collectors are kept for the lifetime of the process (or until ClearCollectors()).
+    static void AddCollector(MetricsCollector collector);
+    static void ClearCollectors();
+
+    /// Replaces @p out with one complete exposition (registry, collectors, "# EOF").
+    static void Serialize(std::string& out);
+
+    /// Snapshots produced by the exporter thread since the process started.
+    [[nodiscard]] static uint64_t GetSnapshotCount() noexcept;
+};
+} // namespace EngineCore::Foundation
@@ -0,0 +1,79 @@
+#pragma once
+#include "Metrics.h"
+
+#include <chrono>
+
+// Each call site resolves its metric once (function-local static); afterwards an update is a
+// relaxed atomic on the metric itself. Names must be string literals or otherwise constant per
+// call site.
+
+#define LT_METRIC_COUNTER_ADD(name, help, amount)                                                                      \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        static ::EngineCore::Foundation::Counter& lt_metric_ =                                                         \
+            ::EngineCore::Foundation::MetricsRegistry::Instance().counter(name, help);                                 \
+        lt_metric_.add(static_cast<uint64_t>(amount));                                                                 \
+    } while (0)
+
+#define LT_METRIC_COUNTER_INC(name, help) LT_METRIC_COUNTER_ADD(name, help, 1)
+
+#define LT_METRIC_GAUGE_SET(name, help, value)                                                                         \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        static ::EngineCore::Foundation::Gauge& lt_metric_ =                                                           \
+            ::EngineCore::Foundation::MetricsRegistry::Instance().gauge(name, help);                                   \
+        lt_metric_.set(static_cast<double>(value));                                                                    \
+    } while (0)
+
+#define LT_METRIC_GAUGE_ADD(name, help, delta)                                                                         \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        static ::EngineCore::Foundation::Gauge& lt_metric_ =                                                           \
+            ::EngineCore::Foundation::MetricsRegistry::Instance().gauge(name, help);                                   \
+        lt_metric_.add(static_cast<double>(delta));                                                                    \
+    } while (0)
+
+/// Uses Histogram::DefaultMillisecondBounds().
+#define LT_METRIC_OBSERVE(name, help, value)                                                                           \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        static ::EngineCore::Foundation::Histogram& lt_metric_ =                                                       \
+            ::EngineCore::Foundation::MetricsRegistry::Instance().histogram(name, help);                               \
+        lt_metric_.observe(static_cast<double>(value));                                                                \
+    } while (0)
+
+namespace EngineCore::Foundation
+{
+/// Adds the scope's duration in nanoseconds to a counter.
+class ScopedMetricTimer
+{
+  public:
+    explicit ScopedMetricTimer(Counter& nanoseconds) noexcept
+        : m_counter(nanoseconds), m_start(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~ScopedMetricTimer()
+    {
+        m_counter.add(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count()));
+    }
+
+    ScopedMetricTimer(const ScopedMetricTimer&)            = delete;
+    ScopedMetricTimer& operator=(const ScopedMetricTimer&) = delete;
+
+  private:
+    Counter& m_counter;
+    std::chrono::steady_clock::time_point m_start;
+};
+} // namespace EngineCore::Foundation
+
+#define LT_METRIC_CONCAT_INNER(a, b) a##b
+#define LT_METRIC_CONCAT(a, b) LT_METRIC_CONCAT_INNER(a, b)
+
+/// Accumulates the enclosing scope's duration into the nanosecond counter @p name.
+#define LT_METRIC_SCOPED_TIME_NS(name, help)                                                                           \
+    static ::EngineCore::Foundation::Counter& LT_METRIC_CONCAT(lt_metric_timer_counter_, __LINE__) =                   \
+        ::EngineCore::Foundation::MetricsRegistry::Instance().counter(name, help);                                     \
+    ::EngineCore::Foundation::ScopedMetricTimer LT_METRIC_CONCAT(lt_metric_timer_, __LINE__)(                         \
+        LT_METRIC_CONCAT(lt_metric_timer_counter_, __LINE__))
@@ -0,0 +1,154 @@
+#include "OpenMetricsWriter.h"
+#include "Metrics.h"
+
+#include <charconv>
+#include <cmath>
+#include <string_view>
+
+using namespace EngineCore::Foundation;
+
+namespace
+{
+constexpr std::string_view kTotalSuffix = "_total";
+
+/// Formats @p value as an OpenMetrics float ("1.0" rather than "1", "+Inf", "NaN") into @p buffer.
+std::string_view FormatFloat(double value, char (&buffer)[32]) noexcept
+{
+    if (std::isnan(value))
+        return "NaN";
+    if (std::isinf(value))
+        return value > 0 ? "+Inf" : "-Inf";
+
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer) - 2, value);
+    std::string_view text(buffer, static_cast<size_t>(result.ptr - buffer));
+    if (text.find_first_of(".e") == std::string_view::npos)
+    {
+        *result.ptr       = '.';
+        *(result.ptr + 1) = '0';
+        text              = std::string_view(buffer, text.size() + 2);
+    }
+    return text;
+}
+} // namespace
+
+void OpenMetricsWriter::family(std::string_view name, std::string_view type, std::string_view help)
+{
+    m_out.append("# TYPE ").append(name).append(" ").append(type).append("\n");
+    if (!help.empty())
+    {
+        m_out.append("# HELP ").append(name).append(" ");
+        appendEscaped(help);
+        m_out.append("\n");
+    }
+}
+
+void OpenMetricsWriter::sample(std::string_view name, std::string_view suffix, std::span<const MetricLabel> labels,
+                               double value)
+{
+    beginSample(name, suffix, labels);
+    appendNumber(value);
+    m_out.push_back('\n');
+}
+
+void OpenMetricsWriter::sample(std::string_view name, std::string_view suffix, std::span<const MetricLabel> labels,
+                               uint64_t value)
+{
+    beginSample(name, suffix, labels);
+    appendNumber(value);
+    m_out.push_back('\n');
+}
+
+void OpenMetricsWriter::registry(const MetricsRegistry& registry)
+{
+    registry.forEach([this](const Metric& metric) {
+        const std::string_view name = metric.name();
+        switch (metric.type())
+        {
+        case MetricType::Counter: {
+            const bool hasSuffix =
+                name.size() > kTotalSuffix.size() && name.substr(name.size() - kTotalSuffix.size()) == kTotalSuffix;
+            const std::string_view familyName = hasSuffix ? name.substr(0, name.size() - kTotalSuffix.size()) : name;
+            family(familyName, "counter", metric.help());
+            sample(familyName, kTotalSuffix, {}, static_cast<const Counter&>(metric).value());
+            break;
+        }
+        case MetricType::Gauge:
+            family(name, "gauge", metric.help());
+            sample(name, {}, {}, static_cast<const Gauge&>(metric).value());
+            break;
+        case MetricType::Histogram: {
+            const auto& histogram = static_cast<const Histogram&>(metric);
+            family(name, "histogram", metric.help());
+
+            // Buckets are read one by one while observers keep running; _count is derived from the
+            // same reads so the exposition stays self-consistent (+Inf bucket == _count).
+            const auto bounds  = histogram.bounds();
+            uint64_t cumulative = 0;
+            char buffer[32];
+            for (size_t i = 0; i <= bounds.size(); ++i)
+            {
+                cumulative += histogram.bucketCount(i);
+                const std::string_view le = i < bounds.size() ? FormatFloat(bounds[i], buffer) : "+Inf";
+                const MetricLabel label{"le", le};
+                sample(name, "_bucket", std::span<const MetricLabel>(&label, 1), cumulative);
+            }
+            sample(name, "_sum", {}, histogram.sum());
+            sample(name, "_count", {}, cumulative);
+            break;
+        }
+        }
+    });
+}
+
+void OpenMetricsWriter::eof()
+{
+    m_out.append("# EOF\n");
+}
+
+void OpenMetricsWriter::beginSample(std::string_view name, std::string_view suffix,
+                                    std::span<const MetricLabel> labels)
+{
+    m_out.append(name).append(suffix);
+    if (!labels.empty())
+    {
+        m_out.push_back('{');
+        for (size_t i = 0; i < labels.size(); ++i)
+        {
+            if (i > 0)
+                m_out.push_back(',');
+            m_out.append(labels[i].name).append("=\"");
+            appendEscaped(labels[i].value);
+            m_out.push_back('"');
+        }
+        m_out.push_back('}');
+    }
+    m_out.push_back(' ');
+}
+
+void OpenMetricsWriter::appendEscaped(std::string_view text)
+{
+    for (char c : text)
+    {
+        if (c == '\\')
+            m_out.append("\\\\");
+        else if (c == '\n')
+            m_out.append("\\n");
+        else if (c == '"')
+            m_out.append("\\\"");
+        else
+            m_out.push_back(c);
+    }
+}
+
+void OpenMetricsWriter::appendNumber(double value)
+{
+    char buffer[32];
+    m_out.append(FormatFloat(value, buffer));
+}
+
+void OpenMetricsWriter::appendNumber(uint64_t value)
+{
+    char buffer[24];
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    m_out.append(buffer, static_cast<size_t>(result.ptr - buffer));
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace EngineCore::Foundation
+{
+class MetricsRegistry;
+
+struct MetricLabel
+{
+    std::string_view name;
+    std::string_view value;
+};
+
+/**
+ * @brief Appends metrics to a string in the OpenMetrics text format
+ *
+ * The writer only appends to the caller's buffer, so reusing one buffer whose capacity already
+ * fits a snapshot serializes without allocating. Call family() once per metric family, then
+ * sample() for each of its points, and finish the exposition with eof().
+ */
+class OpenMetricsWriter
+{
+  public:
+    explicit OpenMetricsWriter(std::string& out) noexcept : m_out(out)
+    {
+    }
+
+    /// @p type is an OpenMetrics type name: "counter", "gauge", "histogram", "summary" or "unknown".
+    void family(std::string_view name, std::string_view type, std::string_view help);
+
+    /// Writes `<name><suffix>{labels} value`; @p suffix is e.g. "_total", "_bucket" or empty.
+    void sample(std::string_view name, std::string_view suffix, std::span<const MetricLabel> labels, double value);
+    void sample(std::string_view name, std::string_view suffix, std::span<const MetricLabel> labels, uint64_t value);
+
+    void sample(std::string_view name, std::initializer_list<MetricLabel> labels, double value)
+    {
+        sample(name, {}, std::span<const MetricLabel>(labels.begin(), labels.size()), value);
+    }
+    void sample(std::string_view name, std::initializer_list<MetricLabel> labels, uint64_t value)
+    {
+        sample(name, {}, std::span<const MetricLabel>(labels.begin(), labels.size()), value);
+    }
+
+    /// Every metric in @p registry. Counters are exported under their name without the _total suffix.
+    void registry(const MetricsRegistry& registry);
+
+    void eof();
+
+  private:
+    void beginSample(std::string_view name, std::string_view suffix, std::span<const MetricLabel> labels);
+    void appendEscaped(std::string_view text);
+    void appendNumber(double value);
+    void appendNumber(uint64_t value);
+
+    std::string& m_out;
+};
+} // namespace EngineCore::Foundation
@@ -0,0 +1,79 @@
+#include "ChromeTraceWriter.h"
+
+#include <iomanip>
+
+using namespace EngineCore::Foundation;
+
+ChromeTraceWriter::ChromeTraceWriter(std::ostream& out)
+    : m_out(out), m_flags(out.flags()), m_precision(out.precision())
+{
+    m_out << std::fixed << std::setprecision(3);
+    m_out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+}
+
+ChromeTraceWriter::~ChromeTraceWriter()
+{
+    m_out << "\n]}\n";
+    m_out.flags(m_flags);
+    m_out.precision(m_precision);
+}
+
+std::ostream& ChromeTraceWriter::next()
+{
+    if (!m_first)
+        m_out << ",\n";
+    m_first = false;
+    return m_out;
+}
+
+void ChromeTraceWriter::threadName(uint32_t tid, std::string_view name)
+{
+    next() << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << tid << ",\"args\":{\"name\":";
+    WriteString(m_out, name);
+    m_out << "}}";
+}
+
+void ChromeTraceWriter::complete(std::string_view name, uint32_t tid, double tsUs, double durUs)
+{
+    next() << "{\"name\":";
+    WriteString(m_out, name);
+    m_out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << tid << ",\"ts\":" << tsUs << ",\"dur\":" << durUs << "}";
+}
+
+void ChromeTraceWriter::counter(std::string_view name, double tsUs, std::string_view series, double value)
+{
+    next() << "{\"name\":";
+    WriteString(m_out, name);
+    m_out << ",\"ph\":\"C\",\"pid\":1,\"ts\":" << tsUs << ",\"args\":{";
+    WriteString(m_out, series);
+    m_out << ":" << value << "}}";
+}
+
+void ChromeTraceWriter::instant(std::string_view name, uint32_t tid, double tsUs, std::string_view argName,
+                                std::string_view argValue)
+{
+    next() << "{\"name\":";
+    WriteString(m_out, name);
+    m_out << ",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":" << tid << ",\"ts\":" << tsUs << ",\"args\":{";
+    WriteString(m_out, argName);
+    m_out << ":";
+    WriteString(m_out, argValue);
+    m_out << "}}";
+}
+
+void ChromeTraceWriter::WriteString(std::ostream& out, std::string_view text)
+{
+    out << '"';
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+            out << '\\' << c;
+        else if (c == '\n')
+            out << "\\n";
+        else if (c == '\t')
+            out << "\\t";
+        else if (static_cast<unsigned char>(c) >= 0x20)
+            out << c;
+    }
+    out << '"';
+}
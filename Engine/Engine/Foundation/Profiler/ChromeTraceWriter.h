@@ -0,0 +1,38 @@
+#pragma once
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+
+namespace EngineCore::Foundation
+{
+/**
+ * @brief Streams Chrome trace event JSON (chrome://tracing, ui.perfetto.dev)
+ * Timestamps and durations are in microseconds. Events go to pid 1.
+ */
+class ChromeTraceWriter
+{
+  public:
+    explicit ChromeTraceWriter(std::ostream& out);
+    ~ChromeTraceWriter();
+
+    ChromeTraceWriter(const ChromeTraceWriter&)            = delete;
+    ChromeTraceWriter& operator=(const ChromeTraceWriter&) = delete;
+
+    void threadName(uint32_t tid, std::string_view name);
+    void complete(std::string_view name, uint32_t tid, double tsUs, double durUs);
+    /// Counter track sample ("C" event) with a single series.
+    void counter(std::string_view name, double tsUs, std::string_view series, double value);
+    /// Instant event ("i" event) on the @p tid track with one string argument.
+    void instant(std::string_view name, uint32_t tid, double tsUs, std::string_view argName, std::string_view argValue);
+
+    static void WriteString(std::ostream& out, std::string_view text);
+
+  private:
+    std::ostream& next();
+
+    std::ostream& m_out;
+    std::ios_base::fmtflags m_flags;
+    std::streamsize m_precision;
+    bool m_first = true;
+};
+} // namespace EngineCore::Foundation
@@ -0,0 +1,411 @@
+#include "CpuProfiler.h"
+#include "ChromeTraceWriter.h"
+#include "Foundation/Log/LoggerMacro.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define LT_PROFILER_USE_TSC 1
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#else
+#define LT_PROFILER_USE_TSC 0
+#endif
+
+using namespace EngineCore::Foundation;
+
+std::atomic<bool> CpuProfiler::s_recording{false};
+std::atomic<bool> CpuProfiler::s_capturing{false};
+std::atomic<bool> CpuProfiler::s_flightRecording{false};
+
+namespace
+{
+constexpr uint64_t kEventMask = CpuProfiler::kEventsPerThread - 1;
+static_assert((CpuProfiler::kEventsPerThread & kEventMask) == 0, "Ring size must be a power of two");
+
+struct ZoneEvent
+{
+    uint64_t tick;
+    const char* name; ///< nullptr marks the end of the innermost open zone
+};
+
+/// Ring entry. Readers copy slots while the owning thread may overwrite them, so the fields are
+/// atomics; a torn copy is detected afterwards from head (see PushEvent and CollectThreadLocked).
+struct ZoneSlot
+{
+    std::atomic<uint64_t> tick{0};
+    std::atomic<const char*> name{nullptr};
+};
+
+struct ThreadBuffer
+{
+    uint32_t tid = 0;
+    std::string name;
+    std::unique_ptr<ZoneSlot[]> events;
+    std::atomic<uint64_t> head{0};
+    uint64_t captureBegin = 0; ///< head when the current capture started
+};
+
+inline uint64_t ReadTick() noexcept
+{
+#if LT_PROFILER_USE_TSC
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+#endif
+}
+
+int64_t SteadyNs() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+struct ProfilerState
+{
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> threads;
+    uint32_t nextTid = 0;
+
+    std::atomic<bool> pending{false};
+    uint32_t requestedFrames = 0;
+    uint32_t framesRemaining = 0; ///< 0 while capturing means "until StopCapture"
+    std::string outputPath;
+
+    bool hasCapture     = false;
+    uint64_t startTick  = 0;
+    uint64_t endTick    = 0;
+    int64_t startNs     = 0;
+    int64_t endNs       = 0;
+    std::vector<uint64_t> frameTicks;
+
+    const uint64_t calibrationTick = ReadTick();
+    const int64_t calibrationNs    = SteadyNs();
+};
+
+// Leaked: worker threads may still close zones during static destruction.
+ProfilerState& State()
+{
+    static ProfilerState* state = new ProfilerState();
+    return *state;
+}
+
+thread_local ThreadBuffer* t_buffer = nullptr;
+
+ThreadBuffer& AcquireThreadBuffer(bool withEvents)
+{
+    if (t_buffer && (!withEvents || t_buffer->events))
+        return *t_buffer;
+
+    auto& state = State();
+    std::scoped_lock lock(state.mutex);
+    if (!t_buffer)
+    {
+        auto buffer = std::make_shared<ThreadBuffer>();
+        buffer->tid = state.nextTid++;
+        state.threads.push_back(buffer);
+        t_buffer = buffer.get();
+    }
+    if (withEvents && !t_buffer->events)
+        t_buffer->events = std::make_unique<ZoneSlot[]>(CpuProfiler::kEventsPerThread);
+    return *t_buffer;
+}
+
+inline void PushEvent(const char* name) noexcept
+{
+    ThreadBuffer* buffer = t_buffer;
+    if (!buffer || !buffer->events)
+    {
+        try
+        {
+            buffer = &AcquireThreadBuffer(true);
+        }
+        catch (...)
+        {
+            return;
+        }
+    }
+    const uint64_t head = buffer->head.load(std::memory_order_relaxed);
+    // Orders the head published for the previous event before the slot write: a reader that
+    // copies this write sees head >= this index after its acquire fence and drops the slot.
+    std::atomic_thread_fence(std::memory_order_release);
+    ZoneSlot& slot = buffer->events[head & kEventMask];
+    slot.tick.store(ReadTick(), std::memory_order_relaxed);
+    slot.name.store(name, std::memory_order_relaxed);
+    buffer->head.store(head + 1, std::memory_order_release);
+}
+
+void StartLocked(ProfilerState& state)
+{
+    for (auto& buffer : state.threads)
+        buffer->captureBegin = buffer->head.load(std::memory_order_acquire);
+
+    state.frameTicks.clear();
+    state.hasCapture = false;
+    state.startNs    = SteadyNs();
+    state.startTick  = ReadTick();
+}
+
+void StopLocked(ProfilerState& state)
+{
+    state.endTick    = ReadTick();
+    state.endNs      = SteadyNs();
+    state.hasCapture = true;
+}
+
+/// Rebuilds zones of one thread from its ring. Entries older than @p firstIndex are ignored.
+void CollectThreadLocked(const ThreadBuffer& buffer, uint64_t firstIndex, uint64_t beginTick, uint64_t endTick,
+                         std::vector<CpuZoneSample>& zones)
+{
+    if (!buffer.events)
+        return;
+
+    // Copy the slots below the published head, then drop whatever a concurrent writer may have
+    // overwritten meanwhile: the acquire fence pairs with the release fence in PushEvent, so any
+    // overwrite the copy saw is covered by headAfter.
+    const uint64_t head  = buffer.head.load(std::memory_order_acquire);
+    const uint64_t begin = std::max(firstIndex, head > CpuProfiler::kEventsPerThread ? head - CpuProfiler::kEventsPerThread : 0);
+    std::vector<ZoneEvent> events;
+    events.reserve(static_cast<size_t>(head - begin));
+    for (uint64_t i = begin; i < head; ++i)
+    {
+        const ZoneSlot& slot = buffer.events[i & kEventMask];
+        events.push_back({slot.tick.load(std::memory_order_relaxed), slot.name.load(std::memory_order_relaxed)});
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t headAfter = buffer.head.load(std::memory_order_relaxed);
+    const uint64_t valid     = headAfter >= CpuProfiler::kEventsPerThread ? headAfter - CpuProfiler::kEventsPerThread + 1 : 0;
+    const size_t skip        = static_cast<size_t>(std::min<uint64_t>(valid > begin ? valid - begin : 0, events.size()));
+
+    struct OpenZone
+    {
+        const char* name;
+        uint64_t tick;
+    };
+    std::vector<OpenZone> open;
+    for (size_t i = skip; i < events.size(); ++i)
+    {
+        const ZoneEvent& event = events[i];
+        if (event.tick < beginTick || event.tick > endTick)
+            continue;
+        if (event.name)
+        {
+            open.push_back({event.name, event.tick});
+        }
+        else if (!open.empty())
+        {
+            zones.push_back({buffer.tid, open.back().name, open.back().tick, event.tick});
+            open.pop_back();
+        }
+    }
+    while (!open.empty())
+    {
+        zones.push_back({buffer.tid, open.back().name, open.back().tick, endTick});
+        open.pop_back();
+    }
+}
+
+void CollectThreadInfoLocked(const ProfilerState& state, std::vector<CpuThreadInfo>& threads)
+{
+    for (const auto& buffer : state.threads)
+        threads.push_back({buffer->tid, buffer->name.empty() ? "Thread " + std::to_string(buffer->tid) : buffer->name});
+}
+} // namespace
+
+void CpuProfiler::UpdateRecording()
+{
+    s_recording.store(s_capturing.load(std::memory_order_relaxed) || s_flightRecording.load(std::memory_order_relaxed),
+                      std::memory_order_release);
+}
+
+void CpuProfiler::SetFlightRecording(bool enabled)
+{
+    auto& state = State();
+    std::scoped_lock lock(state.mutex);
+    s_flightRecording.store(enabled, std::memory_order_relaxed);
+    UpdateRecording();
+}
+
+void CpuProfiler::RequestCapture(uint32_t frames, std::string outputPath)
+{
+    auto& state = State();
+    std::scoped_lock lock(state.mutex);
+    state.requestedFrames = std::max<uint32_t>(frames, 1);
+    state.outputPath      = std::move(outputPath);
+    state.pending.store(true, std::memory_order_relaxed);
+}
+
+void CpuProfiler::StartCapture()
+{
+    auto& state = State();
+    std::scoped_lock lock(state.mutex);
+    if (s_capturing.load(std::memory_order_relaxed))
+        return;
+    state.framesRemaining = 0;
+    StartLocked(state);
+    s_capturing.store(true, std::memory_order_relaxed);
+    UpdateRecording();
+}
+
+void CpuProfiler::StopCapture()
+{
+    auto& state = State();
+    std::scoped_lock lock(state.mutex);
+    if (!s_capturing.load(std::memory_order_relaxed))
+        return;
+    s_capturing.store(false, std::memory_order_relaxed);
+    UpdateRecording();
+    StopLocked(state);
+}
+
+bool CpuProfiler::IsCapturePending() noexcept
+{
+    return State().pending.load(std::memory_order_relaxed);
+}
+
+void CpuProfiler::FrameBoundary() noexcept
+{
+    auto& state = State();
+    if (!s_capturing.load(std::memory_order_relaxed) && !state.pending.load(std::memory_order_relaxed))
+        return;
+
+    std::string exportPath;
+    {
+        std::scoped_lock lock(state.mutex);
+        if (s_capturing.load(std::memory_order_relaxed))
+        {
+            state.frameTicks.push_back(ReadTick());
+            if (state.framesRemaining > 0 && --state.framesRemaining == 0)
+            {
+                s_capturing.store(false, std::memory_order_relaxed);
+                UpdateRecording();
+                StopLocked(state);
+                exportPath = state.outputPath;
+            }
+        }
+        else if (state.pending.exchange(false, std::memory_order_relaxed))
+        {
+            state.framesRemaining = state.requestedFrames;
+            StartLocked(state);
+            state.frameTicks.push_back(state.startTick);
+            s_capturing.store(true, std::memory_order_relaxed);
+            UpdateRecording();
+        }
+    }
+
+    if (!exportPath.empty())
+    {
+        if (WriteChromeTrace(exportPath))
+            LT_LOGFI("Profiler", "CPU capture written to {}", exportPath);
+        else
+            LT_LOGFE("Profiler", "Failed to write CPU capture to {}", exportPath);
+    }
+}
+
+void CpuProfiler::SetThreadName(const char* name) noexcept
+{
+    try
+    {
+        ThreadBuffer& buffer = AcquireThreadBuffer(false);
+        std::scoped_lock lock(State().mutex);
+        buffer.name = name ? name : "";
+    }
+    catch (...)
+    {
+    }
+}
+
+void CpuProfiler::BeginZone(const char* name) noexcept
+{
+    PushEvent(name);
+}
+
+void CpuProfiler::EndZone() noexcept
+{
+    // Zones still open when recording stops are closed at the capture end by the exporter.
+    if (s_recording.load(std::memory_order_relaxed))
+        PushEvent(nullptr);
+}
+
+bool CpuProfiler::WriteChromeTrace(const std::string& path)
+{
+    std::ofstream file(path, std::ios::binary);
+    if (!file)
+        return false;
+    return WriteChromeTrace(file) && file.good();
+}
+
+uint64_t CpuProfiler::Now() noexcept
+{
+    return ReadTick();
+}
+
+double CpuProfiler::TicksPerMicrosecond() noexcept
+{
+#if LT_PROFILER_USE_TSC
+    const auto& state      = State();
+    const double elapsedUs = static_cast<double>(SteadyNs() - state.calibrationNs) / 1000.0;
+    const double ticks     = static_cast<double>(ReadTick() - state.calibrationTick);
+    return (elapsedUs > 0.0 && ticks > 0.0) ? ticks / elapsedUs : 1000.0;
+#else
+    return 1000.0;
+#endif
+}
+
+void CpuProfiler::CollectZones(uint64_t beginTick, uint64_t endTick, std::vector<CpuZoneSample>& zones,
+                               std::vector<CpuThreadInfo>& threads)
+{
+    auto& state = State();
+    std::scoped_lock lock(state.mutex);
+    CollectThreadInfoLocked(state, threads);
+    for (const auto& buffer : state.threads)
+        CollectThreadLocked(*buffer, 0, beginTick, endTick, zones);
+}
+
+bool CpuProfiler::WriteChromeTrace(std::ostream& out)
+{
+    auto& state = State();
+    std::scoped_lock lock(state.mutex);
+    if (!state.hasCapture)
+        return false;
+
+    const double elapsedUs  = static_cast<double>(state.endNs - state.startNs) / 1000.0;
+    const double ticks      = static_cast<double>(state.endTick - state.startTick);
+    const double ticksPerUs = (elapsedUs > 0.0 && ticks > 0.0) ? ticks / elapsedUs : 1000.0;
+    auto toUs = [&](uint64_t tick) {
+        return static_cast<double>(static_cast<int64_t>(tick - state.startTick)) / ticksPerUs;
+    };
+
+    std::vector<CpuThreadInfo> threads;
+    std::vector<CpuZoneSample> zones;
+    CollectThreadInfoLocked(state, threads);
+    for (const auto& buffer : state.threads)
+        CollectThreadLocked(*buffer, buffer->captureBegin, state.startTick, state.endTick, zones);
+
+    ChromeTraceWriter writer(out);
+    for (const auto& thread : threads)
+        writer.threadName(thread.tid, thread.name);
+    for (const auto& zone : zones)
+        writer.complete(zone.name, zone.tid, toUs(zone.beginTick), std::max(0.0, toUs(zone.endTick) - toUs(zone.beginTick)));
+
+    // Frames on their own track so slow frames are easy to spot.
+    constexpr uint32_t kFrameTrack = 0xFFFF;
+    writer.threadName(kFrameTrack, "Frames");
+    for (size_t i = 0; i + 1 < state.frameTicks.size(); ++i)
+    {
+        writer.complete("Frame " + std::to_string(i), kFrameTrack, toUs(state.frameTicks[i]),
+                        toUs(state.frameTicks[i + 1]) - toUs(state.frameTicks[i]));
+    }
+    return true;
+}
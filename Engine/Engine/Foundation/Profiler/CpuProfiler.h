@@ -0,0 +1,116 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace EngineCore::Foundation
+{
+/// One closed zone, in profiler ticks (see CpuProfiler::Now()).
+struct CpuZoneSample
+{
+    uint32_t tid;
+    const char* name;
+    uint64_t beginTick;
+    uint64_t endTick;
+};
+
+struct CpuThreadInfo
+{
+    uint32_t tid;
+    std::string name;
+};
+
+/**
+ * @brief Built-in CPU zone profiler with Chrome trace (Perfetto) export
+ *
+ * Works without Tracy: ZoneScopedN records into per-thread rings while a capture is running.
+ * Outside a capture a zone costs one relaxed atomic load.
+ *
+ * Usage: CpuProfiler::RequestCapture(120, "profile.json"); the capture starts at the next
+ * FrameBoundary(), stops after 120 frames and writes the trace. Open it in ui.perfetto.dev
+ * or chrome://tracing.
+ *
+ * Flight recording keeps the rings filled outside captures so recent history can be
+ * pulled with CollectZones() (see HitchRecorder).
+ */
+class CpuProfiler
+{
+  public:
+    static constexpr uint32_t kEventsPerThread = 1u << 16; ///< Ring size; older events are overwritten
+
+    /// Arms a capture of @p frames frames. An empty @p outputPath keeps the data for WriteChromeTrace().
+    static void RequestCapture(uint32_t frames, std::string outputPath = {});
+    /// Starts recording immediately (no frame limit) until StopCapture().
+    static void StartCapture();
+    static void StopCapture();
+
+    [[nodiscard]] static bool IsCapturing() noexcept
+    {
+        return s_capturing.load(std::memory_order_relaxed);
+    }
+    [[nodiscard]] static bool IsCapturePending() noexcept;
+
+    /// Zones record while a capture runs or flight recording is on.
+    [[nodiscard]] static bool IsRecording() noexcept
+    {
+        return s_recording.load(std::memory_order_relaxed);
+    }
+    static void SetFlightRecording(bool enabled);
+
+    /// Call once per frame from the main loop; drives RequestCapture() and emits frame markers.
+    static void FrameBoundary() noexcept;
+
+    /// Name shown for the calling thread in exported traces.
+    static void SetThreadName(const char* name) noexcept;
+
+    /// Writes the last capture as Chrome trace JSON. Returns false if nothing was captured.
+    static bool WriteChromeTrace(std::ostream& out);
+    static bool WriteChromeTrace(const std::string& path);
+
+    /// Current profiler tick (TSC where available).
+    [[nodiscard]] static uint64_t Now() noexcept;
+    /// Tick rate calibrated against steady_clock since process start.
+    [[nodiscard]] static double TicksPerMicrosecond() noexcept;
+
+    /// Zones that overlap [beginTick, endTick], read from the live rings. Zones still open at
+    /// @p endTick are clipped to it. Safe while other threads record; overwritten entries are dropped.
+    static void CollectZones(uint64_t beginTick, uint64_t endTick, std::vector<CpuZoneSample>& zones,
+                             std::vector<CpuThreadInfo>& threads);
+
+    // Hot path, used through CpuProfileZone. @p name must outlive the capture (string literal).
+    static void BeginZone(const char* name) noexcept;
+    static void EndZone() noexcept;
+
+  private:
+    static void UpdateRecording();
+
+    static std::atomic<bool> s_recording;
+    static std::atomic<bool> s_capturing;
+    static std::atomic<bool> s_flightRecording;
+};
+
+/// RAII zone; records only if the profiler was recording when it was opened.
+class CpuProfileZone
+{
+  public:
+    explicit CpuProfileZone(const char* name) noexcept : m_active(CpuProfiler::IsRecording())
+    {
+        if (m_active)
+            CpuProfiler::BeginZone(name);
+    }
+
+    ~CpuProfileZone()
+    {
+        if (m_active)
+            CpuProfiler::EndZone();
+    }
+
+    CpuProfileZone(const CpuProfileZone&)            = delete;
+    CpuProfileZone& operator=(const CpuProfileZone&) = delete;
+
+  private:
+    bool m_active;
+};
+} // namespace EngineCore::Foundation
@@ -0,0 +1,176 @@
+#include "FrameStats.h"
+#include "Foundation/Log/LoggerMacro.h"
+
+#include <algorithm>
+#include <cmath>
+#include <span>
+
+using namespace EngineCore::Foundation;
+
+namespace
+{
+constexpr std::array<std::string_view, FrameStats::kStageCount> kStageNames = {
+    "Frame", "AssetChanges", "Time", "ECS", "Physics", "Context", "Render", "ContextRender", "Swap"};
+
+constexpr size_t Index(FrameStage stage) noexcept
+{
+    return static_cast<size_t>(stage);
+}
+
+double NearestRank(std::span<const float> sorted, double percentile)
+{
+    if (sorted.empty())
+        return 0.0;
+    const double clamped = std::clamp(percentile, 0.0, 100.0);
+    const size_t rank    = static_cast<size_t>(std::ceil(clamped / 100.0 * static_cast<double>(sorted.size())));
+    return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+} // namespace
+
+FrameStats& FrameStats::Instance()
+{
+    static FrameStats instance;
+    return instance;
+}
+
+void FrameStats::record(FrameStage stage, double elapsedMs)
+{
+    if (stage >= FrameStage::Count)
+        return;
+
+    BudgetCallback callback;
+    double budgetMs = 0.0;
+    {
+        std::scoped_lock lock(m_mutex);
+        StageData& data              = m_stages[Index(stage)];
+        data.last                    = static_cast<float>(elapsedMs);
+        data.samples[data.head]      = data.last;
+        data.head                    = static_cast<uint32_t>((data.head + 1) % kWindowSize);
+        data.count                   = std::min<uint32_t>(data.count + 1, kWindowSize);
+        if (stage == FrameStage::Frame)
+            ++m_frameCount;
+
+        if (data.budgetMs <= 0.0 || elapsedMs <= data.budgetMs)
+            return;
+        ++data.overruns;
+        budgetMs = data.budgetMs;
+        callback = data.callback;
+    }
+
+    if (callback)
+        callback(stage, elapsedMs, budgetMs);
+    else
+        LT_LOGSW_LIMIT("FrameStats", 1, "{} took {:.2f} ms (budget {:.2f} ms)", StageName(stage), elapsedMs, budgetMs);
+}
+
+void FrameStats::setBudget(FrameStage stage, double budgetMs, BudgetCallback callback)
+{
+    if (stage >= FrameStage::Count)
+        return;
+    std::scoped_lock lock(m_mutex);
+    StageData& data = m_stages[Index(stage)];
+    data.budgetMs   = std::max(budgetMs, 0.0);
+    data.callback   = data.budgetMs > 0.0 ? std::move(callback) : BudgetCallback{};
+    data.overruns   = 0;
+}
+
+void FrameStats::clearBudget(FrameStage stage)
+{
+    setBudget(stage, 0.0);
+}
+
+std::vector<float> FrameStats::sortedWindowLocked(const StageData& data) const
+{
+    std::vector<float> sorted(data.samples.begin(), data.samples.begin() + data.count);
+    std::sort(sorted.begin(), sorted.end());
+    return sorted;
+}
+
+FrameStageSummary FrameStats::getSummary(FrameStage stage) const
+{
+    FrameStageSummary summary;
+    if (stage >= FrameStage::Count)
+        return summary;
+
+    std::scoped_lock lock(m_mutex);
+    const StageData& data = m_stages[Index(stage)];
+    summary.lastMs        = data.last;
+    summary.budgetMs      = data.budgetMs;
+    summary.samples       = data.count;
+    summary.overruns      = data.overruns;
+    if (data.count == 0)
+        return summary;
+
+    // Sorted on the stack: the metrics exporter polls this from its thread and must not allocate.
+    std::array<float, kWindowSize> window;
+    std::copy_n(data.samples.begin(), data.count, window.begin());
+    const std::span<float> sorted(window.data(), data.count);
+    std::sort(sorted.begin(), sorted.end());
+    double total = 0.0;
+    for (float sample : sorted)
+        total += sample;
+
+    summary.p50Ms = NearestRank(sorted, 50.0);
+    summary.p95Ms = NearestRank(sorted, 95.0);
+    summary.p99Ms = NearestRank(sorted, 99.0);
+    summary.maxMs = sorted.back();
+    summary.avgMs = total / static_cast<double>(sorted.size());
+    return summary;
+}
+
+double FrameStats::getPercentile(FrameStage stage, double percentile) const
+{
+    if (stage >= FrameStage::Count)
+        return 0.0;
+    std::scoped_lock lock(m_mutex);
+    return NearestRank(sortedWindowLocked(m_stages[Index(stage)]), percentile);
+}
+
+std::vector<float> FrameStats::getHistory(FrameStage stage) const
+{
+    std::vector<float> history;
+    if (stage >= FrameStage::Count)
+        return history;
+
+    std::scoped_lock lock(m_mutex);
+    const StageData& data = m_stages[Index(stage)];
+    history.reserve(data.count);
+    const size_t first = (data.head + kWindowSize - data.count) % kWindowSize;
+    for (size_t i = 0; i < data.count; ++i)
+        history.push_back(data.samples[(first + i) % kWindowSize]);
+    return history;
+}
+
+uint64_t FrameStats::getFrameCount() const
+{
+    std::scoped_lock lock(m_mutex);
+    return m_frameCount;
+}
+
+void FrameStats::reset()
+{
+    std::scoped_lock lock(m_mutex);
+    for (StageData& data : m_stages)
+    {
+        data.head     = 0;
+        data.count    = 0;
+        data.last     = 0.0f;
+        data.overruns = 0;
+    }
+    m_frameCount = 0;
+}
+
+std::string_view FrameStats::StageName(FrameStage stage) noexcept
+{
+    return stage < FrameStage::Count ? kStageNames[Index(stage)] : std::string_view("Unknown");
+}
+
+std::optional<FrameStage> FrameStats::ParseStage(std::string_view name) noexcept
+{
+    for (size_t i = 0; i < kStageNames.size(); ++i)
+    {
+        if (kStageNames[i] == name)
+            return static_cast<FrameStage>(i);
+    }
+    return std::nullopt;
+}
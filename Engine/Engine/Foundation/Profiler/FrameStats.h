@@ -0,0 +1,123 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace EngineCore::Foundation
+{
+/// Stages of Application::engineTick tracked by FrameStats. Frame is the whole loop iteration.
+enum class FrameStage : uint8_t
+{
+    Frame = 0,
+    AssetChanges,
+    Time,
+    ECS,
+    Physics,
+    Context,
+    Render,
+    ContextRender,
+    Swap,
+    Count
+};
+
+/// Percentiles over the current rolling window, in milliseconds.
+struct FrameStageSummary
+{
+    double p50Ms       = 0.0;
+    double p95Ms       = 0.0;
+    double p99Ms       = 0.0;
+    double maxMs       = 0.0;
+    double avgMs       = 0.0;
+    double lastMs      = 0.0;
+    double budgetMs    = 0.0; ///< 0 when no budget is set
+    uint32_t samples   = 0;
+    uint64_t overruns  = 0;   ///< Samples over budget since the budget was set
+};
+
+/**
+ * @brief Rolling frame and per-stage timing statistics
+ *
+ * The main loop records one sample per stage per frame into a fixed window of the last
+ * kWindowSize frames; queries report tail percentiles over that window. Budgets fire a
+ * callback (or a rate-limited warning) for every sample that exceeds them.
+ */
+class FrameStats
+{
+  public:
+    static constexpr size_t kWindowSize = 512;
+    static constexpr size_t kStageCount = static_cast<size_t>(FrameStage::Count);
+
+    /// Invoked on the recording thread, outside the internal lock.
+    using BudgetCallback = std::function<void(FrameStage stage, double elapsedMs, double budgetMs)>;
+
+    static FrameStats& Instance();
+
+    FrameStats() = default;
+    FrameStats(const FrameStats&)            = delete;
+    FrameStats& operator=(const FrameStats&) = delete;
+
+    void record(FrameStage stage, double elapsedMs);
+
+    /// An empty @p callback logs a rate-limited warning instead. @p budgetMs <= 0 clears the budget.
+    void setBudget(FrameStage stage, double budgetMs, BudgetCallback callback = {});
+    void clearBudget(FrameStage stage);
+
+    [[nodiscard]] FrameStageSummary getSummary(FrameStage stage) const;
+    /// @p percentile in [0, 100]; nearest-rank over the window.
+    [[nodiscard]] double getPercentile(FrameStage stage, double percentile) const;
+    /// Copy of the window in recording order (oldest first), for plotting.
+    [[nodiscard]] std::vector<float> getHistory(FrameStage stage) const;
+    [[nodiscard]] uint64_t getFrameCount() const;
+
+    void reset();
+
+    [[nodiscard]] static std::string_view StageName(FrameStage stage) noexcept;
+    [[nodiscard]] static std::optional<FrameStage> ParseStage(std::string_view name) noexcept;
+
+  private:
+    struct StageData
+    {
+        std::array<float, kWindowSize> samples{};
+        uint32_t head     = 0;
+        uint32_t count    = 0;
+        float last        = 0.0f;
+        double budgetMs   = 0.0;
+        uint64_t overruns = 0;
+        BudgetCallback callback;
+    };
+
+    std::vector<float> sortedWindowLocked(const StageData& data) const;
+
+    mutable std::mutex m_mutex;
+    std::array<StageData, kStageCount> m_stages{};
+    uint64_t m_frameCount = 0;
+};
+
+/// RAII timer that records the scope duration into FrameStats::Instance().
+class FrameStageTimer
+{
+  public:
+    explicit FrameStageTimer(FrameStage stage) noexcept
+        : m_stage(stage), m_start(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~FrameStageTimer()
+    {
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - m_start;
+        FrameStats::Instance().record(m_stage, elapsed.count());
+    }
+
+    FrameStageTimer(const FrameStageTimer&)            = delete;
+    FrameStageTimer& operator=(const FrameStageTimer&) = delete;
+
+  private:
+    FrameStage m_stage;
+    std::chrono::steady_clock::time_point m_start;
+};
+} // namespace EngineCore::Foundation
@@ -0,0 +1,382 @@
+#include "HitchRecorder.h"
+#include "ChromeTraceWriter.h"
+#include "CpuProfiler.h"
+#include "Foundation/Log/LoggerMacro.h"
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace EngineCore::Foundation;
+
+std::atomic<bool> HitchRecorder::s_enabled{false};
+std::array<HitchRecorder::PaddedCounter, static_cast<size_t>(HitchCounter::Count)> HitchRecorder::s_counters{};
+
+namespace
+{
+constexpr size_t kCounterCount = static_cast<size_t>(HitchCounter::Count);
+constexpr std::array<const char*, kCounterCount> kCounterNames = {"Allocations", "Events", "Jobs", "Log lines"};
+const char* const kVerbosityNames[] = {"Verbose", "Debug", "Info", "Warning", "Error", "Fatal"};
+
+constexpr uint32_t kFrameTrack = 0xFFFF;
+constexpr uint32_t kLogTrack   = 0xFFFE;
+
+struct FrameRecord
+{
+    uint64_t index;
+    uint64_t beginTick;
+    uint64_t endTick;
+    double ms;
+    std::array<uint64_t, kCounterCount> counts;
+};
+
+struct LogLine
+{
+    uint64_t tick;
+    LogVerbosity level;
+    std::string category;
+    std::string message;
+};
+
+/// Keeps the most recent log lines for dumps.
+class HitchLogSink final : public ILogSink
+{
+  public:
+    explicit HitchLogSink(size_t capacity) : m_capacity(std::max<size_t>(capacity, 1))
+    {
+    }
+
+    void write(LogVerbosity level, const std::string& category, const std::string& message) override
+    {
+        HitchRecorder::Count(HitchCounter::LogLines);
+        std::scoped_lock lock(m_mutex);
+        if (m_lines.size() == m_capacity)
+            m_lines.pop_front();
+        m_lines.push_back({CpuProfiler::Now(), level, category, message});
+    }
+
+    std::vector<LogLine> snapshot(uint64_t sinceTick)
+    {
+        std::scoped_lock lock(m_mutex);
+        std::vector<LogLine> lines;
+        for (const auto& line : m_lines)
+        {
+            if (line.tick >= sinceTick)
+                lines.push_back(line);
+        }
+        return lines;
+    }
+
+  private:
+    const size_t m_capacity;
+    std::mutex m_mutex;
+    std::deque<LogLine> m_lines;
+};
+
+struct RecorderState
+{
+    std::mutex mutex;
+    HitchRecorderConfig config;
+    std::deque<FrameRecord> frames;
+    std::array<uint64_t, kCounterCount> lastCounts{};
+    uint64_t frameIndex    = 0;
+    uint64_t lastTick      = 0;
+    int64_t lastNs         = 0;
+    int64_t lastDumpNs     = 0;
+    uint64_t hitchCount    = 0;
+    std::string lastDumpPath;
+    std::shared_ptr<HitchLogSink> logSink;
+
+    std::mutex writerMutex; ///< Guards writer; taken before mutex when both are needed
+    std::thread writer;     ///< Writes the dump of the last hitch
+    std::atomic<bool> writing{false};
+};
+
+/// Everything a dump contains, copied out of the recorder and profiler rings.
+struct HitchHistory
+{
+    std::vector<FrameRecord> frames;
+    std::vector<CpuZoneSample> zones;
+    std::vector<CpuThreadInfo> threads;
+    std::vector<LogLine> logLines;
+    bool hasLog = false;
+};
+
+RecorderState& State()
+{
+    static RecorderState* state = new RecorderState();
+    return *state;
+}
+
+int64_t SteadyNs() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+bool CaptureHistory(HitchHistory& history)
+{
+    auto& state = State();
+    std::shared_ptr<HitchLogSink> sink;
+    {
+        std::scoped_lock lock(state.mutex);
+        history.frames.assign(state.frames.begin(), state.frames.end());
+        sink = state.logSink;
+    }
+    if (history.frames.empty())
+        return false;
+
+    const uint64_t beginTick = history.frames.front().beginTick;
+    const uint64_t endTick   = history.frames.back().endTick;
+    CpuProfiler::CollectZones(beginTick, endTick, history.zones, history.threads);
+    if (sink)
+    {
+        history.hasLog   = true;
+        history.logLines = sink->snapshot(beginTick);
+        std::erase_if(history.logLines, [endTick](const LogLine& line) { return line.tick > endTick; });
+    }
+    return true;
+}
+
+void WriteHistory(std::ostream& out, const HitchHistory& history)
+{
+    const uint64_t beginTick = history.frames.front().beginTick;
+    const double ticksPerUs  = CpuProfiler::TicksPerMicrosecond();
+    auto toUs = [&](uint64_t tick) {
+        return static_cast<double>(static_cast<int64_t>(tick - beginTick)) / ticksPerUs;
+    };
+
+    ChromeTraceWriter writer(out);
+    for (const auto& thread : history.threads)
+        writer.threadName(thread.tid, thread.name);
+    for (const auto& zone : history.zones)
+        writer.complete(zone.name, zone.tid, toUs(zone.beginTick), std::max(0.0, toUs(zone.endTick) - toUs(zone.beginTick)));
+
+    writer.threadName(kFrameTrack, "Frames");
+    for (const auto& frame : history.frames)
+    {
+        const double ts = toUs(frame.beginTick);
+        writer.complete("Frame " + std::to_string(frame.index), kFrameTrack, ts, toUs(frame.endTick) - ts);
+        for (size_t i = 0; i < kCounterCount; ++i)
+            writer.counter(kCounterNames[i], ts, "per frame", static_cast<double>(frame.counts[i]));
+    }
+
+    if (history.hasLog)
+    {
+        writer.threadName(kLogTrack, "Log");
+        for (const auto& line : history.logLines)
+            writer.instant(line.category, kLogTrack, toUs(line.tick), kVerbosityNames[static_cast<size_t>(line.level)],
+                           line.message);
+    }
+}
+
+std::filesystem::path DumpPath(double frameMs)
+{
+    auto& state = State();
+    std::scoped_lock lock(state.mutex);
+    const uint64_t frame = state.frames.empty() ? 0 : state.frames.back().index;
+    return std::filesystem::path(state.config.directory) /
+           ("hitch_" + std::to_string(frame) + "_" + std::to_string(static_cast<int>(frameMs)) + "ms.json");
+}
+
+bool WriteDumpFile(const std::filesystem::path& path, const HitchHistory& history)
+{
+    std::error_code ec;
+    if (path.has_parent_path())
+        std::filesystem::create_directories(path.parent_path(), ec);
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file)
+        return false;
+    WriteHistory(file, history);
+    if (!file.good())
+        return false;
+
+    auto& state = State();
+    std::scoped_lock lock(state.mutex);
+    state.lastDumpPath = path.string();
+    return true;
+}
+
+/// Joins the previous writer if it is done; false while it is still writing. Caller holds writerMutex.
+bool ReapWriter(RecorderState& state)
+{
+    if (state.writing.load(std::memory_order_acquire))
+        return false;
+    if (state.writer.joinable())
+        state.writer.join();
+    return true;
+}
+} // namespace
+
+void HitchRecorder::Enable(HitchRecorderConfig config)
+{
+    auto& state = State();
+    std::shared_ptr<HitchLogSink> sink;
+    const uint32_t frames   = std::max<uint32_t>(config.frames, 1);
+    const double budgetMs   = config.budgetMs;
+    const std::string where = config.directory;
+    {
+        std::scoped_lock lock(state.mutex);
+        if (IsEnabled())
+            return;
+        config.frames = frames;
+        state.config  = std::move(config);
+        state.frames.clear();
+        state.lastNs     = 0;
+        state.lastDumpNs = 0;
+        state.logSink    = std::make_shared<HitchLogSink>(state.config.logLines);
+        sink             = state.logSink;
+        for (size_t i = 0; i < kCounterCount; ++i)
+            state.lastCounts[i] = s_counters[i].value.load(std::memory_order_relaxed);
+        s_enabled.store(true, std::memory_order_relaxed);
+    }
+    GetLogger().addSink(sink);
+    CpuProfiler::SetFlightRecording(true);
+    LT_LOGFI("HitchRecorder", "Recording the last {} frames; frames over {:.1f} ms are dumped to {}", frames,
+             budgetMs, where);
+}
+
+void HitchRecorder::Disable()
+{
+    auto& state = State();
+    std::shared_ptr<HitchLogSink> sink;
+    {
+        std::scoped_lock lock(state.mutex);
+        if (!IsEnabled())
+            return;
+        s_enabled.store(false, std::memory_order_relaxed);
+        sink = std::move(state.logSink);
+    }
+    WaitForDump();
+    CpuProfiler::SetFlightRecording(false);
+    GetLogger().removeSink(sink);
+}
+
+void HitchRecorder::FrameBoundary() noexcept
+{
+    if (!IsEnabled())
+        return;
+
+    try
+    {
+        auto& state         = State();
+        const uint64_t tick = CpuProfiler::Now();
+        const int64_t ns    = SteadyNs();
+        double hitchMs      = 0.0;
+        {
+            std::scoped_lock lock(state.mutex);
+            std::array<uint64_t, kCounterCount> counts{};
+            for (size_t i = 0; i < kCounterCount; ++i)
+                counts[i] = s_counters[i].value.load(std::memory_order_relaxed);
+
+            if (state.lastNs != 0)
+            {
+                FrameRecord frame{state.frameIndex++, state.lastTick, tick, static_cast<double>(ns - state.lastNs) / 1e6, {}};
+                for (size_t i = 0; i < kCounterCount; ++i)
+                    frame.counts[i] = counts[i] - state.lastCounts[i];
+                if (state.frames.size() == state.config.frames)
+                    state.frames.pop_front();
+                state.frames.push_back(frame);
+
+                const auto cooldownNs = static_cast<int64_t>(state.config.cooldownSeconds * 1e9);
+                if (frame.ms > state.config.budgetMs && (state.lastDumpNs == 0 || ns - state.lastDumpNs >= cooldownNs))
+                {
+                    hitchMs          = frame.ms;
+                    state.lastDumpNs = ns;
+                    ++state.hitchCount;
+                }
+            }
+            state.lastCounts = counts;
+            state.lastTick   = tick;
+            state.lastNs     = ns;
+        }
+
+        if (hitchMs > 0.0)
+        {
+            // The history is copied here, while it still describes the slow frame; encoding and
+            // file I/O happen on a writer thread so the dump cannot cause the next hitch.
+            auto& state = State();
+            std::scoped_lock writerLock(state.writerMutex);
+            if (!ReapWriter(state))
+            {
+                LT_LOGW("HitchRecorder", "Previous hitch dump is still being written; this hitch is not dumped");
+                return;
+            }
+            auto history = std::make_shared<HitchHistory>();
+            if (!CaptureHistory(*history))
+                return;
+            const std::filesystem::path path = DumpPath(hitchMs);
+
+            state.writing.store(true, std::memory_order_release);
+            try
+            {
+                state.writer = std::thread([history, path, hitchMs]() {
+                    if (WriteDumpFile(path, *history))
+                        LT_LOGFW("HitchRecorder", "Frame took {:.2f} ms, history written to {}", hitchMs,
+                                 path.string());
+                    else
+                        LT_LOGFE("HitchRecorder", "Failed to write hitch trace to {}", path.string());
+                    State().writing.store(false, std::memory_order_release);
+                });
+            }
+            catch (...)
+            {
+                state.writing.store(false, std::memory_order_release);
+                throw;
+            }
+        }
+    }
+    catch (...)
+    {
+    }
+}
+
+bool HitchRecorder::WriteTrace(std::ostream& out)
+{
+    HitchHistory history;
+    if (!CaptureHistory(history))
+        return false;
+    WriteHistory(out, history);
+    return true;
+}
+
+std::string HitchRecorder::Dump(double frameMs)
+{
+    HitchHistory history;
+    const std::filesystem::path path = DumpPath(frameMs);
+    if (!CaptureHistory(history) || !WriteDumpFile(path, history))
+    {
+        LT_LOGFE("HitchRecorder", "Failed to write hitch trace to {}", path.string());
+        return {};
+    }
+    return path.string();
+}
+
+void HitchRecorder::WaitForDump()
+{
+    auto& state = State();
+    std::scoped_lock writerLock(state.writerMutex);
+    if (state.writer.joinable())
+        state.writer.join();
+}
+
+uint64_t HitchRecorder::GetHitchCount() noexcept
+{
+    auto& state = State();
+    std::scoped_lock lock(state.mutex);
+    return state.hitchCount;
+}
+
+std::string HitchRecorder::GetLastDumpPath()
+{
+    auto& state = State();
+    std::scoped_lock lock(state.mutex);
+    return state.lastDumpPath;
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace EngineCore::Foundation
+{
+/// Per-frame activity counters kept by the hitch recorder.
+enum class HitchCounter : uint8_t
+{
+    Allocations, ///< ProfileAllocator / tracked global allocations
+    Events,      ///< EventBus::emit calls
+    Jobs,        ///< JobSystem::submit calls
+    LogLines,    ///< Log records reaching the sinks
+    Count
+};
+
+struct HitchRecorderConfig
+{
+    double budgetMs        = 50.0;      ///< A frame longer than this triggers a dump
+    uint32_t frames        = 120;       ///< Frames of history written per dump
+    std::string directory  = "Hitches"; ///< Dumps go to <directory>/hitch_<frame>_<ms>ms.json
+    double cooldownSeconds = 10.0;      ///< Minimum time between two automatic dumps
+    uint32_t logLines      = 256;       ///< Log lines of history kept
+};
+
+/**
+ * @brief Always-on flight recorder that dumps the last N frames when a frame blows its budget
+ *
+ * While enabled the CpuProfiler keeps recording zones into its rings (flight recording), and
+ * the recorder tracks per-frame counters and recent log lines. When FrameBoundary() sees a
+ * slow frame, it copies the history and a writer thread saves it as a Chrome trace next to
+ * the zones of those frames; a hitch while the previous dump is still being written is counted
+ * but not dumped.
+ * Per-thread rings are finite, so very busy threads may have lost their oldest frames.
+ */
+class HitchRecorder
+{
+  public:
+    static void Enable(HitchRecorderConfig config = {});
+    static void Disable();
+
+    [[nodiscard]] static bool IsEnabled() noexcept
+    {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    /// Hot path; one relaxed load when disabled.
+    static void Count(HitchCounter counter, uint64_t amount = 1) noexcept
+    {
+        if (IsEnabled())
+            s_counters[static_cast<size_t>(counter)].value.fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    /// Call once per frame from the main loop; measures the frame that just ended.
+    static void FrameBoundary() noexcept;
+
+    /// Writes the recorded history (up to now) as Chrome trace JSON. False if nothing was recorded.
+    static bool WriteTrace(std::ostream& out);
+    /// Writes the history to a new file in the configured directory and returns its path (empty on failure).
+    static std::string Dump(double frameMs = 0.0);
+    /// Blocks until the dump started by the last hitch is on disk.
+    static void WaitForDump();
+
+    [[nodiscard]] static uint64_t GetHitchCount() noexcept;
+    [[nodiscard]] static std::string GetLastDumpPath();
+
+  private:
+    struct alignas(64) PaddedCounter
+    {
+        std::atomic<uint64_t> value{0};
+    };
+
+    static std::atomic<bool> s_enabled;
+    static std::array<PaddedCounter, static_cast<size_t>(HitchCounter::Count)> s_counters;
+};
+} // namespace EngineCore::Foundation
@@ -1,4 +1,5 @@
 #include "Profiler.h"
+#include "HitchRecorder.h"
 #ifdef TRACY_ENABLE
 #include <tracy/Tracy.hpp>
 // TracyOpenGL.hpp removed - Profiler.cpp doesn't use GPU profiling functions
@@ -34,6 +35,7 @@ void Profiler::BeginZone(const char *name) noexcept
 
 void Profiler::Alloc(const void *ptr, std::size_t size, const char *name) noexcept
 {
+    HitchRecorder::Count(HitchCounter::Allocations);
 #ifdef TRACY_ENABLE
     if (name)
         TracyAllocN(ptr, size, name);
@@ -1,3 +1,39 @@
+#pragma once
 #ifdef TRACY_ENABLE
 #include <tracy/Tracy.hpp>
-#endif
\ No newline at end of file
+#endif
+#include "CpuProfiler.h"
+
+#define LT_PROFILE_CONCAT_INNER(a, b) a##b
+#define LT_PROFILE_CONCAT(a, b) LT_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef TRACY_ENABLE
+#define LT_PROFILE_TRACY_ZONE(var, name) ZoneNamedN(var, name, true)
+#define LT_PROFILE_TRACY_FUNCTION_ZONE(var) ZoneNamed(var, true)
+#else
+#define LT_PROFILE_TRACY_ZONE(var, name) static_cast<void>(0)
+#define LT_PROFILE_TRACY_FUNCTION_ZONE(var) static_cast<void>(0)
+#endif
+
+// Scoped zone for both Tracy (when enabled) and the built-in CpuProfiler. @p name must be a string literal.
+#define LT_PROFILE_ZONE(name)                                                                                      \
+    LT_PROFILE_TRACY_ZONE(LT_PROFILE_CONCAT(lt_tracyZone_, __LINE__), name);                                       \
+    ::EngineCore::Foundation::CpuProfileZone LT_PROFILE_CONCAT(lt_cpuZone_, __LINE__)(name)
+
+// Existing ZoneScopedN/ZoneScoped call sites feed both profilers. The Tracy variable keeps its
+// usual name so ZoneText and friends still work.
+#undef ZoneScopedN
+#define ZoneScopedN(name)                                                                                          \
+    LT_PROFILE_TRACY_ZONE(___tracy_scoped_zone, name);                                                             \
+    ::EngineCore::Foundation::CpuProfileZone LT_PROFILE_CONCAT(lt_cpuZone_, __LINE__)(name)
+#undef ZoneScoped
+#define ZoneScoped                                                                                                 \
+    LT_PROFILE_TRACY_FUNCTION_ZONE(___tracy_scoped_zone);                                                          \
+    ::EngineCore::Foundation::CpuProfileZone LT_PROFILE_CONCAT(lt_cpuZone_, __LINE__)(__func__)
+
+// Without Tracy the remaining instrumentation compiles away.
+#ifndef TRACY_ENABLE
+#define FrameMark
+#define TracyMessage(text, size) static_cast<void>(0)
+#define ZoneText(text, size) static_cast<void>(0)
+#endif
@@ -3,6 +3,7 @@
 #include <optional>
 #include <memory>
 
+#include <Foundation/Math/Math.h>
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -38,10 +39,14 @@ struct RotationComponent {
 
     glm::quat toQuat() const noexcept {
         if (qx==0 && qy==0 && qz==0 && qw==1) {
-		glm::quat qy_ = glm::angleAxis(glm::radians(y), glm::vec3(0.f, 1.f, 0.f));
-		glm::quat qx_ = glm::angleAxis(glm::radians(x), glm::vec3(1.f, 0.f, 0.f));
-		glm::quat qz_ = glm::angleAxis(glm::radians(z), glm::vec3(0.f, 0.f, 1.f));
-            return glm::normalize(qy_ * qx_ * qz_);
+            // angleAxis(y, Y) * angleAxis(x, X) * angleAxis(z, Z), expanded: each factor has
+            // two zero components, so most of the two quaternion products drop out.
+            const float hx = glm::radians(x) * 0.5f, hy = glm::radians(y) * 0.5f, hz = glm::radians(z) * 0.5f;
+            const float sx = glm::sin(hx), cx = glm::cos(hx);
+            const float sy = glm::sin(hy), cy = glm::cos(hy);
+            const float sz = glm::sin(hz), cz = glm::cos(hz);
+            const float w1 = cy * cx, x1 = cy * sx, y1 = sy * cx, z1 = -(sy * sx);
+            return glm::normalize(glm::quat(w1 * cz - z1 * sz, x1 * cz + y1 * sz, y1 * cz - x1 * sz, w1 * sz + z1 * cz));
         }
         return glm::normalize(glm::quat(qw, qx, qy, qz));
     }
@@ -92,16 +97,11 @@ struct TransformComponent {
         : position(pos), rotation(rot), scale(scl) {}
 
     glm::mat4 toMatrix() const noexcept {
-        glm::mat4 translation = glm::translate(glm::mat4(1.0f), position.toGLMVec());
-        glm::mat4 rotationMat = glm::mat4_cast(rotation.toQuat());
-        glm::mat4 scaleMat = glm::scale(glm::mat4(1.0f), scale.toGLMVec());
-        return translation * rotationMat * scaleMat;
+        return Math::TRS(position.toGLMVec(), rotation.toQuat(), scale.toGLMVec());
     }
 
     glm::mat4 toMatrixNoScale() const noexcept {
-        glm::mat4 translation = glm::translate(glm::mat4(1.0f), position.toGLMVec());
-        glm::mat4 rotationMat = glm::mat4_cast(rotation.toQuat());
-        return translation * rotationMat;
+        return Math::TRS(position.toGLMVec(), rotation.toQuat(), glm::vec3(1.0f));
     }
 
     static TransformComponent FromTRS(const glm::vec3& pos,
@@ -115,6 +115,48 @@ struct TransformComponent {
     }
 };
 
+// World-space matrix of a TransformComponent. Parents are flecs ChildOf pairs; the matrix is
+// parent world * local and is kept up to date by ECSModule::TransformHierarchy. Added along with
+// TransformComponent, read-only for everything else.
+struct WorldTransformComponent {
+    glm::mat4 matrix{1.0f};
+
+    glm::vec3 position() const noexcept {
+        return glm::vec3(matrix[3]);
+    }
+
+    // Rotation with the scale taken out; not meaningful under mirroring scales.
+    glm::quat rotation() const noexcept {
+        return glm::quat_cast(glm::mat3(glm::normalize(glm::vec3(matrix[0])),
+                                        glm::normalize(glm::vec3(matrix[1])),
+                                        glm::normalize(glm::vec3(matrix[2]))));
+    }
+
+    // World pose -> pose relative to this transform, e.g. a physics result for a child entity.
+    void toLocal(glm::vec3& pos, glm::quat& rot) const noexcept {
+        pos = glm::vec3(glm::inverse(matrix) * glm::vec4(pos, 1.0f));
+        rot = glm::normalize(glm::inverse(rotation()) * rot);
+    }
+};
+
+// World pose of an entity from its own transform and its parent's cached world matrix. The
+// entity's own WorldTransformComponent is refreshed after the frame's systems ran, so it would
+// lag a frame behind a transform written this frame (or be identity for a new entity).
+inline void GetWorldPose(const flecs::entity& entity, const TransformComponent& local, glm::vec3& pos, glm::quat& rot) {
+    const flecs::entity parent = entity.parent();
+    if (parent.is_valid()) {
+        if (const auto* parentWorld = parent.get<WorldTransformComponent>()) {
+            WorldTransformComponent world;
+            world.matrix = parentWorld->matrix * local.toMatrix();
+            pos = world.position();
+            rot = world.rotation();
+            return;
+        }
+    }
+    pos = local.position.toGLMVec();
+    rot = local.rotation.toQuat();
+}
+
 inline TransformComponent& EnsureTransformComponent(flecs::entity& entity) {
     if (!entity.has<TransformComponent>()) {
         entity.set<TransformComponent>(TransformComponent{});
@@ -178,6 +220,14 @@ struct MeshComponent
     ResourceModule::AssetID fragShaderID;
 };
 
+// Local-space box of an entity, from its mesh AABB or collider shape. Entities with bounds and a
+// transform are kept in the world's ECSModule::SpatialIndex.
+struct BoundsComponent
+{
+    glm::vec3 min = glm::vec3(-0.5f);
+    glm::vec3 max = glm::vec3(0.5f);
+};
+
 struct PointLightComponent
 {
 	float innerRadius = 0.0f;  
@@ -199,3 +249,6 @@ struct MaterialComponent
 // Tags
 struct EditorOnlyTag {};
 struct InvisibleTag{};
+// Added to a component's own entity, not to entities: marks the component for replication
+// snapshots (Replication/ReplicationServer.h). The component needs reflection members.
+struct ReplicatedTag {};
@@ -3,6 +3,7 @@
 #include "ComponentRegistry.h"
 #include "Components/ECSComponents.h"
 #include "Events.h"
+#include "FlecsJobBridge.h"
 #include "Systems/ECSLuaScriptsSystem.h"
 #include "Systems/ECSPhysicsSystem.h"
 #include "Editor/Modules/EditorGuiModule/Events.h"
@@ -15,11 +16,15 @@
 #include <Modules/PhysicsModule/Components/ColliderComponent.h>
 #include <Modules/PhysicsModule/Components/CharacterControllerComponent.h>
 #include <Modules/PhysicsModule/Components/PhysicsMaterialComponent.h>
+#include <Modules/PhysicsModule/Systems/PhysicsSnapshotSync.h>
 #include <Modules/ProjectModule/ProjectModule.h>
 #include <Modules/ResourceModule/ResourceManager.h>
 #include <Modules/ResourceModule/RWorld.h>
+#include <Modules/TimeModule/TimeModule.h>
 #include <glm/fwd.hpp>
 
+#include <cctype>
+
 namespace ECSModule
 {
 void ECSModule::startup()
@@ -33,6 +38,19 @@ void ECSModule::startup()
 
     m_worldManager = std::make_unique<WorldManager>(res, scripts, physics);
 
+    auto jobs = Core::Locator().tryGet<JobSystem>();
+    m_worldManager->setJobSystem(jobs.get());
+    m_saver = std::make_unique<WorldSaver>(jobs.get());
+    if (m_taskThreads != 0)
+    {
+        if (FlecsJobBridge::Install(jobs.get()))
+        {
+            const auto stages = m_taskThreads < 0 ? static_cast<int32_t>(FlecsJobBridge::StageCount()) : m_taskThreads;
+            m_worldManager->setTaskThreads(stages);
+            LT_LOGFI("ECSModule", "Multi-threaded systems use {} stages", stages);
+        }
+    }
+
     createWorld("Default");
     openBasicWorld();
 
@@ -130,8 +148,32 @@ void ECSModule::shutdown()
 {
     ZoneScopedN("ECSModule::shutdown");
     LT_LOGI("ECSModule", "Shutdown");
+    m_saver.reset();
+    stopJournal();
+    m_streamer.reset();
     m_worldManager->clear();
     m_worldManager.reset();
+    FlecsJobBridge::Uninstall();
+}
+
+void ECSModule::applyConfig(const ECSModuleConfig &config)
+{
+    if (config.taskThreads.has_value())
+    {
+        m_taskThreads = *config.taskThreads;
+    }
+    if (config.streaming.has_value())
+    {
+        m_streamingConfig = *config.streaming;
+        if (m_streamer)
+            m_streamer->configure(m_streamingConfig);
+    }
+    if (config.autosave.has_value())
+    {
+        m_autosaveConfig = *config.autosave;
+        if (m_autosaveConfig.intervalSeconds <= 0.0f)
+            stopJournal();
+    }
 }
 
 EntityWorld *ECSModule::getCurrentWorld()
@@ -153,6 +195,10 @@ EntityWorld &ECSModule::createWorld(const std::string &name)
 void ECSModule::closeWorld(const std::string &name)
 {
     ZoneScopedN("ECSModule::closeWorld");
+    if (m_streamer && name == m_streamedWorld)
+        m_streamer.reset();
+    if (m_journal && name == m_journaledWorld)
+        stopJournal();
     m_worldManager->destroyWorld(name);
     GCEB().emit(Events::ECS::WorldClosed{name});
 }
@@ -168,6 +214,18 @@ void ECSModule::openBasicWorld()
 void ECSModule::openWorldByResource(const std::string &guid)
 {
     ZoneScopedN("ECSModule::openWorldByResource");
+    if (std::filesystem::path(guid).extension() == ".lpartition")
+    {
+        std::filesystem::path manifest(guid);
+        if (manifest.is_relative())
+        {
+            const auto &project = GCXM(ProjectModule::ProjectModule)->getProjectConfig();
+            manifest = std::filesystem::path(project.getResourcesPath()) / manifest;
+        }
+        openPartitionedWorld(guid, manifest);
+        return;
+    }
+
     auto worldRes = GCM(ResourceModule::ResourceManager)->loadBySource<ResourceModule::RWorld>(guid);
     if (!worldRes)
     {
@@ -175,10 +233,131 @@ void ECSModule::openWorldByResource(const std::string &guid)
         return;
     }
 
+    // Autosave follows the world opened last; the old journal observes a world reset() may clear
+    stopJournal();
     m_worldManager->createWorld(guid);
     m_worldManager->setActiveWorld(guid);
-    m_worldManager->getActiveWorld()->reset();
-    m_worldManager->getActiveWorld()->deserialize(worldRes->getJsonData().c_str());
+    auto &world = *m_worldManager->getActiveWorld();
+    world.reset();
+
+    // A journal is deleted when its world is closed; one still there means a crash. It only
+    // applies to the resource contents it was recorded against; the next checkpoint replaces it.
+    bool recovered = false;
+    const auto source = WorldJournalSource::Of(guid, worldRes->getJsonData());
+    if (m_autosaveConfig.intervalSeconds > 0.0f)
+    {
+        const auto journal = journalPath(guid);
+        std::error_code ec;
+        if (std::filesystem::exists(journal, ec))
+        {
+            WorldJournalSource recorded;
+            if (WorldJournal::ReadSource(journal, recorded) && recorded == source)
+            {
+                LT_LOGW("ECSModule", "World " + guid + " was not closed cleanly, recovering it from " + journal.string());
+                recovered = WorldJournal::Recover(world, journal);
+            }
+            else
+            {
+                LT_LOGW("ECSModule", "Ignoring autosave journal " + journal.string() + ": it was not recorded against the "
+                                     "current contents of " + guid);
+            }
+        }
+    }
+    if (!recovered)
+        world.deserialize(worldRes->getJsonData().c_str());
+    startJournal(world, guid, source);
+}
+
+bool ECSModule::openPartitionedWorld(const std::string &name, const std::filesystem::path &manifest)
+{
+    ZoneScopedN("ECSModule::openPartitionedWorld");
+    m_streamer.reset();
+
+    auto &world = m_worldManager->createWorld(name);
+    m_worldManager->setActiveWorld(name);
+    world.reset();
+
+    auto jobs = Core::Locator().tryGet<JobSystem>();
+    m_streamer = std::make_unique<WorldStreamer>(world, jobs.get());
+    m_streamer->configure(m_streamingConfig);
+    if (!m_streamer->open(manifest))
+    {
+        LT_LOGE("ECSModule", "Failed to open partitioned world: " + manifest.string());
+        m_streamer.reset();
+        return false;
+    }
+    m_streamedWorld = name;
+    // Follows the camera from emitRenderFrameData(); starts at the origin until one is seen
+    m_cameraFocus = m_streamer->addFocus(Math::Vec3(0.0f));
+    return true;
+}
+
+bool ECSModule::saveWorld(const std::filesystem::path &path)
+{
+    ZoneScopedN("ECSModule::saveWorld");
+    auto *world = getCurrentWorld();
+    if (!world || !m_saver)
+        return false;
+    if (m_inSimulate)
+    {
+        LT_LOGW("ECSModule", "Stop the simulation before saving the world");
+        return false;
+    }
+    return m_saver->save(*world, path);
+}
+
+std::filesystem::path ECSModule::journalPath(const std::string &world) const
+{
+    std::filesystem::path directory(m_autosaveConfig.directory);
+    if (directory.is_relative())
+    {
+        const auto &project = GCXM(ProjectModule::ProjectModule)->getProjectConfig();
+        directory = std::filesystem::path(project.getProjectPath()) / directory;
+    }
+    // World names are resource paths; flatten them into one file name
+    std::string file = world;
+    for (char &c : file)
+    {
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '.' && c != '-' && c != '_')
+            c = '_';
+    }
+    return directory / (file + ".ljournal");
+}
+
+void ECSModule::startJournal(EntityWorld &world, const std::string &name, const WorldJournalSource &source)
+{
+    if (m_autosaveConfig.intervalSeconds <= 0.0f)
+        return;
+    auto jobs = Core::Locator().tryGet<JobSystem>();
+    m_journal =
+        std::make_unique<WorldJournal>(world, journalPath(name), jobs.get(), m_autosaveConfig.journal, source);
+    m_journaledWorld = name;
+    m_lastAutosave = std::chrono::steady_clock::now();
+}
+
+void ECSModule::stopJournal()
+{
+    if (!m_journal)
+        return;
+    m_journal->discard();
+    m_journal.reset();
+    m_journaledWorld.clear();
+}
+
+void ECSModule::updateSaves()
+{
+    WorldSaver::Result result;
+    if (m_saver && m_saver->poll(result))
+        GCEB().emit(Events::ECS::WorldSaved{result.path.string(), result.ok});
+
+    // Simulated state is not journaled; what simulation touches is written once it is rewound
+    if (!m_journal || m_inSimulate)
+        return;
+    const auto now = std::chrono::steady_clock::now();
+    if (now - m_lastAutosave < std::chrono::duration<float>(m_autosaveConfig.intervalSeconds))
+        return;
+    if (m_journal->flush())
+        m_lastAutosave = now;
 }
 
 void ECSModule::ecsTick(float dt)
@@ -186,8 +365,17 @@ void ECSModule::ecsTick(float dt)
     ZoneScopedN("ECSModule::ecsTick");
     if (m_inSimulate)
         m_worldManager->tickActive(dt);
+}
 
-    emitRenderFrameData();
+void ECSModule::collectStepStart()
+{
+    ZoneScopedN("ECSModule::collectStepStart");
+    m_stepStart.clear();
+    auto *worldPtr = getCurrentWorld();
+    if (!m_inSimulate || !worldPtr)
+        return;
+    // Resets change detection, so the emit that follows the last step carries only what it moved
+    worldPtr->collectRenderFrameData(m_stepStart);
 }
 
 void ECSModule::simulate(bool state)
@@ -200,54 +388,36 @@ void ECSModule::simulate(bool state)
     if (state && !m_inSimulate)
     {
         // Save current world state before starting simulation
-        m_simulationSnapshot = world->serialize();
+        auto& flecsWorld = world->get();
+        m_simulationSnapshot = std::make_unique<WorldSnapshot>(world->getSerializedComponents());
+        PhysicsModule::PhysicsSnapshotSync::Install(flecsWorld, *m_simulationSnapshot);
+        if (!m_simulationSnapshot->capture(flecsWorld))
+        {
+            LT_LOGE("ECSModule", "Cannot snapshot the world; simulation not started");
+            m_simulationSnapshot.reset();
+            return;
+        }
         m_inSimulate = true;
+        // Time accumulated while editing would otherwise run as catch-up steps on the first frame
+        if (auto timeModule = Core::Locator().tryGet<TimeModule::TimeModule>())
+            timeModule->getFixedTimestep().reset();
         GCEB().emit(Events::ECS::WorldOpened{"Simulation"});
     }
     else if (!state && m_inSimulate)
     {
         m_inSimulate = false;
         
-        // Clear all physics bodies before restoring state
-        auto* physicsCtx = PhysicsModule::PhysicsLocator::TryGet();
-        if (physicsCtx)
-        {
-            auto& flecsWorld = world->get();
-            // Collect all entities with RigidBodyComponent to avoid iterator invalidation
-            std::vector<flecs::entity> entitiesToClear;
-            flecsWorld.each<PhysicsModule::RigidBodyComponent>([&entitiesToClear](flecs::entity e, PhysicsModule::RigidBodyComponent&) {
-                entitiesToClear.push_back(e);
-            });
-            
-            // Destroy physics bodies for all entities
-            for (auto& entity : entitiesToClear)
-            {
-                if (entity.is_valid())
-                {
-                    physicsCtx->destroyBodyForEntity(entity);
-                }
-            }
-        }
-        
-        // Restore world state from snapshot
-        if (!m_simulationSnapshot.empty())
+        // Rewind the world in place; physics bodies are kept and moved back instead of rebuilt
+        if (m_simulationSnapshot)
         {
-            world->deserialize(m_simulationSnapshot);
-            
-            // Reset RigidBodyComponent flags to ensure physics bodies are recreated
             auto& flecsWorld = world->get();
-            using namespace PhysicsModule;
-            flecsWorld.each<RigidBodyComponent>([&](flecs::entity e, RigidBodyComponent& rb) {
-                rb.bodyHandle = InvalidBodyHandle;
-                rb.needsCreation = true;
-            });
-            
-            // Also reset ColliderComponent flags
-            flecsWorld.each<ColliderComponent>([&](flecs::entity e, ColliderComponent& collider) {
-                collider.needsCreation = true;
-            });
-            
-            m_simulationSnapshot.clear();
+            // Scripts started during simulation get OnEnd first; whatever they change is rewound too
+            flecsWorld.defer_begin();
+            flecsWorld.each([](ScriptComponent& script) { script.end(); });
+            flecsWorld.defer_end();
+            m_simulationSnapshot->restore(flecsWorld);
+            PhysicsModule::PhysicsSnapshotSync::ResetBodies(flecsWorld);
+            m_simulationSnapshot.reset();
         }
         
         // Emit WorldClosed event to notify renderer to clear render list
@@ -255,71 +425,59 @@ void ECSModule::simulate(bool state)
         GCEB().emit(Events::ECS::WorldClosed{"Simulation"});
         
         // Emit WorldOpened event to notify renderer to rebuild render list
-        // This ensures renderer knows the world is ready after deserialization
+        // This ensures renderer knows the world is ready after restore
         GCEB().emit(Events::ECS::WorldOpened{"EditorWorld"});
     }
 }
 
-void ECSModule::emitRenderFrameData()
+void ECSModule::emitRenderFrameData(uint32_t simulationSteps, float interpolationAlpha)
 {
     ZoneScopedN("ECSModule::emitRenderFrameData");
+    updateSaves();
 
     auto *worldPtr = getCurrentWorld();
     if (!worldPtr)
         return;
 
-    auto &world = worldPtr->get();
-    Events::ECS::RenderFrameData frameData;
-
-    auto qCam = world.query<TransformComponent, CameraComponent>();
-    qCam.each(
-        [&](flecs::entity, const TransformComponent &transform, const CameraComponent &cam) {
-            frameData.camera.posX = transform.position.x;
-            frameData.camera.posY = transform.position.y;
-            frameData.camera.posZ = transform.position.z;
-            frameData.camera.rotX = transform.rotation.x;
-            frameData.camera.rotY = transform.rotation.y;
-            frameData.camera.rotZ = transform.rotation.z;
-            const glm::quat quat = transform.rotation.toQuat();
-            frameData.camera.rotQX = quat.x;
-            frameData.camera.rotQY = quat.y;
-            frameData.camera.rotQZ = quat.z;
-            frameData.camera.rotQW = quat.w;
-            frameData.camera.fov = cam.fov;
-            frameData.camera.aspect = cam.aspect;
-            frameData.camera.nearClip = cam.nearClip;
-            frameData.camera.farClip = cam.farClip;
-        });
-
-    auto qMesh = world.query<TransformComponent, MeshComponent>();
-    qMesh.each([&](flecs::entity e, const TransformComponent &trs,
-                   const MeshComponent &) {
-        if (!e.is_valid())
+    // Cells streamed in now get their world transforms below, in the same frame. Streaming pauses
+    // during simulation: the snapshot restore would delete cells loaded since and bring back
+    // unloaded ones behind the streamer's back.
+    if (m_streamer && !m_inSimulate && worldPtr == m_worldManager->getWorld(m_streamedWorld))
+    {
+        // Last frame's camera; the one for this frame is collected after the update
+        if (m_renderFrame.hasCamera)
         {
-            return;
+            const auto &camera = m_renderFrame.camera;
+            m_streamer->setFocus(m_cameraFocus, Math::Vec3(camera.posX, camera.posY, camera.posZ));
         }
+        m_streamer->update();
+    }
 
-        Events::ECS::ObjectTransformData objectTransform;
-        objectTransform.entityId = e.id();
-        objectTransform.posX = trs.position.x;
-        objectTransform.posY = trs.position.y;
-        objectTransform.posZ = trs.position.z;
-        objectTransform.rotX = trs.rotation.x;
-        objectTransform.rotY = trs.rotation.y;
-        objectTransform.rotZ = trs.rotation.z;
-
-        const glm::quat quat = trs.rotation.toQuat();
-        objectTransform.rotQX = quat.x;
-        objectTransform.rotQY = quat.y;
-        objectTransform.rotQZ = quat.z;
-        objectTransform.rotQW = quat.w;
-        objectTransform.scaleX = trs.scale.x;
-        objectTransform.scaleY = trs.scale.y;
-        objectTransform.scaleZ = trs.scale.z;
-        frameData.objectsTransforms.push_back(objectTransform);
-    });
+    // The editor world is not ticked outside simulation, so recorded commands and edits are
+    // propagated here
+    worldPtr->playbackCommands();
+    worldPtr->resolveMeshBounds();
+    worldPtr->updateTransforms();
+
+    // Reused across frames; only transforms written since the last frame are collected
+    m_renderFrame.clear();
+    worldPtr->collectRenderFrameData(m_renderFrame);
+    // Outside simulation the steps did not touch the world; edits are shown without blending
+    if (m_inSimulate)
+    {
+        m_renderFrame.simulationSteps = simulationSteps;
+        m_renderFrame.interpolationAlpha = interpolationAlpha;
+        if (simulationSteps > 1)
+        {
+            m_renderFrame.stepStartIds.swap(m_stepStart.entityIds);
+            m_renderFrame.stepStartMatrices.swap(m_stepStart.worldMatrices);
+        }
+    }
+    m_stepStart.clear();
+    LT_METRIC_GAUGE_SET("render_transforms_published", "Transforms sent to the renderer last frame",
+                        m_renderFrame.size());
 
-    GCEB().emit(frameData);
+    GCEB().emit(m_renderFrame);
 }
 
 void ECSModule::registerComponents()
@@ -1,31 +1,95 @@
 #pragma once
 #include <EngineMinimal.h>
+#include "Events.h"
 #include "WorldManager.h"
+#include "WorldStreamer.h"
+#include "Serialization/WorldJournal.h"
+#include "Serialization/WorldSaver.h"
+#include "Serialization/WorldSnapshot.h"
+
+#include <chrono>
+#include <optional>
 
 namespace ECSModule
 {
+    struct WorldAutosaveConfig
+    {
+        float intervalSeconds = 30.0f;      ///< Time between journal flushes; 0 turns autosave off
+        std::string directory = "Autosave"; ///< Journal files, relative to the project
+        WorldJournalConfig journal;
+    };
+
+    struct ECSModuleConfig
+    {
+        /// flecs stages for multi_threaded() systems, run on JobSystem workers.
+        /// -1 uses every job worker plus the main thread, 0 keeps systems single-threaded.
+        std::optional<int32_t> taskThreads;
+        /// Radii and budgets for partitioned (.lpartition) worlds.
+        std::optional<WorldStreamingConfig> streaming;
+        /// Crash recovery journal of the world opened from a resource.
+        std::optional<WorldAutosaveConfig> autosave;
+    };
+
     class ECSModule : public IModule
     {
     public:
         void startup() override;
         void shutdown() override;
+        /// One fixed simulation step of the active world; does nothing outside simulation.
         void ecsTick(float dt);
+        /// Called before the last of two or more ecsTick() calls in a frame: keeps the matrices
+        /// the earlier steps wrote, so the frame blends over the last step only.
+        void collectStepStart();
+        /// Publishes the frame's world matrices to the renderer, once per rendered frame.
+        /// @p simulationSteps are the ecsTick() calls since the previous frame, @p interpolationAlpha
+        /// the frame's position between the last two of them.
+        void emitRenderFrameData(uint32_t simulationSteps, float interpolationAlpha);
+
+        void applyConfig(const ECSModuleConfig& config);
 
         EntityWorld* getCurrentWorld();
+        /// All worlds, e.g. for a host that steps its sessions with WorldManager::tickAll().
+        WorldManager& getWorldManager() { return *m_worldManager; }
         EntityWorld& createWorld(const std::string& name);
         void openBasicWorld();
+        /// Opens an .lworld, or streams a partitioned .lpartition world around the camera.
         void openWorldByResource(const std::string& guid);
+        /// Streams the partition at @p manifest into a new active world named @p name.
+        bool openPartitionedWorld(const std::string& name, const std::filesystem::path& manifest);
+        /// Streamer of the open partitioned world, null otherwise. Add focus points for players here.
+        /// It is not updated while simulating.
+        WorldStreamer* getStreamer() { return m_streamer.get(); }
         void closeWorld(const std::string& name);
+        /// Saves the active world to @p path in the binary world format on a job; WorldSaved
+        /// follows. False while simulating or while the previous save is still being written.
+        bool saveWorld(const std::filesystem::path& path);
+        /// Autosave journal of the world last opened from a resource, null when autosave is off.
+        WorldJournal* getJournal() { return m_journal.get(); }
         void simulate(bool state);
         bool isSimulate() const { return m_inSimulate; }
     private:
         void registerComponents();
-        
-        void emitRenderFrameData();
+        std::filesystem::path journalPath(const std::string& world) const;
+        void startJournal(EntityWorld& world, const std::string& name, const WorldJournalSource& source);
+        /// Closing the world normally: its journal is deleted, nothing is left to recover.
+        void stopJournal();
+        void updateSaves();
         
         std::unique_ptr<WorldManager> m_worldManager;
+        std::unique_ptr<WorldStreamer> m_streamer;
+        std::string m_streamedWorld;
+        WorldStreamer::FocusId m_cameraFocus = 0;
+        WorldStreamingConfig m_streamingConfig;
         ModuleEventBinder m_binder;
         bool m_inSimulate = false;
-        std::string m_simulationSnapshot; // Snapshot of world state before simulation
+        int32_t m_taskThreads = 0;
+        std::unique_ptr<WorldSnapshot> m_simulationSnapshot; // World state before simulation, restored in place on stop
+        Events::ECS::RenderFrameData m_renderFrame; // Emitted every tick, capacity kept between frames
+        Events::ECS::RenderFrameData m_stepStart;   // collectStepStart() output for the next emit
+        std::unique_ptr<WorldSaver> m_saver;
+        std::unique_ptr<WorldJournal> m_journal;
+        std::string m_journaledWorld;
+        WorldAutosaveConfig m_autosaveConfig;
+        std::chrono::steady_clock::time_point m_lastAutosave;
     };
 }
\ No newline at end of file
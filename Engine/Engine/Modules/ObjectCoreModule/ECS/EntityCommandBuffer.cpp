@@ -0,0 +1,290 @@
+#include "EntityCommandBuffer.h"
+
+#include <EngineMinimal.h>
+#include <Foundation/Assert/Assert.h>
+
+#include <algorithm>
+#include <atomic>
+
+namespace ECSModule
+{
+namespace
+{
+constexpr uint32_t kSlotMask = 0x7FFFFFFFu;
+
+std::atomic<uint64_t> g_nextQueueId{1};
+
+// One-entry cache per thread: the common case is one world ticking on it
+struct LocalBuffer
+{
+    uint64_t queue = 0;
+    EntityCommandBuffer* buffer = nullptr;
+};
+thread_local LocalBuffer t_local;
+} // namespace
+
+EntityCommandBuffer::~EntityCommandBuffer()
+{
+    clear();
+}
+
+flecs::entity_t EntityCommandBuffer::create(flecs::entity_t prefab)
+{
+    const flecs::entity_t placeholder =
+        kPlaceholderBit | (static_cast<flecs::entity_t>(m_slot & kSlotMask) << 32) | m_placeholders++;
+    m_commands.push_back({CommandType::Create, m_keyed, m_sortKey, placeholder, prefab, nullptr, nullptr});
+    return placeholder;
+}
+
+void EntityCommandBuffer::destroy(flecs::entity_t entity)
+{
+    push(CommandType::Destroy, entity);
+}
+
+void EntityCommandBuffer::push(CommandType type, flecs::entity_t entity, const ComponentOps* ops, void* payload)
+{
+    m_commands.push_back({type, m_keyed, m_sortKey, entity, 0, ops, payload});
+}
+
+void* EntityCommandBuffer::allocate(size_t size, size_t alignment)
+{
+    size = std::max<size_t>(size, 1);
+    while (m_currentPage < m_pages.size())
+    {
+        if (void* memory = m_pages[m_currentPage].allocator->allocate(size, alignment))
+            return memory;
+        ++m_currentPage;
+    }
+
+    // Values larger than a page get a page of their own
+    Page page;
+    const size_t capacity = std::max(kPageSize, size + alignment);
+    page.memory = std::make_unique<uint8_t[]>(capacity);
+    page.allocator = std::make_unique<EngineCore::Foundation::LinearAllocator>(
+        page.memory.get(), capacity, EngineCore::Foundation::MemoryTag::ECS);
+    m_pages.push_back(std::move(page));
+    m_currentPage = m_pages.size() - 1;
+
+    void* memory = m_pages.back().allocator->allocate(size, alignment);
+    LT_ASSERT_MSG(memory, "EntityCommandBuffer page too small for its value");
+    return memory;
+}
+
+size_t EntityCommandBuffer::arenaBytes() const noexcept
+{
+    size_t bytes = 0;
+    for (const Page& page : m_pages)
+        bytes += page.allocator->getUsed();
+    return bytes;
+}
+
+void EntityCommandBuffer::clear()
+{
+    // Played values were moved from but still need their destructor
+    for (const Command& command : m_commands)
+    {
+        if (command.type == CommandType::Set)
+            command.ops->destroy(command.payload);
+    }
+    m_commands.clear();
+    for (Page& page : m_pages)
+        page.allocator->reset();
+    m_currentPage = 0;
+    m_placeholders = 0;
+    m_sortKey = 0;
+    m_keyed = false;
+}
+
+flecs::entity_t EntityCommandBuffer::Resolver::resolve(flecs::entity_t entity)
+{
+    if (!IsPlaceholder(entity))
+        return entity;
+
+    const size_t slot = static_cast<size_t>((entity >> 32) & kSlotMask);
+    const size_t index = static_cast<size_t>(entity & 0xFFFFFFFFu);
+    if (slot >= created.size())
+        return 0;
+    auto& entities = created[slot];
+    if (index >= entities.size())
+        entities.resize(index + 1, 0);
+    if (entities[index] == 0)
+        entities[index] = world.entity().id();
+    return entities[index];
+}
+
+void EntityCommandBuffer::Apply(const Command& command, Resolver& resolver)
+{
+    flecs::world& world = resolver.world;
+    const flecs::entity_t id = resolver.resolve(command.entity);
+    // Targets destroyed by an earlier command, or never valid, are skipped
+    if (id == 0 || !world.is_alive(id))
+        return;
+
+    flecs::entity entity = world.entity(id);
+    switch (command.type)
+    {
+    case CommandType::Create:
+        if (command.prefab != 0)
+        {
+            const flecs::entity_t prefab = resolver.resolve(command.prefab);
+            if (prefab != 0 && world.is_alive(prefab))
+                entity.is_a(prefab);
+        }
+        break;
+    case CommandType::Destroy:
+        entity.destruct();
+        break;
+    case CommandType::Set:
+        command.ops->set(entity, command.payload);
+        break;
+    case CommandType::Add:
+        command.ops->add(entity);
+        break;
+    case CommandType::Remove:
+        entity.remove(command.ops->id(world));
+        break;
+    }
+}
+
+size_t EntityCommandBuffer::playback(flecs::world& world)
+{
+    ZoneScopedN("EntityCommandBuffer::playback");
+    Resolver resolver{world, {}};
+    resolver.created.resize(static_cast<size_t>(m_slot & kSlotMask) + 1);
+
+    std::vector<const Command*> order;
+    order.reserve(m_commands.size());
+    for (const Command& command : m_commands)
+        order.push_back(&command);
+    std::stable_sort(order.begin(), order.end(),
+                     [](const Command* a, const Command* b) { return a->sortKey < b->sortKey; });
+
+    for (const Command* command : order)
+        Apply(*command, resolver);
+
+    const size_t applied = m_commands.size();
+    clear();
+    return applied;
+}
+
+EntityCommandQueue::EntityCommandQueue() : m_id(g_nextQueueId.fetch_add(1, std::memory_order_relaxed))
+{
+}
+
+EntityCommandQueue::~EntityCommandQueue()
+{
+    if (t_local.queue == m_id)
+        t_local = {};
+}
+
+EntityCommandBuffer& EntityCommandQueue::local()
+{
+    if (t_local.queue == m_id)
+        return *t_local.buffer;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    EntityCommandBuffer*& buffer = m_byThread[std::this_thread::get_id()];
+    if (!buffer)
+    {
+        m_buffers.push_back(std::make_unique<EntityCommandBuffer>(static_cast<uint32_t>(m_buffers.size())));
+        buffer = m_buffers.back().get();
+    }
+    t_local = {m_id, buffer};
+    return *buffer;
+}
+
+size_t EntityCommandQueue::playback(flecs::world& world)
+{
+    ZoneScopedN("EntityCommandQueue::playback");
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Each buffer in record order, the stable sort keeps that per key and buffer. The playing
+    // thread's buffer ranks first, the others by creation, which follows thread timing; that is
+    // why their commands need a key of their own and unkeyed ones are dropped.
+    const auto self = m_byThread.find(std::this_thread::get_id());
+    const EntityCommandBuffer* own = self != m_byThread.end() ? self->second : nullptr;
+    m_order.clear();
+    size_t unkeyed = 0;
+    for (size_t i = 0; i < m_buffers.size(); ++i)
+    {
+        const bool isOwn = m_buffers[i].get() == own;
+        const uint32_t rank = isOwn ? 0 : static_cast<uint32_t>(i + 1);
+        for (const auto& command : m_buffers[i]->m_commands)
+        {
+            if (!isOwn && !command.keyed)
+            {
+                ++unkeyed;
+                continue;
+            }
+            m_order.push_back({&command, rank});
+        }
+    }
+    if (unkeyed > 0)
+    {
+        LT_ASSERT_MSG(unkeyed == 0, "Commands recorded off the playing thread need a sort key");
+        LT_METRIC_COUNTER_ADD("ecs_commands_unkeyed_dropped",
+                              "Commands recorded off the playing thread without a sort key, dropped",
+                              unkeyed);
+        LT_LOGSE_LIMIT("ECSModule", 1, "Dropped {} commands recorded off the playing thread without a sort key; "
+                       "record them with EntityCommandQueue::local(key)",
+                       unkeyed);
+    }
+    if (m_order.empty())
+    {
+        for (const auto& buffer : m_buffers)
+            buffer->clear();
+        return 0;
+    }
+    std::stable_sort(m_order.begin(), m_order.end(), [](const Ordered& a, const Ordered& b) {
+        if (a.command->sortKey != b.command->sortKey)
+            return a.command->sortKey < b.command->sortKey;
+        return a.buffer < b.buffer;
+    });
+
+    EntityCommandBuffer::Resolver resolver{world, {}};
+    resolver.created.resize(m_buffers.size());
+    uint32_t sharedKeys = 0;
+    for (size_t i = 0; i < m_order.size(); ++i)
+    {
+        const Ordered& current = m_order[i];
+        if (i > 0)
+        {
+            const Ordered& previous = m_order[i - 1];
+            if (previous.command->sortKey == current.command->sortKey && previous.buffer != current.buffer &&
+                previous.buffer != 0)
+                ++sharedKeys;
+        }
+        EntityCommandBuffer::Apply(*current.command, resolver);
+    }
+    if (sharedKeys > 0)
+    {
+        LT_METRIC_COUNTER_ADD("ecs_command_shared_sort_keys", "Sort keys recorded by several job threads at playback",
+                              sharedKeys);
+        LT_LOGSW_LIMIT("ECSModule", 1, "{} command sort keys were recorded by several threads; their order follows "
+                       "thread timing. Give each job its own key with EntityCommandQueue::local(key)",
+                       sharedKeys);
+    }
+
+    const size_t applied = m_order.size();
+    m_order.clear();
+    for (const auto& buffer : m_buffers)
+        buffer->clear();
+    return applied;
+}
+
+void EntityCommandQueue::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& buffer : m_buffers)
+        buffer->clear();
+}
+
+size_t EntityCommandQueue::size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t count = 0;
+    for (const auto& buffer : m_buffers)
+        count += buffer->size();
+    return count;
+}
+} // namespace ECSModule
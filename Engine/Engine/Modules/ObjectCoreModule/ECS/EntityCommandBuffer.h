@@ -0,0 +1,214 @@
+#pragma once
+#include "flecs.h"
+
+#include <Foundation/Memory/LinearAllocator.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ECSModule
+{
+/// <summary>
+/// Structural changes (create, destroy, set, add, remove) recorded without touching the world and
+/// applied later on the world's thread.
+///
+/// A buffer is used by one thread at a time and records without locks. Component values are
+/// moved into a paged arena that clear() rewinds but keeps. create() returns a placeholder id
+/// that later commands, in this buffer or another buffer of the same EntityCommandQueue, can
+/// target; playback turns it into a real entity the first time it is used.
+/// </summary>
+class EntityCommandBuffer
+{
+  public:
+    static constexpr flecs::entity_t kPlaceholderBit = 1ull << 63;
+    static constexpr size_t kPageSize = 64 * 1024;
+
+    explicit EntityCommandBuffer(uint32_t slot = 0) noexcept : m_slot(slot)
+    {
+    }
+    ~EntityCommandBuffer();
+
+    EntityCommandBuffer(const EntityCommandBuffer&) = delete;
+    EntityCommandBuffer& operator=(const EntityCommandBuffer&) = delete;
+
+    /// Commands recorded from now on are played back ordered by @p key, then in record order.
+    /// Jobs pass something stable such as their range start to get the same result every run.
+    /// Back to 0, and unset, after playback.
+    void setSortKey(uint32_t key) noexcept
+    {
+        m_sortKey = key;
+        m_keyed = true;
+    }
+
+    /// Placeholder for an entity created on playback, an instance of @p prefab when non-zero.
+    flecs::entity_t create(flecs::entity_t prefab = 0);
+    void destroy(flecs::entity_t entity);
+
+    template <typename T> void set(flecs::entity_t entity, T&& value)
+    {
+        using U = std::decay_t<T>;
+        void* payload = allocate(sizeof(U), alignof(U));
+        new (payload) U(std::forward<T>(value));
+        push(CommandType::Set, entity, &OpsFor<U>::kOps, payload);
+    }
+    template <typename T> void add(flecs::entity_t entity)
+    {
+        push(CommandType::Add, entity, &OpsFor<T>::kOps);
+    }
+    template <typename T> void remove(flecs::entity_t entity)
+    {
+        push(CommandType::Remove, entity, &OpsFor<T>::kOps);
+    }
+
+    static bool IsPlaceholder(flecs::entity_t entity) noexcept
+    {
+        return (entity & kPlaceholderBit) != 0;
+    }
+
+    size_t size() const noexcept
+    {
+        return m_commands.size();
+    }
+    bool empty() const noexcept
+    {
+        return m_commands.empty();
+    }
+    size_t arenaBytes() const noexcept;
+
+    /// Applies and clears this buffer alone; placeholders from other buffers are not resolved.
+    /// Runs on the world's thread, outside of iteration. Returns the commands applied.
+    size_t playback(flecs::world& world);
+    /// Drops unplayed commands, destroying their values; the arena pages are kept.
+    void clear();
+
+  private:
+    friend class EntityCommandQueue;
+
+    enum class CommandType : uint8_t
+    {
+        Create,
+        Destroy,
+        Set,
+        Add,
+        Remove
+    };
+
+    struct ComponentOps
+    {
+        flecs::id_t (*id)(flecs::world& world);
+        void (*set)(flecs::entity entity, void* payload); ///< Moves the payload into the entity
+        void (*add)(flecs::entity entity);
+        void (*destroy)(void* payload);
+    };
+
+    template <typename T> struct OpsFor
+    {
+        static constexpr ComponentOps kOps{
+            [](flecs::world& world) -> flecs::id_t { return world.id<T>(); },
+            [](flecs::entity entity, void* payload) {
+                if constexpr (std::is_empty_v<T>)
+                    entity.add<T>();
+                else
+                    entity.set<T>(std::move(*static_cast<T*>(payload)));
+            },
+            [](flecs::entity entity) { entity.add<T>(); },
+            [](void* payload) { static_cast<T*>(payload)->~T(); },
+        };
+    };
+
+    struct Command
+    {
+        CommandType type;
+        bool keyed;                 ///< Recorded after setSortKey()
+        uint32_t sortKey;
+        flecs::entity_t entity;     ///< Target, real or placeholder; the new entity for Create
+        flecs::entity_t prefab;     ///< Create only
+        const ComponentOps* ops;    ///< Set, Add and Remove
+        void* payload;              ///< Set only, in the arena
+    };
+
+    /// Placeholder ids to live entities for one playback, per buffer slot.
+    struct Resolver
+    {
+        flecs::world& world;
+        std::vector<std::vector<flecs::entity_t>> created;
+
+        flecs::entity_t resolve(flecs::entity_t entity);
+    };
+
+    void* allocate(size_t size, size_t alignment);
+    void push(CommandType type, flecs::entity_t entity, const ComponentOps* ops = nullptr, void* payload = nullptr);
+    static void Apply(const Command& command, Resolver& resolver);
+
+    uint32_t m_slot;
+    uint32_t m_sortKey = 0;
+    bool m_keyed = false;
+    uint32_t m_placeholders = 0;
+    std::vector<Command> m_commands;
+
+    struct Page
+    {
+        std::unique_ptr<uint8_t[]> memory;
+        std::unique_ptr<EngineCore::Foundation::LinearAllocator> allocator;
+    };
+    std::vector<Page> m_pages;
+    size_t m_currentPage = 0;
+};
+
+/// <summary>
+/// One EntityCommandBuffer per recording thread, played back together at a sync point.
+///
+/// local() hands every thread its own buffer; only a thread's first call takes a lock. playback()
+/// must not overlap recording: it orders all commands by sort key, then by buffer, then by record
+/// order, and applies them in one pass. Within a key the playing thread's buffer goes first; the
+/// order between other threads' buffers would depend on which thread recorded first, so every
+/// thread other than the playing one has to key its commands (local(key) or setSortKey()), e.g.
+/// with the index of its chunk of work. playback() drops unkeyed commands from those threads,
+/// asserting in debug builds, and warns when two of them share a key.
+/// </summary>
+class EntityCommandQueue
+{
+  public:
+    EntityCommandQueue();
+    ~EntityCommandQueue();
+
+    EntityCommandQueue(const EntityCommandQueue&) = delete;
+    EntityCommandQueue& operator=(const EntityCommandQueue&) = delete;
+
+    /// The calling thread's buffer, created on first use.
+    EntityCommandBuffer& local();
+    /// local() with its sort key set to @p sortKey, e.g. the index of the job's chunk.
+    EntityCommandBuffer& local(uint32_t sortKey)
+    {
+        EntityCommandBuffer& buffer = local();
+        buffer.setSortKey(sortKey);
+        return buffer;
+    }
+
+    /// Applies and clears every buffer. Returns the commands applied.
+    size_t playback(flecs::world& world);
+    /// Drops every buffer's commands.
+    void clear();
+    /// Commands waiting for playback; only exact while no thread is recording.
+    size_t size() const;
+
+  private:
+    mutable std::mutex m_mutex;
+    uint64_t m_id;
+    std::vector<std::unique_ptr<EntityCommandBuffer>> m_buffers;
+    std::unordered_map<std::thread::id, EntityCommandBuffer*> m_byThread;
+    struct Ordered
+    {
+        const EntityCommandBuffer::Command* command;
+        uint32_t buffer; ///< 0 for the playing thread's buffer, then 1 + creation index
+    };
+    std::vector<Ordered> m_order; ///< Reused by playback()
+};
+} // namespace ECSModule
@@ -1,11 +1,18 @@
 #include "EntityWorld.h"
 
 #include "Additionals/ECSSerializeTypes.h"
+#include "FlecsJobBridge.h"
+#include "Serialization/WorldBinarySerializer.h"
 #include "Modules/ResourceModule/ResourceManager.h"
+#include "Modules/ResourceModule/RPrefab.h"
 #include "Systems/ECSLuaScriptsSystem.h"
 #include "Systems/ECSPhysicsSystem.h"
 #include <Modules/PhysicsModule/Systems/SyncToPhysicsSystem.h>
 #include <Modules/PhysicsModule/Systems/SyncFromPhysicsSystem.h>
+#include <Modules/PhysicsModule/Components/CharacterControllerComponent.h>
+#include <Modules/PhysicsModule/Components/ColliderComponent.h>
+#include <Modules/PhysicsModule/Components/RigidBodyComponent.h>
+#include <Core/Core.h>
 #include <cstring>
 #include <nlohmann/json.hpp>
 
@@ -17,6 +24,8 @@ EntityWorld::EntityWorld(ResourceModule::ResourceManager* r, ScriptModule::LuaSc
 EntityWorld::~EntityWorld()
 {
     ECSluaScriptsSystem::getInstance().stopSystem(m_world);
+    // Its removal observer points back here and would fire while the world deletes entities
+    m_spatial.unbind();
 }
 
 void EntityWorld::init()
@@ -35,7 +44,10 @@ void EntityWorld::init()
     PhysicsModule::SyncToPhysicsSystem::Register(m_world);
     PhysicsModule::SyncFromPhysicsSystem::Register(m_world);
     // PhysicsStepSystem is not needed - step is called from PhysicsModule::tick()
-       
+
+    if (m_taskThreads > 1)
+        m_world.set_task_threads(m_taskThreads);
+
     using namespace ResourceModule;
     TransformComponent viewportTransform{};
     viewportTransform.position = {0.f, 2.f, 5.f};
@@ -45,19 +57,162 @@ void EntityWorld::init()
     auto& viewport_camera = m_world.entity("ViewportCamera")
                                 .set<TransformComponent>(viewportTransform)
                                 .set<CameraComponent>({75.0f, 16.0f / 9.0f, 0.1f, 100.0f, true});
+
+    m_hierarchy.bind(m_world);
+    m_spatial.bind(m_world);
+    m_renderFrames.bind(m_world);
 }
 
 void EntityWorld::reset()
 {
     ECSluaScriptsSystem::getInstance().stopSystem(m_world);
+    m_renderFrames.unbind();
+    m_hierarchy.unbind();
+    m_spatial.unbind();
+    m_prefabs.clear();
+    m_commands.clear();
+    m_pendingBounds.clear();
     m_world.reset();
     init();
 }
 
 void EntityWorld::tick(float dt)
+{
+    auto jobs = Core::Locator().tryGet<EngineCore::Foundation::JobSystem>();
+    tick(dt, jobs.get());
+}
+
+void EntityWorld::tick(float dt, EngineCore::Foundation::JobSystem* jobs)
 {
     ZoneScopedN("EntityWorld::tick");
     m_world.progress(dt);
+    playbackCommands();
+    updateTransforms(jobs);
+    LT_METRIC_GAUGE_SET("ecs_entities_alive", "Alive entities in the last ticked world, flecs built-ins included",
+                        ecs_get_entities(m_world.c_ptr()).alive_count);
+}
+
+size_t EntityWorld::playbackCommands()
+{
+    ZoneScopedN("EntityWorld::playbackCommands");
+    m_world.defer_begin();
+    const size_t applied = m_commands.playback(m_world);
+    m_world.defer_end();
+    LT_METRIC_GAUGE_SET("ecs_commands_applied", "Entity commands played back by the last EntityWorld tick", applied);
+    return applied;
+}
+
+size_t EntityWorld::updateTransforms()
+{
+    auto jobs = Core::Locator().tryGet<EngineCore::Foundation::JobSystem>();
+    return updateTransforms(jobs.get());
+}
+
+size_t EntityWorld::updateTransforms(EngineCore::Foundation::JobSystem* jobs)
+{
+    const size_t written = m_hierarchy.update(jobs);
+    m_spatial.update();
+    return written;
+}
+
+size_t EntityWorld::resolveMeshBounds()
+{
+    if (m_pendingBounds.empty())
+        return 0;
+
+    ZoneScopedN("EntityWorld::resolveMeshBounds");
+    // Unknown meshes keep the default unit box. Spawned batches queue runs of entities sharing a
+    // mesh, so the mesh is looked up once per run of equal IDs rather than once per entity.
+    ResourceModule::AssetID lastMesh;
+    BoundsComponent bounds{};
+    bool haveBounds = false;
+    size_t resolved = 0;
+    m_world.defer_begin();
+    for (flecs::entity_t id : m_pendingBounds)
+    {
+        flecs::entity e = m_world.entity(id);
+        const MeshComponent* mesh = e.is_alive() ? e.get<MeshComponent>() : nullptr;
+        if (!mesh)
+            continue;
+        if (!haveBounds || mesh->meshID != lastMesh)
+        {
+            bounds = BoundsComponent{};
+            if (m_resources && !mesh->meshID.empty())
+            {
+                auto data = m_resources->load<ResourceModule::RMesh>(mesh->meshID);
+                if (data && data->isValid())
+                {
+                    bounds.min = data->getMeshData().aabbMin;
+                    bounds.max = data->getMeshData().aabbMax;
+                }
+            }
+            lastMesh = mesh->meshID;
+            haveBounds = true;
+        }
+        e.set<BoundsComponent>(bounds);
+        ++resolved;
+    }
+    m_world.defer_end();
+    m_pendingBounds.clear();
+    return resolved;
+}
+
+void EntityWorld::isolateEvents(bool isolated)
+{
+    if (isolated)
+        m_events = std::make_unique<EngineCore::Foundation::EventBus>();
+    else
+        m_events.reset();
+}
+
+bool EntityWorld::usesSharedModules()
+{
+    return m_world.count<ScriptComponent>() > 0 || m_world.count<RigidbodyComponent>() > 0 ||
+           m_world.count<PhysicsModule::RigidBodyComponent>() > 0 ||
+           m_world.count<PhysicsModule::CharacterControllerComponent>() > 0;
+}
+
+flecs::entity EntityWorld::loadPrefab(const std::string& source)
+{
+    if (flecs::entity prefab = m_prefabs.find(m_world, source))
+        return prefab;
+
+    auto data = m_resources ? m_resources->loadBySource<ResourceModule::RPrefab>(source) : nullptr;
+    if (!data || !data->isValid())
+    {
+        LT_LOGW("ECSModule", "Prefab could not be loaded: " + source);
+        return flecs::entity();
+    }
+    return m_prefabs.create(m_world, source, data->getJsonData());
+}
+
+size_t EntityWorld::spawnBatch(flecs::entity prefab, size_t count, const TransformComponent* transforms,
+                               std::vector<flecs::entity_t>* spawned)
+{
+    ZoneScopedN("EntityWorld::spawnBatch");
+    m_spawnEvent.prefab = prefab.id();
+    m_spawnEvent.ids.clear();
+    const size_t created = ECSModule::PrefabLibrary::Spawn(m_world, prefab, count, transforms, m_spawnEvent.ids);
+    if (created == 0)
+        return 0;
+
+    if (spawned)
+        spawned->insert(spawned->end(), m_spawnEvent.ids.begin(), m_spawnEvent.ids.end());
+    LT_METRIC_COUNTER_ADD("ecs_entities_spawned_total", "Entities created by EntityWorld::spawnBatch", created);
+    events().emit(m_spawnEvent);
+    return created;
+}
+
+void EntityWorld::setTaskThreads(int32_t stages)
+{
+    if (stages > 1 && !ECSModule::FlecsJobBridge::IsInstalled())
+    {
+        LT_LOGW("ECSModule", "flecs task threads requested without a FlecsJobBridge; staying single-threaded");
+        stages = 0;
+    }
+    m_taskThreads = std::max(stages, 0);
+    // One stage is the same as none; flecs only goes through its task API for more than one.
+    m_world.set_task_threads(m_taskThreads > 1 ? m_taskThreads : 0);
 }
 
 std::string EntityWorld::serialize()
@@ -96,6 +251,29 @@ std::string EntityWorld::serialize()
 void EntityWorld::deserialize(const std::string& json)
 {
     // Clear all existing user entities before deserializing
+    clearUserEntities();
+
+    // Use flecs built-in deserialization
+    // This should restore all entities with their components
+    m_world.from_json(json.c_str());
+}
+
+bool EntityWorld::serializeBinary(std::ostream& out)
+{
+    ECSModule::WorldBinaryWriter writer(m_world, m_serializedComponents);
+    return writer.write(out);
+}
+
+bool EntityWorld::deserializeBinary(std::istream& in)
+{
+    clearUserEntities();
+
+    ECSModule::WorldBinaryReader reader(m_world);
+    return reader.read(in);
+}
+
+void EntityWorld::clearUserEntities()
+{
     // Collect all user entities first to avoid iterator invalidation
     std::vector<flecs::entity> entitiesToDestroy;
     m_world.each([&entitiesToDestroy](flecs::entity e) {
@@ -120,10 +298,6 @@ void EntityWorld::deserialize(const std::string& json)
             e.destruct();
         }
     }
-    
-    // Use flecs built-in deserialization
-    // This should restore all entities with their components
-    m_world.from_json(json.c_str());
 }
 
 void EntityWorld::registerTypes()
@@ -151,7 +325,9 @@ void EntityWorld::registerTypes()
 void EntityWorld::registerComponents()
 {
     // Register all ECS components with reflection data for serialization
-    // This is required for flecs to properly serialize/deserialize components
+    // This is required for flecs to properly serialize/deserialize components.
+    // ReplicatedTag opts a component into ECSModule::ReplicationServer snapshots; cameras,
+    // scripts and editor tags stay on the server.
     
     // PositionComponent (used as part of TransformComponent)
     m_world.component<PositionComponent>()
@@ -179,7 +355,13 @@ void EntityWorld::registerComponents()
     m_world.component<TransformComponent>()
         .member<PositionComponent>("position")
         .member<RotationComponent>("rotation")
-        .member<ScaleComponent>("scale");
+        .member<ScaleComponent>("scale")
+        .add<ReplicatedTag>();
+
+    // Derived from TransformComponent by TransformHierarchy, so it has no reflection and is not
+    // saved; With keeps it on every entity that has a transform.
+    m_world.component<WorldTransformComponent>();
+    m_world.component<TransformComponent>().add(flecs::With, m_world.component<WorldTransformComponent>());
     
     // CameraComponent
     m_world.component<CameraComponent>()
@@ -194,22 +376,31 @@ void EntityWorld::registerComponents()
         .member<ResourceModule::AssetID>("meshID")
         .member<ResourceModule::AssetID>("textureID")
         .member<ResourceModule::AssetID>("vertShaderID")
-        .member<ResourceModule::AssetID>("fragShaderID");
+        .member<ResourceModule::AssetID>("fragShaderID")
+        .add<ReplicatedTag>();
     
     // MaterialComponent
     m_world.component<MaterialComponent>()
-        .member<ResourceModule::AssetID>("materialID");
+        .member<ResourceModule::AssetID>("materialID")
+        .add<ReplicatedTag>();
     
     // PointLightComponent
     m_world.component<PointLightComponent>()
         .member<float>("innerRadius")
         .member<float>("outerRadius")
         .member<float>("intencity")
-        .member<glm::vec3>("color");
+        .member<glm::vec3>("color")
+        .add<ReplicatedTag>();
     
+    // BoundsComponent - derived from the mesh or collider by registerObservers(), not saved
+    m_world.component<BoundsComponent>()
+        .member<glm::vec3>("min")
+        .member<glm::vec3>("max");
+
     // DirectionalLightComponent
     m_world.component<DirectionalLightComponent>()
-        .member<float>("intencity");
+        .member<float>("intencity")
+        .add<ReplicatedTag>();
     
     // ScriptComponent
     m_world.component<ScriptComponent>()
@@ -218,8 +409,44 @@ void EntityWorld::registerComponents()
     // Register tags (no members needed)
     m_world.component<EditorOnlyTag>();
     m_world.component<InvisibleTag>();
+    m_world.component<ReplicatedTag>();
+
+    m_serializedComponents = {
+        m_world.id<TransformComponent>(),        m_world.id<CameraComponent>(),
+        m_world.id<MeshComponent>(),             m_world.id<MaterialComponent>(),
+        m_world.id<PointLightComponent>(),       m_world.id<DirectionalLightComponent>(),
+        m_world.id<ScriptComponent>(),           m_world.id<EditorOnlyTag>(),
+        m_world.id<InvisibleTag>(),
+    };
 }
 
 void EntityWorld::registerObservers()
 {
+    // Local bounds for the spatial index: the mesh AABB computed at load, or the collider shape
+    // for physical entities without a mesh. Loading a mesh does not belong in an observer, which
+    // can run inside a tick on a job, so meshes are only queued for resolveMeshBounds().
+    m_world.observer<const MeshComponent>("MeshBounds")
+        .event(flecs::OnSet)
+        .run([this](flecs::iter& it) {
+            while (it.next())
+            {
+                for (auto i : it)
+                    m_pendingBounds.push_back(it.entity(i).id());
+            }
+        });
+
+    m_world.observer<const PhysicsModule::ColliderComponent>("ColliderBounds")
+        .event(flecs::OnSet)
+        .each([](flecs::entity e, const PhysicsModule::ColliderComponent& collider) {
+            if (e.has<MeshComponent>())
+                return;
+
+            const auto& shape = collider.shapeDesc;
+            glm::vec3 extents = shape.size * 0.5f;
+            if (shape.type == PhysicsModule::PhysicsShapeType::Sphere)
+                extents = glm::vec3(shape.radius);
+            else if (shape.type == PhysicsModule::PhysicsShapeType::Capsule)
+                extents = glm::vec3(shape.radius, shape.height * 0.5f + shape.radius, shape.radius);
+            e.set<BoundsComponent>({-extents, extents});
+        });
 }
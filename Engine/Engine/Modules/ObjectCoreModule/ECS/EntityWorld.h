@@ -1,9 +1,18 @@
 #pragma once
 #include "Components/ECSComponents.h"
+#include "EntityCommandBuffer.h"
+#include "PrefabLibrary.h"
+#include "RenderFrameCollector.h"
+#include "SpatialIndex.h"
+#include "TransformHierarchy.h"
 #include "flecs.h"
 
 #include <EngineMinimal.h>
 
+#include <iosfwd>
+#include <memory>
+#include <vector>
+
 namespace ResourceModule
 {
 class ResourceManager;
@@ -27,10 +36,100 @@ class EntityWorld
     void init();
     void reset();
     void tick(float dt);
+    /// tick() with @p jobs for the transform update instead of the core JobSystem; null keeps it
+    /// on the calling thread.
+    void tick(float dt, EngineCore::Foundation::JobSystem* jobs);
+
+    /// Stages used by multi_threaded() systems, including the thread calling tick(); 0 or 1 runs
+    /// everything on the calling thread. Needs an installed FlecsJobBridge, otherwise it stays at 0.
+    /// Kept across reset().
+    void setTaskThreads(int32_t stages);
+    int32_t getTaskThreads() const noexcept
+    {
+        return m_taskThreads;
+    }
 
     std::string serialize();
     void deserialize(const std::string& jsonData);
 
+    /// Binary counterpart of serialize()/deserialize() for large worlds: chunked, one column per
+    /// reflected component, bulk-created on load. See Serialization/WorldBinarySerializer.h.
+    bool serializeBinary(std::ostream& out);
+    bool deserializeBinary(std::istream& in);
+
+    /// Bus for the events this world emits: the core bus unless isolateEvents() gave it its own.
+    EngineCore::Foundation::EventBus& events() noexcept
+    {
+        return m_events ? *m_events : GCEB();
+    }
+    /// With @p isolated the world gets a private EventBus, so what it emits reaches only that bus's
+    /// subscribers (one server session, say) and can be ticked off the main thread. Switching
+    /// drops the subscriptions of the previous private bus.
+    void isolateEvents(bool isolated);
+    bool hasIsolatedEvents() const noexcept
+    {
+        return m_events != nullptr;
+    }
+
+    /// Whether the world has scripts or physics bodies. Those run on the engine-wide Lua VM and
+    /// physics context, so such a world has to be ticked on the main thread.
+    bool usesSharedModules();
+
+    /// Reflected user components saved by serializeBinary(); also the roots of simulation snapshots.
+    const std::vector<flecs::entity_t>& getSerializedComponents() const noexcept
+    {
+        return m_serializedComponents;
+    }
+
+    /// The calling thread's command buffer. Jobs, scripts and tools record structural changes
+    /// here instead of touching the world; tick() plays every thread's buffer back after the
+    /// systems ran, before transforms are refreshed. Threads other than the ticking one set a
+    /// sort key first (EntityCommandBuffer::setSortKey), or their commands are dropped.
+    ECSModule::EntityCommandBuffer& commands()
+    {
+        return m_commands.local();
+    }
+    /// Applies every recorded command now, inside one flecs defer so each entity moves table at
+    /// most once. Main thread only, not while jobs are recording. Returns the commands applied.
+    size_t playbackCommands();
+
+    /// Refreshes WorldTransformComponent for the transforms written since the last call and
+    /// their descendants, then the spatial index; tick() does this after the systems ran.
+    /// Returns the matrices written.
+    size_t updateTransforms();
+
+    /// Gives the entities whose MeshComponent was set since the last call the AABB of their mesh,
+    /// loading it if needed. Main thread; WorldManager and ECSModule call it after ticks and before
+    /// publishing a frame. Returns the entities updated.
+    size_t resolveMeshBounds();
+
+    /// Entities with BoundsComponent by world-space box, current as of the last updateTransforms().
+    const ECSModule::SpatialIndex& getSpatialIndex() const noexcept
+    {
+        return m_spatial;
+    }
+
+    /// Prefab for the .lprefab asset at @p source, built on first use and kept until reset();
+    /// invalid when the asset cannot be loaded.
+    flecs::entity loadPrefab(const std::string& source);
+    /// Prefab from flecs entity JSON, registered under @p key for loadPrefab().
+    flecs::entity createPrefab(const std::string& key, const std::string& json)
+    {
+        return m_prefabs.create(m_world, key, json);
+    }
+
+    /// Creates @p count instances of @p prefab in one bulk operation, instance i at
+    /// transforms[i] when given, and emits a single EntitiesSpawned. Ids are appended to
+    /// @p spawned when it is not null. Returns the number created.
+    size_t spawnBatch(flecs::entity prefab, size_t count, const TransformComponent* transforms = nullptr,
+                      std::vector<flecs::entity_t>* spawned = nullptr);
+
+    /// Appends the transforms changed since the previous call, plus the camera, to @p out.
+    size_t collectRenderFrameData(Events::ECS::RenderFrameData& out)
+    {
+        return m_renderFrames.collect(out);
+    }
+
     flecs::world& get() noexcept
     {
         return m_world;
@@ -40,10 +139,26 @@ class EntityWorld
     void registerTypes();
     void registerComponents();
     void registerObservers();
+    void clearUserEntities();
+    size_t updateTransforms(EngineCore::Foundation::JobSystem* jobs);
 
   private:
     flecs::world m_world;
     ResourceModule::ResourceManager* m_resources;
     ScriptModule::LuaScriptModule* m_scripts;
     PhysicsModule::PhysicsModule* m_physics;
+    int32_t m_taskThreads = 0;
+    /// Components saved by serializeBinary(), filled by registerComponents()
+    std::vector<flecs::entity_t> m_serializedComponents;
+    ECSModule::PrefabLibrary m_prefabs;
+    ECSModule::EntityCommandQueue m_commands;
+    /// Queued by the MeshBounds observer on the ticking thread for resolveMeshBounds()
+    std::vector<flecs::entity_t> m_pendingBounds;
+    std::unique_ptr<EngineCore::Foundation::EventBus> m_events; ///< Null while the core bus is used
+    /// Reused by spawnBatch() so large batches do not reallocate the id list every time
+    Events::ECS::EntitiesSpawned m_spawnEvent;
+    /// Queries on m_world, declared after it so they are released first
+    ECSModule::RenderFrameCollector m_renderFrames;
+    ECSModule::TransformHierarchy m_hierarchy;
+    ECSModule::SpatialIndex m_spatial;
 };
@@ -13,6 +13,15 @@ struct WorldClosed
     std::string name;
 };
 
+/// <summary>
+/// An ECSModule::saveWorld() finished writing, or failed to.
+/// </summary>
+struct WorldSaved
+{
+    std::string path;
+    bool success;
+};
+
 struct EntityCreated
 {
     uint64_t id;
@@ -24,18 +33,29 @@ struct EntityDestroyed
     uint64_t id;
 };
 
-struct ComponentChanged
+/// <summary>
+/// Instances created together by EntityWorld::spawnBatch(); sent once per batch in place of an
+/// EntityCreated per entity. Emitted by reference; copy the ids that must outlive the handler.
+/// </summary>
+struct EntitiesSpawned
 {
-    uint64_t entityId;
-    std::string componentName;
+    uint64_t prefab;
+    std::vector<uint64_t> ids;
 };
 
-struct ObjectTransformData
+/// <summary>
+/// Entities deleted together, e.g. a world partition cell streamed out; sent once per batch in
+/// place of an EntityDestroyed per entity.
+/// </summary>
+struct EntitiesDestroyed
+{
+    std::vector<uint64_t> ids;
+};
+
+struct ComponentChanged
 {
     uint64_t entityId;
-    float posX, posY, posZ;
-    float rotX, rotY, rotZ, rotQX, rotQY, rotQZ, rotQW;
-    float scaleX, scaleY, scaleZ;
+    std::string componentName;
 };
 
 struct CameraRenderData
@@ -48,9 +68,45 @@ struct CameraRenderData
     float farClip;
 };
 
+/// <summary>
+/// World matrices of renderable entities changed since the previous frame, structure-of-arrays.
+/// Emitted by reference from a buffer the ECS module reuses every frame; copy what must outlive
+/// the handler. Entities whose world transform did not change are not listed, the camera always is.
+///
+/// Simulation runs at a fixed rate, so a frame can follow zero, one or several steps. Matrices
+/// sent with simulationSteps > 0 are the latest step's state, and the renderer draws
+/// interpolationAlpha of the way from the step before it. Matrices sent without a step (editor
+/// edits, a world that is not simulating) are shown as they are. When a frame ran several steps,
+/// stepStartIds/stepStartMatrices hold the state before the last one for the entities moved by
+/// the steps before it, so the blend still covers one step.
+/// </summary>
 struct RenderFrameData
 {
-    std::vector<ObjectTransformData> objectsTransforms;
-    CameraRenderData camera;
+    std::vector<uint64_t> entityIds;
+    std::vector<glm::mat4> worldMatrices; ///< WorldTransformComponent, parents applied
+    CameraRenderData camera{};
+    bool hasCamera = false;
+    uint32_t simulationSteps = 0;   ///< Fixed steps run since the previous frame
+    float interpolationAlpha = 1.0f; ///< Position of this frame between the last two steps, in [0, 1]
+    std::vector<uint64_t> stepStartIds;       ///< Entities moved before the last of several steps
+    std::vector<glm::mat4> stepStartMatrices; ///< Their world matrices as the last step began
+
+    size_t size() const noexcept
+    {
+        return entityIds.size();
+    }
+
+    /// Empties the buffer, keeping its capacity for the next frame.
+    void clear() noexcept
+    {
+        entityIds.clear();
+        worldMatrices.clear();
+        camera = {};
+        hasCamera = false;
+        simulationSteps = 0;
+        interpolationAlpha = 1.0f;
+        stepStartIds.clear();
+        stepStartMatrices.clear();
+    }
 };
 } // namespace Events::ECS
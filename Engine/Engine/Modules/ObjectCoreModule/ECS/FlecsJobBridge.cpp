@@ -0,0 +1,85 @@
+#include "FlecsJobBridge.h"
+
+#include <EngineMinimal.h>
+#include <flecs.h>
+
+#include <atomic>
+
+using EngineCore::Foundation::JobHandle;
+using EngineCore::Foundation::JobSystem;
+
+namespace
+{
+std::atomic<JobSystem*> s_jobs{nullptr};
+ecs_os_thread_new_t s_previousTaskNew   = nullptr;
+ecs_os_thread_join_t s_previousTaskJoin = nullptr;
+
+/// One flecs task; flecs joins every task it creates, which frees it.
+struct FlecsTask
+{
+    JobHandle handle;
+    void* result = nullptr;
+};
+
+ecs_os_thread_t TaskNew(ecs_os_thread_callback_t callback, void* arg)
+{
+    auto* task = new FlecsTask();
+    s_jobs.load(std::memory_order_acquire)
+        ->submit([task, callback, arg]() { task->result = callback(arg); }, task->handle, "flecs.task");
+    return reinterpret_cast<ecs_os_thread_t>(task);
+}
+
+void* TaskJoin(ecs_os_thread_t thread)
+{
+    auto* task = reinterpret_cast<FlecsTask*>(thread);
+    s_jobs.load(std::memory_order_acquire)->wait(task->handle);
+    void* result = task->result;
+    delete task;
+    return result;
+}
+} // namespace
+
+namespace ECSModule
+{
+bool FlecsJobBridge::Install(JobSystem* jobs)
+{
+    if (!jobs || JobSystem::kJobSystemDisabled || jobs->getWorkerCount() == 0)
+    {
+        LT_LOGW("ECSModule", "JobSystem has no workers; flecs systems stay single-threaded");
+        return false;
+    }
+
+    // Make sure flecs has set up its own OS API first, or the first world would overwrite ours.
+    ecs_set_os_api_impl();
+    if (s_jobs.load(std::memory_order_acquire) == nullptr)
+    {
+        s_previousTaskNew  = ecs_os_api.task_new_;
+        s_previousTaskJoin = ecs_os_api.task_join_;
+    }
+    s_jobs.store(jobs, std::memory_order_release);
+    ecs_os_api.task_new_  = TaskNew;
+    ecs_os_api.task_join_ = TaskJoin;
+
+    LT_LOGFI("ECSModule", "flecs task threads bridged to {} job workers", jobs->getWorkerCount());
+    return true;
+}
+
+void FlecsJobBridge::Uninstall()
+{
+    if (s_jobs.exchange(nullptr, std::memory_order_acq_rel) == nullptr)
+        return;
+    ecs_os_api.task_new_  = s_previousTaskNew;
+    ecs_os_api.task_join_ = s_previousTaskJoin;
+}
+
+bool FlecsJobBridge::IsInstalled() noexcept
+{
+    return s_jobs.load(std::memory_order_acquire) != nullptr;
+}
+
+size_t FlecsJobBridge::StageCount() noexcept
+{
+    JobSystem* jobs = s_jobs.load(std::memory_order_acquire);
+    return jobs ? jobs->getWorkerCount() + 1 : 0;
+}
+} // namespace ECSModule
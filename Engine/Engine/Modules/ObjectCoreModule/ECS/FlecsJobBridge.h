@@ -0,0 +1,38 @@
+#pragma once
+#include <cstddef>
+
+namespace EngineCore::Foundation
+{
+class JobSystem;
+}
+
+namespace ECSModule
+{
+/// <summary>
+/// Runs flecs task threads on JobSystem workers.
+/// Once installed, worlds configured with EntityWorld::setTaskThreads() run the stages of
+/// multi_threaded() systems as jobs instead of flecs spawning its own threads. The bridge is
+/// process-wide because flecs keeps its OS API in a global.
+/// </summary>
+class FlecsJobBridge
+{
+  public:
+    /// <summary>
+    /// Routes flecs tasks to @p jobs. Returns false (and leaves flecs untouched) when the job
+    /// system has no running workers, e.g. when built with ENGINE_DISABLE_JOB_SYSTEM.
+    /// </summary>
+    static bool Install(EngineCore::Foundation::JobSystem* jobs);
+
+    /// <summary>
+    /// Restores the flecs task API. Worlds must not be progressed with task threads afterwards.
+    /// </summary>
+    static void Uninstall();
+
+    static bool IsInstalled() noexcept;
+
+    /// <summary>
+    /// Stages a world can use: job workers plus the thread calling progress(). 0 when not installed.
+    /// </summary>
+    static size_t StageCount() noexcept;
+};
+} // namespace ECSModule
@@ -0,0 +1,83 @@
+#include "PrefabLibrary.h"
+
+#include <EngineMinimal.h>
+#include <Foundation/Assert/Assert.h>
+#include <Modules/PhysicsModule/Components/ColliderComponent.h>
+
+#include <limits>
+
+namespace ECSModule
+{
+flecs::entity PrefabLibrary::create(flecs::world& world, const std::string& key, const std::string& json)
+{
+    flecs::entity prefab = world.prefab();
+    if (!json.empty() && !prefab.from_json(json.c_str()))
+    {
+        LT_LOGE("ECSModule", "Invalid prefab JSON: " + key);
+        prefab.destruct();
+        return flecs::entity();
+    }
+
+    // Every instance gets a BoundsComponent from its mesh or collider. With the column already on
+    // the prefab, instances are created in their final table instead of moving one by one.
+    if (!prefab.has<BoundsComponent>() &&
+        (prefab.has<MeshComponent>() || prefab.has<PhysicsModule::ColliderComponent>()))
+        prefab.set<BoundsComponent>({});
+
+    if (auto it = m_prefabs.find(key); it != m_prefabs.end() && world.is_alive(it->second))
+        world.entity(it->second).destruct();
+    m_prefabs[key] = prefab.id();
+    return prefab;
+}
+
+flecs::entity PrefabLibrary::find(flecs::world& world, const std::string& key)
+{
+    auto it = m_prefabs.find(key);
+    if (it == m_prefabs.end())
+        return flecs::entity();
+    if (!world.is_alive(it->second))
+    {
+        m_prefabs.erase(it);
+        return flecs::entity();
+    }
+    return world.entity(it->second);
+}
+
+size_t PrefabLibrary::Spawn(flecs::world& world, flecs::entity prefab, size_t count,
+                            const TransformComponent* transforms, std::vector<flecs::entity_t>& out)
+{
+    ZoneScopedN("PrefabLibrary::Spawn");
+    if (count == 0 || !prefab.is_alive())
+        return 0;
+    out.reserve(out.size() + count);
+
+    if (world.is_deferred())
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            flecs::entity e = world.entity().is_a(prefab);
+            if (transforms)
+                e.set<TransformComponent>(transforms[i]);
+            out.push_back(e.id());
+        }
+        return count;
+    }
+
+    LT_ASSERT_MSG(count <= static_cast<size_t>(std::numeric_limits<int32_t>::max()), "Spawn count too large");
+    ecs_bulk_desc_t desc{};
+    desc.count = static_cast<int32_t>(count);
+    desc.ids[0] = ecs_pair(EcsIsA, prefab.id());
+    void* data[FLECS_ID_DESC_MAX] = {};
+    if (transforms)
+    {
+        // Copied into the new column before OnSet fires, so observers see the final values
+        desc.ids[1] = world.id<TransformComponent>();
+        data[1] = const_cast<TransformComponent*>(transforms);
+        desc.data = data;
+    }
+
+    const ecs_entity_t* created = ecs_bulk_init(world.c_ptr(), &desc);
+    out.insert(out.end(), created, created + count);
+    return count;
+}
+} // namespace ECSModule
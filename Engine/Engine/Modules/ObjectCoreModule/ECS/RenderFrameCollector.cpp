@@ -0,0 +1,81 @@
+#include "RenderFrameCollector.h"
+
+#include <EngineMinimal.h>
+
+namespace ECSModule
+{
+void RenderFrameCollector::bind(flecs::world& world)
+{
+    m_meshes =
+        world.query_builder<const WorldTransformComponent, const MeshComponent>().cached().detect_changes().build();
+    m_cameras = world.query_builder<const TransformComponent, const CameraComponent>().cached().build();
+    m_bound = true;
+}
+
+void RenderFrameCollector::unbind()
+{
+    m_meshes = {};
+    m_cameras = {};
+    m_bound = false;
+}
+
+size_t RenderFrameCollector::collect(Events::ECS::RenderFrameData& out)
+{
+    ZoneScopedN("RenderFrameCollector::collect");
+    if (!m_bound)
+        return 0;
+
+    // The last camera wins, as before; it is always sent since the viewport aspect can change
+    // without the component being touched.
+    m_cameras.each([&](flecs::entity e, const TransformComponent& transform, const CameraComponent& cam) {
+        glm::vec3 position;
+        glm::quat quat;
+        GetWorldPose(e, transform, position, quat);
+        // Euler angles are only exact for roots; a parented camera gets them from its world rotation
+        const glm::vec3 euler = e.parent().is_valid()
+                                    ? glm::degrees(glm::eulerAngles(quat))
+                                    : glm::vec3(transform.rotation.x, transform.rotation.y, transform.rotation.z);
+        auto& camera = out.camera;
+        camera.posX = position.x;
+        camera.posY = position.y;
+        camera.posZ = position.z;
+        camera.rotX = euler.x;
+        camera.rotY = euler.y;
+        camera.rotZ = euler.z;
+        camera.rotQX = quat.x;
+        camera.rotQY = quat.y;
+        camera.rotQZ = quat.z;
+        camera.rotQW = quat.w;
+        camera.fov = cam.fov;
+        camera.aspect = cam.aspect;
+        camera.nearClip = cam.nearClip;
+        camera.farClip = cam.farClip;
+        out.hasCamera = true;
+    });
+
+    // Cheap check over the query's table monitors; a static scene stops here.
+    if (!m_meshes.changed())
+        return 0;
+
+    const size_t first = out.size();
+    m_meshes.run([&](flecs::iter& it) {
+        while (it.next())
+        {
+            if (!it.changed())
+                continue;
+
+            auto transforms = it.field<const WorldTransformComponent>(0);
+            const size_t count = it.count();
+            const size_t base = out.size();
+            out.entityIds.resize(base + count);
+            out.worldMatrices.resize(base + count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                out.entityIds[base + i] = it.entity(i).id();
+                out.worldMatrices[base + i] = transforms[i].matrix;
+            }
+        }
+    });
+    return out.size() - first;
+}
+} // namespace ECSModule
@@ -0,0 +1,30 @@
+#pragma once
+#include "Components/ECSComponents.h"
+#include "Events.h"
+#include "flecs.h"
+
+namespace ECSModule
+{
+/// <summary>
+/// Fills Events::ECS::RenderFrameData from cached queries with flecs change detection, so a
+/// frame only carries the world matrices TransformHierarchy wrote since the previous collect().
+/// Change detection is per table: one modified entity republishes the others stored with it.
+/// Writers have to go through set() or modified(), like the rest of the engine already does.
+/// </summary>
+class RenderFrameCollector
+{
+  public:
+    /// Builds the queries on @p world. The first collect() afterwards publishes every entity.
+    void bind(flecs::world& world);
+    /// Drops the queries; must run before the world they were built on is destroyed.
+    void unbind();
+
+    /// Appends changed world matrices and the active camera to @p out. Returns the transforms added.
+    size_t collect(Events::ECS::RenderFrameData& out);
+
+  private:
+    flecs::query<const WorldTransformComponent, const MeshComponent> m_meshes;
+    flecs::query<const TransformComponent, const CameraComponent> m_cameras;
+    bool m_bound = false;
+};
+} // namespace ECSModule
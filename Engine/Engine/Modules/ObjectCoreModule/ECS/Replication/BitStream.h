@@ -0,0 +1,216 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace ECSModule
+{
+/// <summary>
+/// Bit-packed buffer for replication snapshots. Bits fill each byte from the least significant
+/// end; bits past bitCount() are always zero, so two writers holding the same bits compare equal.
+/// </summary>
+class BitWriter
+{
+  public:
+    /// Low @p count bits of @p value, count up to 64.
+    void writeBits(uint64_t value, uint32_t count)
+    {
+        while (count > 0)
+        {
+            const size_t byte = m_bits >> 3;
+            const uint32_t used = static_cast<uint32_t>(m_bits & 7);
+            if (byte == m_bytes.size())
+                m_bytes.push_back(0);
+            const uint32_t take = std::min(8u - used, count);
+            m_bytes[byte] |= static_cast<uint8_t>((value & ((1u << take) - 1)) << used);
+            value >>= take;
+            count -= take;
+            m_bits += take;
+        }
+    }
+
+    void writeBool(bool value)
+    {
+        writeBits(value ? 1 : 0, 1);
+    }
+
+    /// 6-bit width, then the value in that many bits: 6 bits for 0, 14 for 255. @p value below 2^63.
+    void writeVarUint(uint64_t value)
+    {
+        const uint32_t width = std::min(static_cast<uint32_t>(std::bit_width(value)), 63u);
+        writeBits(width, 6);
+        writeBits(value, width);
+    }
+
+    /// Zigzag-mapped so small magnitudes of either sign stay short. |@p value| below 2^62.
+    void writeSigned(int64_t value)
+    {
+        writeVarUint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+    }
+
+    void writeBytes(const void* data, size_t size)
+    {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        if ((m_bits & 7) == 0)
+        {
+            m_bytes.insert(m_bytes.end(), bytes, bytes + size);
+            m_bits += size * 8;
+            return;
+        }
+        for (size_t i = 0; i < size; ++i)
+            writeBits(bytes[i], 8);
+    }
+
+    void append(const BitWriter& other)
+    {
+        const size_t whole = other.m_bits >> 3;
+        writeBytes(other.m_bytes.data(), whole);
+        if (const uint32_t rest = static_cast<uint32_t>(other.m_bits & 7))
+            writeBits(other.m_bytes[whole], rest);
+    }
+
+    /// Drops everything written after the first @p bits.
+    void truncate(size_t bits)
+    {
+        if (bits >= m_bits)
+            return;
+        m_bits = bits;
+        m_bytes.resize((bits + 7) >> 3);
+        if (const size_t rest = bits & 7)
+            m_bytes.back() &= static_cast<uint8_t>((1u << rest) - 1);
+    }
+
+    void clear() noexcept
+    {
+        m_bytes.clear();
+        m_bits = 0;
+    }
+
+    size_t bitCount() const noexcept
+    {
+        return m_bits;
+    }
+    size_t byteCount() const noexcept
+    {
+        return m_bytes.size();
+    }
+    const std::vector<uint8_t>& bytes() const noexcept
+    {
+        return m_bytes;
+    }
+
+    bool operator==(const BitWriter& other) const noexcept
+    {
+        return m_bits == other.m_bits && m_bytes == other.m_bytes;
+    }
+
+  private:
+    std::vector<uint8_t> m_bytes;
+    size_t m_bits = 0;
+};
+
+/// <summary>
+/// Reads what a BitWriter wrote. Reading past the end returns zeros and sets overflowed(), so a
+/// decoder can run to completion and check once.
+/// </summary>
+class BitReader
+{
+  public:
+    BitReader(const uint8_t* data, size_t size) noexcept : m_data(data), m_size(size * 8)
+    {
+    }
+
+    uint64_t readBits(uint32_t count)
+    {
+        if (count > m_size - m_bits)
+        {
+            m_overflow = true;
+            m_bits = m_size;
+            return 0;
+        }
+        uint64_t value = 0;
+        uint32_t shift = 0;
+        while (shift < count)
+        {
+            const uint32_t used = static_cast<uint32_t>(m_bits & 7);
+            const uint32_t take = std::min(8u - used, count - shift);
+            const uint64_t bits = (m_data[m_bits >> 3] >> used) & ((1u << take) - 1);
+            value |= bits << shift;
+            shift += take;
+            m_bits += take;
+        }
+        return value;
+    }
+
+    bool readBool()
+    {
+        return readBits(1) != 0;
+    }
+
+    uint64_t readVarUint()
+    {
+        return readBits(static_cast<uint32_t>(readBits(6)));
+    }
+
+    int64_t readSigned()
+    {
+        const uint64_t zigzag = readVarUint();
+        return static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1);
+    }
+
+    bool readBytes(void* data, size_t size)
+    {
+        auto* bytes = static_cast<uint8_t*>(data);
+        if (size * 8 > m_size - m_bits)
+        {
+            m_overflow = true;
+            m_bits = m_size;
+            std::memset(bytes, 0, size);
+            return false;
+        }
+        if ((m_bits & 7) == 0)
+        {
+            std::memcpy(bytes, m_data + (m_bits >> 3), size);
+            m_bits += size * 8;
+            return true;
+        }
+        for (size_t i = 0; i < size; ++i)
+            bytes[i] = static_cast<uint8_t>(readBits(8));
+        return true;
+    }
+
+    /// Advances without copying; what a decoder does with a value it has no place for.
+    void skipBits(size_t count)
+    {
+        if (count > m_size - m_bits)
+        {
+            m_overflow = true;
+            m_bits = m_size;
+            return;
+        }
+        m_bits += count;
+    }
+
+    size_t position() const noexcept
+    {
+        return m_bits;
+    }
+    size_t remainingBits() const noexcept
+    {
+        return m_size - m_bits;
+    }
+    bool overflowed() const noexcept
+    {
+        return m_overflow;
+    }
+
+  private:
+    const uint8_t* m_data;
+    size_t m_size;
+    size_t m_bits = 0;
+    bool m_overflow = false;
+};
+} // namespace ECSModule
@@ -0,0 +1,249 @@
+#include "Replication.h"
+#include "../Components/ECSComponents.h"
+
+#include <EngineMinimal.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace ECSModule
+{
+namespace
+{
+/// Keeps quantized values well inside what BitWriter::writeSigned() takes.
+constexpr double kQuantLimit = static_cast<double>(1ll << 40);
+constexpr float kSmallestThreeRange = 0.70710678f; ///< 1/sqrt(2): bound of the three smaller components
+
+int64_t Quantize(float value, float step) noexcept
+{
+    if (!std::isfinite(value))
+        return 0;
+    return static_cast<int64_t>(std::clamp(std::round(static_cast<double>(value) / step), -kQuantLimit, kQuantLimit));
+}
+
+float Dequantize(int64_t value, float step) noexcept
+{
+    return static_cast<float>(static_cast<double>(value) * step);
+}
+
+uint32_t HashBytes(uint32_t hash, const void* data, size_t size) noexcept
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+} // namespace
+
+ReplicationSchema::ReplicationSchema(flecs::world& world, const ReplicationConfig& config)
+    : m_world(world.c_ptr()), m_config(config)
+{
+    const ReplicationConfig defaults;
+    m_config.rotationBits = std::clamp(config.rotationBits, 4u, 24u);
+    if (!(m_config.positionStep > 0.0f))
+        m_config.positionStep = defaults.positionStep;
+    if (!(m_config.scaleStep > 0.0f))
+        m_config.scaleStep = defaults.scaleStep;
+    m_config.historyLength = std::max(config.historyLength, 1u);
+
+    std::vector<WorldBinaryLayout> layouts;
+    ecs_iter_t it = ecs_each_id(world.c_ptr(), world.id<ReplicatedTag>());
+    while (ecs_each_next(&it))
+    {
+        for (int32_t i = 0; i < it.count; ++i)
+        {
+            WorldBinaryLayout layout = WorldBinaryLayout::Build(world, it.entities[i]);
+            if (!layout.valid)
+            {
+                LT_LOGW("ECSModule", "Replication cannot encode component " + layout.path + "; not replicated");
+                continue;
+            }
+            layouts.push_back(std::move(layout));
+        }
+    }
+    std::sort(layouts.begin(), layouts.end(),
+              [](const WorldBinaryLayout& a, const WorldBinaryLayout& b) { return a.path < b.path; });
+    if (layouts.size() > kMaxComponents)
+    {
+        LT_LOGFW("ECSModule", "Replication supports {} components, {} are tagged; the rest are not replicated",
+                 kMaxComponents, layouts.size());
+        layouts.resize(kMaxComponents);
+    }
+
+    uint32_t hash = 2166136261u;
+    hash = HashBytes(hash, &m_config.positionStep, sizeof(float));
+    hash = HashBytes(hash, &m_config.rotationBits, sizeof(uint32_t));
+    hash = HashBytes(hash, &m_config.scaleStep, sizeof(float));
+    const flecs::entity_t transform = world.id<TransformComponent>();
+    for (WorldBinaryLayout& layout : layouts)
+    {
+        hash = HashBytes(hash, layout.path.data(), layout.path.size());
+        hash = HashBytes(hash, &layout.fingerprint, sizeof(layout.fingerprint));
+        if (layout.component == transform)
+            m_transform = m_layouts.size();
+        const EcsComponent* info = ecs_get(m_world, layout.component, EcsComponent);
+        m_strides.push_back(info ? static_cast<size_t>(info->size) : 0);
+        m_layouts.push_back(std::move(layout));
+    }
+    m_hash = hash;
+}
+
+void ReplicationSchema::encode(size_t index, const void* value, BitWriter& out, std::string& scratch) const
+{
+    if (index == m_transform)
+    {
+        encodeTransform(value, out);
+        return;
+    }
+
+    const auto* base = static_cast<const uint8_t*>(value);
+    for (const auto& field : m_layouts[index].fields)
+    {
+        const uint8_t* data = base + field.offset;
+        if (field.kind == WorldBinaryLayout::FieldKind::Raw)
+        {
+            if (field.type == ecs_id(ecs_bool_t))
+                out.writeBool(*data != 0);
+            else
+                out.writeBytes(data, field.size);
+            continue;
+        }
+        WorldBinaryLayout::GetText(m_world, field, data, scratch);
+        out.writeVarUint(scratch.size());
+        out.writeBytes(scratch.data(), scratch.size());
+    }
+}
+
+bool ReplicationSchema::decode(size_t index, BitReader& in, void* value, std::string& scratch) const
+{
+    if (index == m_transform)
+    {
+        decodeTransform(in, value);
+        return !in.overflowed();
+    }
+
+    auto* base = static_cast<uint8_t*>(value);
+    for (const auto& field : m_layouts[index].fields)
+    {
+        uint8_t* data = base ? base + field.offset : nullptr;
+        if (field.kind == WorldBinaryLayout::FieldKind::Raw)
+        {
+            if (field.type == ecs_id(ecs_bool_t))
+            {
+                const bool flag = in.readBool();
+                if (data)
+                    *data = flag ? 1 : 0;
+            }
+            else if (data)
+            {
+                in.readBytes(data, field.size);
+            }
+            else
+            {
+                in.skipBits(field.size * 8ull);
+            }
+            continue;
+        }
+
+        const uint64_t length = in.readVarUint();
+        if (length > in.remainingBits() / 8)
+        {
+            in.skipBits(in.remainingBits() + 1);
+            return false;
+        }
+        scratch.resize(static_cast<size_t>(length));
+        in.readBytes(scratch.data(), scratch.size());
+        if (data)
+            WorldBinaryLayout::SetText(m_world, field, data, scratch);
+    }
+    return !in.overflowed();
+}
+
+void ReplicationSchema::encodeTransform(const void* value, BitWriter& out) const
+{
+    const auto& transform = *static_cast<const TransformComponent*>(value);
+    out.writeSigned(Quantize(transform.position.x, m_config.positionStep));
+    out.writeSigned(Quantize(transform.position.y, m_config.positionStep));
+    out.writeSigned(Quantize(transform.position.z, m_config.positionStep));
+
+    // Smallest three: the largest component is implied by unit length, and flipping the sign of
+    // the quaternion (same rotation) makes it positive.
+    const glm::quat q = transform.rotation.toQuat();
+    const float components[4] = {q.x, q.y, q.z, q.w};
+    uint32_t largest = 0;
+    for (uint32_t i = 1; i < 4; ++i)
+    {
+        if (std::abs(components[i]) > std::abs(components[largest]))
+            largest = i;
+    }
+    const float sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+    const float levels = static_cast<float>((1u << m_config.rotationBits) - 1);
+    out.writeBits(largest, 2);
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        if (i == largest)
+            continue;
+        const float unit = std::clamp((components[i] * sign + kSmallestThreeRange) / (2.0f * kSmallestThreeRange),
+                                      0.0f, 1.0f);
+        out.writeBits(static_cast<uint64_t>(std::lround(unit * levels)), m_config.rotationBits);
+    }
+
+    const int64_t one = Quantize(1.0f, m_config.scaleStep);
+    const int64_t x = Quantize(transform.scale.x, m_config.scaleStep);
+    const int64_t y = Quantize(transform.scale.y, m_config.scaleStep);
+    const int64_t z = Quantize(transform.scale.z, m_config.scaleStep);
+    const bool unit = x == one && y == one && z == one;
+    out.writeBool(unit);
+    if (unit)
+        return;
+    const bool uniform = x == y && y == z;
+    out.writeBool(uniform);
+    out.writeSigned(x);
+    if (!uniform)
+    {
+        out.writeSigned(y);
+        out.writeSigned(z);
+    }
+}
+
+void ReplicationSchema::decodeTransform(BitReader& in, void* value) const
+{
+    glm::vec3 position;
+    position.x = Dequantize(in.readSigned(), m_config.positionStep);
+    position.y = Dequantize(in.readSigned(), m_config.positionStep);
+    position.z = Dequantize(in.readSigned(), m_config.positionStep);
+
+    const auto largest = static_cast<uint32_t>(in.readBits(2));
+    const float levels = static_cast<float>((1u << m_config.rotationBits) - 1);
+    float components[4] = {};
+    float sum = 0.0f;
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        if (i == largest)
+            continue;
+        const float unit = static_cast<float>(in.readBits(m_config.rotationBits)) / levels;
+        components[i] = unit * 2.0f * kSmallestThreeRange - kSmallestThreeRange;
+        sum += components[i] * components[i];
+    }
+    components[largest] = std::sqrt(std::max(1.0f - sum, 0.0f));
+
+    glm::vec3 scale(1.0f);
+    if (!in.readBool())
+    {
+        const bool uniform = in.readBool();
+        scale.x = Dequantize(in.readSigned(), m_config.scaleStep);
+        scale.y = uniform ? scale.x : Dequantize(in.readSigned(), m_config.scaleStep);
+        scale.z = uniform ? scale.x : Dequantize(in.readSigned(), m_config.scaleStep);
+    }
+
+    if (!value || in.overflowed())
+        return;
+    auto& transform = *static_cast<TransformComponent*>(value);
+    transform.position.fromGLMVec(position);
+    transform.rotation.fromQuat(glm::quat(components[3], components[0], components[1], components[2]));
+    transform.scale.fromGMLVec(scale);
+}
+} // namespace ECSModule
@@ -0,0 +1,94 @@
+#pragma once
+#include "BitStream.h"
+#include "../Serialization/WorldBinarySerializer.h"
+
+#include <flecs.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ECSModule
+{
+/// <summary>
+/// Entity id shared by a ReplicationServer and its clients. Never reused within a session; 0 is none.
+/// </summary>
+using NetId = uint32_t;
+
+/// <summary>
+/// Quantization and history settings. Server and clients must use the same values: they are
+/// part of the schema hash every snapshot carries.
+/// </summary>
+struct ReplicationConfig
+{
+    float positionStep = 1.0f / 256.0f; ///< TransformComponent position precision, world units
+    uint32_t rotationBits = 12;         ///< Per smallest-three quaternion component, 4 to 24
+    float scaleStep = 1.0f / 1024.0f;   ///< TransformComponent scale precision
+    uint32_t historyLength = 64;        ///< Unacknowledged snapshots a server keeps per client
+};
+
+/// <summary>
+/// The replicated components of a world, found through ReplicatedTag on the component entities
+/// and ordered by path so that every world registering the same components agrees on indices.
+///
+/// Components are encoded from their reflection layout (WorldBinaryLayout): bools as one bit,
+/// other fixed-size fields as their bytes, strings and asset ids as a varuint length plus bytes.
+/// TransformComponent has its own codec: position in positionStep units, rotation as the smallest
+/// three quaternion components in rotationBits each, scale as one bit when it is 1 and one value
+/// when it is uniform.
+/// </summary>
+class ReplicationSchema
+{
+  public:
+    static constexpr size_t kMaxComponents = 32;
+
+    ReplicationSchema(flecs::world& world, const ReplicationConfig& config);
+
+    size_t size() const noexcept
+    {
+        return m_layouts.size();
+    }
+    const WorldBinaryLayout& layout(size_t index) const noexcept
+    {
+        return m_layouts[index];
+    }
+    flecs::entity_t component(size_t index) const noexcept
+    {
+        return m_layouts[index].component;
+    }
+    size_t stride(size_t index) const noexcept
+    {
+        return m_strides[index];
+    }
+    /// Covers the component paths, their layouts and the quantization settings.
+    uint32_t hash() const noexcept
+    {
+        return m_hash;
+    }
+    const ReplicationConfig& config() const noexcept
+    {
+        return m_config;
+    }
+
+    /// <summary>
+    /// Appends the component at @p value. Encoding the same value twice gives the same bits,
+    /// which is how a server tells a real change from a write of the old value.
+    /// </summary>
+    void encode(size_t index, const void* value, BitWriter& out, std::string& scratch) const;
+    /// <summary>
+    /// Reads a component into @p value, or past it when @p value is null. False on overflow.
+    /// </summary>
+    bool decode(size_t index, BitReader& in, void* value, std::string& scratch) const;
+
+  private:
+    void encodeTransform(const void* value, BitWriter& out) const;
+    void decodeTransform(BitReader& in, void* value) const;
+
+    const ecs_world_t* m_world;
+    ReplicationConfig m_config;
+    std::vector<WorldBinaryLayout> m_layouts;
+    std::vector<size_t> m_strides;
+    size_t m_transform = SIZE_MAX; ///< Index of TransformComponent, if replicated
+    uint32_t m_hash = 0;
+};
+} // namespace ECSModule
@@ -0,0 +1,260 @@
+#include "ReplicationClient.h"
+#include "../EntityWorld.h"
+#include "../Events.h"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+namespace ECSModule
+{
+ReplicationClient::ReplicationClient(EntityWorld& world, const ReplicationConfig& config)
+    : m_world(world), m_schema(world.get(), config)
+{
+}
+
+ReplicationClient::~ReplicationClient()
+{
+    clear();
+}
+
+bool ReplicationClient::fail(std::string message)
+{
+    m_error = std::move(message);
+    LT_LOGSW_LIMIT("ECSModule", 1, "Replication snapshot rejected: {}", m_error);
+    return false;
+}
+
+bool ReplicationClient::apply(std::span<const uint8_t> snapshot)
+{
+    ZoneScopedN("ReplicationClient::apply");
+    BitReader in(snapshot.data(), snapshot.size());
+    const auto tick = static_cast<uint32_t>(in.readBits(32));
+    const auto baselineTick = static_cast<uint32_t>(in.readBits(32));
+    const auto hash = static_cast<uint32_t>(in.readBits(32));
+    if (in.overflowed())
+        return fail("truncated header");
+    if (hash != m_schema.hash())
+        return fail("built from different replicated components or settings");
+    if (tick <= m_lastTick)
+    {
+        // Reordered or repeated; not worth a warning
+        m_error = "stale snapshot";
+        return false;
+    }
+
+    const Scope* baseline = nullptr;
+    if (baselineTick != 0)
+    {
+        for (const Scope& scope : m_scopes)
+        {
+            if (scope.tick == baselineTick)
+                baseline = &scope;
+        }
+        if (!baseline)
+            return fail("delta against unknown snapshot " + std::to_string(baselineTick));
+    }
+    if (!parse(in, baseline))
+        return false;
+
+    flecs::world& ecs = m_world.get();
+    ecs_world_t* world = ecs.c_ptr();
+    Events::ECS::EntitiesSpawned spawned{0, {}};
+    Scope scope;
+    scope.tick = tick;
+    if (baseline)
+        std::set_difference(baseline->ids.begin(), baseline->ids.end(), m_removals.begin(), m_removals.end(),
+                            std::back_inserter(scope.ids));
+
+    for (const Update& update : m_updates)
+    {
+        auto [ghost, created] = m_ghosts.try_emplace(update.id, 0);
+        if (created || !ecs.is_alive(ghost->second))
+        {
+            ghost->second = ecs.entity().id();
+            spawned.ids.push_back(ghost->second);
+        }
+        const flecs::entity_t entity = ghost->second;
+
+        for (uint32_t i = 0; i < m_schema.size() && update.hasMask; ++i)
+        {
+            const bool wanted = (update.mask & (1u << i)) != 0;
+            if (wanted != ecs_has_id(world, entity, m_schema.component(i)))
+            {
+                if (wanted)
+                    ecs_add_id(world, entity, m_schema.component(i));
+                else
+                    ecs_remove_id(world, entity, m_schema.component(i));
+            }
+        }
+
+        BitReader values(snapshot.data(), snapshot.size());
+        values.skipBits(update.payload);
+        for (uint32_t i = 0; i < m_schema.size(); ++i)
+        {
+            if (!(update.changed & (1u << i)))
+                continue;
+            const flecs::entity_t component = m_schema.component(i);
+            ecs_add_id(world, entity, component);
+            void* value = m_schema.stride(i) > 0 ? ecs_get_mut_id(world, entity, component) : nullptr;
+            m_schema.decode(i, values, value, m_text);
+            if (value)
+                ecs_modified_id(world, entity, component);
+        }
+        if (update.hasParent && update.parent)
+            m_parents[update.id] = update.parent;
+        else if (update.hasParent)
+            m_parents.erase(update.id);
+        scope.ids.push_back(update.id);
+    }
+    std::sort(scope.ids.begin(), scope.ids.end());
+    scope.ids.erase(std::unique(scope.ids.begin(), scope.ids.end()), scope.ids.end());
+    attachParents(scope);
+
+    // Removed, or out of the scope the server based this snapshot on
+    Events::ECS::EntitiesDestroyed destroyed;
+    ecs.defer_begin();
+    for (auto it = m_ghosts.begin(); it != m_ghosts.end();)
+    {
+        if (std::binary_search(scope.ids.begin(), scope.ids.end(), it->first))
+        {
+            ++it;
+            continue;
+        }
+        if (ecs.is_alive(it->second))
+        {
+            ecs.entity(it->second).destruct();
+            destroyed.ids.push_back(it->second);
+        }
+        it = m_ghosts.erase(it);
+    }
+    ecs.defer_end();
+
+    // The server never goes back to a baseline older than the one it just used
+    while (!m_scopes.empty() && m_scopes.front().tick < baselineTick)
+        m_scopes.pop_front();
+    m_scopes.push_back(std::move(scope));
+    while (m_scopes.size() > m_schema.config().historyLength)
+        m_scopes.pop_front();
+    m_lastTick = tick;
+    m_error.clear();
+
+    if (!spawned.ids.empty())
+        m_world.events().emit(spawned);
+    if (!destroyed.ids.empty())
+        m_world.events().emit(destroyed);
+    return true;
+}
+
+void ReplicationClient::attachParents(const Scope& scope)
+{
+    ecs_world_t* world = m_world.get().c_ptr();
+    auto inScope = [&scope](NetId id) { return std::binary_search(scope.ids.begin(), scope.ids.end(), id); };
+    for (auto it = m_parents.begin(); it != m_parents.end();)
+    {
+        if (!inScope(it->first))
+        {
+            it = m_parents.erase(it);
+            continue;
+        }
+        const flecs::entity_t child = find(it->first);
+        const flecs::entity_t parent = inScope(it->second) ? find(it->second) : 0;
+        ++it;
+        if (!child || !ecs_is_alive(world, child))
+            continue;
+        // Deleting a parent deletes its children, so one leaving the scope is let go of first
+        const flecs::entity_t wanted = parent && ecs_is_alive(world, parent) ? parent : 0;
+        const flecs::entity_t current = ecs_get_target(world, child, EcsChildOf, 0);
+        if (current == wanted)
+            continue;
+        if (wanted)
+            ecs_add_pair(world, child, EcsChildOf, wanted);
+        else
+            ecs_remove_pair(world, child, EcsChildOf, EcsWildcard);
+    }
+}
+
+bool ReplicationClient::parse(BitReader& in, const Scope* baseline)
+{
+    m_removals.clear();
+    m_updates.clear();
+
+    // Every removal takes at least 7 bits
+    const uint64_t removals = in.readVarUint();
+    if (removals * 7 > in.remainingBits())
+        return fail("corrupt removal count");
+    uint64_t id = 0;
+    for (uint64_t i = 0; i < removals; ++i)
+    {
+        const uint64_t gap = in.readVarUint();
+        id += gap;
+        if (gap == 0 || id > std::numeric_limits<NetId>::max())
+            return fail("corrupt removal list");
+        m_removals.push_back(static_cast<NetId>(id));
+    }
+
+    const auto components = static_cast<uint32_t>(m_schema.size());
+    const uint32_t all = components == 32 ? ~0u : (1u << components) - 1;
+    while (in.readBool())
+    {
+        Update update;
+        const uint64_t netId = in.readVarUint();
+        update.full = in.readBool();
+        update.hasMask = update.full || in.readBool();
+        if (update.hasMask)
+            update.mask = static_cast<uint32_t>(in.readBits(components));
+        update.changed = update.full ? update.mask : static_cast<uint32_t>(in.readBits(components));
+        update.hasParent = update.full || in.readBool();
+        const uint64_t parent = update.hasParent ? in.readVarUint() : 0;
+        if (in.overflowed())
+            return fail("truncated update");
+        if (netId == 0 || netId > std::numeric_limits<NetId>::max() || (update.mask & ~all) ||
+            (update.changed & ~all) || parent > std::numeric_limits<NetId>::max() || parent == netId)
+            return fail("corrupt update");
+        update.parent = static_cast<NetId>(parent);
+        update.id = static_cast<NetId>(netId);
+        if (!update.full && (!baseline || !std::binary_search(baseline->ids.begin(), baseline->ids.end(), update.id) ||
+                             !m_ghosts.contains(update.id)))
+            return fail("delta for unknown entity " + std::to_string(update.id));
+
+        update.payload = in.position();
+        for (uint32_t i = 0; i < components; ++i)
+        {
+            if ((update.changed & (1u << i)) && !m_schema.decode(i, in, nullptr, m_text))
+                return fail("truncated component " + m_schema.layout(i).path);
+        }
+        m_updates.push_back(update);
+    }
+    if (in.overflowed())
+        return fail("truncated update list");
+    return true;
+}
+
+flecs::entity_t ReplicationClient::find(NetId id) const
+{
+    auto found = m_ghosts.find(id);
+    return found != m_ghosts.end() ? found->second : 0;
+}
+
+void ReplicationClient::clear()
+{
+    flecs::world& ecs = m_world.get();
+    Events::ECS::EntitiesDestroyed destroyed;
+    ecs.defer_begin();
+    for (const auto& [id, entity] : m_ghosts)
+    {
+        if (ecs.is_alive(entity))
+        {
+            ecs.entity(entity).destruct();
+            destroyed.ids.push_back(entity);
+        }
+    }
+    ecs.defer_end();
+    m_ghosts.clear();
+    m_parents.clear();
+    m_scopes.clear();
+    m_lastTick = 0;
+    if (!destroyed.ids.empty())
+        m_world.events().emit(destroyed);
+}
+} // namespace ECSModule
@@ -0,0 +1,106 @@
+#pragma once
+#include "Replication.h"
+
+#include <EngineMinimal.h>
+
+#include <deque>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class EntityWorld;
+
+namespace ECSModule
+{
+/// <summary>
+/// Applies ReplicationServer snapshots to a local EntityWorld, creating, updating and deleting
+/// the entities they describe (ghosts). The world must register the same replicated components
+/// with the same ReplicationConfig; a snapshot whose schema hash differs is rejected.
+///
+/// A snapshot is checked in full before anything is applied, so a truncated or corrupt buffer
+/// leaves the world untouched. Send lastTick() back to the server as the acknowledgement.
+/// New ghosts are announced with EntitiesSpawned, deleted ones with EntitiesDestroyed.
+///
+/// Ghosts are parented (ChildOf) to the ghost of the parent NetId the server sends, so local
+/// transforms resolve as on the server. A ghost whose parent is not in the client's scope stays
+/// a root until the parent arrives; it is detached rather than deleted when its parent leaves.
+/// </summary>
+class ReplicationClient
+{
+  public:
+    explicit ReplicationClient(EntityWorld& world, const ReplicationConfig& config = {});
+    /// Deletes the ghosts.
+    ~ReplicationClient();
+
+    ReplicationClient(const ReplicationClient&) = delete;
+    ReplicationClient& operator=(const ReplicationClient&) = delete;
+
+    /// <summary>
+    /// Applies one snapshot. False for a snapshot that is corrupt, built from another schema,
+    /// older than the last one applied, or a delta against a snapshot this client never applied.
+    /// </summary>
+    bool apply(std::span<const uint8_t> snapshot);
+
+    /// Tick of the last snapshot applied; 0 before the first
+    uint32_t lastTick() const noexcept
+    {
+        return m_lastTick;
+    }
+    /// Local entity of @p id, 0 when the client has none
+    flecs::entity_t find(NetId id) const;
+    size_t entityCount() const noexcept
+    {
+        return m_ghosts.size();
+    }
+    /// Deletes every ghost and forgets the snapshots applied; the next one must be a full snapshot.
+    void clear();
+
+    const ReplicationSchema& getSchema() const noexcept
+    {
+        return m_schema;
+    }
+    const std::string& error() const noexcept
+    {
+        return m_error;
+    }
+
+  private:
+    /// Entities a snapshot left the client with, sorted
+    struct Scope
+    {
+        uint32_t tick = 0;
+        std::vector<NetId> ids;
+    };
+
+    struct Update
+    {
+        NetId id = 0;
+        bool full = false;
+        bool hasMask = false;
+        uint32_t mask = 0;
+        uint32_t changed = 0;
+        bool hasParent = false;
+        NetId parent = 0;
+        size_t payload = 0; ///< Bit offset of the component values
+    };
+
+    bool fail(std::string message);
+    bool parse(BitReader& in, const Scope* baseline);
+    /// Matches the ghosts' ChildOf pairs to m_parents for the ghosts of @p scope
+    void attachParents(const Scope& scope);
+
+    EntityWorld& m_world;
+    ReplicationSchema m_schema;
+    std::unordered_map<NetId, flecs::entity_t> m_ghosts;
+    std::unordered_map<NetId, NetId> m_parents; ///< Parent NetId of every parented ghost
+    std::deque<Scope> m_scopes;
+    uint32_t m_lastTick = 0;
+
+    // Filled by parse()
+    std::vector<NetId> m_removals;
+    std::vector<Update> m_updates;
+    std::string m_text;
+    std::string m_error;
+};
+} // namespace ECSModule
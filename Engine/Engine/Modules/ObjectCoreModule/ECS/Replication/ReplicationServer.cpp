@@ -0,0 +1,463 @@
+#include "ReplicationServer.h"
+#include "../EntityWorld.h"
+
+#include <algorithm>
+
+namespace ECSModule
+{
+namespace
+{
+NetId Key(NetId id) noexcept
+{
+    return id;
+}
+
+NetId Key(const std::pair<NetId, uint32_t>& item) noexcept
+{
+    return item.first;
+}
+} // namespace
+
+ReplicationServer::ReplicationServer(EntityWorld& world, const ReplicationConfig& config)
+    : m_world(world), m_schema(world.get(), config)
+{
+    flecs::world& ecs = world.get();
+    for (uint32_t i = 0; i < m_schema.size(); ++i)
+    {
+        const flecs::entity_t component = m_schema.component(i);
+        // Recorded here, applied by capture(): observers run inside whatever is changing the
+        // world, and a snapshot only ever describes captured state.
+        m_observers.push_back(ecs.observer<>()
+                                  .with(component)
+                                  .event(flecs::OnAdd)
+                                  .yield_existing()
+                                  .run([this, i](flecs::iter& it) {
+                                      while (it.next())
+                                          for (auto row : it)
+                                              m_membership.push_back({it.entity(row).id(), i, true});
+                                  }));
+        m_observers.push_back(ecs.observer<>()
+                                  .with(component)
+                                  .event(flecs::OnRemove)
+                                  .run([this, i](flecs::iter& it) {
+                                      while (it.next())
+                                          for (auto row : it)
+                                              m_membership.push_back({it.entity(row).id(), i, false});
+                                  }));
+        // Tags have no values; their presence travels in the component mask.
+        m_changes.push_back(m_schema.stride(i) > 0
+                                ? ecs.query_builder<>().with(component).in().cached().detect_changes().build()
+                                : flecs::query<>{});
+    }
+    m_observers.push_back(ecs.observer<>()
+                              .with(flecs::ChildOf, flecs::Wildcard)
+                              .event(flecs::OnAdd)
+                              .event(flecs::OnRemove)
+                              .run([this](flecs::iter& it) {
+                                  while (it.next())
+                                      for (auto row : it)
+                                          m_reparented.push_back(it.entity(row).id());
+                              }));
+    m_positions = ecs.query_builder<const WorldTransformComponent>().cached().detect_changes().build();
+}
+
+ReplicationServer::~ReplicationServer()
+{
+    for (flecs::observer& observer : m_observers)
+        observer.destruct();
+    m_changes.clear();
+    m_positions = {};
+}
+
+void ReplicationServer::capture()
+{
+    ZoneScopedN("ReplicationServer::capture");
+    ++m_tick;
+    m_stats.changedComponents = 0;
+    applyMembership();
+    refreshParents();
+
+    // Only tables written since the last capture; unchanged entities in them re-encode to the
+    // same bits and keep their tick.
+    for (uint32_t i = 0; i < m_changes.size(); ++i)
+    {
+        if (m_schema.stride(i) == 0 || !m_changes[i].changed())
+            continue;
+        const size_t stride = m_schema.stride(i);
+        m_changes[i].run([&](flecs::iter& it) {
+            while (it.next())
+            {
+                if (!it.changed())
+                    continue;
+                const auto* base = static_cast<const uint8_t*>(ecs_field_w_size(it.c_ptr(), stride, 0));
+                for (auto row : it)
+                {
+                    auto found = m_byEntity.find(it.entity(row).id());
+                    if (found != m_byEntity.end())
+                        encode(m_entries[found->second], i, base + stride * row);
+                }
+            }
+        });
+    }
+
+    if (m_positions.changed())
+    {
+        m_positions.run([&](flecs::iter& it) {
+            while (it.next())
+            {
+                if (!it.changed())
+                    continue;
+                auto transforms = it.field<const WorldTransformComponent>(0);
+                for (auto row : it)
+                {
+                    auto found = m_byEntity.find(it.entity(row).id());
+                    if (found == m_byEntity.end())
+                        continue;
+                    Entry& entry = m_entries[found->second];
+                    entry.position = transforms[row].position();
+                    entry.hasPosition = true;
+                }
+            }
+        });
+    }
+
+    m_stats.entities = static_cast<uint32_t>(m_entries.size());
+    LT_METRIC_GAUGE_SET("replication_entities", "Entities tracked by the replication server", m_stats.entities);
+    LT_METRIC_COUNTER_ADD("replication_changed_components", "Replicated component values that changed",
+                          m_stats.changedComponents);
+}
+
+void ReplicationServer::applyMembership()
+{
+    for (const Membership& change : m_membership)
+    {
+        auto found = m_byEntity.find(change.entity);
+        if (found == m_byEntity.end())
+        {
+            if (!change.added)
+                continue;
+            found = m_byEntity.emplace(change.entity, m_entries.size()).first;
+            Entry& entry = m_entries.emplace_back();
+            entry.entity = change.entity;
+            entry.components.resize(m_schema.size());
+        }
+
+        Entry& entry = m_entries[found->second];
+        const uint32_t bit = 1u << change.component;
+        entry.mask = change.added ? entry.mask | bit : entry.mask & ~bit;
+        if (!entry.touched)
+        {
+            entry.touched = true;
+            m_touched.push_back(change.entity);
+        }
+    }
+    m_membership.clear();
+
+    flecs::world& ecs = m_world.get();
+    for (flecs::entity_t entity : m_touched)
+    {
+        const size_t index = m_byEntity.at(entity);
+        Entry& entry = m_entries[index];
+        entry.touched = false;
+        if (entry.mask == 0 || !ecs.is_alive(entity))
+        {
+            // Children that stay replicated lose their parent's NetId
+            if (entry.id != 0 && ecs.is_alive(entity))
+                queueChildren(entity);
+            erase(index);
+            continue;
+        }
+
+        flecs::entity handle = ecs.entity(entity);
+        if (entry.id == 0)
+        {
+            entry.id = m_nextId++;
+            m_byNetId.emplace(entry.id, index);
+            readPosition(entry);
+            m_reparented.push_back(entity);
+            queueChildren(entity);
+        }
+        const auto* camera = handle.get<CameraComponent>();
+        entry.excluded = handle.has<EditorOnlyTag>() || (camera && camera->isViewportCamera);
+
+        if (entry.mask == entry.capturedMask)
+            continue;
+        entry.maskTick = m_tick;
+        for (uint32_t i = 0; i < m_schema.size(); ++i)
+        {
+            const uint32_t bit = 1u << i;
+            if ((entry.mask & bit) && !(entry.capturedMask & bit))
+            {
+                const void* value = ecs_get_id(ecs.c_ptr(), entity, m_schema.component(i));
+                if (value || m_schema.stride(i) == 0)
+                    encode(entry, i, value);
+            }
+            else if (!(entry.mask & bit) && (entry.capturedMask & bit))
+            {
+                entry.components[i] = {};
+            }
+        }
+        entry.capturedMask = entry.mask;
+    }
+    m_touched.clear();
+}
+
+void ReplicationServer::refreshParents()
+{
+    ecs_world_t* world = m_world.get().c_ptr();
+    for (flecs::entity_t entity : m_reparented)
+    {
+        auto found = m_byEntity.find(entity);
+        if (found == m_byEntity.end() || !ecs_is_alive(world, entity))
+            continue;
+        Entry& entry = m_entries[found->second];
+        const flecs::entity_t target = ecs_get_target(world, entity, EcsChildOf, 0);
+        const NetId parent = target ? getNetId(target) : 0;
+        if (parent == entry.parent)
+            continue;
+        entry.parent = parent;
+        entry.parentTick = m_tick;
+    }
+    m_reparented.clear();
+}
+
+void ReplicationServer::queueChildren(flecs::entity_t entity)
+{
+    m_world.get().entity(entity).children([this](flecs::entity child) { m_reparented.push_back(child.id()); });
+}
+
+void ReplicationServer::erase(size_t index)
+{
+    m_byEntity.erase(m_entries[index].entity);
+    if (m_entries[index].id != 0)
+        m_byNetId.erase(m_entries[index].id);
+
+    if (index + 1 != m_entries.size())
+    {
+        m_entries[index] = std::move(m_entries.back());
+        m_byEntity[m_entries[index].entity] = index;
+        if (m_entries[index].id != 0)
+            m_byNetId[m_entries[index].id] = index;
+    }
+    m_entries.pop_back();
+}
+
+void ReplicationServer::encode(Entry& entry, uint32_t component, const void* value)
+{
+    m_scratch.clear();
+    m_schema.encode(component, value, m_scratch, m_text);
+    ComponentState& state = entry.components[component];
+    if (state.changedTick != 0 && state.bits == m_scratch)
+        return;
+    std::swap(state.bits, m_scratch);
+    state.changedTick = m_tick;
+    ++m_stats.changedComponents;
+}
+
+void ReplicationServer::readPosition(Entry& entry)
+{
+    if (const auto* transform = m_world.get().entity(entry.entity).get<WorldTransformComponent>())
+    {
+        entry.position = transform->position();
+        entry.hasPosition = true;
+    }
+}
+
+ReplicationServer::Client* ReplicationServer::findClient(ClientId client)
+{
+    auto it = std::find_if(m_clients.begin(), m_clients.end(), [client](const Client& c) { return c.id == client; });
+    return it != m_clients.end() ? &*it : nullptr;
+}
+
+ReplicationServer::ClientId ReplicationServer::addClient(const ClientSettings& settings)
+{
+    Client& client = m_clients.emplace_back();
+    client.id = m_nextClient++;
+    client.settings = settings;
+    return client.id;
+}
+
+void ReplicationServer::removeClient(ClientId client)
+{
+    std::erase_if(m_clients, [client](const Client& c) { return c.id == client; });
+}
+
+void ReplicationServer::setClientSettings(ClientId client, const ClientSettings& settings)
+{
+    if (Client* c = findClient(client))
+        c->settings = settings;
+}
+
+void ReplicationServer::setClientFocus(ClientId client, const Math::Vec3& position)
+{
+    if (Client* c = findClient(client))
+        c->focus = position;
+}
+
+void ReplicationServer::acknowledge(ClientId client, uint32_t tick)
+{
+    Client* c = findClient(client);
+    if (!c || tick <= c->acked || tick > m_tick)
+        return;
+    c->acked = tick;
+    // Acknowledgements only move forward, so nothing older can become a baseline again
+    while (!c->history.empty() && c->history.front().tick < tick)
+        c->history.pop_front();
+}
+
+bool ReplicationServer::writeSnapshot(ClientId clientId, std::vector<uint8_t>& out)
+{
+    ZoneScopedN("ReplicationServer::writeSnapshot");
+    Client* client = findClient(clientId);
+    if (!client || (!client->history.empty() && client->history.back().tick == m_tick))
+        return false;
+
+    const Record* baseline = nullptr;
+    for (const Record& record : client->history)
+    {
+        if (record.tick == client->acked)
+            baseline = &record;
+    }
+
+    // Relevant entities, nearest first
+    ++m_stamp;
+    m_candidates.clear();
+    const float radius = client->settings.relevanceRadius;
+    for (size_t i = 0; i < m_entries.size(); ++i)
+    {
+        Entry& entry = m_entries[i];
+        if (entry.excluded)
+            continue;
+        const float distance = entry.hasPosition ? glm::distance(entry.position, client->focus) : 0.0f;
+        if (radius > 0.0f && distance > radius)
+            continue;
+        entry.relevantStamp = m_stamp;
+        m_candidates.emplace_back(distance, i);
+    }
+    std::sort(m_candidates.begin(), m_candidates.end(), [this](const auto& a, const auto& b) {
+        return a.first != b.first ? a.first < b.first : m_entries[a.second].id < m_entries[b.second].id;
+    });
+
+    m_removals.clear();
+    if (baseline)
+    {
+        for (const auto& [id, tick] : baseline->entities)
+        {
+            auto found = m_byNetId.find(id);
+            if (found == m_byNetId.end() || m_entries[found->second].relevantStamp != m_stamp)
+                m_removals.push_back(id);
+        }
+    }
+
+    BitWriter& bits = m_snapshot;
+    bits.clear();
+    bits.writeBits(m_tick, 32);
+    bits.writeBits(baseline ? baseline->tick : 0, 32);
+    bits.writeBits(m_schema.hash(), 32);
+    bits.writeVarUint(m_removals.size());
+    NetId previous = 0;
+    for (NetId id : m_removals)
+    {
+        bits.writeVarUint(id - previous);
+        previous = id;
+    }
+
+    Record record;
+    record.tick = m_tick;
+    record.entities.reserve(m_candidates.size());
+    // One bit stays free for the end of the list
+    const size_t limit = static_cast<size_t>(client->settings.maxSnapshotBytes) * 8;
+    const auto components = static_cast<uint32_t>(m_schema.size());
+    uint32_t sent = 0;
+    uint32_t deferred = 0;
+    for (const auto& candidate : m_candidates)
+    {
+        const Entry& entry = m_entries[candidate.second];
+        bool known = false;
+        uint32_t upToDate = 0;
+        if (baseline)
+        {
+            auto it = std::lower_bound(baseline->entities.begin(), baseline->entities.end(), entry.id,
+                                       [](const auto& a, const auto& b) { return Key(a) < Key(b); });
+            if (it != baseline->entities.end() && it->first == entry.id)
+            {
+                known = true;
+                upToDate = it->second;
+            }
+            // Dropped by a later snapshot: the client may have deleted it, so it starts over
+            for (auto record = client->history.rbegin(); known && record->tick > baseline->tick; ++record)
+                known = std::binary_search(record->entities.begin(), record->entities.end(), entry.id,
+                                           [](const auto& a, const auto& b) { return Key(a) < Key(b); });
+        }
+
+        uint32_t changed = 0;
+        for (uint32_t i = 0; i < components; ++i)
+        {
+            if ((entry.mask & (1u << i)) && (!known || entry.components[i].changedTick > upToDate))
+                changed |= 1u << i;
+        }
+        const bool maskChanged = !known || entry.maskTick > upToDate;
+        const bool parentChanged = !known || entry.parentTick > upToDate;
+        if (known && !maskChanged && changed == 0 && !parentChanged)
+        {
+            record.entities.emplace_back(entry.id, upToDate);
+            continue;
+        }
+
+        const size_t start = bits.bitCount();
+        bits.writeBool(true);
+        bits.writeVarUint(entry.id);
+        bits.writeBool(!known);
+        if (known)
+            bits.writeBool(maskChanged);
+        if (maskChanged)
+            bits.writeBits(entry.mask, components);
+        if (known)
+        {
+            bits.writeBits(changed, components);
+            bits.writeBool(parentChanged);
+        }
+        if (parentChanged)
+            bits.writeVarUint(entry.parent);
+        for (uint32_t i = 0; i < components; ++i)
+        {
+            if (changed & (1u << i))
+                bits.append(entry.components[i].bits);
+        }
+
+        if (bits.bitCount() + 1 > limit)
+        {
+            // Over budget: a known entity keeps what the client has, a new one waits outside its scope
+            bits.truncate(start);
+            ++deferred;
+            if (known)
+                record.entities.emplace_back(entry.id, upToDate);
+            continue;
+        }
+        record.entities.emplace_back(entry.id, m_tick);
+        ++sent;
+    }
+    bits.writeBool(false);
+
+    std::sort(record.entities.begin(), record.entities.end());
+    client->history.push_back(std::move(record));
+    while (client->history.size() > m_schema.config().historyLength)
+        client->history.pop_front();
+
+    out.assign(bits.bytes().begin(), bits.bytes().end());
+    m_stats.lastSnapshotBytes = static_cast<uint32_t>(out.size());
+    m_stats.lastSnapshotEntities = sent;
+    m_stats.lastSnapshotDeferred = deferred;
+    ++m_stats.snapshotsWritten;
+    m_stats.bytesWritten += out.size();
+    LT_METRIC_COUNTER_ADD("replication_snapshot_bytes", "Replication snapshot bytes written", out.size());
+    LT_METRIC_OBSERVE("replication_snapshot_entities", "Entity updates per replication snapshot", sent);
+    return true;
+}
+
+NetId ReplicationServer::getNetId(flecs::entity_t entity) const
+{
+    auto found = m_byEntity.find(entity);
+    return found != m_byEntity.end() ? m_entries[found->second].id : 0;
+}
+} // namespace ECSModule
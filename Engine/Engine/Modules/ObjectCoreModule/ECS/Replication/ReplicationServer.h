@@ -0,0 +1,196 @@
+#pragma once
+#include "Replication.h"
+#include "../Components/ECSComponents.h"
+
+#include <EngineMinimal.h>
+
+#include <deque>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class EntityWorld;
+
+namespace ECSModule
+{
+struct ReplicationClientSettings
+{
+    float relevanceRadius = 0.0f;     ///< Entities farther than this from the client's focus are not sent; 0 sends all
+    uint32_t maxSnapshotBytes = 1200; ///< Removals are always sent; entity updates stop at this size
+};
+
+/// <summary>
+/// Server side of snapshot replication: tracks the replicated components (ReplicationSchema) of
+/// an EntityWorld and writes one delta snapshot per client against the last snapshot that client
+/// acknowledged. Byte buffers in, byte buffers out; the transport is someone else's.
+///
+/// capture() picks up what changed since the previous capture: entities gaining or losing
+/// replicated components come from observers, value changes from cached queries with flecs
+/// change detection, so tables nobody wrote are not visited. A changed table is re-encoded and
+/// compared against the stored encoding per entity; only components whose bits differ are
+/// stamped with the capture's tick. writeSnapshot() then sends a client, per relevant entity,
+/// the components stamped after the tick that client last acknowledged for it, nearest to the
+/// client's focus first, until maxSnapshotBytes is reached; what does not fit goes next time.
+///
+/// Snapshot layout (BitStream.h): u32 tick, u32 baseline tick (0: none), u32 schema hash,
+/// varuint removal count and gap-coded NetIds, then per entity a 1 bit, varuint NetId, a full
+/// bit, [a mask-present bit], [the component mask], [the changed mask], [a parent-present bit],
+/// [varuint parent NetId], the changed components; a 0 bit ends the list. Values are absolute,
+/// quantized per ReplicationSchema.
+///
+/// The ChildOf parent travels as its NetId (0: a root, or a parent that is not replicated), so
+/// TransformComponent stays local and the client rebuilds the hierarchy (ReplicationClient).
+///
+/// Entities with EditorOnlyTag and viewport cameras are not replicated; that is checked when the
+/// entity's replicated components change. Relevance uses WorldTransformComponent, so capture()
+/// after EntityWorld::updateTransforms(); entities without one are relevant to every client.
+/// The server has to be destroyed before its world.
+/// </summary>
+class ReplicationServer
+{
+  public:
+    using ClientId = uint32_t;
+
+    using ClientSettings = ReplicationClientSettings;
+
+    struct Stats
+    {
+        uint32_t entities = 0;          ///< Replicated entities after the last capture()
+        uint32_t changedComponents = 0; ///< Components whose encoding changed in the last capture()
+        uint32_t lastSnapshotBytes = 0;
+        uint32_t lastSnapshotEntities = 0; ///< Entity updates in the last snapshot
+        uint32_t lastSnapshotDeferred = 0; ///< Entities left out of the last snapshot by the byte budget
+        uint64_t snapshotsWritten = 0;
+        uint64_t bytesWritten = 0;
+    };
+
+    explicit ReplicationServer(EntityWorld& world, const ReplicationConfig& config = {});
+    ~ReplicationServer();
+
+    ReplicationServer(const ReplicationServer&) = delete;
+    ReplicationServer& operator=(const ReplicationServer&) = delete;
+
+    /// <summary>
+    /// Starts a new tick and records the world's changes under it. Main thread, outside the
+    /// world's tick.
+    /// </summary>
+    void capture();
+    uint32_t getTick() const noexcept
+    {
+        return m_tick;
+    }
+
+    ClientId addClient(const ClientSettings& settings = {});
+    void removeClient(ClientId client);
+    void setClientSettings(ClientId client, const ClientSettings& settings);
+    void setClientFocus(ClientId client, const Math::Vec3& position);
+    /// <summary>
+    /// The client has applied the snapshot of @p tick; later snapshots are deltas against it.
+    /// Older or unknown ticks are ignored.
+    /// </summary>
+    void acknowledge(ClientId client, uint32_t tick);
+
+    /// <summary>
+    /// Writes the snapshot of the current tick for @p client into @p out; one per client and
+    /// tick, a second call returns false. A client without an acknowledged snapshot still in the
+    /// history gets every relevant entity in full, as does an entity some snapshot sent after
+    /// the acknowledged one dropped.
+    /// </summary>
+    bool writeSnapshot(ClientId client, std::vector<uint8_t>& out);
+
+    /// 0 for entities that are not replicated
+    NetId getNetId(flecs::entity_t entity) const;
+    const ReplicationSchema& getSchema() const noexcept
+    {
+        return m_schema;
+    }
+    const Stats& getStats() const noexcept
+    {
+        return m_stats;
+    }
+
+  private:
+    struct ComponentState
+    {
+        BitWriter bits;
+        uint32_t changedTick = 0;
+    };
+
+    struct Entry
+    {
+        flecs::entity_t entity = 0;
+        NetId id = 0;
+        uint32_t mask = 0;         ///< Replicated components the entity has, by schema index
+        uint32_t capturedMask = 0; ///< mask as of the last capture()
+        uint32_t maskTick = 0;
+        uint32_t relevantStamp = 0; ///< Equals the snapshot stamp while writing a snapshot it is in
+        bool touched = false;      ///< Membership changed since the last capture()
+        bool excluded = false;
+        bool hasPosition = false;
+        NetId parent = 0;
+        uint32_t parentTick = 0; ///< Capture that last changed parent
+        Math::Vec3 position{0.0f};
+        std::vector<ComponentState> components;
+    };
+
+    struct Membership
+    {
+        flecs::entity_t entity;
+        uint32_t component;
+        bool added;
+    };
+
+    /// What a client was sent in one snapshot: per entity, the tick its state is current as of
+    struct Record
+    {
+        uint32_t tick = 0;
+        std::vector<std::pair<NetId, uint32_t>> entities; ///< Sorted by NetId
+    };
+
+    struct Client
+    {
+        ClientId id = 0;
+        ClientSettings settings;
+        Math::Vec3 focus{0.0f};
+        uint32_t acked = 0;
+        std::deque<Record> history;
+    };
+
+    Client* findClient(ClientId client);
+    void applyMembership();
+    /// Re-reads the parent NetId of the entities in m_reparented
+    void refreshParents();
+    /// Queues the children of @p entity for refreshParents(), e.g. when its NetId changes
+    void queueChildren(flecs::entity_t entity);
+    void erase(size_t index);
+    void encode(Entry& entry, uint32_t component, const void* value);
+    void readPosition(Entry& entry);
+
+    EntityWorld& m_world;
+    ReplicationSchema m_schema;
+    std::vector<flecs::observer> m_observers;
+    std::vector<flecs::query<>> m_changes; ///< Per schema component
+    flecs::query<const WorldTransformComponent> m_positions;
+
+    std::vector<Entry> m_entries;
+    std::unordered_map<flecs::entity_t, size_t> m_byEntity;
+    std::unordered_map<NetId, size_t> m_byNetId;
+    std::vector<Membership> m_membership; ///< Observed since the last capture()
+    std::vector<flecs::entity_t> m_touched;
+    std::vector<flecs::entity_t> m_reparented; ///< ChildOf changes observed since the last capture()
+    NetId m_nextId = 1;
+    uint32_t m_tick = 0;
+    uint32_t m_stamp = 0;
+
+    std::vector<Client> m_clients;
+    ClientId m_nextClient = 1;
+
+    // Scratch reused across calls
+    BitWriter m_scratch;
+    BitWriter m_snapshot;
+    std::string m_text;
+    std::vector<std::pair<float, size_t>> m_candidates;
+    std::vector<NetId> m_removals;
+    Stats m_stats;
+};
+} // namespace ECSModule
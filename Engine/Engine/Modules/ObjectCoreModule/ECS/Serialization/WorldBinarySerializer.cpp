@@ -0,0 +1,941 @@
+#include "WorldBinarySerializer.h"
+
+#include <EngineMinimal.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+
+namespace ECSModule
+{
+namespace
+{
+constexpr uint32_t FourCC(const char (&tag)[5]) noexcept
+{
+    return static_cast<uint32_t>(static_cast<uint8_t>(tag[0])) | static_cast<uint32_t>(static_cast<uint8_t>(tag[1])) << 8 |
+           static_cast<uint32_t>(static_cast<uint8_t>(tag[2])) << 16 |
+           static_cast<uint32_t>(static_cast<uint8_t>(tag[3])) << 24;
+}
+
+constexpr uint32_t kMagic = FourCC("LWLD");
+constexpr uint32_t kChunkTag = FourCC("CHNK");
+constexpr uint32_t kDoneTag = FourCC("DONE");
+
+constexpr uint8_t kChunkNames = 1;
+constexpr uint8_t kChunkParents = 2;
+/// First version with entity ids and parents in chunks
+constexpr uint16_t kFirstIdVersion = 2;
+
+/// Upper bound for a single string or column, to reject corrupt lengths before allocating.
+constexpr uint32_t kMaxBlockBytes = 1u << 30;
+
+uint64_t Fnv1a(std::string_view text) noexcept
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : text)
+    {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+class ByteWriter
+{
+  public:
+    explicit ByteWriter(std::vector<uint8_t>& buffer) : m_buffer(buffer)
+    {
+    }
+
+    template <typename T> void put(T value)
+    {
+        putBytes(&value, sizeof(T));
+    }
+
+    void putBytes(const void* data, size_t size)
+    {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+    }
+
+    void putString(std::string_view text)
+    {
+        put(static_cast<uint32_t>(text.size()));
+        putBytes(text.data(), text.size());
+    }
+
+    size_t size() const noexcept
+    {
+        return m_buffer.size();
+    }
+
+    void patch(size_t at, uint32_t value)
+    {
+        std::memcpy(m_buffer.data() + at, &value, sizeof(value));
+    }
+
+  private:
+    std::vector<uint8_t>& m_buffer;
+};
+
+class ByteReader
+{
+  public:
+    explicit ByteReader(std::istream& in) : m_in(in)
+    {
+    }
+
+    template <typename T> bool get(T& value)
+    {
+        return getBytes(&value, sizeof(T));
+    }
+
+    bool getBytes(void* data, size_t size)
+    {
+        m_in.read(static_cast<char*>(data), static_cast<std::streamsize>(size));
+        m_consumed += static_cast<uint64_t>(m_in.gcount());
+        return static_cast<size_t>(m_in.gcount()) == size;
+    }
+
+    bool getString(std::string& text)
+    {
+        uint32_t size = 0;
+        if (!get(size) || size > kMaxBlockBytes)
+            return false;
+        text.resize(size);
+        return getBytes(text.data(), size);
+    }
+
+    bool skip(uint32_t size)
+    {
+        m_in.ignore(static_cast<std::streamsize>(size));
+        m_consumed += static_cast<uint64_t>(m_in.gcount());
+        return static_cast<uint32_t>(m_in.gcount()) == size;
+    }
+
+    uint64_t consumed() const noexcept
+    {
+        return m_consumed;
+    }
+
+    /// Bytes left in a seekable stream; UINT64_MAX when the stream cannot tell
+    uint64_t remaining()
+    {
+        const std::streampos at = m_in.tellg();
+        if (at == std::streampos(-1))
+            return UINT64_MAX;
+        m_in.seekg(0, std::ios::end);
+        const std::streampos end = m_in.tellg();
+        m_in.seekg(at);
+        if (end == std::streampos(-1) || end < at)
+            return UINT64_MAX;
+        return static_cast<uint64_t>(end - at);
+    }
+
+  private:
+    std::istream& m_in;
+    uint64_t m_consumed = 0;
+};
+
+int32_t ComponentSize(const ecs_world_t* world, ecs_entity_t type)
+{
+    const EcsComponent* info = ecs_get(world, type, EcsComponent);
+    return info ? info->size : 0;
+}
+
+/// Captures the string an opaque type hands to its serialize callback.
+int CaptureOpaqueValue(const ecs_serializer_t* ser, ecs_entity_t type, const void* value)
+{
+    if (type != ecs_id(ecs_string_t))
+        return -1;
+    const char* text = *static_cast<const char* const*>(value);
+    static_cast<std::string*>(ser->ctx)->assign(text ? text : "");
+    return 0;
+}
+
+int RejectOpaqueMember(const ecs_serializer_t*, const char*)
+{
+    return -1;
+}
+
+bool AppendFields(const ecs_world_t* world, ecs_entity_t type, uint32_t baseOffset, std::string& signature,
+                  std::vector<WorldBinaryLayout::Field>& fields)
+{
+    using FieldKind = WorldBinaryLayout::FieldKind;
+    const uint32_t size = static_cast<uint32_t>(ComponentSize(world, type));
+
+    if (const EcsOpaque* opaque = ecs_get(world, type, EcsOpaque))
+    {
+        if (opaque->as_type != ecs_id(ecs_string_t) || !opaque->serialize || !opaque->assign_string)
+            return false;
+        fields.push_back({FieldKind::Opaque, baseOffset, size, type});
+        signature += "o;";
+        return true;
+    }
+
+    if (const EcsPrimitive* primitive = ecs_get(world, type, EcsPrimitive))
+    {
+        const bool isString = primitive->kind == EcsString;
+        fields.push_back({isString ? FieldKind::CString : FieldKind::Raw, baseOffset, size, type});
+        signature += isString ? "s;" : "p" + std::to_string(primitive->kind) + ":" + std::to_string(size) + ";";
+        return true;
+    }
+
+    if (ecs_has(world, type, EcsEnum) || ecs_has(world, type, EcsBitmask))
+    {
+        fields.push_back({FieldKind::Raw, baseOffset, size, type});
+        signature += "e" + std::to_string(size) + ";";
+        return true;
+    }
+
+    if (const EcsStruct* structInfo = ecs_get(world, type, EcsStruct))
+    {
+        const auto* members = ecs_vec_first_t(&structInfo->members, ecs_member_t);
+        const int32_t memberCount = ecs_vec_count(&structInfo->members);
+        for (int32_t i = 0; i < memberCount; ++i)
+        {
+            const ecs_member_t& member = members[i];
+            const int32_t count = std::max(member.count, 1);
+            const int32_t stride = ComponentSize(world, member.type);
+            signature += member.name;
+            signature += count > 1 ? "[" + std::to_string(count) + "]{" : "{";
+            for (int32_t element = 0; element < count; ++element)
+            {
+                if (!AppendFields(world, member.type,
+                                  baseOffset + static_cast<uint32_t>(member.offset + element * stride), signature,
+                                  fields))
+                    return false;
+            }
+            signature += "}";
+        }
+        return true;
+    }
+
+    return false;
+}
+
+} // namespace
+
+WorldBinaryLayout WorldBinaryLayout::Build(flecs::world& world, flecs::entity_t component)
+{
+    WorldBinaryLayout layout;
+    layout.component = component;
+
+    char* path = ecs_get_path(world.c_ptr(), component);
+    layout.path = path ? path : "";
+    ecs_os_free(path);
+
+    std::string signature = layout.path + "=";
+    const int32_t size = ComponentSize(world.c_ptr(), component);
+    if (size == 0)
+    {
+        // Tag: presence only.
+        layout.valid = true;
+    }
+    else
+    {
+        layout.valid = ecs_has(world.c_ptr(), component, EcsStruct) &&
+                       AppendFields(world.c_ptr(), component, 0, signature, layout.fields);
+    }
+    layout.fingerprint = Fnv1a(signature);
+    return layout;
+}
+
+void WorldBinaryLayout::GetText(const ecs_world_t* world, const Field& field, const void* value, std::string& text)
+{
+    text.clear();
+    if (field.kind == FieldKind::CString)
+    {
+        const char* chars = *static_cast<const char* const*>(value);
+        text.assign(chars ? chars : "");
+    }
+    else if (field.kind == FieldKind::Opaque)
+    {
+        ecs_serializer_t capture{};
+        capture.value = CaptureOpaqueValue;
+        capture.member = RejectOpaqueMember;
+        capture.world = world;
+        capture.ctx = &text;
+        ecs_get(world, field.type, EcsOpaque)->serialize(&capture, value);
+    }
+}
+
+void WorldBinaryLayout::SetText(const ecs_world_t* world, const Field& field, void* value, const std::string& text)
+{
+    if (field.kind == FieldKind::CString)
+    {
+        auto** slot = static_cast<char**>(value);
+        ecs_os_free(*slot);
+        *slot = ecs_os_strdup(text.c_str());
+    }
+    else if (field.kind == FieldKind::Opaque)
+    {
+        ecs_get(world, field.type, EcsOpaque)->assign_string(value, text.c_str());
+    }
+}
+
+WorldBinaryWriter::WorldBinaryWriter(flecs::world& world, std::span<const flecs::entity_t> components,
+                                     uint32_t chunkEntities)
+    : m_world(world), m_chunkEntities(std::max<uint32_t>(chunkEntities, 1))
+{
+    for (flecs::entity_t component : components)
+    {
+        WorldBinaryLayout layout = WorldBinaryLayout::Build(world, component);
+        if (!layout.valid)
+        {
+            LT_LOGW("ECSModule", "Binary world format cannot store component " + layout.path + "; skipped");
+            continue;
+        }
+        m_layouts.push_back(std::move(layout));
+    }
+    // An Or query can only hold so many terms.
+    if (m_layouts.size() > FLECS_TERM_COUNT_MAX)
+    {
+        LT_LOGW("ECSModule", "Binary world format: too many components, extra ones are skipped");
+        m_layouts.resize(FLECS_TERM_COUNT_MAX);
+    }
+    for (const auto& layout : m_layouts)
+        m_strides.push_back(static_cast<size_t>(ComponentSize(world.c_ptr(), layout.component)));
+}
+
+void WorldBinaryCapture::encodeHeader(std::vector<uint8_t>& buffer) const
+{
+    ByteWriter writer(buffer);
+    writer.put(kMagic);
+    writer.put(kWorldBinaryVersion);
+    writer.put(uint16_t{0});
+    writer.put(static_cast<uint32_t>(m_layouts.size()));
+    for (const auto& layout : m_layouts)
+    {
+        writer.putString(layout.path);
+        writer.put(layout.fingerprint);
+    }
+}
+
+void WorldBinaryCapture::encodeChunk(const Chunk& chunk, std::vector<uint8_t>& buffer) const
+{
+    ByteWriter writer(buffer);
+    const size_t count = chunk.entities.size();
+    writer.put(kChunkTag);
+    writer.put(static_cast<uint32_t>(count));
+    writer.put(static_cast<uint16_t>(chunk.columns.size()));
+    for (uint16_t column : chunk.columns)
+        writer.put(column);
+
+    uint8_t flags = 0;
+    if (!chunk.names.empty())
+        flags |= kChunkNames;
+    if (!chunk.parents.empty())
+        flags |= kChunkParents;
+    writer.put(flags);
+    for (flecs::entity_t entity : chunk.entities)
+        writer.put(static_cast<uint64_t>(entity));
+    for (const std::string& name : chunk.names)
+        writer.putString(name);
+    for (flecs::entity_t parent : chunk.parents)
+        writer.put(static_cast<uint64_t>(parent));
+
+    size_t text = 0;
+    for (size_t c = 0; c < chunk.columns.size(); ++c)
+    {
+        const WorldBinaryLayout& layout = m_layouts[chunk.columns[c]];
+        const size_t stride = m_strides[chunk.columns[c]];
+        const size_t lengthAt = writer.size();
+        writer.put(uint32_t{0});
+        for (const auto& field : layout.fields)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (field.kind == WorldBinaryLayout::FieldKind::Raw)
+                    writer.putBytes(chunk.rows[c].data() + stride * i + field.offset, field.size);
+                else
+                    writer.putString(chunk.texts[text++]);
+            }
+        }
+        writer.patch(lengthAt, static_cast<uint32_t>(writer.size() - lengthAt - sizeof(uint32_t)));
+    }
+}
+
+bool WorldBinaryCapture::write(std::ostream& out) const
+{
+    ZoneScopedN("WorldBinaryCapture::write");
+    std::vector<uint8_t> buffer;
+    auto flush = [&]() {
+        out.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+        return out.good();
+    };
+
+    encodeHeader(buffer);
+    if (!flush())
+        return false;
+    for (const Chunk& chunk : m_chunks)
+    {
+        encodeChunk(chunk, buffer);
+        if (!flush())
+            return false;
+    }
+    ByteWriter writer(buffer);
+    writer.put(kDoneTag);
+    writer.put(static_cast<uint32_t>(m_entities.size()));
+    return flush();
+}
+
+void WorldBinaryWriter::initCapture(WorldBinaryCapture& capture) const
+{
+    capture = {};
+    capture.m_layouts = m_layouts;
+    capture.m_strides = m_strides;
+}
+
+bool WorldBinaryWriter::collect(const std::function<bool(WorldBinaryCapture::Chunk&)>& sink)
+{
+    ecs_world_t* world = m_world.c_ptr();
+    m_entities = 0;
+    if (m_layouts.empty())
+        return true;
+
+    ecs_query_desc_t desc{};
+    for (size_t i = 0; i < m_layouts.size(); ++i)
+    {
+        desc.terms[i].id = m_layouts[i].component;
+        desc.terms[i].inout = EcsIn;
+        if (i + 1 < m_layouts.size())
+            desc.terms[i].oper = EcsOr;
+    }
+    ecs_query_t* query = ecs_query_init(world, &desc);
+    if (!query)
+        return false;
+
+    WorldBinaryCapture::Chunk chunk;
+    std::vector<uint16_t> columns;
+    std::vector<int32_t> rows;
+    std::string text;
+
+    bool ok = true;
+    ecs_iter_t it = ecs_query_iter(world, query);
+    while (ecs_query_next(&it))
+    {
+        if (!ok)
+            continue; // Drain the iterator so the query releases its table locks.
+
+        columns.clear();
+        for (size_t i = 0; i < m_layouts.size(); ++i)
+        {
+            if (ecs_table_has_id(world, it.table, m_layouts[i].component))
+                columns.push_back(static_cast<uint16_t>(i));
+        }
+
+        // Rows of the table that pass the filter; a chunk may skip rows, so fields are read by row.
+        rows.clear();
+        for (int32_t i = 0; i < it.count; ++i)
+        {
+            if (!m_filter || m_filter(it.entities[i]))
+                rows.push_back(i);
+        }
+
+        for (size_t first = 0; first < rows.size() && ok; first += m_chunkEntities)
+        {
+            const size_t count = std::min<size_t>(rows.size() - first, m_chunkEntities);
+            const int32_t* chunkRows = rows.data() + first;
+            chunk.columns = columns;
+            chunk.entities.resize(count);
+            for (size_t i = 0; i < count; ++i)
+                chunk.entities[i] = it.entities[chunkRows[i]];
+
+            chunk.names.clear();
+            bool hasNames = false;
+            for (size_t i = 0; i < count && !hasNames; ++i)
+                hasNames = ecs_get_name(world, chunk.entities[i]) != nullptr;
+            for (size_t i = 0; hasNames && i < count; ++i)
+            {
+                const char* name = ecs_get_name(world, chunk.entities[i]);
+                chunk.names.emplace_back(name ? name : "");
+            }
+
+            // ChildOf is part of the table type, so a chunk has a parent for all entities or none
+            chunk.parents.clear();
+            if (ecs_table_has_id(world, it.table, ecs_pair(EcsChildOf, EcsWildcard)))
+            {
+                chunk.parents.resize(count);
+                for (size_t i = 0; i < count; ++i)
+                    chunk.parents[i] = ecs_get_target(world, chunk.entities[i], EcsChildOf, 0);
+            }
+
+            chunk.rows.resize(columns.size());
+            chunk.texts.clear();
+            for (size_t c = 0; c < columns.size(); ++c)
+            {
+                const WorldBinaryLayout& layout = m_layouts[columns[c]];
+                std::vector<uint8_t>& bytes = chunk.rows[c];
+                bytes.clear();
+                if (layout.fields.empty())
+                    continue;
+
+                const auto* base =
+                    static_cast<const uint8_t*>(ecs_table_get_id(world, it.table, layout.component, it.offset));
+                const size_t stride = m_strides[columns[c]];
+                bytes.resize(stride * count);
+                for (size_t i = 0; i < count; ++i)
+                    std::memcpy(bytes.data() + stride * i, base + stride * static_cast<size_t>(chunkRows[i]), stride);
+
+                for (const auto& field : layout.fields)
+                {
+                    if (field.kind == WorldBinaryLayout::FieldKind::Raw)
+                        continue;
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        WorldBinaryLayout::GetText(
+                            world, field, base + stride * static_cast<size_t>(chunkRows[i]) + field.offset, text);
+                        chunk.texts.push_back(text);
+                    }
+                }
+            }
+
+            m_entities += static_cast<uint32_t>(count);
+            ok = sink(chunk);
+        }
+    }
+    ecs_query_fini(query);
+    return ok;
+}
+
+bool WorldBinaryWriter::write(std::ostream& out)
+{
+    ZoneScopedN("WorldBinaryWriter::write");
+    // One chunk is captured, encoded and flushed at a time, bounding the buffers to a chunk.
+    WorldBinaryCapture capture;
+    initCapture(capture);
+    std::vector<uint8_t> buffer;
+    auto flush = [&]() {
+        out.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+        return out.good();
+    };
+
+    capture.encodeHeader(buffer);
+    if (!flush())
+        return false;
+    const bool ok = collect([&](WorldBinaryCapture::Chunk& chunk) {
+        capture.encodeChunk(chunk, buffer);
+        return flush();
+    });
+    if (!ok)
+        return false;
+
+    ByteWriter writer(buffer);
+    writer.put(kDoneTag);
+    writer.put(m_entities);
+    return flush();
+}
+
+bool WorldBinaryWriter::capture(WorldBinaryCapture& capture)
+{
+    ZoneScopedN("WorldBinaryWriter::capture");
+    initCapture(capture);
+    return collect([&](WorldBinaryCapture::Chunk& chunk) {
+        capture.m_entities.insert(capture.m_entities.end(), chunk.entities.begin(), chunk.entities.end());
+        size_t bytes = (chunk.entities.size() + chunk.parents.size()) * sizeof(flecs::entity_t);
+        for (const auto& row : chunk.rows)
+            bytes += row.size();
+        for (const auto& text : chunk.texts)
+            bytes += text.size();
+        for (const auto& name : chunk.names)
+            bytes += name.size();
+        capture.m_bytes += bytes;
+        capture.m_chunks.push_back(std::move(chunk));
+        chunk = {};
+        return true;
+    });
+}
+
+bool WorldBinaryReader::fail(std::string message)
+{
+    m_error = std::move(message);
+    m_in = nullptr;
+    LT_LOGE("ECSModule", "Binary world load failed: " + m_error);
+    return false;
+}
+
+bool WorldBinaryReader::failChunk(std::string message)
+{
+    ecs_world_t* world = m_world.c_ptr();
+    for (ecs_entity_t entity : m_chunk)
+        ecs_delete(world, entity);
+    m_chunk.clear();
+    m_ids.clear();
+    std::erase_if(m_pending, [world](const PendingChild& child) { return !ecs_is_alive(world, child.entity); });
+    return fail(std::move(message));
+}
+
+flecs::entity_t WorldBinaryReader::findParent(uint64_t parent) const
+{
+    if (auto found = m_loaded.find(parent); found != m_loaded.end())
+        return found->second;
+    const flecs::entity_t resolved = m_resolveParent ? m_resolveParent(parent) : 0;
+    return resolved && ecs_is_alive(m_world.c_ptr(), resolved) ? resolved : 0;
+}
+
+void WorldBinaryReader::attach(flecs::entity_t entity, flecs::entity_t parent, const std::string& name)
+{
+    ecs_world_t* world = m_world.c_ptr();
+    if (parent)
+        ecs_add_pair(world, entity, EcsChildOf, parent);
+    if (!name.empty())
+        ecs_set_name(world, entity, name.c_str());
+}
+
+void WorldBinaryReader::resolvePending()
+{
+    uint32_t missing = 0;
+    for (const PendingChild& child : m_pending)
+    {
+        const flecs::entity_t parent = findParent(child.parent);
+        if (parent)
+        {
+            attach(child.entity, parent, child.name);
+            continue;
+        }
+        // The name was only unique under the lost parent; a root may already carry it
+        ++missing;
+        const bool taken = !child.name.empty() && ecs_lookup_child(m_world.c_ptr(), 0, child.name.c_str());
+        attach(child.entity, 0, taken ? std::string() : child.name);
+    }
+    m_pending.clear();
+    if (missing > 0)
+    {
+        m_parentsMissing += missing;
+        LT_LOGFW("ECSModule", "Binary world: {} entities have a parent that was not loaded; they stay roots", missing);
+    }
+}
+
+bool WorldBinaryReader::Scan(std::istream& in, WorldBinaryIndex& index, std::string* error)
+{
+    ZoneScopedN("WorldBinaryReader::Scan");
+    ByteReader reader(in);
+    index = {};
+    auto reject = [error](const char* message) {
+        if (error)
+            *error = message;
+        return false;
+    };
+
+    uint32_t magic = 0;
+    uint16_t version = 0;
+    uint16_t reserved = 0;
+    if (!reader.get(magic) || magic != kMagic)
+        return reject("not a binary world stream");
+    if (!reader.get(version) || !reader.get(reserved) || version == 0 || version > kWorldBinaryVersion)
+        return reject("unsupported version");
+    const bool hasIds = version >= kFirstIdVersion;
+    if (!reader.get(index.components) || index.components > FLECS_TERM_COUNT_MAX)
+        return reject("corrupt component table");
+
+    std::string text;
+    for (uint32_t i = 0; i < index.components; ++i)
+    {
+        uint64_t fingerprint = 0;
+        if (!reader.getString(text) || !reader.get(fingerprint))
+            return reject("truncated component table");
+    }
+
+    while (true)
+    {
+        uint32_t tag = 0;
+        if (!reader.get(tag))
+            return reject("truncated stream");
+        if (tag == kDoneTag)
+        {
+            uint32_t total = 0;
+            if (!reader.get(total) || total != index.entities)
+                return reject("entity count mismatch");
+            return true;
+        }
+        if (tag != kChunkTag)
+            return reject("unexpected block");
+
+        uint32_t count = 0;
+        uint16_t columnCount = 0;
+        if (!reader.get(count) || !reader.get(columnCount) || columnCount > index.components)
+            return reject("corrupt chunk header");
+        for (uint16_t i = 0; i < columnCount; ++i)
+        {
+            uint16_t column = 0;
+            if (!reader.get(column) || column >= index.components)
+                return reject("corrupt chunk header");
+        }
+
+        uint8_t flags = 0;
+        if (!reader.get(flags) || (flags & ~(kChunkNames | kChunkParents)) || (!hasIds && (flags & kChunkParents)))
+            return reject("corrupt chunk flags");
+        if (count > kMaxBlockBytes / sizeof(uint64_t))
+            return reject("corrupt chunk header");
+        if (hasIds && !reader.skip(count * static_cast<uint32_t>(sizeof(uint64_t))))
+            return reject("truncated entity ids");
+        for (uint32_t i = 0; (flags & kChunkNames) && i < count; ++i)
+        {
+            uint32_t length = 0;
+            if (!reader.get(length) || length > kMaxBlockBytes || !reader.skip(length))
+                return reject("truncated entity names");
+        }
+        if ((flags & kChunkParents) && !reader.skip(count * static_cast<uint32_t>(sizeof(uint64_t))))
+            return reject("truncated entity parents");
+        for (uint16_t i = 0; i < columnCount; ++i)
+        {
+            uint32_t length = 0;
+            if (!reader.get(length) || length > kMaxBlockBytes || !reader.skip(length))
+                return reject("truncated column");
+        }
+
+        index.chunkEntities.push_back(count);
+        index.entities += count;
+    }
+}
+
+bool WorldBinaryReader::read(std::istream& in)
+{
+    ZoneScopedN("WorldBinaryReader::read");
+    if (!begin(in))
+        return false;
+    while (!m_finished)
+    {
+        if (!readChunk())
+            return false;
+    }
+    return true;
+}
+
+bool WorldBinaryReader::begin(std::istream& in)
+{
+    ZoneScopedN("WorldBinaryReader::begin");
+    ecs_world_t* world = m_world.c_ptr();
+    ByteReader reader(in);
+    m_in = &in;
+    m_finished = false;
+    m_entities = 0;
+    m_skippedColumns = 0;
+    m_parentsMissing = 0;
+    m_chunk.clear();
+    m_ids.clear();
+    m_loaded.clear();
+    m_pending.clear();
+    m_layouts.clear();
+    m_matched.clear();
+    m_error.clear();
+
+    uint32_t magic = 0;
+    uint16_t version = 0;
+    uint16_t reserved = 0;
+    uint32_t componentCount = 0;
+    if (!reader.get(magic) || magic != kMagic)
+        return fail("not a binary world stream");
+    if (!reader.get(version) || !reader.get(reserved) || version == 0 || version > kWorldBinaryVersion)
+        return fail("unsupported version " + std::to_string(version));
+    m_version = version;
+    if (!reader.get(componentCount) || componentCount > FLECS_TERM_COUNT_MAX)
+        return fail("corrupt component table");
+
+    m_layouts.resize(componentCount);
+    m_matched.resize(componentCount);
+    for (uint32_t i = 0; i < componentCount; ++i)
+    {
+        std::string path;
+        uint64_t fingerprint = 0;
+        if (!reader.getString(path) || !reader.get(fingerprint))
+            return fail("truncated component table");
+
+        const ecs_entity_t component = ecs_lookup(world, path.c_str());
+        if (component)
+            m_layouts[i] = WorldBinaryLayout::Build(m_world, component);
+        m_matched[i] = component && m_layouts[i].valid && m_layouts[i].fingerprint == fingerprint;
+        if (!m_matched[i])
+            LT_LOGW("ECSModule", "Binary world: component " + path + " is missing or changed; its data is skipped");
+    }
+    return true;
+}
+
+bool WorldBinaryReader::readChunk()
+{
+    ZoneScopedN("WorldBinaryReader::readChunk");
+    m_chunk.clear();
+    m_ids.clear();
+    if (m_finished)
+        return true;
+    if (!m_in)
+        return fail("no stream; begin() was not called or failed");
+
+    ecs_world_t* world = m_world.c_ptr();
+    ByteReader reader(*m_in);
+    const auto componentCount = static_cast<uint32_t>(m_layouts.size());
+
+    uint32_t tag = 0;
+    if (!reader.get(tag))
+        return fail("truncated stream");
+
+    if (tag == kDoneTag)
+    {
+        uint32_t total = 0;
+        if (!reader.get(total) || total != m_entities)
+            return fail("entity count mismatch");
+        resolvePending();
+        m_finished = true;
+        m_in = nullptr;
+        return true;
+    }
+    if (tag != kChunkTag)
+        return fail("unexpected block");
+
+    uint32_t count = 0;
+    uint16_t columnCount = 0;
+    if (!reader.get(count) || !reader.get(columnCount) || columnCount > componentCount)
+        return fail("corrupt chunk header");
+    m_columns.resize(columnCount);
+    for (auto& column : m_columns)
+    {
+        if (!reader.get(column) || column >= componentCount)
+            return fail("corrupt chunk header");
+    }
+
+    // The smallest chunk body that can hold count entities: the flags, the column lengths, the
+    // entity ids and the fixed part of every matched field. A corrupt count fails here, before
+    // creating anything.
+    if (count > static_cast<uint32_t>(INT32_MAX))
+        return fail("corrupt chunk header");
+    const bool hasIds = m_version >= kFirstIdVersion;
+    uint64_t entityBytes = hasIds ? sizeof(uint64_t) : 0;
+    for (uint16_t column : m_columns)
+    {
+        if (!m_matched[column])
+            continue;
+        for (const auto& field : m_layouts[column].fields)
+            entityBytes += field.kind == WorldBinaryLayout::FieldKind::Raw ? field.size : sizeof(uint32_t);
+    }
+    const uint64_t headerBytes = sizeof(uint8_t) + sizeof(uint32_t) * static_cast<uint64_t>(columnCount);
+    const uint64_t available = reader.remaining();
+    if (available < headerBytes || (entityBytes && count > (available - headerBytes) / entityBytes))
+        return fail("truncated chunk");
+
+    // Bulk-create the chunk's entities straight into their final table.
+    ecs_bulk_desc_t desc{};
+    desc.count = static_cast<int32_t>(count);
+    int32_t idCount = 0;
+    for (uint16_t column : m_columns)
+    {
+        if (m_matched[column] && idCount < FLECS_ID_DESC_MAX)
+            desc.ids[idCount++] = m_layouts[column].component;
+    }
+    const ecs_entity_t* created = count ? ecs_bulk_init(world, &desc) : nullptr;
+    m_chunk.assign(created, created + count);
+
+    uint8_t flags = 0;
+    if (!reader.get(flags))
+        return failChunk("truncated chunk");
+    if ((flags & ~(kChunkNames | kChunkParents)) || (!hasIds && (flags & kChunkParents)))
+        return failChunk("corrupt chunk flags");
+    if (hasIds)
+    {
+        m_ids.resize(count);
+        if (count && !reader.getBytes(m_ids.data(), count * sizeof(uint64_t)))
+            return failChunk("truncated entity ids");
+    }
+    m_names.resize(count);
+    for (std::string& name : m_names)
+    {
+        name.clear();
+        if ((flags & kChunkNames) && !reader.getString(name))
+            return failChunk("truncated entity names");
+    }
+    m_parents.assign(count, 0);
+    if ((flags & kChunkParents) && count && !reader.getBytes(m_parents.data(), count * sizeof(uint64_t)))
+        return failChunk("truncated entity parents");
+
+    // A name is only unique under its parent, so children are named once they have one; those
+    // whose parent has not been read yet wait for the footer.
+    for (size_t i = 0; i < m_chunk.size(); ++i)
+    {
+        const flecs::entity_t parent = m_parents[i] ? findParent(m_parents[i]) : 0;
+        if (m_parents[i] && !parent)
+            m_pending.push_back({m_chunk[i], m_parents[i], std::move(m_names[i])});
+        else
+            attach(m_chunk[i], parent, m_names[i]);
+    }
+
+    // Names and parents move entities between tables, so component pointers are taken only now.
+    for (uint16_t column : m_columns)
+    {
+        uint32_t length = 0;
+        if (!reader.get(length) || length > kMaxBlockBytes)
+            return failChunk("corrupt column");
+
+        const WorldBinaryLayout& layout = m_layouts[column];
+        if (!m_matched[column])
+        {
+            ++m_skippedColumns;
+            if (!reader.skip(length))
+                return failChunk("truncated column");
+            continue;
+        }
+        if (layout.fields.empty())
+        {
+            if (length != 0)
+                return failChunk("corrupt tag column");
+            continue;
+        }
+
+        const uint64_t start = reader.consumed();
+        m_targets.resize(m_chunk.size());
+        for (size_t i = 0; i < m_chunk.size(); ++i)
+            m_targets[i] = static_cast<uint8_t*>(ecs_get_mut_id(world, m_chunk[i], layout.component));
+
+        for (const auto& field : layout.fields)
+        {
+            const EcsOpaque* opaque =
+                field.kind == WorldBinaryLayout::FieldKind::Opaque ? ecs_get(world, field.type, EcsOpaque) : nullptr;
+            for (uint8_t* target : m_targets)
+            {
+                uint8_t* value = target + field.offset;
+                switch (field.kind)
+                {
+                case WorldBinaryLayout::FieldKind::Raw:
+                    if (!reader.getBytes(value, field.size))
+                        return failChunk("truncated column");
+                    break;
+                case WorldBinaryLayout::FieldKind::CString: {
+                    if (!reader.getString(m_text))
+                        return failChunk("truncated column");
+                    auto** slot = reinterpret_cast<char**>(value);
+                    ecs_os_free(*slot);
+                    *slot = ecs_os_strdup(m_text.c_str());
+                    break;
+                }
+                case WorldBinaryLayout::FieldKind::Opaque:
+                    if (!reader.getString(m_text))
+                        return failChunk("truncated column");
+                    opaque->assign_string(value, m_text.c_str());
+                    break;
+                }
+            }
+        }
+        if (reader.consumed() - start != length)
+            return failChunk("column length mismatch for " + layout.path);
+    }
+
+    // OnSet observers (render, scripts, physics) run once per entity, batched by defer.
+    ecs_defer_begin(world);
+    for (uint16_t column : m_columns)
+    {
+        if (!m_matched[column] || m_layouts[column].fields.empty())
+            continue;
+        for (ecs_entity_t entity : m_chunk)
+            ecs_modified_id(world, entity, m_layouts[column].component);
+    }
+    ecs_defer_end(world);
+
+    for (size_t i = 0; i < m_ids.size(); ++i)
+        m_loaded[m_ids[i]] = m_chunk[i];
+    m_entities += count;
+    return true;
+}
+} // namespace ECSModule
@@ -0,0 +1,303 @@
+#pragma once
+#include <flecs.h>
+
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ECSModule
+{
+/// <summary>
+/// Binary world format, version 2 (little-endian, native float layout):
+///
+///   header   "LWLD" u16 version u16 reserved
+///            u32 componentCount, then per component: string path, u64 fingerprint
+///   chunk*   "CHNK" u32 entityCount u16 columnCount u16 componentIndex[columnCount]
+///            u8 flags (1: names, 2: parents)
+///            u64 entity[entityCount]   the writer's entity ids
+///            [string name per entity]  with names
+///            [u64 parent per entity]   with parents: the entity id of the ChildOf target, 0 for roots
+///            per column: u32 byteLength, then each reflected field for all entities in turn
+///   footer   "DONE" u32 totalEntities
+///
+/// Strings are u32 length + bytes. A chunk holds entities of one flecs table, so a column is a
+/// straight walk over table storage. Columns whose component is missing or whose reflected layout
+/// (fingerprint) differs on load are skipped, which keeps old saves loadable after fields change.
+///
+/// Parents are stored as the writer's ids and remapped on load to the entities created for them
+/// (WorldBinaryReader). ChildOf is the only relationship kept; other pairs are not written.
+/// Version 1 streams have neither entity ids nor parents and are still read.
+/// </summary>
+constexpr uint16_t kWorldBinaryVersion = 2;
+
+/// <summary>
+/// Reflected layout of one component, flattened to the fields the format stores.
+/// </summary>
+struct WorldBinaryLayout
+{
+    enum class FieldKind : uint8_t
+    {
+        Raw,     ///< Fixed-size primitive, enum or entity id, copied as bytes
+        CString, ///< flecs::String member (char*)
+        Opaque,  ///< Opaque type serialized as a string (std::string, AssetID)
+    };
+
+    struct Field
+    {
+        FieldKind kind = FieldKind::Raw;
+        uint32_t offset = 0;
+        uint32_t size = 0;
+        flecs::entity_t type = 0;
+    };
+
+    flecs::entity_t component = 0;
+    std::string path;
+    uint64_t fingerprint = 0;
+    std::vector<Field> fields;
+    bool valid = false;
+
+    /// <summary>
+    /// Builds the layout from the component's flecs reflection data (EcsStruct members). Tags
+    /// have no fields. Components with members the format cannot store are marked invalid.
+    /// </summary>
+    static WorldBinaryLayout Build(flecs::world& world, flecs::entity_t component);
+
+    /// <summary>
+    /// Text of a CString or Opaque field; @p value points at the field inside the component.
+    /// </summary>
+    static void GetText(const ecs_world_t* world, const Field& field, const void* value, std::string& text);
+    /// <summary>
+    /// Replaces the text of a CString or Opaque field, freeing or reassigning the old value.
+    /// </summary>
+    static void SetText(const ecs_world_t* world, const Field& field, void* value, const std::string& text);
+};
+
+/// <summary>
+/// The entities a WorldBinaryWriter would write, copied out of the world so that encoding them
+/// and writing the file can happen on a job while the world keeps changing. Component rows are
+/// bit copies of which only the Raw fields are ever read back; strings are extracted up front.
+/// </summary>
+class WorldBinaryCapture
+{
+  public:
+    /// <summary>
+    /// Writes the same stream WorldBinaryWriter::write() would have written when the capture
+    /// was taken. Does not touch the world, so any thread.
+    /// </summary>
+    bool write(std::ostream& out) const;
+
+    /// Captured entities in stream order
+    const std::vector<flecs::entity_t>& entities() const noexcept
+    {
+        return m_entities;
+    }
+    /// Heap bytes held by the copies
+    size_t memoryBytes() const noexcept
+    {
+        return m_bytes;
+    }
+
+  private:
+    friend class WorldBinaryWriter;
+
+    struct Chunk
+    {
+        std::vector<uint16_t> columns;
+        std::vector<flecs::entity_t> entities;
+        std::vector<std::string> names;         ///< Empty when no entity of the chunk is named
+        std::vector<flecs::entity_t> parents;   ///< ChildOf targets; empty when the chunk has none
+        std::vector<std::vector<uint8_t>> rows; ///< Per column, the chunk's component rows back to back
+        std::vector<std::string> texts;         ///< CString and Opaque values in stream order
+    };
+
+    void encodeHeader(std::vector<uint8_t>& buffer) const;
+    void encodeChunk(const Chunk& chunk, std::vector<uint8_t>& buffer) const;
+
+    std::vector<WorldBinaryLayout> m_layouts;
+    std::vector<size_t> m_strides; ///< Component size per layout
+    std::vector<Chunk> m_chunks;
+    std::vector<flecs::entity_t> m_entities;
+    size_t m_bytes = 0;
+};
+
+/// <summary>
+/// Streams every entity that has at least one of the given components to a binary stream.
+/// </summary>
+class WorldBinaryWriter
+{
+  public:
+    /// <summary>
+    /// @p chunkEntities caps entities per chunk, bounding the writer's buffer.
+    /// </summary>
+    WorldBinaryWriter(flecs::world& world, std::span<const flecs::entity_t> components, uint32_t chunkEntities = 4096);
+
+    /// <summary>
+    /// Writes only the entities @p filter accepts, e.g. those of one world partition cell.
+    /// Called for every candidate during write(); an empty filter writes them all.
+    /// </summary>
+    void setFilter(std::function<bool(flecs::entity_t)> filter)
+    {
+        m_filter = std::move(filter);
+    }
+
+    bool write(std::ostream& out);
+    /// <summary>
+    /// Copies what write() would write into @p capture, for writing it elsewhere later. Main
+    /// thread; costs a copy of the rows and strings instead of the encoding and the file write.
+    /// </summary>
+    bool capture(WorldBinaryCapture& capture);
+
+    uint32_t entitiesWritten() const noexcept
+    {
+        return m_entities;
+    }
+
+  private:
+    /// Hands each chunk to @p sink as it is captured; stops when the sink returns false.
+    bool collect(const std::function<bool(WorldBinaryCapture::Chunk&)>& sink);
+    void initCapture(WorldBinaryCapture& capture) const;
+
+    flecs::world& m_world;
+    std::vector<WorldBinaryLayout> m_layouts;
+    std::vector<size_t> m_strides;
+    std::function<bool(flecs::entity_t)> m_filter;
+    uint32_t m_chunkEntities;
+    uint32_t m_entities = 0;
+};
+
+/// <summary>
+/// Shape of a binary world stream as found by WorldBinaryReader::Scan().
+/// </summary>
+struct WorldBinaryIndex
+{
+    uint32_t components = 0;
+    uint32_t entities = 0;
+    std::vector<uint32_t> chunkEntities; ///< Entity count of each chunk, in stream order
+};
+
+/// <summary>
+/// Reads a stream produced by WorldBinaryWriter chunk by chunk, bulk-creating each chunk's entities.
+/// Entities are added to the world as-is; clear it first to replace its contents.
+///
+/// A stored parent is looked up among the entities read so far from the stream, then through the
+/// parent resolver. Children whose parent comes later in the stream get it, and their name, when
+/// the footer is read; those still without one there stay roots and are counted (parentsMissing()).
+/// </summary>
+class WorldBinaryReader
+{
+  public:
+    /// Maps a parent id the stream does not contain to an entity of the world; 0 when unknown
+    using ParentResolver = std::function<flecs::entity_t(uint64_t)>;
+
+    explicit WorldBinaryReader(flecs::world& world) : m_world(world)
+    {
+    }
+
+    /// <summary>
+    /// Resolves parents written by an earlier stream, e.g. the records before this one in a journal.
+    /// </summary>
+    void setParentResolver(ParentResolver resolver)
+    {
+        m_resolveParent = std::move(resolver);
+    }
+
+    /// <summary>
+    /// Checks the framing of a whole stream and counts its chunks and entities without a world,
+    /// so it can run on a job ahead of the read.
+    /// </summary>
+    static bool Scan(std::istream& in, WorldBinaryIndex& index, std::string* error = nullptr);
+
+    /// <summary>
+    /// Reads the whole stream: begin() and readChunk() until finished().
+    /// </summary>
+    bool read(std::istream& in);
+
+    /// <summary>
+    /// Reads the header and resolves its components. @p in must outlive the reads that follow.
+    /// </summary>
+    bool begin(std::istream& in);
+    /// <summary>
+    /// Creates the entities of the next chunk; at the footer it sets finished() instead.
+    /// Lets a caller spread a large load over several frames.
+    /// </summary>
+    bool readChunk();
+    bool finished() const noexcept
+    {
+        return m_finished;
+    }
+    /// <summary>
+    /// Entities created by the last readChunk().
+    /// </summary>
+    const std::vector<flecs::entity_t>& chunkEntities() const noexcept
+    {
+        return m_chunk;
+    }
+    /// <summary>
+    /// The writer's ids of chunkEntities(); empty for version 1 streams.
+    /// </summary>
+    const std::vector<uint64_t>& chunkSourceIds() const noexcept
+    {
+        return m_ids;
+    }
+
+    uint32_t entitiesRead() const noexcept
+    {
+        return m_entities;
+    }
+    uint32_t columnsSkipped() const noexcept
+    {
+        return m_skippedColumns;
+    }
+    /// Children whose parent was neither in the stream nor known to the resolver
+    uint32_t parentsMissing() const noexcept
+    {
+        return m_parentsMissing;
+    }
+    const std::string& error() const noexcept
+    {
+        return m_error;
+    }
+
+  private:
+    /// A child read before its parent
+    struct PendingChild
+    {
+        flecs::entity_t entity;
+        uint64_t parent;
+        std::string name;
+    };
+
+    bool fail(std::string message);
+    /// Deletes the entities of a partly read chunk, then fail()
+    bool failChunk(std::string message);
+    flecs::entity_t findParent(uint64_t parent) const;
+    /// Makes @p entity a child of @p parent (when non-zero), then names it
+    void attach(flecs::entity_t entity, flecs::entity_t parent, const std::string& name);
+    void resolvePending();
+
+    flecs::world& m_world;
+    std::istream* m_in = nullptr;
+    uint16_t m_version = 0;
+    bool m_finished = false;
+    std::vector<WorldBinaryLayout> m_layouts; ///< Per component of the stream's table
+    std::vector<uint8_t> m_matched;           ///< Whether m_layouts[i] matches the stored layout
+    std::vector<flecs::entity_t> m_chunk;
+    std::vector<uint64_t> m_ids;
+    std::vector<std::string> m_names;
+    std::vector<uint64_t> m_parents;
+    std::unordered_map<uint64_t, flecs::entity_t> m_loaded; ///< Writer id to created entity, this stream
+    std::vector<PendingChild> m_pending;
+    ParentResolver m_resolveParent;
+    std::vector<uint16_t> m_columns;
+    std::vector<uint8_t*> m_targets;
+    std::string m_text;
+    uint32_t m_entities = 0;
+    uint32_t m_skippedColumns = 0;
+    uint32_t m_parentsMissing = 0;
+    std::string m_error;
+};
+} // namespace ECSModule
@@ -0,0 +1,501 @@
+#include "WorldJournal.h"
+#include "WorldSaver.h"
+#include "../Components/ECSComponents.h"
+#include "../EntityWorld.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string_view>
+#include <unordered_map>
+
+namespace ECSModule
+{
+namespace
+{
+constexpr uint32_t FourCC(const char (&tag)[5]) noexcept
+{
+    return static_cast<uint32_t>(static_cast<uint8_t>(tag[0])) | static_cast<uint32_t>(static_cast<uint8_t>(tag[1])) << 8 |
+           static_cast<uint32_t>(static_cast<uint8_t>(tag[2])) << 16 |
+           static_cast<uint32_t>(static_cast<uint8_t>(tag[3])) << 24;
+}
+
+constexpr uint32_t kMagic = FourCC("LJNL");
+constexpr uint32_t kCheckpointTag = FourCC("CKPT");
+constexpr uint32_t kDeltaTag = FourCC("DLTA");
+constexpr uint16_t kJournalVersion = 2;
+constexpr uint16_t kFirstSourceVersion = 2;
+constexpr size_t kRecordHeaderBytes = 16;
+/// Resource names are paths; anything longer is a corrupt header
+constexpr uint32_t kMaxResourceBytes = 64 * 1024;
+
+uint64_t Fnv1a(std::string_view data) noexcept
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : data)
+    {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+template <typename T> void Put(std::string& out, T value)
+{
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T> bool Get(std::string_view data, size_t& at, T& value)
+{
+    if (data.size() - at < sizeof(T))
+        return false;
+    std::memcpy(&value, data.data() + at, sizeof(T));
+    at += sizeof(T);
+    return true;
+}
+
+bool WriteRecord(std::ostream& out, uint32_t tag, const std::string& payload)
+{
+    std::string header;
+    Put(header, tag);
+    Put(header, static_cast<uint32_t>(payload.size()));
+    Put(header, Fnv1a(payload));
+    out.write(header.data(), static_cast<std::streamsize>(header.size()));
+    out.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+    return out.good();
+}
+
+/// Reads the file header up to the first record; @p source is left empty for version 1 files.
+bool ReadHeader(std::istream& in, uint16_t& version, WorldJournalSource& source, size_t& bytes)
+{
+    uint32_t magic = 0;
+    uint16_t reserved = 0;
+    auto get = [&in](auto& value) {
+        in.read(reinterpret_cast<char*>(&value), sizeof(value));
+        return in.gcount() == static_cast<std::streamsize>(sizeof(value));
+    };
+    if (!get(magic) || magic != kMagic || !get(version) || !get(reserved) || version == 0 ||
+        version > kJournalVersion)
+        return false;
+    bytes = sizeof(magic) + sizeof(version) + sizeof(reserved);
+    source = {};
+    if (version < kFirstSourceVersion)
+        return true;
+
+    uint32_t length = 0;
+    if (!get(length) || length > kMaxResourceBytes)
+        return false;
+    source.resource.resize(length);
+    in.read(source.resource.data(), length);
+    if (in.gcount() != static_cast<std::streamsize>(length) || !get(source.contentHash))
+        return false;
+    bytes += sizeof(length) + length + sizeof(source.contentHash);
+    return true;
+}
+
+/// A record read back from the file, checked but not applied
+struct Record
+{
+    uint32_t tag = 0;
+    std::vector<uint64_t> removed;
+    std::vector<uint64_t> entities;
+    std::string_view stream;
+};
+
+/// False for a torn or corrupt record; @p at then stays where it was.
+bool ReadRecord(std::string_view file, size_t& at, Record& record)
+{
+    size_t cursor = at;
+    uint32_t length = 0;
+    uint64_t checksum = 0;
+    if (!Get(file, cursor, record.tag) || !Get(file, cursor, length) || !Get(file, cursor, checksum))
+        return false;
+    if ((record.tag != kCheckpointTag && record.tag != kDeltaTag) || file.size() - cursor < length)
+        return false;
+    const std::string_view payload = file.substr(cursor, length);
+    if (Fnv1a(payload) != checksum)
+        return false;
+
+    size_t inner = 0;
+    for (auto* ids : {&record.removed, &record.entities})
+    {
+        uint32_t count = 0;
+        if (!Get(payload, inner, count) || (payload.size() - inner) / sizeof(uint64_t) < count)
+            return false;
+        ids->resize(count);
+        if (count)
+            std::memcpy(ids->data(), payload.data() + inner, count * sizeof(uint64_t));
+        inner += count * sizeof(uint64_t);
+    }
+    record.stream = payload.substr(inner);
+    at = cursor + length;
+    return true;
+}
+} // namespace
+
+WorldJournalSource WorldJournalSource::Of(std::string resource, std::string_view contents)
+{
+    return {std::move(resource), Fnv1a(contents)};
+}
+
+WorldJournal::WorldJournal(EntityWorld& world, std::filesystem::path path, EngineCore::Foundation::JobSystem* jobs,
+                           const WorldJournalConfig& config, const WorldJournalSource& source)
+    : m_world(world), m_path(std::move(path)), m_jobs(jobs), m_config(config)
+{
+    Put(m_header, kMagic);
+    Put(m_header, kJournalVersion);
+    Put(m_header, uint16_t{0});
+    Put(m_header, static_cast<uint32_t>(source.resource.size()));
+    m_header += source.resource;
+    Put(m_header, source.contentHash);
+
+    flecs::world& ecs = world.get();
+    for (flecs::entity_t component : world.getSerializedComponents())
+    {
+        // Added components, removed ones and deleted entities; the checkpoint covers what exists now
+        m_observers.push_back(ecs.observer<>()
+                                  .with(component)
+                                  .event(flecs::OnAdd)
+                                  .event(flecs::OnRemove)
+                                  .run([this](flecs::iter& it) {
+                                      while (it.next())
+                                          for (auto row : it)
+                                              m_dirty.insert(it.entity(row).id());
+                                  }));
+        const EcsComponent* info = ecs_get(ecs.c_ptr(), component, EcsComponent);
+        if (info && info->size > 0)
+            m_changes.push_back(ecs.query_builder<>().with(component).in().cached().detect_changes().build());
+    }
+    // Reparenting: the record stores the parent. Unsaved entities marked here end up in removed, harmlessly.
+    m_observers.push_back(ecs.observer<>()
+                              .with(flecs::ChildOf, flecs::Wildcard)
+                              .event(flecs::OnAdd)
+                              .event(flecs::OnRemove)
+                              .run([this](flecs::iter& it) {
+                                  while (it.next())
+                                      for (auto row : it)
+                                          m_dirty.insert(it.entity(row).id());
+                              }));
+}
+
+WorldJournal::~WorldJournal()
+{
+    wait();
+    for (flecs::observer& observer : m_observers)
+        observer.destruct();
+    m_changes.clear();
+}
+
+void WorldJournal::collectChanges()
+{
+    for (flecs::query<>& query : m_changes)
+    {
+        if (!query.changed())
+            continue;
+        query.run([&](flecs::iter& it) {
+            while (it.next())
+            {
+                if (!it.changed())
+                    continue;
+                for (auto row : it)
+                    m_dirty.insert(it.entity(row).id());
+            }
+        });
+    }
+}
+
+bool WorldJournal::flush()
+{
+    ZoneScopedN("WorldJournal::flush");
+    if (m_pending)
+    {
+        if (!m_handle.isDone())
+            return false;
+        finishWrite();
+    }
+
+    collectChanges();
+    m_stats.dirtyEntities = static_cast<uint32_t>(m_dirty.size());
+    if (m_dirty.empty() && !m_needCheckpoint)
+        return true;
+
+    const bool compact =
+        m_stats.records > m_config.compactRecords ||
+        (m_stats.checkpointBytes > 0 && m_deltaBytes > m_config.compactRatio * static_cast<double>(m_stats.checkpointBytes));
+    auto pending = std::make_shared<Pending>();
+    pending->checkpoint = m_needCheckpoint || compact;
+
+    // The viewport camera is not content, and the world Recover() fills makes its own
+    flecs::world& ecs = m_world.get();
+    WorldBinaryWriter writer(ecs, m_world.getSerializedComponents());
+    writer.setFilter([&, checkpoint = pending->checkpoint](flecs::entity_t entity) {
+        if (!checkpoint && !m_dirty.contains(entity))
+            return false;
+        const auto* camera = flecs::entity(ecs, entity).get<CameraComponent>();
+        return !camera || !camera->isViewportCamera;
+    });
+    if (!writer.capture(pending->capture))
+    {
+        ++m_stats.failures;
+        LT_LOGE("ECSModule", "World journal: cannot capture the world");
+        return false;
+    }
+
+    // Dirty entities the capture did not find were deleted or lost all their serialized components
+    if (!pending->checkpoint)
+    {
+        for (flecs::entity_t entity : pending->capture.entities())
+            m_dirty.erase(entity);
+        pending->removed.assign(m_dirty.begin(), m_dirty.end());
+    }
+    m_dirty.clear();
+    m_needCheckpoint = false;
+    m_stats.lastFlushEntities = writer.entitiesWritten();
+    m_pending = pending;
+
+    auto job = [pending, path = m_path, header = m_header]() {
+        ZoneScopedN("WorldJournal::write");
+        std::string payload;
+        Put(payload, static_cast<uint32_t>(pending->removed.size()));
+        for (flecs::entity_t entity : pending->removed)
+            Put(payload, static_cast<uint64_t>(entity));
+        Put(payload, static_cast<uint32_t>(pending->capture.entities().size()));
+        for (flecs::entity_t entity : pending->capture.entities())
+            Put(payload, static_cast<uint64_t>(entity));
+        std::ostringstream stream;
+        if (!pending->capture.write(stream))
+        {
+            pending->error = "cannot encode the world";
+            return;
+        }
+        payload += stream.str();
+        pending->capture = {};
+        pending->payloadBytes = payload.size();
+
+        if (pending->checkpoint)
+        {
+            // A new file with only the checkpoint replaces the old one and its deltas at once
+            pending->ok = WriteFileAtomically(
+                path,
+                [&](std::ostream& out) {
+                    out.write(header.data(), static_cast<std::streamsize>(header.size()));
+                    return WriteRecord(out, kCheckpointTag, payload);
+                },
+                pending->error);
+            return;
+        }
+
+        std::ofstream out(path, std::ios::binary | std::ios::app);
+        if (!out.is_open())
+        {
+            pending->error = "cannot open " + path.string();
+            return;
+        }
+        pending->ok = WriteRecord(out, kDeltaTag, payload);
+        out.flush();
+        pending->ok = pending->ok && out.good();
+        if (!pending->ok)
+            pending->error = "cannot append to " + path.string();
+    };
+
+    if (m_jobs)
+        m_jobs->submit(std::move(job), m_handle, "WorldJournal::write");
+    else
+        job();
+    if (m_handle.isDone())
+        finishWrite();
+    return true;
+}
+
+void WorldJournal::finishWrite()
+{
+    const Pending& pending = *m_pending;
+    if (!pending.ok)
+    {
+        // The file may now end in a partial record; start over rather than append after it
+        ++m_stats.failures;
+        m_needCheckpoint = true;
+        LT_LOGE("ECSModule", "World journal " + m_path.string() + ": " + pending.error);
+    }
+    else if (pending.checkpoint)
+    {
+        m_stats.records = 1;
+        m_stats.checkpointBytes = pending.payloadBytes;
+        m_stats.fileBytes = m_header.size() + kRecordHeaderBytes + pending.payloadBytes;
+        ++m_stats.checkpoints;
+        m_deltaBytes = 0;
+    }
+    else
+    {
+        ++m_stats.records;
+        m_stats.fileBytes += kRecordHeaderBytes + pending.payloadBytes;
+        m_deltaBytes += pending.payloadBytes;
+    }
+    m_pending.reset();
+    LT_METRIC_GAUGE_SET("world_journal_bytes", "Size of the world autosave journal", m_stats.fileBytes);
+}
+
+void WorldJournal::wait()
+{
+    m_handle.wait();
+    if (m_pending)
+        finishWrite();
+}
+
+void WorldJournal::discard()
+{
+    wait();
+    std::error_code ec;
+    std::filesystem::remove(m_path, ec);
+    m_needCheckpoint = true;
+    m_stats.records = 0;
+    m_stats.fileBytes = 0;
+    m_stats.checkpointBytes = 0;
+    m_deltaBytes = 0;
+}
+
+bool WorldJournal::Recover(EntityWorld& world, const std::filesystem::path& path, RecoverStats* stats)
+{
+    ZoneScopedN("WorldJournal::Recover");
+    RecoverStats local;
+    RecoverStats& result = stats ? *stats : local;
+    result = {};
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open())
+        return false;
+    uint16_t version = 0;
+    WorldJournalSource source;
+    size_t at = 0;
+    if (!ReadHeader(in, version, source, at))
+    {
+        LT_LOGE("ECSModule", "World journal " + path.string() + " is not a journal or has an unsupported version");
+        return false;
+    }
+    in.seekg(0);
+    const std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    const std::string_view file(contents);
+
+    flecs::world& ecs = world.get();
+    std::unordered_map<uint64_t, flecs::entity_t> recovered; ///< Session entity id to recovered entity
+    auto remove = [&](uint64_t id) {
+        auto found = recovered.find(id);
+        if (found == recovered.end())
+            return;
+        if (ecs.is_alive(found->second))
+            ecs_delete(ecs.c_ptr(), found->second);
+        recovered.erase(found);
+    };
+
+    Record record;
+    while (at < file.size())
+    {
+        // Everything is checked before the record is applied, so a torn record changes nothing
+        const size_t start = at;
+        WorldBinaryIndex index;
+        std::istringstream data;
+        bool valid = ReadRecord(file, at, record) && (result.records > 0 || record.tag == kCheckpointTag);
+        if (valid)
+        {
+            data.str(std::string(record.stream));
+            valid = WorldBinaryReader::Scan(data, index) && index.entities == record.entities.size();
+            data.clear();
+            data.seekg(0);
+        }
+        if (!valid)
+        {
+            at = start;
+            result.tornTail = true;
+            break;
+        }
+
+        if (record.tag == kCheckpointTag)
+        {
+            for (const auto& [id, entity] : recovered)
+            {
+                if (ecs.is_alive(entity))
+                    ecs_delete(ecs.c_ptr(), entity);
+            }
+            recovered.clear();
+        }
+        for (uint64_t id : record.removed)
+            remove(id);
+        // Deleting a parent deletes its children, so children the record does not replace wait
+        // under a holder per replaced parent, which also keeps their names unique
+        std::vector<std::pair<uint64_t, flecs::entity>> holders;
+        for (uint64_t id : record.entities)
+        {
+            auto found = recovered.find(id);
+            if (found == recovered.end() || !ecs.is_alive(found->second))
+                continue;
+            std::vector<flecs::entity> children;
+            ecs.entity(found->second).children([&](flecs::entity child) { children.push_back(child); });
+            if (children.empty())
+                continue;
+            flecs::entity holder = ecs.entity();
+            for (flecs::entity child : children)
+                child.child_of(holder);
+            holders.emplace_back(id, holder);
+        }
+        // Replaced entities go before the new ones are named, so their names are free again
+        for (uint64_t id : record.entities)
+            remove(id);
+
+        // Parents outside this record were recovered from earlier ones
+        WorldBinaryReader reader(ecs);
+        reader.setParentResolver([&recovered](uint64_t id) {
+            auto found = recovered.find(id);
+            return found != recovered.end() ? found->second : flecs::entity_t{0};
+        });
+        size_t next = 0;
+        bool read = reader.begin(data);
+        while (read && !reader.finished())
+        {
+            read = reader.readChunk();
+            for (flecs::entity_t entity : reader.chunkEntities())
+                recovered[record.entities[next++]] = entity;
+        }
+        for (auto& [id, holder] : holders)
+        {
+            // The parent's entity lost in a torn record takes the waiting children with it, as in the session
+            auto found = recovered.find(id);
+            if (found != recovered.end() && ecs.is_alive(found->second))
+            {
+                std::vector<flecs::entity> children;
+                holder.children([&](flecs::entity child) { children.push_back(child); });
+                for (flecs::entity child : children)
+                    child.child_of(found->second);
+            }
+            holder.destruct();
+        }
+        ++result.records;
+        if (!read)
+        {
+            result.tornTail = true;
+            break;
+        }
+    }
+
+    if (result.records == 0)
+    {
+        LT_LOGE("ECSModule", "World journal " + path.string() + " has no readable checkpoint");
+        return false;
+    }
+    result.entities = static_cast<uint32_t>(recovered.size());
+    if (result.tornTail)
+        LT_LOGFW("ECSModule", "World journal {}: ignored a torn record at byte {} and everything after it",
+                 path.string(), at);
+    LT_LOGFI("ECSModule", "Recovered {} entities from {} journal records in {}", result.entities, result.records,
+             path.string());
+    return true;
+}
+
+bool WorldJournal::ReadSource(const std::filesystem::path& path, WorldJournalSource& source)
+{
+    std::ifstream in(path, std::ios::binary);
+    uint16_t version = 0;
+    size_t bytes = 0;
+    return in.is_open() && ReadHeader(in, version, source, bytes) && version >= kFirstSourceVersion;
+}
+} // namespace ECSModule
@@ -0,0 +1,159 @@
+#pragma once
+#include "WorldBinarySerializer.h"
+
+#include <EngineMinimal.h>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+class EntityWorld;
+
+namespace ECSModule
+{
+struct WorldJournalConfig
+{
+    uint32_t compactRecords = 64; ///< Delta records after which the next flush() writes a checkpoint instead
+    float compactRatio = 1.0f;    ///< ... or once the deltas together outgrow the checkpoint this many times
+};
+
+/// <summary>
+/// The world resource a journal records changes to. A journal only makes sense on top of the
+/// resource contents it started from, so recovery checks this first (WorldJournal::ReadSource).
+/// </summary>
+struct WorldJournalSource
+{
+    std::string resource;     ///< GUID or source path of the world resource
+    uint64_t contentHash = 0; ///< FNV-1a of the resource data the world was loaded from
+
+    static WorldJournalSource Of(std::string resource, std::string_view contents);
+    bool operator==(const WorldJournalSource& other) const = default;
+};
+
+/// <summary>
+/// Incremental autosave of an EntityWorld: an append-only file of the entities that changed,
+/// enough to rebuild the world after a crash with Recover().
+///
+/// Entities gaining or losing serialized components are recorded by observers, value changes
+/// by cached queries with flecs change detection, at table granularity: an entity in a table
+/// written since the last flush() is saved again whether or not its own row changed. flush()
+/// captures only those entities (WorldBinaryCapture) and appends them on a job. The first
+/// flush(), and the one after compactRecords deltas or compactRatio growth, writes a checkpoint
+/// of the whole world to a new file renamed over the old one, which drops the deltas before it.
+///
+/// File layout: "LJNL" u16 version u16 reserved, u32 length + resource, u64 contentHash (the
+/// WorldJournalSource; version 1 files lack it), then records of
+///   "CKPT" or "DLTA" u32 payloadLength u64 payloadChecksum (FNV-1a)
+///   payload  u32 removedCount u64 removed[], u32 entityCount u64 entity[], binary world stream
+/// Entity ids are the journaling session's; the stream holds the entities in the listed order,
+/// each replacing all the state an earlier record gave it. A crash mid-append leaves a torn
+/// record, which Recover() detects by length and checksum and drops with everything after it.
+///
+/// ChildOf parents are kept: the stream stores them as session ids, which Recover() maps to the
+/// entities recovered so far, and reparenting marks an entity dirty. Children a record does not
+/// replace are moved over to their parent's new entity.
+///
+/// The viewport camera is left out. Other relationships and entity references in Raw fields are
+/// not remapped; names are saved, but a rename alone does not mark an entity dirty.
+/// The journal has to be destroyed before its world.
+/// </summary>
+class WorldJournal
+{
+  public:
+    struct Stats
+    {
+        uint32_t records = 0;         ///< In the current file, checkpoint included
+        uint64_t fileBytes = 0;
+        uint64_t checkpointBytes = 0; ///< Payload of the checkpoint the file starts with
+        uint32_t dirtyEntities = 0;   ///< Waiting for the next flush()
+        uint32_t lastFlushEntities = 0;
+        uint64_t checkpoints = 0;
+        uint64_t failures = 0;
+    };
+
+    struct RecoverStats
+    {
+        uint32_t records = 0; ///< Applied
+        uint32_t entities = 0; ///< In the recovered world
+        bool tornTail = false; ///< Stopped at an incomplete or corrupt record
+    };
+
+    /// @p jobs writes the records; null writes them inside flush(). @p source goes into the file header.
+    WorldJournal(EntityWorld& world, std::filesystem::path path, EngineCore::Foundation::JobSystem* jobs,
+                 const WorldJournalConfig& config = {}, const WorldJournalSource& source = {});
+    /// Waits for a write in flight; the file stays for Recover().
+    ~WorldJournal();
+
+    WorldJournal(const WorldJournal&) = delete;
+    WorldJournal& operator=(const WorldJournal&) = delete;
+
+    /// <summary>
+    /// Starts writing the entities changed since the last flush(), or a checkpoint. False while
+    /// the previous write is still running; the changes stay for the next call. Main thread,
+    /// outside the world's tick.
+    /// </summary>
+    bool flush();
+    /// Blocks until the write in flight is done.
+    void wait();
+    /// <summary>
+    /// Deletes the file, e.g. when the world is closed normally; the next flush() starts over
+    /// with a checkpoint.
+    /// </summary>
+    void discard();
+
+    const std::filesystem::path& getPath() const noexcept
+    {
+        return m_path;
+    }
+    const Stats& getStats() const noexcept
+    {
+        return m_stats;
+    }
+
+    /// <summary>
+    /// Rebuilds the journaled world in @p world from the file at @p path. Entities are added to
+    /// the world as-is, so pass an empty one (EntityWorld::reset()). False, with the world
+    /// untouched, when the file is missing or its checkpoint is unreadable; records after a
+    /// torn one are ignored.
+    /// </summary>
+    static bool Recover(EntityWorld& world, const std::filesystem::path& path, RecoverStats* stats = nullptr);
+    /// <summary>
+    /// Reads the WorldJournalSource from the header of the file at @p path. False when the file is
+    /// missing, is not a journal or predates the source header.
+    /// </summary>
+    static bool ReadSource(const std::filesystem::path& path, WorldJournalSource& source);
+
+  private:
+    /// Owned by the write job until its handle is done
+    struct Pending
+    {
+        WorldBinaryCapture capture;
+        std::vector<flecs::entity_t> removed;
+        bool checkpoint = false;
+        uint64_t payloadBytes = 0;
+        bool ok = false;
+        std::string error;
+    };
+
+    void collectChanges();
+    void finishWrite();
+
+    EntityWorld& m_world;
+    std::filesystem::path m_path;
+    EngineCore::Foundation::JobSystem* m_jobs;
+    WorldJournalConfig m_config;
+    std::string m_header; ///< File header every checkpoint starts a file with
+    std::vector<flecs::observer> m_observers;
+    std::vector<flecs::query<>> m_changes; ///< Per serialized component with data
+
+    std::unordered_set<flecs::entity_t> m_dirty;
+    bool m_needCheckpoint = true;
+    uint64_t m_deltaBytes = 0;
+    std::shared_ptr<Pending> m_pending;
+    EngineCore::Foundation::JobHandle m_handle;
+    Stats m_stats;
+};
+} // namespace ECSModule
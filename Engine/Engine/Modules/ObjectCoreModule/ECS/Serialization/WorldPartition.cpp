@@ -0,0 +1,269 @@
+#include "WorldPartition.h"
+#include "WorldBinarySerializer.h"
+#include "../Components/ECSComponents.h"
+
+#include <EngineMinimal.h>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <unordered_set>
+
+namespace ECSModule
+{
+namespace
+{
+std::optional<uint64_t> WriteCell(flecs::world& world, std::span<const flecs::entity_t> components,
+                                  uint32_t chunkEntities, const std::filesystem::path& path,
+                                  std::function<bool(flecs::entity_t)> filter, uint32_t& entities)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open())
+    {
+        LT_LOGE("ECSModule", "World partition: cannot write " + path.string());
+        return std::nullopt;
+    }
+
+    WorldBinaryWriter writer(world, components, chunkEntities);
+    writer.setFilter(std::move(filter));
+    if (!writer.write(out))
+    {
+        LT_LOGE("ECSModule", "World partition: failed writing " + path.string());
+        return std::nullopt;
+    }
+    out.close();
+    entities = writer.entitiesWritten();
+    return static_cast<uint64_t>(std::filesystem::file_size(path));
+}
+
+/// Topmost ChildOf ancestor of @p entity; the entity itself when it has no parent.
+flecs::entity_t RootOf(const ecs_world_t* world, flecs::entity_t entity)
+{
+    while (const flecs::entity_t parent = ecs_get_target(world, entity, EcsChildOf, 0))
+        entity = parent;
+    return entity;
+}
+} // namespace
+
+std::optional<WorldPartition> WorldPartition::Build(flecs::world& world, std::span<const flecs::entity_t> components,
+                                                    float cellSize, const std::filesystem::path& manifest,
+                                                    uint32_t chunkEntities)
+{
+    ZoneScopedN("WorldPartition::Build");
+    if (!(cellSize > 0.0f))
+    {
+        LT_LOGE("ECSModule", "World partition: cell size must be positive");
+        return std::nullopt;
+    }
+
+    WorldPartition partition;
+    partition.m_cellSize = cellSize;
+    partition.m_directory = manifest.parent_path();
+
+    // Hierarchies stay whole, so a cell never streams a child without its parent: roots are placed
+    // by position and everything below them follows the root (RootOf in the filters below).
+    std::unordered_map<flecs::entity_t, WorldCellKey> placement;
+    std::unordered_set<flecs::entity_t> skipped;
+    world.each([&](flecs::entity e, const TransformComponent& transform) {
+        // The editor's viewport camera is not content; every world makes its own
+        const auto* camera = e.get<CameraComponent>();
+        if (camera && camera->isViewportCamera)
+        {
+            skipped.insert(e.id());
+            return;
+        }
+        if (e.parent())
+            return;
+        placement.emplace(e.id(), partition.cellAt(transform.position.toGLMVec()));
+    });
+
+    std::unordered_set<WorldCellKey, WorldCellKeyHash> occupied;
+    for (const auto& [entity, key] : placement)
+        occupied.insert(key);
+    std::vector<WorldCellKey> keys(occupied.begin(), occupied.end());
+    std::sort(keys.begin(), keys.end(), [](const WorldCellKey& a, const WorldCellKey& b) {
+        return a.z != b.z ? a.z < b.z : a.x < b.x;
+    });
+
+    const std::string folder = manifest.stem().string() + "_cells";
+    std::error_code ec;
+    std::filesystem::create_directories(partition.m_directory / folder, ec);
+
+    // One writer per cell, each walking every table: a bake step, not meant for the frame.
+    for (const WorldCellKey& key : keys)
+    {
+        Cell cell;
+        cell.key = key;
+        cell.file = folder + "/cell_" + std::to_string(key.x) + "_" + std::to_string(key.z) + ".lcell";
+        auto bytes = WriteCell(
+            world, components, chunkEntities, partition.resolve(cell.file),
+            [&world, &placement, key](flecs::entity_t e) {
+                auto it = placement.find(RootOf(world.c_ptr(), e));
+                return it != placement.end() && it->second == key;
+            },
+            cell.entities);
+        if (!bytes)
+            return std::nullopt;
+        cell.bytes = *bytes;
+        // A cell of components the format cannot store is left out rather than streamed empty
+        if (cell.entities > 0)
+            partition.m_cells.push_back(std::move(cell));
+        else
+            std::filesystem::remove(partition.resolve(cell.file), ec);
+    }
+
+    Cell persistent;
+    persistent.file = folder + "/persistent.lcell";
+    auto bytes = WriteCell(
+        world, components, chunkEntities, partition.resolve(persistent.file),
+        [&world, &placement, &skipped](flecs::entity_t e) {
+            const flecs::entity_t root = RootOf(world.c_ptr(), e);
+            return !placement.contains(root) && !skipped.contains(root);
+        },
+        persistent.entities);
+    if (!bytes)
+        return std::nullopt;
+    if (persistent.entities > 0)
+    {
+        persistent.bytes = *bytes;
+        partition.m_persistent = std::move(persistent);
+    }
+    else
+    {
+        std::filesystem::remove(partition.resolve(persistent.file), ec);
+    }
+
+    partition.index();
+    if (!partition.save(manifest))
+        return std::nullopt;
+
+    LT_LOGFI("ECSModule", "World partition {}: {} cells, {} persistent entities", manifest.string(),
+             partition.m_cells.size(), partition.m_persistent.entities);
+    return partition;
+}
+
+bool WorldPartition::load(const std::filesystem::path& manifest)
+{
+    ZoneScopedN("WorldPartition::load");
+    std::ifstream in(manifest);
+    if (!in.is_open())
+    {
+        LT_LOGE("ECSModule", "World partition: cannot open " + manifest.string());
+        return false;
+    }
+
+    nlohmann::json j;
+    try
+    {
+        in >> j;
+        if (j.value("version", 0u) != kVersion)
+        {
+            LT_LOGE("ECSModule", "World partition: unsupported manifest version in " + manifest.string());
+            return false;
+        }
+
+        const float cellSize = j.at("cellSize").get<float>();
+        if (!(cellSize > 0.0f))
+        {
+            LT_LOGE("ECSModule", "World partition: cell size must be positive in " + manifest.string());
+            return false;
+        }
+
+        std::vector<Cell> cells;
+        for (const auto& entry : j.at("cells"))
+        {
+            Cell cell;
+            cell.key = {entry.at("x").get<int32_t>(), entry.at("z").get<int32_t>()};
+            cell.file = entry.at("file").get<std::string>();
+            cell.bytes = entry.value("bytes", uint64_t{0});
+            cell.entities = entry.value("entities", 0u);
+            cells.push_back(std::move(cell));
+        }
+
+        Cell persistent;
+        if (j.contains("persistent"))
+        {
+            const auto& entry = j["persistent"];
+            persistent.file = entry.at("file").get<std::string>();
+            persistent.bytes = entry.value("bytes", uint64_t{0});
+            persistent.entities = entry.value("entities", 0u);
+        }
+
+        m_cellSize = cellSize;
+        m_cells = std::move(cells);
+        m_persistent = std::move(persistent);
+    }
+    catch (const nlohmann::json::exception& e)
+    {
+        LT_LOGE("ECSModule", "World partition: invalid manifest " + manifest.string() + ": " + e.what());
+        return false;
+    }
+
+    m_directory = manifest.parent_path();
+    index();
+    return true;
+}
+
+bool WorldPartition::save(const std::filesystem::path& manifest)
+{
+    nlohmann::json j;
+    j["version"] = kVersion;
+    j["cellSize"] = m_cellSize;
+    if (!m_persistent.file.empty())
+        j["persistent"] = {{"file", m_persistent.file},
+                           {"bytes", m_persistent.bytes},
+                           {"entities", m_persistent.entities}};
+
+    auto& cells = j["cells"] = nlohmann::json::array();
+    for (const Cell& cell : m_cells)
+    {
+        cells.push_back({{"x", cell.key.x},
+                         {"z", cell.key.z},
+                         {"file", cell.file},
+                         {"bytes", cell.bytes},
+                         {"entities", cell.entities}});
+    }
+
+    std::ofstream out(manifest, std::ios::trunc);
+    if (!out.is_open())
+    {
+        LT_LOGE("ECSModule", "World partition: cannot write " + manifest.string());
+        return false;
+    }
+    out << j.dump(2);
+    m_directory = manifest.parent_path();
+    return out.good();
+}
+
+const WorldPartition::Cell* WorldPartition::findCell(const WorldCellKey& key) const
+{
+    auto it = m_lookup.find(key);
+    return it != m_lookup.end() ? &m_cells[it->second] : nullptr;
+}
+
+WorldCellKey WorldPartition::cellAt(const Math::Vec3& position) const noexcept
+{
+    return {static_cast<int32_t>(std::floor(position.x / m_cellSize)),
+            static_cast<int32_t>(std::floor(position.z / m_cellSize))};
+}
+
+float WorldPartition::distanceTo(const WorldCellKey& key, const Math::Vec3& position) const noexcept
+{
+    const float minX = static_cast<float>(key.x) * m_cellSize;
+    const float minZ = static_cast<float>(key.z) * m_cellSize;
+    const float dx = std::max({minX - position.x, 0.0f, position.x - (minX + m_cellSize)});
+    const float dz = std::max({minZ - position.z, 0.0f, position.z - (minZ + m_cellSize)});
+    return std::sqrt(dx * dx + dz * dz);
+}
+
+void WorldPartition::index()
+{
+    m_lookup.clear();
+    for (size_t i = 0; i < m_cells.size(); ++i)
+    {
+        if (!m_lookup.emplace(m_cells[i].key, i).second)
+            LT_LOGW("ECSModule", "World partition: cell " + m_cells[i].file + " is listed twice; the first one is used");
+    }
+}
+} // namespace ECSModule
@@ -0,0 +1,107 @@
+#pragma once
+#include <flecs.h>
+
+#include <Foundation/Math/Math.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ECSModule
+{
+/// <summary>
+/// Cell on the partition grid. The grid is laid over X and Z; a cell spans every height.
+/// </summary>
+struct WorldCellKey
+{
+    int32_t x = 0;
+    int32_t z = 0;
+
+    bool operator==(const WorldCellKey&) const noexcept = default;
+};
+
+struct WorldCellKeyHash
+{
+    size_t operator()(const WorldCellKey& key) const noexcept
+    {
+        return std::hash<uint64_t>{}(static_cast<uint64_t>(static_cast<uint32_t>(key.x)) << 32 |
+                                     static_cast<uint32_t>(key.z));
+    }
+};
+
+/// <summary>
+/// A world split into square cells for streaming, described by a JSON manifest (.lpartition):
+///
+///   { "version": 1, "cellSize": 128.0, "persistent": { "file": ..., "bytes": ... },
+///     "cells": [ { "x": 0, "z": -1, "file": "open_cells/cell_0_-1.lcell", "bytes": ..., "entities": ... } ] }
+///
+/// Every cell file is a binary world stream (WorldBinarySerializer.h) holding the root entities
+/// whose position falls inside the cell, each with all of its ChildOf descendants, so parents and
+/// children always stream together. Hierarchies whose root has no transform go to the persistent
+/// file, which is loaded with the world and never streamed; the editor's viewport camera is left
+/// out. File names are relative to the manifest.
+/// Cells are self-contained: references between entities of different cells are not kept.
+/// </summary>
+class WorldPartition
+{
+  public:
+    static constexpr uint32_t kVersion = 1;
+
+    struct Cell
+    {
+        WorldCellKey key;
+        std::string file;
+        uint64_t bytes = 0; ///< Size of the cell file; what the streamer budgets with
+        uint32_t entities = 0;
+    };
+
+    /// <summary>
+    /// Splits the entities of @p world that have any of @p components into cells of @p cellSize
+    /// and writes the cell files plus the manifest at @p manifest. Cells get @p chunkEntities per
+    /// chunk so a streamer can instantiate them a chunk at a time. Returns the written partition.
+    /// </summary>
+    static std::optional<WorldPartition> Build(flecs::world& world, std::span<const flecs::entity_t> components,
+                                               float cellSize, const std::filesystem::path& manifest,
+                                               uint32_t chunkEntities = 256);
+
+    bool load(const std::filesystem::path& manifest);
+    bool save(const std::filesystem::path& manifest);
+
+    float getCellSize() const noexcept
+    {
+        return m_cellSize;
+    }
+    const std::vector<Cell>& getCells() const noexcept
+    {
+        return m_cells;
+    }
+    const Cell* findCell(const WorldCellKey& key) const;
+    /// Empty when every entity has a place on the grid
+    const Cell& getPersistent() const noexcept
+    {
+        return m_persistent;
+    }
+
+    WorldCellKey cellAt(const Math::Vec3& position) const noexcept;
+    /// Horizontal distance from @p position to the nearest point of cell @p key; 0 inside it.
+    float distanceTo(const WorldCellKey& key, const Math::Vec3& position) const noexcept;
+    /// Absolute path of a cell file.
+    std::filesystem::path resolve(const std::string& file) const
+    {
+        return m_directory / file;
+    }
+
+  private:
+    void index();
+
+    float m_cellSize = 128.0f;
+    std::vector<Cell> m_cells;
+    Cell m_persistent;
+    std::unordered_map<WorldCellKey, size_t, WorldCellKeyHash> m_lookup;
+    std::filesystem::path m_directory;
+};
+} // namespace ECSModule
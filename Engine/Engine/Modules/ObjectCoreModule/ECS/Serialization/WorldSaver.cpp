@@ -0,0 +1,123 @@
+#include "WorldSaver.h"
+#include "../EntityWorld.h"
+
+#include <fstream>
+
+namespace ECSModule
+{
+bool WriteFileAtomically(const std::filesystem::path& path, const std::function<bool(std::ostream&)>& write,
+                         std::string& error)
+{
+    std::error_code ec;
+    if (path.has_parent_path())
+    {
+        std::filesystem::create_directories(path.parent_path(), ec);
+        if (ec)
+        {
+            error = "cannot create " + path.parent_path().string() + ": " + ec.message();
+            return false;
+        }
+    }
+
+    std::filesystem::path tmpPath = path;
+    tmpPath += ".tmp";
+    {
+        std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!out.is_open())
+        {
+            error = "cannot open " + tmpPath.string();
+            return false;
+        }
+        const bool written = write(out);
+        out.flush();
+        if (!written || !out.good())
+        {
+            out.close();
+            std::filesystem::remove(tmpPath, ec);
+            error = "cannot write " + tmpPath.string();
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tmpPath, path, ec);
+    if (ec)
+    {
+        error = "cannot move " + tmpPath.string() + " into place: " + ec.message();
+        std::filesystem::remove(tmpPath, ec);
+        return false;
+    }
+    return true;
+}
+
+WorldSaver::WorldSaver(EngineCore::Foundation::JobSystem* jobs) : m_jobs(jobs)
+{
+}
+
+WorldSaver::~WorldSaver()
+{
+    wait();
+}
+
+bool WorldSaver::save(EntityWorld& world, const std::filesystem::path& path)
+{
+    ZoneScopedN("WorldSaver::save");
+    if (m_pending)
+    {
+        LT_LOGW("ECSModule", "World save to " + path.string() + " skipped: the previous save is still running");
+        return false;
+    }
+
+    auto pending = std::make_shared<Pending>();
+    pending->result.path = path;
+    WorldBinaryWriter writer(world.get(), world.getSerializedComponents());
+    if (!writer.capture(pending->capture))
+    {
+        LT_LOGE("ECSModule", "World save to " + path.string() + " failed: cannot capture the world");
+        return false;
+    }
+    pending->result.entities = writer.entitiesWritten();
+    LT_METRIC_GAUGE_SET("world_save_capture_bytes", "Memory taken by the copy of the last world saved",
+                        pending->capture.memoryBytes());
+    m_pending = pending;
+
+    auto job = [pending]() {
+        ZoneScopedN("WorldSaver::write");
+        pending->result.ok = WriteFileAtomically(
+            pending->result.path, [&](std::ostream& out) { return pending->capture.write(out); },
+            pending->result.error);
+        // The copy can be large; free it on the job rather than in poll()
+        pending->capture = {};
+    };
+
+    if (m_jobs)
+        m_jobs->submit(std::move(job), m_handle, "WorldSaver::write");
+    else
+        job();
+    return true;
+}
+
+bool WorldSaver::poll(Result& result)
+{
+    if (!m_pending || !m_handle.isDone())
+        return false;
+
+    result = std::move(m_pending->result);
+    m_pending.reset();
+    if (result.ok)
+    {
+        LT_LOGFI("ECSModule", "Saved world ({} entities) to {}", result.entities, result.path.string());
+        LT_METRIC_COUNTER_INC("world_saves", "Worlds saved by WorldSaver");
+    }
+    else
+    {
+        LT_LOGE("ECSModule", "World save to " + result.path.string() + " failed: " + result.error);
+        LT_METRIC_COUNTER_INC("world_save_failures", "World saves that could not be written");
+    }
+    return true;
+}
+
+void WorldSaver::wait()
+{
+    m_handle.wait();
+}
+} // namespace ECSModule
@@ -0,0 +1,81 @@
+#pragma once
+#include "WorldBinarySerializer.h"
+
+#include <EngineMinimal.h>
+
+#include <filesystem>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <string>
+
+class EntityWorld;
+
+namespace ECSModule
+{
+/// <summary>
+/// Writes @p path through @p write into a temporary file next to it and renames that over
+/// @p path, so a reader sees either the old file or the complete new one. On failure the
+/// temporary file is removed and @p error says why.
+/// </summary>
+bool WriteFileAtomically(const std::filesystem::path& path, const std::function<bool(std::ostream&)>& write,
+                         std::string& error);
+
+/// <summary>
+/// Saves worlds in the binary world format without stalling the main thread: save() takes a
+/// WorldBinaryCapture of the world, which copies component rows and strings, and a job encodes
+/// it and writes the file (WriteFileAtomically). The world can change right after save()
+/// returns; the file holds the world as it was at the call.
+///
+/// One save runs at a time. poll() reports a finished save once, on the main thread.
+/// </summary>
+class WorldSaver
+{
+  public:
+    struct Result
+    {
+        std::filesystem::path path;
+        uint32_t entities = 0;
+        bool ok = false;
+        std::string error;
+    };
+
+    /// @p jobs runs the encoding and the write; null does both inside save().
+    explicit WorldSaver(EngineCore::Foundation::JobSystem* jobs);
+    /// Waits for a save in flight.
+    ~WorldSaver();
+
+    WorldSaver(const WorldSaver&) = delete;
+    WorldSaver& operator=(const WorldSaver&) = delete;
+
+    /// <summary>
+    /// Captures @p world and starts writing it to @p path. False, without capturing, while the
+    /// previous save has not been reported by poll() yet.
+    /// </summary>
+    bool save(EntityWorld& world, const std::filesystem::path& path);
+    /// A save was started and poll() has not reported it yet
+    bool isSaving() const noexcept
+    {
+        return m_pending != nullptr;
+    }
+    /// <summary>
+    /// Logs and returns a finished save into @p result; false while the save is running or when
+    /// there is none. Main thread.
+    /// </summary>
+    bool poll(Result& result);
+    /// Blocks until the save in flight is written; poll() still reports it.
+    void wait();
+
+  private:
+    /// Owned by the write job until its handle is done
+    struct Pending
+    {
+        WorldBinaryCapture capture;
+        Result result;
+    };
+
+    EngineCore::Foundation::JobSystem* m_jobs;
+    std::shared_ptr<Pending> m_pending;
+    EngineCore::Foundation::JobHandle m_handle;
+};
+} // namespace ECSModule
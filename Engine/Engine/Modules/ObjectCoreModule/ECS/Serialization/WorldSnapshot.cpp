@@ -0,0 +1,365 @@
+#include "WorldSnapshot.h"
+
+#include <EngineMinimal.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace ECSModule
+{
+namespace
+{
+bool IsIdentifier(ecs_id_t id) noexcept
+{
+    // Names, symbols and aliases are restored through ecs_set_name, which keeps the lookup index right.
+    return ECS_IS_PAIR(id) && ECS_PAIR_FIRST(id) == EcsIdentifier;
+}
+
+void TableIds(const ecs_table_t* table, std::vector<flecs::id_t>& out)
+{
+    out.clear();
+    const ecs_type_t* type = ecs_table_get_type(table);
+    for (int32_t i = 0; i < type->count; ++i)
+    {
+        if (!IsIdentifier(type->array[i]))
+            out.push_back(type->array[i]);
+    }
+}
+
+bool CopyIsIllegal(const ecs_type_info_t& info) noexcept
+{
+#ifdef ECS_TYPE_HOOK_COPY_ILLEGAL
+    return (info.hooks.flags & ECS_TYPE_HOOK_COPY_ILLEGAL) != 0;
+#else
+    (void)info;
+    return false;
+#endif
+}
+
+void CopyConstruct(void* dst, const void* src, int32_t count, const ecs_type_info_t& info)
+{
+    if (info.hooks.copy_ctor)
+    {
+        info.hooks.copy_ctor(dst, src, count, &info);
+    }
+    else if (info.hooks.copy)
+    {
+        if (info.hooks.ctor)
+            info.hooks.ctor(dst, count, &info);
+        else
+            std::memset(dst, 0, static_cast<size_t>(info.size) * static_cast<size_t>(count));
+        info.hooks.copy(dst, src, count, &info);
+    }
+    else
+    {
+        std::memcpy(dst, src, static_cast<size_t>(info.size) * static_cast<size_t>(count));
+    }
+}
+} // namespace
+
+WorldSnapshot::WorldSnapshot(std::vector<flecs::entity_t> roots) : m_roots(std::move(roots))
+{
+    if (m_roots.size() > FLECS_TERM_COUNT_MAX)
+    {
+        LT_LOGW("ECSModule", "WorldSnapshot: too many root components, extra ones are ignored");
+        m_roots.resize(FLECS_TERM_COUNT_MAX);
+    }
+}
+
+WorldSnapshot::~WorldSnapshot()
+{
+    releaseValues();
+}
+
+void WorldSnapshot::setRestoreHook(flecs::entity_t component, RestoreHook hook)
+{
+    m_restoreHooks[component] = std::move(hook);
+}
+
+void WorldSnapshot::setDiscardHook(EntityHook hook)
+{
+    m_discardHook = std::move(hook);
+}
+
+ecs_query_t* WorldSnapshot::createQuery(ecs_world_t* world) const
+{
+    if (m_roots.empty())
+        return nullptr;
+
+    ecs_query_desc_t desc{};
+    for (size_t i = 0; i < m_roots.size(); ++i)
+    {
+        desc.terms[i].id = m_roots[i];
+        desc.terms[i].inout = EcsInOutNone;
+        if (i + 1 < m_roots.size())
+            desc.terms[i].oper = EcsOr;
+    }
+    // Disabling an entity during simulation must not hide it from restore().
+    desc.flags = EcsQueryMatchDisabled | EcsQueryMatchPrefab;
+    return ecs_query_init(world, &desc);
+}
+
+void WorldSnapshot::reserveArena(size_t bytes)
+{
+    if (bytes > m_arenaCapacity)
+    {
+        m_arena.reset();
+        m_arenaCapacity = bytes;
+        m_arenaMemory = std::make_unique<uint8_t[]>(m_arenaCapacity);
+    }
+    if (!m_arena && m_arenaCapacity > 0)
+    {
+        m_arena = std::make_unique<EngineCore::Foundation::LinearAllocator>(
+            m_arenaMemory.get(), m_arenaCapacity, EngineCore::Foundation::MemoryTag::ECS);
+    }
+    if (m_arena)
+        m_arena->reset();
+}
+
+bool WorldSnapshot::capture(flecs::world& world)
+{
+    ZoneScopedN("WorldSnapshot::capture");
+    clear();
+
+    ecs_world_t* ecs = world.c_ptr();
+    ecs_query_t* query = createQuery(ecs);
+    if (!query)
+        return m_roots.empty();
+
+    // Pass 1: size the arena so every column lands in one allocation.
+    size_t bytes = 0;
+    ecs_iter_t it = ecs_query_iter(ecs, query);
+    while (ecs_query_next(&it))
+    {
+        const ecs_type_t* type = ecs_table_get_type(it.table);
+        for (int32_t i = 0; i < type->count; ++i)
+        {
+            if (IsIdentifier(type->array[i]) || ecs_table_type_to_column_index(it.table, i) < 0)
+                continue;
+            const ecs_type_info_t* info = ecs_get_type_info(ecs, type->array[i]);
+            bytes += static_cast<size_t>(info->size) * static_cast<size_t>(it.count) + static_cast<size_t>(info->alignment);
+        }
+    }
+    reserveArena(bytes);
+
+    // Pass 2: copy.
+    bool skippedColumns = false;
+    it = ecs_query_iter(ecs, query);
+    while (ecs_query_next(&it))
+    {
+        Table table;
+        TableIds(it.table, table.ids);
+        table.rows = static_cast<uint32_t>(it.count);
+        table.firstColumn = static_cast<uint32_t>(m_columns.size());
+
+        const ecs_type_t* type = ecs_table_get_type(it.table);
+        for (int32_t i = 0; i < type->count; ++i)
+        {
+            const int32_t columnIndex = ecs_table_type_to_column_index(it.table, i);
+            if (IsIdentifier(type->array[i]) || columnIndex < 0)
+                continue;
+
+            Column column;
+            column.id = type->array[i];
+            column.info = *ecs_get_type_info(ecs, column.id);
+            if (CopyIsIllegal(column.info))
+            {
+                skippedColumns = true;
+                continue;
+            }
+            column.data = static_cast<uint8_t*>(
+                m_arena->allocate(static_cast<size_t>(column.info.size) * static_cast<size_t>(it.count),
+                                  static_cast<size_t>(column.info.alignment)));
+            CopyConstruct(column.data, ecs_table_get_column(it.table, columnIndex, it.offset), it.count, column.info);
+            m_columns.push_back(column);
+        }
+        table.columnCount = static_cast<uint32_t>(m_columns.size()) - table.firstColumn;
+
+        const auto tableIndex = static_cast<uint32_t>(m_tables.size());
+        m_tables.push_back(std::move(table));
+        for (int32_t row = 0; row < it.count; ++row)
+        {
+            const char* name = ecs_get_name(ecs, it.entities[row]);
+            m_entities.push_back({it.entities[row], tableIndex, static_cast<uint32_t>(row), name ? name : ""});
+        }
+    }
+    ecs_query_fini(query);
+
+    if (skippedColumns)
+        LT_LOGW("ECSModule", "WorldSnapshot: non-copyable components are not captured");
+    return true;
+}
+
+WorldSnapshot::RestoreStats WorldSnapshot::restore(flecs::world& world)
+{
+    ZoneScopedN("WorldSnapshot::restore");
+    ecs_world_t* ecs = world.c_ptr();
+    RestoreStats stats;
+
+    std::vector<flecs::entity_t> saved;
+    saved.reserve(m_entities.size());
+    for (const Entity& entity : m_entities)
+        saved.push_back(entity.id);
+    std::sort(saved.begin(), saved.end());
+
+    // Entities spawned during simulation.
+    if (ecs_query_t* query = createQuery(ecs))
+    {
+        std::vector<flecs::entity_t> spawned;
+        ecs_iter_t it = ecs_query_iter(ecs, query);
+        while (ecs_query_next(&it))
+        {
+            for (int32_t i = 0; i < it.count; ++i)
+            {
+                if (!std::binary_search(saved.begin(), saved.end(), it.entities[i]))
+                    spawned.push_back(it.entities[i]);
+            }
+        }
+        ecs_query_fini(query);
+
+        for (flecs::entity_t entity : spawned)
+        {
+            if (!ecs_is_alive(ecs, entity))
+                continue; // Went with a deleted parent
+            if (m_discardHook)
+                m_discardHook(flecs::entity(ecs, entity));
+            ecs_delete(ecs, entity);
+            ++stats.destroyed;
+        }
+    }
+
+    // Bring back deleted entities before any type is restored, so ChildOf targets exist.
+    std::vector<uint8_t> restorable(m_entities.size(), 1);
+    for (size_t i = 0; i < m_entities.size(); ++i)
+    {
+        const flecs::entity_t id = m_entities[i].id;
+        if (ecs_is_alive(ecs, id))
+            continue;
+        if (ecs_get_alive(ecs, id) != 0)
+        {
+            // Its index was recycled by an entity the snapshot does not cover.
+            LT_LOGFW("ECSModule", "WorldSnapshot: entity {} cannot be recreated, its id is in use", id);
+            restorable[i] = 0;
+            continue;
+        }
+        ecs_make_alive(ecs, id);
+        ++stats.recreated;
+    }
+
+    // Types. Entities still in the table type they were captured with take the fast path.
+    std::unordered_map<const ecs_table_t*, uint32_t> sameType;
+    std::vector<flecs::id_t> liveIds;
+    for (size_t i = 0; i < m_entities.size(); ++i)
+    {
+        if (!restorable[i])
+            continue;
+        const Entity& entity = m_entities[i];
+        const Table& table = m_tables[entity.table];
+
+        const ecs_table_t* live = ecs_get_table(ecs, entity.id);
+        const auto known = live ? sameType.find(live) : sameType.end();
+        if (known == sameType.end() || known->second != entity.table)
+        {
+            liveIds.clear();
+            if (live)
+                TableIds(live, liveIds);
+            if (liveIds == table.ids)
+            {
+                sameType[live] = entity.table;
+            }
+            else
+            {
+                // Both lists are sorted by id, as flecs keeps table types.
+                auto liveIt = liveIds.begin();
+                auto savedIt = table.ids.begin();
+                while (liveIt != liveIds.end() || savedIt != table.ids.end())
+                {
+                    if (savedIt == table.ids.end() || (liveIt != liveIds.end() && *liveIt < *savedIt))
+                        ecs_remove_id(ecs, entity.id, *liveIt++);
+                    else if (liveIt == liveIds.end() || *savedIt < *liveIt)
+                        ecs_add_id(ecs, entity.id, *savedIt++);
+                    else
+                        ++liveIt, ++savedIt;
+                }
+                ++stats.retyped;
+            }
+        }
+
+        const char* name = ecs_get_name(ecs, entity.id);
+        if (entity.name != (name ? name : ""))
+            ecs_set_name(ecs, entity.id, entity.name.empty() ? nullptr : entity.name.c_str());
+    }
+
+    // Values. No structural changes from here on, so component pointers stay valid.
+    std::vector<std::pair<flecs::entity_t, flecs::id_t>> modified;
+    for (size_t i = 0; i < m_entities.size(); ++i)
+    {
+        if (!restorable[i])
+            continue;
+        const Entity& entity = m_entities[i];
+        const Table& table = m_tables[entity.table];
+        for (uint32_t c = 0; c < table.columnCount; ++c)
+        {
+            const Column& column = m_columns[table.firstColumn + c];
+            const size_t size = static_cast<size_t>(column.info.size);
+            const uint8_t* value = column.data + size * entity.row;
+            void* live = ecs_get_mut_id(ecs, entity.id, column.id);
+            if (!live)
+                continue;
+
+            if (const auto hook = m_restoreHooks.find(column.id); hook != m_restoreHooks.end())
+            {
+                hook->second(flecs::entity(ecs, entity.id), value, live);
+            }
+            else if (!column.info.hooks.copy)
+            {
+                if (std::memcmp(live, value, size) == 0)
+                {
+                    ++stats.componentsUnchanged;
+                    continue;
+                }
+                std::memcpy(live, value, size);
+            }
+            else
+            {
+                column.info.hooks.copy(live, value, 1, &column.info);
+            }
+            ++stats.componentsCopied;
+            modified.emplace_back(entity.id, column.id);
+        }
+        ++stats.entities;
+    }
+
+    ecs_defer_begin(ecs);
+    for (const auto& [entity, id] : modified)
+        ecs_modified_id(ecs, entity, id);
+    ecs_defer_end(ecs);
+
+    LT_LOGFI("ECSModule", "Snapshot restored: {} entities, {} recreated, {} destroyed, {} retyped, {} values copied",
+             stats.entities, stats.recreated, stats.destroyed, stats.retyped, stats.componentsCopied);
+    return stats;
+}
+
+void WorldSnapshot::releaseValues() noexcept
+{
+    for (const Table& table : m_tables)
+    {
+        for (uint32_t c = 0; c < table.columnCount; ++c)
+        {
+            const Column& column = m_columns[table.firstColumn + c];
+            if (column.info.hooks.dtor)
+                column.info.hooks.dtor(column.data, static_cast<int32_t>(table.rows), &column.info);
+        }
+    }
+}
+
+void WorldSnapshot::clear()
+{
+    releaseValues();
+    m_tables.clear();
+    m_columns.clear();
+    m_entities.clear();
+    if (m_arena)
+        m_arena->reset();
+}
+} // namespace ECSModule
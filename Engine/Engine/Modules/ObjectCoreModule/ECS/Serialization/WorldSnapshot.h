@@ -0,0 +1,112 @@
+#pragma once
+#include <flecs.h>
+
+#include <Foundation/Memory/LinearAllocator.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ECSModule
+{
+/// <summary>
+/// In-memory copy of a world's entities, used to rewind the editor world when simulation stops.
+///
+/// capture() copies every component column of the matching tables into one arena, using the
+/// components' copy hooks. restore() rewinds the live world in place: entities spawned since the
+/// capture are deleted, deleted ones come back under their old ids, only entities whose type
+/// changed move tables, and trivially copyable values that did not change are not touched.
+/// Nothing is serialized; ids, handles and pointers inside components are kept as-is.
+/// </summary>
+class WorldSnapshot
+{
+  public:
+    /// Replaces the default copy-assignment of one component on restore. Runs while restore() walks
+    /// the world, so it only fixes up the value: no scripts, no structural changes.
+    using RestoreHook = std::function<void(flecs::entity entity, const void* saved, void* live)>;
+    using EntityHook = std::function<void(flecs::entity entity)>;
+
+    struct RestoreStats
+    {
+        uint32_t entities = 0;
+        uint32_t recreated = 0;           ///< Deleted after capture, brought back
+        uint32_t destroyed = 0;           ///< Spawned after capture, deleted
+        uint32_t retyped = 0;             ///< Components added or removed after capture
+        uint32_t componentsCopied = 0;
+        uint32_t componentsUnchanged = 0; ///< Skipped, bytes equal to the saved value
+    };
+
+    /// <summary>
+    /// Entities with at least one of @p roots are captured, with all of their components.
+    /// </summary>
+    explicit WorldSnapshot(std::vector<flecs::entity_t> roots);
+    ~WorldSnapshot();
+
+    WorldSnapshot(const WorldSnapshot&) = delete;
+    WorldSnapshot& operator=(const WorldSnapshot&) = delete;
+
+    void setRestoreHook(flecs::entity_t component, RestoreHook hook);
+    /// Called for every entity spawned after capture(), right before restore() deletes it.
+    void setDiscardHook(EntityHook hook);
+
+    bool capture(flecs::world& world);
+    RestoreStats restore(flecs::world& world);
+    void clear();
+
+    bool empty() const noexcept
+    {
+        return m_entities.empty();
+    }
+    size_t entityCount() const noexcept
+    {
+        return m_entities.size();
+    }
+    size_t arenaBytes() const noexcept
+    {
+        return m_arena ? m_arena->getUsed() : 0;
+    }
+
+  private:
+    struct Column
+    {
+        flecs::id_t id = 0;
+        ecs_type_info_t info{}; ///< By value: the snapshot may outlive the world's type info
+        uint8_t* data = nullptr;
+    };
+
+    struct Table
+    {
+        std::vector<flecs::id_t> ids; ///< Table type without name/symbol pairs
+        uint32_t rows = 0;
+        uint32_t firstColumn = 0;
+        uint32_t columnCount = 0;
+    };
+
+    struct Entity
+    {
+        flecs::entity_t id = 0;
+        uint32_t table = 0;
+        uint32_t row = 0;
+        std::string name;
+    };
+
+    ecs_query_t* createQuery(ecs_world_t* world) const;
+    void releaseValues() noexcept;
+    void reserveArena(size_t bytes);
+
+    std::vector<flecs::entity_t> m_roots;
+    std::unordered_map<flecs::entity_t, RestoreHook> m_restoreHooks;
+    EntityHook m_discardHook;
+
+    std::vector<Table> m_tables;
+    std::vector<Column> m_columns;
+    std::vector<Entity> m_entities;
+
+    std::unique_ptr<uint8_t[]> m_arenaMemory;
+    size_t m_arenaCapacity = 0;
+    std::unique_ptr<EngineCore::Foundation::LinearAllocator> m_arena;
+};
+} // namespace ECSModule
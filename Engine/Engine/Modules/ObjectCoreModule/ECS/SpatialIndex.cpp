@@ -0,0 +1,499 @@
+#include "SpatialIndex.h"
+
+#include <EngineMinimal.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ECSModule
+{
+namespace
+{
+// Cell coordinates are packed 21 bits per axis into the hash key
+constexpr int32_t kCellBias = 1 << 20;
+constexpr uint64_t kCellMask = (uint64_t(1) << 21) - 1;
+
+// Queries per job in the batched variants
+constexpr size_t kQueriesPerJob = 32;
+
+/// @p coordinate must not be NaN: clamp passes it through and the cast is then undefined.
+int32_t ToCell(float coordinate, float invCellSize) noexcept
+{
+    const float cell = std::floor(coordinate * invCellSize);
+    return static_cast<int32_t>(std::clamp(cell, static_cast<float>(-kCellBias), static_cast<float>(kCellBias - 1)));
+}
+
+bool HasNaN(const Math::AABB& box) noexcept
+{
+    return glm::any(glm::isnan(box.min)) || glm::any(glm::isnan(box.max));
+}
+
+bool IsFinite(const Math::AABB& box) noexcept
+{
+    return !HasNaN(box) && !glm::any(glm::isinf(box.min)) && !glm::any(glm::isinf(box.max));
+}
+
+template <typename Fn> void RunBatch(EngineCore::Foundation::JobSystem* jobs, size_t count, Fn& fn)
+{
+    if (jobs)
+    {
+        jobs->parallel_for(0, count, fn, kQueriesPerJob);
+        return;
+    }
+    for (size_t i = 0; i < count; ++i)
+        fn(i);
+}
+} // namespace
+
+size_t SpatialIndex::CellRange::count() const noexcept
+{
+    if (hi.x < lo.x || hi.y < lo.y || hi.z < lo.z)
+        return 0;
+    return static_cast<size_t>(hi.x - lo.x + 1) * static_cast<size_t>(hi.y - lo.y + 1) *
+           static_cast<size_t>(hi.z - lo.z + 1);
+}
+
+SpatialIndex::SpatialIndex(float cellSize) : m_cellSize(cellSize), m_invCellSize(1.0f / cellSize)
+{
+}
+
+void SpatialIndex::bind(flecs::world& world)
+{
+    m_query = world.query_builder<const WorldTransformComponent, const BoundsComponent>()
+                  .cached()
+                  .detect_changes()
+                  .build();
+    // Fires when either component goes, including on entity deletion
+    m_onRemove = world.observer<const WorldTransformComponent, const BoundsComponent>()
+                     .event(flecs::OnRemove)
+                     .each([this](flecs::entity e, const WorldTransformComponent&, const BoundsComponent&) {
+                         remove(e.id());
+                     });
+    m_bound = true;
+}
+
+void SpatialIndex::unbind()
+{
+    if (m_onRemove.is_alive())
+        m_onRemove.destruct();
+    m_onRemove = flecs::observer();
+    m_query = {};
+    m_bound = false;
+    clear();
+}
+
+size_t SpatialIndex::update()
+{
+    ZoneScopedN("SpatialIndex::update");
+    if (!m_bound || !m_query.changed())
+        return 0;
+
+    size_t written = 0;
+    m_query.run([&](flecs::iter& it) {
+        while (it.next())
+        {
+            if (!it.changed())
+                continue;
+
+            auto worlds = it.field<const WorldTransformComponent>(0);
+            auto bounds = it.field<const BoundsComponent>(1);
+            for (size_t i = 0; i < it.count(); ++i)
+            {
+                const Math::AABB local(bounds[i].min, bounds[i].max);
+                insertOrUpdate(it.entity(i).id(), local.Transformed(worlds[i].matrix));
+            }
+            written += it.count();
+        }
+    });
+
+    LT_METRIC_GAUGE_SET("spatial_index_entries", "Entities in the active spatial index", size());
+    LT_METRIC_GAUGE_SET("spatial_index_cells", "Occupied cells in the active spatial index", m_cells.size());
+    return written;
+}
+
+void SpatialIndex::insertOrUpdate(flecs::entity_t entity, const Math::AABB& worldBounds)
+{
+    if (!IsFinite(worldBounds))
+    {
+        // NaN or infinite bounds come from a broken transform or bounds component; such a box
+        // has no cells and no query could match it, so the entity leaves the index instead
+        remove(entity);
+        LT_METRIC_COUNTER_INC("spatial_index_rejected_bounds",
+                              "Entities left out of the spatial index for non-finite bounds");
+        LT_LOGSW_LIMIT("ECSModule", 1, "Spatial index: entity {} has non-finite bounds and is not indexed", entity);
+        return;
+    }
+
+    auto [it, inserted] = m_slots.try_emplace(entity, 0u);
+    if (inserted)
+    {
+        uint32_t slot;
+        if (!m_freeSlots.empty())
+        {
+            slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        else
+        {
+            slot = static_cast<uint32_t>(m_entries.size());
+            m_entries.emplace_back();
+        }
+        it->second = slot;
+
+        Entry& entry = m_entries[slot];
+        entry.entity = entity;
+        entry.bounds = worldBounds;
+        entry.cells = cellsOf(worldBounds);
+        entry.large = entry.cells.count() > kMaxCellsPerEntry;
+        link(slot);
+        return;
+    }
+
+    Entry& entry = m_entries[it->second];
+    entry.bounds = worldBounds;
+    const CellRange cells = cellsOf(worldBounds);
+    if (cells == entry.cells)
+        return; // Still in the same cells, the common case for small moves
+
+    unlink(it->second);
+    entry.cells = cells;
+    entry.large = cells.count() > kMaxCellsPerEntry;
+    link(it->second);
+}
+
+void SpatialIndex::remove(flecs::entity_t entity)
+{
+    auto it = m_slots.find(entity);
+    if (it == m_slots.end())
+        return;
+
+    unlink(it->second);
+    m_entries[it->second] = Entry{};
+    m_freeSlots.push_back(it->second);
+    m_slots.erase(it);
+}
+
+void SpatialIndex::clear()
+{
+    m_entries.clear();
+    m_freeSlots.clear();
+    m_slots.clear();
+    m_cells.clear();
+    m_large.clear();
+}
+
+const Math::AABB* SpatialIndex::bounds(flecs::entity_t entity) const
+{
+    auto it = m_slots.find(entity);
+    return it != m_slots.end() ? &m_entries[it->second].bounds : nullptr;
+}
+
+SpatialIndex::CellRange SpatialIndex::cellsOf(const Math::AABB& box) const noexcept
+{
+    CellRange range;
+    if (box.Empty() || HasNaN(box))
+        return range;
+    range.lo = {ToCell(box.min.x, m_invCellSize), ToCell(box.min.y, m_invCellSize), ToCell(box.min.z, m_invCellSize)};
+    range.hi = {ToCell(box.max.x, m_invCellSize), ToCell(box.max.y, m_invCellSize), ToCell(box.max.z, m_invCellSize)};
+    return range;
+}
+
+uint64_t SpatialIndex::CellKey(int32_t x, int32_t y, int32_t z) noexcept
+{
+    return (static_cast<uint64_t>(x + kCellBias) & kCellMask) |
+           ((static_cast<uint64_t>(y + kCellBias) & kCellMask) << 21) |
+           ((static_cast<uint64_t>(z + kCellBias) & kCellMask) << 42);
+}
+
+Math::AABB SpatialIndex::cellBox(uint64_t key) const noexcept
+{
+    const glm::vec3 cell(static_cast<float>(static_cast<int32_t>(key & kCellMask) - kCellBias),
+                         static_cast<float>(static_cast<int32_t>((key >> 21) & kCellMask) - kCellBias),
+                         static_cast<float>(static_cast<int32_t>((key >> 42) & kCellMask) - kCellBias));
+    return Math::AABB(cell * m_cellSize, (cell + 1.0f) * m_cellSize);
+}
+
+void SpatialIndex::link(uint32_t slot)
+{
+    const Entry& entry = m_entries[slot];
+    if (entry.large)
+    {
+        m_large.push_back(slot);
+        return;
+    }
+
+    const CellRange& r = entry.cells;
+    for (int32_t z = r.lo.z; z <= r.hi.z; ++z)
+        for (int32_t y = r.lo.y; y <= r.hi.y; ++y)
+            for (int32_t x = r.lo.x; x <= r.hi.x; ++x)
+                m_cells[CellKey(x, y, z)].push_back(slot);
+}
+
+void SpatialIndex::unlink(uint32_t slot)
+{
+    const auto eraseFrom = [slot](std::vector<uint32_t>& slots) {
+        auto it = std::find(slots.begin(), slots.end(), slot);
+        if (it != slots.end())
+        {
+            *it = slots.back();
+            slots.pop_back();
+        }
+    };
+
+    const Entry& entry = m_entries[slot];
+    if (entry.large)
+    {
+        eraseFrom(m_large);
+        return;
+    }
+
+    const CellRange& r = entry.cells;
+    for (int32_t z = r.lo.z; z <= r.hi.z; ++z)
+        for (int32_t y = r.lo.y; y <= r.hi.y; ++y)
+            for (int32_t x = r.lo.x; x <= r.hi.x; ++x)
+            {
+                auto it = m_cells.find(CellKey(x, y, z));
+                if (it == m_cells.end())
+                    continue;
+                eraseFrom(it->second);
+                if (it->second.empty())
+                    m_cells.erase(it);
+            }
+}
+
+template <typename Fn> void SpatialIndex::forEachCandidate(const Math::AABB& region, Fn&& fn) const
+{
+    for (uint32_t slot : m_large)
+        fn(slot);
+
+    const CellRange range = cellsOf(region);
+    const size_t cells = range.count();
+    if (cells == 0)
+        return;
+
+    // Whichever is smaller: the cells the region covers, or the cells that hold anything
+    if (cells <= m_cells.size())
+    {
+        for (int32_t z = range.lo.z; z <= range.hi.z; ++z)
+            for (int32_t y = range.lo.y; y <= range.hi.y; ++y)
+                for (int32_t x = range.lo.x; x <= range.hi.x; ++x)
+                {
+                    auto it = m_cells.find(CellKey(x, y, z));
+                    if (it == m_cells.end())
+                        continue;
+                    for (uint32_t slot : it->second)
+                        fn(slot);
+                }
+        return;
+    }
+
+    for (const auto& [key, slots] : m_cells)
+    {
+        const glm::ivec3 cell(static_cast<int32_t>(key & kCellMask) - kCellBias,
+                              static_cast<int32_t>((key >> 21) & kCellMask) - kCellBias,
+                              static_cast<int32_t>((key >> 42) & kCellMask) - kCellBias);
+        if (glm::all(glm::greaterThanEqual(cell, range.lo)) && glm::all(glm::lessThanEqual(cell, range.hi)))
+        {
+            for (uint32_t slot : slots)
+                fn(slot);
+        }
+    }
+}
+
+template <typename Fn>
+void SpatialIndex::forEachRayCandidate(const Ray& ray, const glm::vec3& invDir, const float& maxT, Fn&& fn) const
+{
+    for (uint32_t slot : m_large)
+        fn(slot);
+    if (m_cells.empty() || glm::any(glm::isnan(ray.origin)))
+        return;
+
+    // Walking a long ray through a sparse grid visits mostly empty cells; test the occupied
+    // cells directly instead when there are fewer of them.
+    const glm::vec3 span = glm::abs(ray.direction) * maxT * m_invCellSize;
+    if (static_cast<double>(span.x) + span.y + span.z > 4.0 * static_cast<double>(m_cells.size()) + 64.0)
+    {
+        for (const auto& [key, slots] : m_cells)
+        {
+            float t;
+            if (Math::RayIntersectsAABB(ray.origin, invDir, cellBox(key), maxT, t))
+            {
+                for (uint32_t slot : slots)
+                    fn(slot);
+            }
+        }
+        return;
+    }
+
+    // 3D DDA (Amanatides & Woo): visit cells in the order the ray enters them. maxT may shrink
+    // while walking, which is how raycast() stops at the first cell past its closest hit.
+    glm::ivec3 cell(ToCell(ray.origin.x, m_invCellSize), ToCell(ray.origin.y, m_invCellSize),
+                    ToCell(ray.origin.z, m_invCellSize));
+    glm::ivec3 step(0);
+    glm::vec3 tMax(std::numeric_limits<float>::infinity());
+    glm::vec3 tDelta(std::numeric_limits<float>::infinity());
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        if (ray.direction[axis] > 0.0f)
+        {
+            step[axis] = 1;
+            tMax[axis] = ((static_cast<float>(cell[axis]) + 1.0f) * m_cellSize - ray.origin[axis]) * invDir[axis];
+            tDelta[axis] = m_cellSize * invDir[axis];
+        }
+        else if (ray.direction[axis] < 0.0f)
+        {
+            step[axis] = -1;
+            tMax[axis] = (static_cast<float>(cell[axis]) * m_cellSize - ray.origin[axis]) * invDir[axis];
+            tDelta[axis] = -m_cellSize * invDir[axis];
+        }
+    }
+
+    float t = 0.0f;
+    while (t <= maxT)
+    {
+        auto it = m_cells.find(CellKey(cell.x, cell.y, cell.z));
+        if (it != m_cells.end())
+        {
+            for (uint32_t slot : it->second)
+                fn(slot);
+        }
+
+        const int axis = tMax.x < tMax.y ? (tMax.x < tMax.z ? 0 : 2) : (tMax.y < tMax.z ? 1 : 2);
+        t = tMax[axis];
+        cell[axis] += step[axis];
+        tMax[axis] += tDelta[axis];
+        if (cell[axis] < -kCellBias || cell[axis] >= kCellBias)
+            break;
+    }
+}
+
+void SpatialIndex::SortUnique(std::vector<flecs::entity_t>& out, size_t first)
+{
+    std::sort(out.begin() + first, out.end());
+    out.erase(std::unique(out.begin() + first, out.end()), out.end());
+}
+
+void SpatialIndex::queryBox(const Math::AABB& box, std::vector<flecs::entity_t>& out) const
+{
+    const size_t first = out.size();
+    forEachCandidate(box, [&](uint32_t slot) {
+        const Entry& entry = m_entries[slot];
+        if (entry.bounds.Intersects(box))
+            out.push_back(entry.entity);
+    });
+    SortUnique(out, first);
+}
+
+void SpatialIndex::querySphere(const glm::vec3& center, float radius, std::vector<flecs::entity_t>& out) const
+{
+    const size_t first = out.size();
+    forEachCandidate(Math::AABB::FromCenterExtents(center, glm::vec3(radius)), [&](uint32_t slot) {
+        const Entry& entry = m_entries[slot];
+        if (Math::SphereIntersectsAABB(center, radius, entry.bounds))
+            out.push_back(entry.entity);
+    });
+    SortUnique(out, first);
+}
+
+void SpatialIndex::queryFrustum(const Math::Frustum& frustum, std::vector<flecs::entity_t>& out) const
+{
+    const size_t first = out.size();
+    const auto test = [&](uint32_t slot) {
+        const Entry& entry = m_entries[slot];
+        if (frustum.Intersects(entry.bounds))
+            out.push_back(entry.entity);
+    };
+
+    // A frustum has no tight cell range; cull whole occupied cells first
+    for (uint32_t slot : m_large)
+        test(slot);
+    for (const auto& [key, slots] : m_cells)
+    {
+        if (!frustum.Intersects(cellBox(key)))
+            continue;
+        for (uint32_t slot : slots)
+            test(slot);
+    }
+    SortUnique(out, first);
+}
+
+bool SpatialIndex::raycast(const Ray& ray, RayHit& hit) const
+{
+    hit = RayHit{};
+    if (m_slots.empty())
+        return false;
+
+    const glm::vec3 invDir = 1.0f / ray.direction;
+    float maxT = ray.maxDistance;
+    forEachRayCandidate(ray, invDir, maxT, [&](uint32_t slot) {
+        const Entry& entry = m_entries[slot];
+        float t;
+        if (Math::RayIntersectsAABB(ray.origin, invDir, entry.bounds, maxT, t) && (hit.entity == 0 || t < hit.distance))
+        {
+            hit.entity = entry.entity;
+            hit.distance = t;
+            maxT = t;
+        }
+    });
+    return hit.entity != 0;
+}
+
+void SpatialIndex::raycastAll(const Ray& ray, std::vector<RayHit>& out) const
+{
+    if (m_slots.empty())
+        return;
+
+    const size_t first = out.size();
+    const glm::vec3 invDir = 1.0f / ray.direction;
+    const float maxT = ray.maxDistance;
+    forEachRayCandidate(ray, invDir, maxT, [&](uint32_t slot) {
+        const Entry& entry = m_entries[slot];
+        float t;
+        if (Math::RayIntersectsAABB(ray.origin, invDir, entry.bounds, maxT, t))
+            out.push_back({entry.entity, t});
+    });
+
+    // An entry is found once per cell it spans, always at the same distance
+    const auto begin = out.begin() + static_cast<std::ptrdiff_t>(first);
+    std::sort(begin, out.end(), [](const RayHit& a, const RayHit& b) {
+        return a.distance != b.distance ? a.distance < b.distance : a.entity < b.entity;
+    });
+    out.erase(std::unique(begin, out.end(),
+                          [](const RayHit& a, const RayHit& b) { return a.entity == b.entity; }),
+              out.end());
+}
+
+void SpatialIndex::queryBoxes(const std::vector<Math::AABB>& boxes, std::vector<std::vector<flecs::entity_t>>& out,
+                              EngineCore::Foundation::JobSystem* jobs) const
+{
+    ZoneScopedN("SpatialIndex::queryBoxes");
+    out.resize(boxes.size());
+    auto run = [&](size_t i) {
+        out[i].clear();
+        queryBox(boxes[i], out[i]);
+    };
+    RunBatch(jobs, boxes.size(), run);
+}
+
+void SpatialIndex::querySpheres(const std::vector<glm::vec4>& spheres, std::vector<std::vector<flecs::entity_t>>& out,
+                                EngineCore::Foundation::JobSystem* jobs) const
+{
+    ZoneScopedN("SpatialIndex::querySpheres");
+    out.resize(spheres.size());
+    auto run = [&](size_t i) {
+        out[i].clear();
+        querySphere(glm::vec3(spheres[i]), spheres[i].w, out[i]);
+    };
+    RunBatch(jobs, spheres.size(), run);
+}
+
+void SpatialIndex::raycasts(const std::vector<Ray>& rays, std::vector<RayHit>& out,
+                            EngineCore::Foundation::JobSystem* jobs) const
+{
+    ZoneScopedN("SpatialIndex::raycasts");
+    out.resize(rays.size());
+    auto run = [&](size_t i) { raycast(rays[i], out[i]); };
+    RunBatch(jobs, rays.size(), run);
+}
+} // namespace ECSModule
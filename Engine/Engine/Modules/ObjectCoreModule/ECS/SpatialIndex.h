@@ -0,0 +1,141 @@
+#pragma once
+#include "Components/ECSComponents.h"
+#include "flecs.h"
+
+#include <Foundation/Math/Bounds.h>
+
+#include <unordered_map>
+#include <vector>
+
+namespace EngineCore::Foundation
+{
+class JobSystem;
+}
+
+namespace ECSModule
+{
+/// <summary>
+/// Hashed uniform grid over the world-space boxes of entities with BoundsComponent and a
+/// transform, keyed by entity id.
+///
+/// An entry is listed in every cell its box overlaps; boxes spanning more than kMaxCellsPerEntry
+/// cells are kept in a separate list that every query scans. update() re-reads only the tables
+/// whose WorldTransformComponent or BoundsComponent changed, and moves an entry between cells
+/// only when its cell range changed. Queries are const and can run concurrently; the batched
+/// variants split their queries over JobSystem workers.
+/// </summary>
+class SpatialIndex
+{
+  public:
+    struct Ray
+    {
+        glm::vec3 origin{0.0f};
+        glm::vec3 direction{0.0f, 0.0f, -1.0f}; ///< Need not be normalized; distances are in its units
+        float maxDistance = 1000.0f;
+    };
+
+    struct RayHit
+    {
+        flecs::entity_t entity = 0; ///< 0 when nothing was hit
+        float distance = 0.0f;      ///< Where the ray enters the entity's box
+    };
+
+    static constexpr size_t kMaxCellsPerEntry = 64;
+
+    explicit SpatialIndex(float cellSize = 8.0f);
+
+    /// Builds the feeding query and the removal observer on @p world; the next update() indexes
+    /// every entity with bounds.
+    void bind(flecs::world& world);
+    /// Drops the query and observer and empties the index; must run before the world is destroyed.
+    void unbind();
+
+    /// Applies transform and bounds changes since the last call; run after the transform
+    /// hierarchy. Returns the entries written.
+    size_t update();
+
+    /// Bounds with NaN or infinite coordinates are rejected: the entity is removed from the index.
+    void insertOrUpdate(flecs::entity_t entity, const Math::AABB& worldBounds);
+    void remove(flecs::entity_t entity);
+    void clear();
+
+    size_t size() const noexcept
+    {
+        return m_slots.size();
+    }
+    float cellSize() const noexcept
+    {
+        return m_cellSize;
+    }
+    /// World-space box of @p entity, null when it is not indexed.
+    const Math::AABB* bounds(flecs::entity_t entity) const;
+
+    // Entities are appended to @p out, each once, in no particular order
+    void queryBox(const Math::AABB& box, std::vector<flecs::entity_t>& out) const;
+    void querySphere(const glm::vec3& center, float radius, std::vector<flecs::entity_t>& out) const;
+    void queryFrustum(const Math::Frustum& frustum, std::vector<flecs::entity_t>& out) const;
+
+    /// Closest box hit along @p ray.
+    bool raycast(const Ray& ray, RayHit& hit) const;
+    /// Every box hit along @p ray, nearest first.
+    void raycastAll(const Ray& ray, std::vector<RayHit>& out) const;
+
+    // Batched variants: result i belongs to query i. Run on the calling thread when @p jobs is null.
+    void queryBoxes(const std::vector<Math::AABB>& boxes, std::vector<std::vector<flecs::entity_t>>& out,
+                    EngineCore::Foundation::JobSystem* jobs = nullptr) const;
+    void querySpheres(const std::vector<glm::vec4>& spheres, std::vector<std::vector<flecs::entity_t>>& out,
+                      EngineCore::Foundation::JobSystem* jobs = nullptr) const; ///< xyz center, w radius
+    void raycasts(const std::vector<Ray>& rays, std::vector<RayHit>& out,
+                  EngineCore::Foundation::JobSystem* jobs = nullptr) const;
+
+  private:
+    struct CellRange
+    {
+        glm::ivec3 lo{0};
+        glm::ivec3 hi{-1};
+
+        bool operator==(const CellRange& other) const noexcept
+        {
+            return lo == other.lo && hi == other.hi;
+        }
+        size_t count() const noexcept;
+    };
+
+    struct Entry
+    {
+        flecs::entity_t entity = 0;
+        Math::AABB bounds;
+        CellRange cells;
+        bool large = false;
+    };
+
+    CellRange cellsOf(const Math::AABB& box) const noexcept;
+    static uint64_t CellKey(int32_t x, int32_t y, int32_t z) noexcept;
+    Math::AABB cellBox(uint64_t key) const noexcept;
+
+    void link(uint32_t slot);
+    void unlink(uint32_t slot);
+
+    /// Calls @p fn(slot) for every entry in cells overlapping @p region plus the large ones.
+    /// Slots can repeat; callers deduplicate.
+    template <typename Fn> void forEachCandidate(const Math::AABB& region, Fn&& fn) const;
+    /// Same along a ray, nearest cells first while walking the grid; stops past @p maxT, which
+    /// @p fn may lower.
+    template <typename Fn>
+    void forEachRayCandidate(const Ray& ray, const glm::vec3& invDir, const float& maxT, Fn&& fn) const;
+    static void SortUnique(std::vector<flecs::entity_t>& out, size_t first);
+
+    float m_cellSize;
+    float m_invCellSize;
+
+    std::vector<Entry> m_entries;
+    std::vector<uint32_t> m_freeSlots;
+    std::unordered_map<flecs::entity_t, uint32_t> m_slots;
+    std::unordered_map<uint64_t, std::vector<uint32_t>> m_cells;
+    std::vector<uint32_t> m_large;
+
+    flecs::query<const WorldTransformComponent, const BoundsComponent> m_query;
+    flecs::observer m_onRemove;
+    bool m_bound = false;
+};
+} // namespace ECSModule
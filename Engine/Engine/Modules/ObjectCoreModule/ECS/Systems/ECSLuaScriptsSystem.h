@@ -3,6 +3,7 @@
 #include <Modules/ResourceModule/ResourceManager.h>
 #include <Modules/ResourceModule/Script.h>
 #include <Foundation/Log/LoggerMacro.h>
+#include <Foundation/Metrics/MetricsMacros.h>
 #include <flecs.h>
 
 #include <exception>
@@ -58,7 +59,7 @@ struct ScriptComponent {
 
 		auto scriptResource = resourceManager->load<ResourceModule::RScript>(scriptID);
 		if (!scriptResource) {
-			LT_LOGW(kScriptSystemCategory.data(), std::format("Failed to load script asset [{}]", scriptID.str()));
+			LT_LOGFW(kScriptSystemCategory.data(), "Failed to load script asset [{}]", scriptID.str());
 			resetState();
 			return false;
 		}
@@ -158,6 +159,8 @@ struct ScriptComponent {
 			return;
 
 		sol::protected_function func = candidate;
+		LT_METRIC_COUNTER_INC("script_calls_total", "Lua script callbacks invoked by the ECS script system");
+		LT_METRIC_SCOPED_TIME_NS("script_lua_time_ns_total", "Time spent in Lua script callbacks, nanoseconds");
 		sol::protected_function_result result = func(std::forward<Args>(args)...);
 		if (!result.valid()) {
 			sol::error err = result;
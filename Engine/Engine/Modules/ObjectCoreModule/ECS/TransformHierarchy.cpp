@@ -0,0 +1,174 @@
+#include "TransformHierarchy.h"
+
+#include <EngineMinimal.h>
+#include <Foundation/Math/TransformBatch.h>
+
+#include <algorithm>
+#include <cstddef>
+
+namespace ECSModule
+{
+namespace
+{
+constexpr size_t kTransformFloats = sizeof(TransformComponent) / sizeof(float);
+constexpr size_t kPositionOffset = offsetof(TransformComponent, position) / sizeof(float);
+constexpr size_t kScaleOffset = offsetof(TransformComponent, scale) / sizeof(float);
+static_assert(sizeof(TransformComponent) == 13 * sizeof(float), "TransformComponent is read as packed floats");
+
+// Local matrices are composed this many at a time on the stack
+constexpr size_t kChunk = 64;
+// Entities per job when a depth level is split over workers
+constexpr size_t kEntitiesPerJob = 2048;
+} // namespace
+
+void TransformHierarchy::bind(flecs::world& world)
+{
+    // Term 1 is the parent's world matrix, optional so roots match too; cascade orders tables by
+    // ChildOf depth so parents always come before their children.
+    m_query = world.query_builder<const TransformComponent, const WorldTransformComponent, WorldTransformComponent>()
+                  .term_at(1)
+                  .parent()
+                  .cascade()
+                  .optional()
+                  .cached()
+                  .detect_changes()
+                  .build();
+    m_bound = true;
+}
+
+void TransformHierarchy::unbind()
+{
+    m_query = {};
+    m_bound = false;
+    m_batches.clear();
+    m_depths.clear();
+    m_ranges.clear();
+    m_updatedTables.clear();
+}
+
+size_t TransformHierarchy::update(EngineCore::Foundation::JobSystem* jobs)
+{
+    ZoneScopedN("TransformHierarchy::update");
+    if (!m_bound || !m_query.changed())
+        return 0;
+
+    m_batches.clear();
+    m_depths.clear();
+    m_updatedTables.clear();
+
+    size_t written = 0;
+    m_query.run([&](flecs::iter& it) {
+        const flecs::world world = it.world();
+        while (it.next())
+        {
+            const bool hasParent = it.is_set(1);
+            const ecs_table_t* parentTable = hasParent ? ecs_get_table(world, it.src(1)) : nullptr;
+            const bool dirty = it.changed() || (parentTable && m_updatedTables.count(parentTable) != 0);
+            if (!dirty)
+            {
+                // Keeps the out column clean so readers don't see this table as changed
+                it.skip();
+                continue;
+            }
+
+            const ecs_table_t* table = it.c_ptr()->table;
+            m_updatedTables.insert(table);
+
+            Batch batch;
+            batch.local = &it.field<const TransformComponent>(0)[0];
+            batch.world = &it.field<WorldTransformComponent>(2)[0];
+            batch.parent = hasParent ? &it.field<const WorldTransformComponent>(1)[0].matrix : nullptr;
+            batch.count = it.count();
+            m_batches.push_back(batch);
+            m_depths.push_back(ecs_table_get_depth(world, table, EcsChildOf));
+            written += batch.count;
+        }
+    });
+
+    // Cascade yields tables in depth order; each level only reads matrices of the levels before it
+    size_t first = 0;
+    while (first < m_batches.size())
+    {
+        size_t last = first + 1;
+        while (last < m_batches.size() && m_depths[last] == m_depths[first])
+            ++last;
+        computeLevel(first, last, jobs);
+        first = last;
+    }
+
+    LT_METRIC_GAUGE_SET("transform_hierarchy_updated", "World matrices recomputed in the last hierarchy update",
+                        written);
+    return written;
+}
+
+void TransformHierarchy::computeLevel(size_t first, size_t last, EngineCore::Foundation::JobSystem* jobs)
+{
+    size_t total = 0;
+    for (size_t i = first; i < last; ++i)
+        total += m_batches[i].count;
+
+    if (!jobs || jobs->getWorkerCount() == 0 || total < 2 * kEntitiesPerJob)
+    {
+        for (size_t i = first; i < last; ++i)
+            Compute(m_batches[i]);
+        return;
+    }
+
+    // Tables within a level are independent; large ones are split so a single wide table
+    // (e.g. thousands of roots) still spreads over the workers.
+    m_ranges.clear();
+    for (size_t i = first; i < last; ++i)
+    {
+        const Batch& batch = m_batches[i];
+        for (size_t begin = 0; begin < batch.count; begin += kEntitiesPerJob)
+        {
+            Batch range = batch;
+            range.local += begin;
+            range.world += begin;
+            range.count = std::min(kEntitiesPerJob, batch.count - begin);
+            m_ranges.push_back(range);
+        }
+    }
+
+    auto compute = [this](size_t index) { Compute(m_ranges[index]); };
+    jobs->parallel_for(0, m_ranges.size(), compute, 1);
+}
+
+void TransformHierarchy::Compute(const Batch& batch)
+{
+    float quats[kChunk * 4];
+    glm::mat4 locals[kChunk];
+
+    for (size_t begin = 0; begin < batch.count; begin += kChunk)
+    {
+        const size_t count = std::min(kChunk, batch.count - begin);
+        const TransformComponent* local = batch.local + begin;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const glm::quat q = local[i].rotation.toQuat();
+            quats[i * 4 + 0] = q.x;
+            quats[i * 4 + 1] = q.y;
+            quats[i * 4 + 2] = q.z;
+            quats[i * 4 + 3] = q.w;
+        }
+
+        const auto* floats = reinterpret_cast<const float*>(local);
+        const Math::TRSView view = Math::TRSView::Interleaved(floats + kPositionOffset, kTransformFloats, quats, 4,
+                                                              floats + kScaleOffset, kTransformFloats);
+        Math::ComposeTRS(view, 0, count, locals);
+
+        WorldTransformComponent* world = batch.world + begin;
+        if (batch.parent)
+        {
+            const glm::mat4& parent = *batch.parent;
+            for (size_t i = 0; i < count; ++i)
+                world[i].matrix = parent * locals[i];
+        }
+        else
+        {
+            for (size_t i = 0; i < count; ++i)
+                world[i].matrix = locals[i];
+        }
+    }
+}
+} // namespace ECSModule
@@ -0,0 +1,59 @@
+#pragma once
+#include "Components/ECSComponents.h"
+#include "flecs.h"
+
+#include <unordered_set>
+#include <vector>
+
+namespace EngineCore::Foundation
+{
+class JobSystem;
+}
+
+namespace ECSModule
+{
+/// <summary>
+/// Keeps WorldTransformComponent in sync with TransformComponent along flecs ChildOf chains.
+///
+/// update() walks a cached query in depth order (cascade) and only recomputes tables whose
+/// local transform was written since the last update (set() or modified()), or whose parent's
+/// table was recomputed in this pass; children of one parent share a table, so a moved parent
+/// recomputes exactly its subtree. Recomputed tables are flagged as changed, which is what
+/// change-detecting readers of WorldTransformComponent (the render frame collector) key on.
+/// Tables of the same depth are independent and are computed on JobSystem workers when the
+/// level is large enough.
+/// </summary>
+class TransformHierarchy
+{
+  public:
+    void bind(flecs::world& world);
+    /// Drops the query; must run before the world it was built on is destroyed.
+    void unbind();
+
+    /// Recomputes what changed. Runs on the calling thread when @p jobs is null. Returns the
+    /// number of world matrices written.
+    size_t update(EngineCore::Foundation::JobSystem* jobs = nullptr);
+
+  private:
+    /// One recomputed table, or part of one
+    struct Batch
+    {
+        const TransformComponent* local = nullptr;
+        WorldTransformComponent* world = nullptr;
+        const glm::mat4* parent = nullptr; ///< null for roots
+        size_t count = 0;
+    };
+
+    static void Compute(const Batch& batch);
+    void computeLevel(size_t first, size_t last, EngineCore::Foundation::JobSystem* jobs);
+
+    flecs::query<const TransformComponent, const WorldTransformComponent, WorldTransformComponent> m_query;
+    bool m_bound = false;
+
+    // Scratch, reused between updates
+    std::vector<Batch> m_batches;
+    std::vector<int32_t> m_depths;
+    std::vector<Batch> m_ranges;
+    std::unordered_set<const ecs_table_t*> m_updatedTables;
+};
+} // namespace ECSModule
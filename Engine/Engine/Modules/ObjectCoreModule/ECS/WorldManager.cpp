@@ -7,6 +7,8 @@ using EngineCore::Foundation::ResourceAllocator;
 
 #include <EngineMinimal.h>
 
+#include <algorithm>
+
 using namespace ECSModule;
 
 EntityWorld &WorldManager::createWorld(const std::string &name)
@@ -19,8 +21,11 @@ EntityWorld &WorldManager::createWorld(const std::string &name)
 
     auto world = std::make_unique<EntityWorld>(m_resources, m_scripts, m_physics);
     world->init();
+    if (m_taskThreads > 1)
+        world->setTaskThreads(m_taskThreads);
     EntityWorld &ref = *world;
     m_worlds[name] = std::move(world);
+    m_schedules[name] = {};
 
     LT_LOGI("ECSModule", "Created world: " + name);
     GCEB().emit(Events::ECS::WorldOpened{name});
@@ -35,6 +40,7 @@ void WorldManager::destroyWorld(const std::string &name)
 
     GCEB().emit(Events::ECS::WorldClosed{name});
     m_worlds.erase(it);
+    m_schedules.erase(name);
 
     if (m_activeWorld == name)
         m_activeWorld.clear();
@@ -66,7 +72,132 @@ void WorldManager::setActiveWorld(const std::string &name)
 void WorldManager::tickActive(float dt)
 {
     if (auto *active = getActiveWorld())
+    {
         active->tick(dt);
+        active->resolveMeshBounds();
+    }
+}
+
+size_t WorldManager::tickAll(float dt, double frameBudgetMs)
+{
+    ZoneScopedN("WorldManager::tickAll");
+    m_tickStart = std::chrono::steady_clock::now();
+
+    m_tickOrder.clear();
+    for (auto &[name, world] : m_worlds)
+    {
+        Schedule &schedule = m_schedules[name];
+        if (schedule.settings.paused)
+            continue;
+        const bool onJob = m_jobs && world->hasIsolatedEvents() && world->getTaskThreads() <= 1 &&
+                           !world->usesSharedModules();
+        m_tickOrder.push_back({&name, world.get(), &schedule, onJob});
+    }
+
+    // Owed worlds first, then the most expensive; names keep the order stable between runs
+    std::sort(m_tickOrder.begin(), m_tickOrder.end(), [](const TickEntry &a, const TickEntry &b) {
+        const bool aOwed = a.schedule->stats.pendingDt > 0.0f;
+        const bool bOwed = b.schedule->stats.pendingDt > 0.0f;
+        if (aOwed != bOwed)
+            return aOwed;
+        if (a.schedule->stats.averageMs != b.schedule->stats.averageMs)
+            return a.schedule->stats.averageMs > b.schedule->stats.averageMs;
+        return *a.name < *b.name;
+    });
+
+    JobHandle handle;
+    for (TickEntry &entry : m_tickOrder)
+    {
+        if (entry.onJob)
+            m_jobs->submit([this, &entry, dt, frameBudgetMs]() { tickScheduled(entry, dt, frameBudgetMs); },
+                         handle, "WorldManager.tick");
+    }
+    for (TickEntry &entry : m_tickOrder)
+    {
+        if (!entry.onJob)
+            tickScheduled(entry, dt, frameBudgetMs);
+    }
+    if (m_jobs)
+        m_jobs->wait(handle);
+    // Meshes are loaded here rather than by the observers of ticks that ran on jobs
+    for (TickEntry &entry : m_tickOrder)
+        entry.world->resolveMeshBounds();
+
+    size_t ticked = 0;
+    size_t deferred = 0;
+    for (const TickEntry &entry : m_tickOrder)
+    {
+        if (entry.schedule->stats.pendingDt > 0.0f)
+            ++deferred;
+        else
+            ++ticked;
+    }
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - m_tickStart;
+    LT_METRIC_OBSERVE("ecs_tick_all_ms", "WorldManager::tickAll duration in milliseconds", elapsed.count());
+    LT_METRIC_GAUGE_SET("ecs_worlds_ticked", "Worlds ticked by the last WorldManager::tickAll", ticked);
+    if (deferred > 0)
+        LT_METRIC_COUNTER_ADD("ecs_world_ticks_deferred_total", "World ticks pushed to the next tickAll by its frame budget",
+                              deferred);
+    return ticked;
+}
+
+void WorldManager::tickScheduled(TickEntry &entry, float dt, double frameBudgetMs)
+{
+    using clock = std::chrono::steady_clock;
+    TickStats &stats = entry.schedule->stats;
+
+    const auto start = clock::now();
+    const bool owed = stats.pendingDt > 0.0f;
+    if (frameBudgetMs > 0.0 && !owed &&
+        std::chrono::duration<double, std::milli>(start - m_tickStart).count() >= frameBudgetMs)
+    {
+        stats.pendingDt = dt;
+        ++stats.deferred;
+        return;
+    }
+
+    entry.world->tick(dt + stats.pendingDt, m_jobs);
+    stats.pendingDt = 0.0f;
+
+    const double ms = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+    stats.onJob = entry.onJob;
+    stats.lastMs = ms;
+    stats.averageMs = stats.ticks == 0 ? ms : stats.averageMs + (ms - stats.averageMs) / 16.0;
+    stats.maxMs = std::max(stats.maxMs, ms);
+    ++stats.ticks;
+
+    const double budgetMs = entry.schedule->settings.budgetMs;
+    if (budgetMs > 0.0 && ms > budgetMs)
+    {
+        ++stats.overruns;
+        LT_METRIC_COUNTER_INC("ecs_world_tick_overruns_total", "World ticks longer than their budget");
+        LT_LOGSW_LIMIT("ECSModule", 1, "World '{}' tick took {:.2f} ms, budget {:.2f} ms", *entry.name, ms, budgetMs);
+    }
+}
+
+void WorldManager::setTickSettings(const std::string &name, const TickSettings &settings)
+{
+    if (m_worlds.contains(name))
+        m_schedules[name].settings = settings;
+}
+
+const WorldManager::TickSettings *WorldManager::getTickSettings(const std::string &name) const
+{
+    auto it = m_schedules.find(name);
+    return it != m_schedules.end() ? &it->second.settings : nullptr;
+}
+
+const WorldManager::TickStats *WorldManager::getTickStats(const std::string &name) const
+{
+    auto it = m_schedules.find(name);
+    return it != m_schedules.end() ? &it->second.stats : nullptr;
+}
+
+void WorldManager::setTaskThreads(int32_t stages)
+{
+    m_taskThreads = stages;
+    for (auto &[name, world] : m_worlds)
+        world->setTaskThreads(stages);
 }
 
 void WorldManager::clear()
@@ -74,6 +205,8 @@ void WorldManager::clear()
     m_activeWorld.clear();
     
     m_worlds.clear();
+    m_schedules.clear();
+    m_tickOrder.clear();
 }
 
 std::vector<std::string, ResourceAllocator<std::string>> WorldManager::getLoadedWorlds() const
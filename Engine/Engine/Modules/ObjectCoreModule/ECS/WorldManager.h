@@ -2,9 +2,11 @@
 #include "EntityWorld.h"
 #include "Foundation/Memory/ResourceAllocator.h"
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 using EngineCore::Foundation::ResourceAllocator;
 
@@ -15,6 +17,26 @@ class WorldManager
   public:
     using WorldPtr = std::unique_ptr<EntityWorld>;
 
+    /// How tickAll() treats one world.
+    struct TickSettings
+    {
+        double budgetMs = 0.0; ///< Tick time the world should stay under; longer ticks count as overruns. 0 = none
+        bool paused = false;   ///< Not ticked by tickAll(); paused time is not made up later
+    };
+
+    /// Per-world tickAll() statistics.
+    struct TickStats
+    {
+        uint64_t ticks = 0;
+        uint64_t deferred = 0;  ///< Calls whose frame budget ran out before the world started
+        uint64_t overruns = 0;  ///< Ticks longer than TickSettings::budgetMs
+        double lastMs = 0.0;
+        double averageMs = 0.0; ///< Moving average over roughly the last 16 ticks
+        double maxMs = 0.0;
+        float pendingDt = 0.0f; ///< Time owed by deferred calls, added to the next tick
+        bool onJob = false;     ///< Whether the last tick ran as a job
+    };
+
     explicit WorldManager(ResourceModule::ResourceManager* resources, ScriptModule::LuaScriptModule* scripts,
                           PhysicsModule::PhysicsModule* physics) :
         m_resources(resources), m_scripts(scripts), m_physics(physics)
@@ -29,13 +51,59 @@ class WorldManager
     void setActiveWorld(const std::string& name);
 
     void tickActive(float dt);
+
+    /// <summary>
+    /// Ticks every unpaused world once, each independently. Worlds with isolated events
+    /// (EntityWorld::isolateEvents), no flecs task threads and no scripts or physics bodies run
+    /// as JobSystem jobs; the rest run one after another on the calling thread meanwhile.
+    ///
+    /// With @p frameBudgetMs, worlds that have not started when that much time has passed are
+    /// deferred: they tick on the next call with both calls' time. Deferred worlds start first
+    /// and are never deferred twice in a row; after them the slowest worlds go first, so the
+    /// long ticks overlap. Returns the worlds ticked.
+    /// </summary>
+    size_t tickAll(float dt, double frameBudgetMs = 0.0);
+
+    /// Jobs tickAll() runs worlds on; null, the default, ticks every world on the calling thread.
+    void setJobSystem(EngineCore::Foundation::JobSystem* jobs) noexcept
+    {
+        m_jobs = jobs;
+    }
+
+    void setTickSettings(const std::string& name, const TickSettings& settings);
+    /// Null for unknown worlds.
+    const TickSettings* getTickSettings(const std::string& name) const;
+    const TickStats* getTickStats(const std::string& name) const;
+
+    /// Applied to every world, including ones created later (see EntityWorld::setTaskThreads).
+    void setTaskThreads(int32_t stages);
     void clear();
 
     std::vector<std::string, ResourceAllocator<std::string>> getLoadedWorlds() const;
 
   private:
+    struct Schedule
+    {
+        TickSettings settings;
+        TickStats stats;
+    };
+    struct TickEntry
+    {
+        const std::string* name;
+        EntityWorld* world;
+        Schedule* schedule;
+        bool onJob;
+    };
+
+    void tickScheduled(TickEntry& entry, float dt, double frameBudgetMs);
+
     std::unordered_map<std::string, WorldPtr> m_worlds;
+    std::unordered_map<std::string, Schedule> m_schedules;
+    std::vector<TickEntry> m_tickOrder; ///< Reused by tickAll()
+    std::chrono::steady_clock::time_point m_tickStart;
+    EngineCore::Foundation::JobSystem* m_jobs = nullptr;
     std::string m_activeWorld;
+    int32_t m_taskThreads = 0;
 
     ResourceModule::ResourceManager* m_resources;
     ScriptModule::LuaScriptModule* m_scripts;
@@ -0,0 +1,408 @@
+#include "WorldStreamer.h"
+#include "EntityWorld.h"
+#include "Events.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <limits>
+
+namespace ECSModule
+{
+using Clock = std::chrono::steady_clock;
+
+WorldStreamer::WorldStreamer(EntityWorld& world, EngineCore::Foundation::JobSystem* jobs) : m_world(world), m_jobs(jobs)
+{
+    configure(m_config);
+}
+
+WorldStreamer::~WorldStreamer()
+{
+    close();
+}
+
+bool WorldStreamer::open(const std::filesystem::path& manifest)
+{
+    ZoneScopedN("WorldStreamer::open");
+    close();
+    if (!m_partition.load(manifest))
+        return false;
+
+    const WorldPartition::Cell& persistent = m_partition.getPersistent();
+    if (!persistent.file.empty())
+    {
+        std::ifstream in(m_partition.resolve(persistent.file), std::ios::binary);
+        WorldBinaryReader reader(m_world.get());
+        if (!in.is_open() || !reader.begin(in))
+        {
+            LT_LOGE("ECSModule", "World streaming: cannot load persistent entities " + persistent.file);
+            return false;
+        }
+        while (!reader.finished())
+        {
+            if (!reader.readChunk())
+            {
+                destroy(m_persistent);
+                return false;
+            }
+            m_persistent.insert(m_persistent.end(), reader.chunkEntities().begin(), reader.chunkEntities().end());
+        }
+    }
+
+    m_slots = std::vector<Slot>(m_partition.getCells().size());
+    m_open = true;
+    LT_LOGFI("ECSModule", "World streaming: opened {} with {} cells", manifest.string(), m_slots.size());
+    return true;
+}
+
+void WorldStreamer::close()
+{
+    ZoneScopedN("WorldStreamer::close");
+    for (Slot& slot : m_slots)
+        slot.handle.wait();
+    for (size_t i = 0; i < m_slots.size(); ++i)
+    {
+        if (m_slots[i].state != CellState::Unloaded)
+            unload(i);
+    }
+    destroy(m_persistent);
+    m_slots.clear();
+    m_stats.loadedCells = 0;
+    m_stats.pendingCells = 0;
+    m_stats.residentBytes = 0;
+    m_open = false;
+}
+
+void WorldStreamer::configure(const WorldStreamingConfig& config)
+{
+    m_config = config;
+    m_config.loadRadius = std::max(config.loadRadius, 0.0f);
+    m_config.unloadRadius = std::max(config.unloadRadius, m_config.loadRadius);
+    m_config.instantiateBudgetMs = std::max(config.instantiateBudgetMs, 0.0);
+    m_config.maxConcurrentReads = std::max<uint32_t>(config.maxConcurrentReads, 1);
+}
+
+WorldStreamer::FocusId WorldStreamer::addFocus(const Math::Vec3& position)
+{
+    const FocusId id = m_nextFocus++;
+    m_foci.emplace_back(id, position);
+    return id;
+}
+
+void WorldStreamer::setFocus(FocusId id, const Math::Vec3& position)
+{
+    for (auto& [focus, at] : m_foci)
+    {
+        if (focus == id)
+            at = position;
+    }
+}
+
+void WorldStreamer::removeFocus(FocusId id)
+{
+    std::erase_if(m_foci, [id](const auto& focus) { return focus.first == id; });
+}
+
+WorldStreamer::CellState WorldStreamer::getCellState(const WorldCellKey& key) const
+{
+    const WorldPartition::Cell* cell = m_partition.findCell(key);
+    if (!cell || m_slots.empty())
+        return CellState::Unloaded;
+    return m_slots[static_cast<size_t>(cell - m_partition.getCells().data())].state;
+}
+
+void WorldStreamer::update()
+{
+    ZoneScopedN("WorldStreamer::update");
+    if (!m_open)
+        return;
+
+    const auto& cells = m_partition.getCells();
+    for (size_t i = 0; i < m_slots.size(); ++i)
+    {
+        float nearest = std::numeric_limits<float>::max();
+        for (const auto& [id, position] : m_foci)
+            nearest = std::min(nearest, m_partition.distanceTo(cells[i].key, position));
+        m_slots[i].distance = nearest;
+    }
+
+    // Out of range: unload, or let the read finish and drop it
+    for (size_t i = 0; i < m_slots.size(); ++i)
+    {
+        Slot& slot = m_slots[i];
+        const bool outOfRange = slot.distance > m_config.unloadRadius;
+        if (slot.state == CellState::Reading)
+            slot.cancelled = outOfRange;
+        else if (slot.state != CellState::Unloaded && outOfRange)
+            unload(i);
+    }
+
+    for (size_t i = 0; i < m_slots.size(); ++i)
+    {
+        if (m_slots[i].state == CellState::Reading && m_slots[i].handle.isDone())
+            finishRead(i);
+    }
+
+    // Nearest wanted cells first, as far as reads and the budget allow
+    m_order.clear();
+    uint32_t reading = 0;
+    for (size_t i = 0; i < m_slots.size(); ++i)
+    {
+        if (m_slots[i].state == CellState::Reading)
+            ++reading;
+        else if (m_slots[i].state == CellState::Unloaded && m_slots[i].distance <= m_config.loadRadius)
+            m_order.push_back(i);
+    }
+    std::sort(m_order.begin(), m_order.end(),
+              [this](size_t a, size_t b) { return m_slots[a].distance < m_slots[b].distance; });
+    for (size_t index : m_order)
+    {
+        if (reading >= m_config.maxConcurrentReads)
+            break;
+        if (!makeRoom(cells[index].bytes))
+        {
+            LT_LOGSW_LIMIT("ECSModule", 1, "World streaming: memory budget of {} bytes is full; cell {} waits",
+                           m_config.memoryBudgetBytes, cells[index].file);
+            break;
+        }
+        startRead(index);
+        // Reads without a job system are done already
+        if (m_slots[index].state == CellState::Reading)
+            ++reading;
+    }
+
+    instantiate();
+
+    m_stats.loadedCells = 0;
+    m_stats.pendingCells = 0;
+    for (const Slot& slot : m_slots)
+    {
+        if (slot.state == CellState::Loaded)
+            ++m_stats.loadedCells;
+        else if (slot.state != CellState::Unloaded && slot.state != CellState::Failed)
+            ++m_stats.pendingCells;
+    }
+    LT_METRIC_GAUGE_SET("world_stream_cells_loaded", "World partition cells loaded", m_stats.loadedCells);
+    LT_METRIC_GAUGE_SET("world_stream_cells_pending", "World partition cells being read or instantiated",
+                        m_stats.pendingCells);
+    LT_METRIC_GAUGE_SET("world_stream_resident_bytes", "Cell bytes held against the streaming budget",
+                        m_stats.residentBytes);
+}
+
+void WorldStreamer::startRead(size_t index)
+{
+    Slot& slot = m_slots[index];
+    const WorldPartition::Cell& cell = m_partition.getCells()[index];
+    slot.state = CellState::Reading;
+    slot.cancelled = false;
+    slot.charged = cell.bytes;
+    m_stats.residentBytes += slot.charged;
+
+    auto read = std::make_shared<PendingRead>();
+    slot.read = read;
+    auto job = [read, path = m_partition.resolve(cell.file)]() {
+        ZoneScopedN("WorldStreamer::read");
+        std::ifstream in(path, std::ios::binary);
+        if (!in.is_open())
+        {
+            read->error = "cannot open " + path.string();
+            return;
+        }
+        read->data.str(std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()));
+        read->ok = WorldBinaryReader::Scan(read->data, read->index, &read->error);
+        read->data.clear();
+        read->data.seekg(0);
+    };
+
+    if (m_jobs)
+        m_jobs->submit(std::move(job), slot.handle, "WorldStreamer::read");
+    else
+        job();
+    if (slot.handle.isDone())
+        finishRead(index);
+}
+
+void WorldStreamer::finishRead(size_t index)
+{
+    Slot& slot = m_slots[index];
+    const WorldPartition::Cell& cell = m_partition.getCells()[index];
+    if (slot.cancelled)
+    {
+        release(slot);
+        return;
+    }
+    if (!slot.read->ok)
+    {
+        LT_LOGE("ECSModule", "World streaming: cell " + cell.file + " failed: " + slot.read->error);
+        ++m_stats.failures;
+        m_stats.residentBytes -= slot.charged;
+        slot.charged = 0;
+        slot.read.reset();
+        slot.state = CellState::Failed;
+        return;
+    }
+
+    // The manifest may be stale; budget what was actually read
+    const auto actual = static_cast<uint64_t>(slot.read->data.view().size());
+    m_stats.residentBytes += actual - slot.charged;
+    slot.charged = actual;
+    slot.entities.reserve(slot.read->index.entities);
+    slot.state = CellState::Staged;
+}
+
+bool WorldStreamer::makeRoom(uint64_t bytes)
+{
+    while (m_stats.residentBytes + bytes > m_config.memoryBudgetBytes)
+    {
+        // Only cells kept by hysteresis may go; a focus still needs everything within loadRadius
+        size_t victim = m_slots.size();
+        for (size_t i = 0; i < m_slots.size(); ++i)
+        {
+            const Slot& slot = m_slots[i];
+            const bool evictable = slot.state == CellState::Loaded || slot.state == CellState::Staged;
+            if (evictable && slot.distance > m_config.loadRadius &&
+                (victim == m_slots.size() || slot.distance > m_slots[victim].distance))
+                victim = i;
+        }
+        if (victim == m_slots.size())
+            return false;
+        unload(victim);
+        ++m_stats.cellsEvicted;
+    }
+    return true;
+}
+
+void WorldStreamer::unload(size_t index)
+{
+    ZoneScopedN("WorldStreamer::unload");
+    Slot& slot = m_slots[index];
+    const bool wasLoaded = slot.state == CellState::Loaded || slot.state == CellState::Instantiating;
+    destroy(slot.entities);
+    release(slot);
+    if (wasLoaded)
+        ++m_stats.cellsUnloaded;
+}
+
+void WorldStreamer::release(Slot& slot)
+{
+    m_stats.residentBytes -= slot.charged;
+    slot.charged = 0;
+    slot.cancelled = false;
+    slot.chunksRead = 0;
+    slot.reader.reset();
+    slot.read.reset();
+    slot.entities.clear();
+    slot.entities.shrink_to_fit();
+    slot.state = CellState::Unloaded;
+}
+
+void WorldStreamer::destroy(std::vector<flecs::entity_t>& entities)
+{
+    if (entities.empty())
+        return;
+
+    flecs::world& world = m_world.get();
+    Events::ECS::EntitiesDestroyed event;
+    event.ids.reserve(entities.size());
+    // Gameplay may have deleted some already
+    world.defer_begin();
+    for (flecs::entity_t id : entities)
+    {
+        if (world.is_alive(id))
+        {
+            world.entity(id).destruct();
+            event.ids.push_back(id);
+        }
+    }
+    world.defer_end();
+    entities.clear();
+    m_world.events().emit(event);
+}
+
+void WorldStreamer::instantiate()
+{
+    ZoneScopedN("WorldStreamer::instantiate");
+    m_stats.entitiesCreated = 0;
+
+    m_order.clear();
+    for (size_t i = 0; i < m_slots.size(); ++i)
+    {
+        const CellState state = m_slots[i].state;
+        if (state == CellState::Staged || state == CellState::Instantiating)
+            m_order.push_back(i);
+    }
+    if (m_order.empty())
+        return;
+    std::sort(m_order.begin(), m_order.end(),
+              [this](size_t a, size_t b) { return m_slots[a].distance < m_slots[b].distance; });
+
+    const auto start = Clock::now();
+    const auto budget = std::chrono::duration<double, std::milli>(m_config.instantiateBudgetMs);
+    bool first = true;
+    Events::ECS::EntitiesSpawned spawned{0, {}};
+
+    for (size_t index : m_order)
+    {
+        Slot& slot = m_slots[index];
+        const WorldPartition::Cell& cell = m_partition.getCells()[index];
+        if (slot.state == CellState::Staged)
+        {
+            slot.reader = std::make_unique<WorldBinaryReader>(m_world.get());
+            if (!slot.reader->begin(slot.read->data))
+            {
+                ++m_stats.failures;
+                unload(index);
+                slot.state = CellState::Failed;
+                continue;
+            }
+            slot.state = CellState::Instantiating;
+        }
+
+        // This update's ids of the cell, dropped again if the cell fails and unload() destroys them
+        const size_t spawnedBefore = spawned.ids.size();
+        while (!slot.reader->finished())
+        {
+            // The footer is read right after the last chunk, outside the budget
+            const bool footer = slot.chunksRead == slot.read->index.chunkEntities.size();
+            if (!footer)
+            {
+                // At least one chunk per update, so a tight budget still makes progress
+                if (!first && Clock::now() - start >= budget)
+                    break;
+                first = false;
+                ++slot.chunksRead;
+            }
+
+            if (!slot.reader->readChunk())
+            {
+                LT_LOGE("ECSModule", "World streaming: cell " + cell.file + " failed: " + slot.reader->error());
+                ++m_stats.failures;
+                unload(index);
+                slot.state = CellState::Failed;
+                spawned.ids.resize(spawnedBefore);
+                break;
+            }
+            const auto& created = slot.reader->chunkEntities();
+            slot.entities.insert(slot.entities.end(), created.begin(), created.end());
+            spawned.ids.insert(spawned.ids.end(), created.begin(), created.end());
+        }
+
+        if (slot.state == CellState::Instantiating && slot.reader->finished())
+        {
+            slot.reader.reset();
+            slot.read.reset();
+            slot.state = CellState::Loaded;
+            ++m_stats.cellsLoaded;
+        }
+        if (slot.state == CellState::Instantiating)
+            break; // Out of time
+    }
+
+    m_stats.entitiesCreated = static_cast<uint32_t>(spawned.ids.size());
+    LT_METRIC_OBSERVE("world_stream_instantiate_ms", "Main-thread time spent creating streamed entities per update",
+                      std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+    if (!spawned.ids.empty())
+        m_world.events().emit(spawned);
+}
+} // namespace ECSModule
@@ -0,0 +1,157 @@
+#pragma once
+#include "Serialization/WorldBinarySerializer.h"
+#include "Serialization/WorldPartition.h"
+
+#include <EngineMinimal.h>
+
+#include <filesystem>
+#include <memory>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+class EntityWorld;
+
+namespace ECSModule
+{
+struct WorldStreamingConfig
+{
+    float loadRadius = 256.0f;   ///< Cells this close to a focus point are loaded
+    float unloadRadius = 384.0f; ///< Loaded cells farther than this from every focus are unloaded; at least loadRadius
+    uint64_t memoryBudgetBytes = 256ull << 20; ///< Cell bytes read or loaded at once
+    double instantiateBudgetMs = 2.0; ///< Main-thread time per update() for creating entities; one chunk always runs
+    uint32_t maxConcurrentReads = 4;
+};
+
+/// <summary>
+/// Streams the cells of a WorldPartition in and out of an EntityWorld around focus points
+/// (cameras, players).
+///
+/// Reading a cell file and checking its framing run as a job; update() then instantiates staged
+/// cells a chunk at a time on the main thread, nearest first, until instantiateBudgetMs is used.
+/// A cell within loadRadius of any focus is loaded and stays until it is beyond unloadRadius of
+/// all of them, so a focus moving along a cell border does not make it flicker. The memory budget
+/// is counted in cell file bytes, held from the start of the read until the cell is unloaded;
+/// when a wanted cell does not fit, loaded cells outside loadRadius are evicted farthest first.
+///
+/// Unloading deletes the cell's entities: changes made to them are lost, and a cell that comes
+/// back gets new entity ids.
+/// </summary>
+class WorldStreamer
+{
+  public:
+    enum class CellState : uint8_t
+    {
+        Unloaded,
+        Reading,       ///< File read in flight on a job
+        Staged,        ///< Read and checked, waiting for update() to instantiate it
+        Instantiating, ///< Some chunks created
+        Loaded,
+        Failed, ///< Not retried until the cell has been out of range
+    };
+
+    using FocusId = uint32_t;
+
+    struct Stats
+    {
+        uint32_t loadedCells = 0;
+        uint32_t pendingCells = 0; ///< Reading, staged or instantiating
+        uint64_t residentBytes = 0;
+        uint64_t cellsLoaded = 0;
+        uint64_t cellsUnloaded = 0;
+        uint64_t cellsEvicted = 0; ///< Unloaded early for the memory budget
+        uint64_t failures = 0;
+        uint32_t entitiesCreated = 0; ///< By the last update()
+    };
+
+    /// @p jobs reads the cell files; null reads them inside update().
+    WorldStreamer(EntityWorld& world, EngineCore::Foundation::JobSystem* jobs);
+    ~WorldStreamer();
+
+    WorldStreamer(const WorldStreamer&) = delete;
+    WorldStreamer& operator=(const WorldStreamer&) = delete;
+
+    /// <summary>
+    /// Loads the manifest and the partition's persistent entities; cells follow in update().
+    /// Closes what was open before.
+    /// </summary>
+    bool open(const std::filesystem::path& manifest);
+    /// <summary>
+    /// Waits for reads in flight and deletes every entity the streamer created.
+    /// </summary>
+    void close();
+    bool isOpen() const noexcept
+    {
+        return m_open;
+    }
+
+    void configure(const WorldStreamingConfig& config);
+    const WorldStreamingConfig& getConfig() const noexcept
+    {
+        return m_config;
+    }
+
+    FocusId addFocus(const Math::Vec3& position);
+    void setFocus(FocusId id, const Math::Vec3& position);
+    void removeFocus(FocusId id);
+
+    /// <summary>
+    /// Unloads, finishes reads, starts new ones and instantiates within the time budget.
+    /// Main thread, once per frame, outside the world's tick.
+    /// </summary>
+    void update();
+
+    CellState getCellState(const WorldCellKey& key) const;
+    const Stats& getStats() const noexcept
+    {
+        return m_stats;
+    }
+    const WorldPartition& getPartition() const noexcept
+    {
+        return m_partition;
+    }
+
+  private:
+    /// Written by the read job, read by update() once the job handle is done
+    struct PendingRead
+    {
+        std::istringstream data;
+        WorldBinaryIndex index;
+        std::string error;
+        bool ok = false;
+    };
+
+    struct Slot
+    {
+        CellState state = CellState::Unloaded;
+        float distance = 0.0f;
+        bool cancelled = false; ///< Went out of range while reading
+        uint64_t charged = 0;   ///< Bytes counted against the budget
+        size_t chunksRead = 0;
+        std::shared_ptr<PendingRead> read;
+        EngineCore::Foundation::JobHandle handle;
+        std::unique_ptr<WorldBinaryReader> reader;
+        std::vector<flecs::entity_t> entities;
+    };
+
+    void startRead(size_t index);
+    void finishRead(size_t index);
+    bool makeRoom(uint64_t bytes);
+    void unload(size_t index);
+    void release(Slot& slot);
+    void destroy(std::vector<flecs::entity_t>& entities);
+    void instantiate();
+
+    EntityWorld& m_world;
+    EngineCore::Foundation::JobSystem* m_jobs;
+    WorldStreamingConfig m_config;
+    WorldPartition m_partition;
+    std::vector<Slot> m_slots; ///< One per partition cell, same order
+    std::vector<flecs::entity_t> m_persistent;
+    std::vector<std::pair<FocusId, Math::Vec3>> m_foci;
+    FocusId m_nextFocus = 1;
+    std::vector<size_t> m_order; ///< Scratch for nearest-first passes
+    Stats m_stats;
+    bool m_open = false;
+};
+} // namespace ECSModule
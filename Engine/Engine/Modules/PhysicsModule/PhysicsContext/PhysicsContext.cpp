@@ -3,6 +3,7 @@
 #include "DebugDrawer.h"
 #include "ContactCallback.h"
 #include "../../../Foundation/Event/EventBus.h"
+#include "../../../Foundation/Metrics/MetricsMacros.h"
 #include "../../../Modules/RenderModule/RenderContext.h"
 #include "../Utils/PhysicsConverters.h"
 #include "../Factory/PhysicsFactory.h"
@@ -32,6 +33,7 @@ namespace PhysicsModule
         const int maxSubSteps = 10;
         const float fixedTimeStep = 1.0f / 60.0f;
         m_world->world->stepSimulation(dt, maxSubSteps, fixedTimeStep);
+        LT_METRIC_GAUGE_SET("physics_bodies", "Rigid bodies owned by the PhysicsContext", m_entityBodies.size());
 
         // Don't call debugDrawWorld here - call it in render phase via debugDraw()
         dispatchCollisionEvents();
@@ -252,6 +254,42 @@ namespace PhysicsModule
         return true;
     }
 
+    bool PhysicsContext::resetBodyState(flecs::entity entity, const glm::vec3& position, const glm::quat& rotation)
+    {
+        btRigidBody* body = getBodyForEntity(entity);
+        if (!body)
+            return false;
+
+        const btTransform transform = ToBullet(position, rotation);
+        body->setWorldTransform(transform);
+        body->setInterpolationWorldTransform(transform);
+        if (body->getMotionState())
+        {
+            body->getMotionState()->setWorldTransform(transform);
+        }
+
+        const btVector3 zero(0, 0, 0);
+        body->setLinearVelocity(zero);
+        body->setAngularVelocity(zero);
+        body->setInterpolationLinearVelocity(zero);
+        body->setInterpolationAngularVelocity(zero);
+        body->clearForces();
+
+        // Contacts cached at the old position would push the body on the next step
+        if (body->getBroadphaseHandle())
+        {
+            m_world->world->getBroadphase()->getOverlappingPairCache()->cleanProxyFromPairs(
+                body->getBroadphaseHandle(), m_world->world->getDispatcher());
+        }
+        m_world->world->updateSingleAabb(body);
+
+        if (!body->isStaticObject())
+        {
+            body->activate(true);
+        }
+        return true;
+    }
+
     btRigidBody* PhysicsContext::getBodyForEntity(flecs::entity entity) const
     {
         flecs::entity_t entityId = entity.id();
@@ -51,6 +51,8 @@ namespace PhysicsModule
         bool destroyBodyForEntity(flecs::entity entity);
         bool updateBodyTransform(flecs::entity entity, const glm::vec3& position, const glm::quat& rotation);
         bool getBodyTransform(flecs::entity entity, glm::vec3& position, glm::quat& rotation) const;
+        // Teleports the body and drops its velocities, forces and contacts, keeping the Bullet objects
+        bool resetBodyState(flecs::entity entity, const glm::vec3& position, const glm::quat& rotation);
 
         // World access
         btDiscreteDynamicsWorld& world() noexcept;
@@ -0,0 +1,101 @@
+#include "PhysicsSnapshotSync.h"
+#include "../PhysicsLocator.h"
+#include "../PhysicsContext/PhysicsContext.h"
+#include "../Components/RigidBodyComponent.h"
+#include "../Components/ColliderComponent.h"
+#include "../../ObjectCoreModule/ECS/Components/ECSComponents.h"
+#include "../../ObjectCoreModule/ECS/Serialization/WorldSnapshot.h"
+#include "../Utils/PhysicsTypes.h"
+
+namespace PhysicsModule
+{
+    namespace
+    {
+        bool HasBody(const RigidBodyComponent& rb)
+        {
+            return !rb.needsCreation && rb.bodyHandle != InvalidBodyHandle;
+        }
+
+        bool SameShape(const ColliderComponent& a, const ColliderComponent& b)
+        {
+            return a.shapeDesc.type == b.shapeDesc.type && a.shapeDesc.size == b.shapeDesc.size &&
+                   a.shapeDesc.radius == b.shapeDesc.radius && a.shapeDesc.height == b.shapeDesc.height &&
+                   a.isTrigger == b.isTrigger;
+        }
+
+        void DropBody(flecs::entity e, RigidBodyComponent& rb)
+        {
+            if (auto* ctx = PhysicsLocator::TryGet())
+                ctx->destroyBodyForEntity(e);
+            rb.bodyHandle = InvalidBodyHandle;
+            rb.needsCreation = true;
+        }
+    }
+
+    void PhysicsSnapshotSync::Install(flecs::world& world, ECSModule::WorldSnapshot& snapshot)
+    {
+        // The body survives unless the properties it was built from changed during simulation
+        snapshot.setRestoreHook(world.id<RigidBodyComponent>(), [](flecs::entity e, const void* saved, void* live)
+        {
+            auto& rb = *static_cast<RigidBodyComponent*>(live);
+            const auto& before = *static_cast<const RigidBodyComponent*>(saved);
+
+            const bool keep = HasBody(rb) && rb.mass == before.mass && rb.isStatic == before.isStatic &&
+                              rb.isKinematic == before.isKinematic;
+            const PhysicsBodyHandle body = rb.bodyHandle;
+            rb = before;
+            if (keep)
+            {
+                rb.bodyHandle = body;
+                rb.needsCreation = false;
+            }
+            else
+            {
+                // Also covers entities recreated by the restore whose old body is still registered
+                DropBody(e, rb);
+            }
+        });
+
+        snapshot.setRestoreHook(world.id<ColliderComponent>(), [](flecs::entity e, const void* saved, void* live)
+        {
+            auto& collider = *static_cast<ColliderComponent*>(live);
+            const auto& before = *static_cast<const ColliderComponent*>(saved);
+
+            const bool rebuild = !SameShape(collider, before);
+            const PhysicsShapeHandle shape = collider.shapeHandle;
+            const bool needsCreation = collider.needsCreation;
+            collider = before;
+            collider.shapeHandle = shape;
+            collider.needsCreation = needsCreation || rebuild;
+
+            if (rebuild)
+            {
+                if (auto* rb = e.get_mut<RigidBodyComponent>(); rb && HasBody(*rb))
+                    DropBody(e, *rb);
+                collider.needsCreation = true;
+            }
+        });
+
+        snapshot.setDiscardHook([](flecs::entity e)
+        {
+            if (e.has<RigidBodyComponent>())
+            {
+                if (auto* ctx = PhysicsLocator::TryGet())
+                    ctx->destroyBodyForEntity(e);
+            }
+        });
+    }
+
+    void PhysicsSnapshotSync::ResetBodies(flecs::world& world)
+    {
+        auto* ctx = PhysicsLocator::TryGet();
+        if (!ctx)
+            return;
+
+        world.each([ctx](flecs::entity e, const TransformComponent& transform, const RigidBodyComponent& rb)
+        {
+            if (HasBody(rb))
+                ctx->resetBodyState(e, transform.position.toGLMVec(), transform.rotation.toQuat());
+        });
+    }
+}
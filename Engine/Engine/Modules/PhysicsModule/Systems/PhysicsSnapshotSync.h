@@ -0,0 +1,23 @@
+#pragma once
+
+#include <flecs.h>
+
+namespace ECSModule
+{
+    class WorldSnapshot;
+}
+
+namespace PhysicsModule
+{
+    // Keeps Bullet bodies alive across an editor simulate start/stop snapshot restore
+    class PhysicsSnapshotSync
+    {
+    public:
+        // Restore hooks for RigidBodyComponent/ColliderComponent and a discard hook that frees
+        // the bodies of entities spawned during simulation
+        static void Install(flecs::world& world, ECSModule::WorldSnapshot& snapshot);
+
+        // After restore: moves every kept body back to its entity's restored transform, at rest
+        static void ResetBodies(flecs::world& world);
+    };
+}
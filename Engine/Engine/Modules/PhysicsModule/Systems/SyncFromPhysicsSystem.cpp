@@ -8,9 +8,11 @@ namespace PhysicsModule
 {
     void SyncFromPhysicsSystem::Register(flecs::world& world)
     {
-        // Run in OnUpdate phase
+        // Run in OnUpdate phase. Only reads Bullet motion states and writes the entity's own
+        // transform, so the entities can be split across flecs stages.
         world.system<TransformComponent, RigidBodyComponent>()
             .kind(flecs::OnUpdate)
+            .multi_threaded()
             .each([](flecs::entity e, TransformComponent& transform, 
                      RigidBodyComponent& rb)
             {
@@ -25,6 +27,13 @@ namespace PhysicsModule
                     glm::quat rotation;
                     if (ctx->getBodyTransform(e, position, rotation))
                     {
+                        // Bullet reports world space; a child stores its pose relative to the parent
+                        const flecs::entity parent = e.parent();
+                        if (parent.is_valid())
+                        {
+                            if (const auto* parentWorld = parent.get<WorldTransformComponent>())
+                                parentWorld->toLocal(position, rotation);
+                        }
                         transform.position.fromGLMVec(position);
                         transform.rotation.fromQuat(rotation);
                         e.modified<TransformComponent>();
@@ -10,10 +10,11 @@ namespace PhysicsModule
 {
     void SyncToPhysicsSystem::Register(flecs::world& world)
     {
-        // Run in OnUpdate phase
-        world.system<TransformComponent, RigidBodyComponent, ColliderComponent>()
+        // Run in OnUpdate phase. Stays on the main thread: creating bodies mutates the Bullet world.
+        // Transform is read-only here so the system does not flag every physics table as changed.
+        world.system<const TransformComponent, RigidBodyComponent, ColliderComponent>()
             .kind(flecs::OnUpdate)
-            .each([](flecs::entity e, TransformComponent& transform, 
+            .each([](flecs::entity e, const TransformComponent& transform, 
                      RigidBodyComponent& rb, ColliderComponent& collider)
             {
                 auto* ctx = PhysicsLocator::TryGet();
@@ -27,8 +28,8 @@ namespace PhysicsModule
                     desc.mass = rb.mass;
                     desc.bodyType = rb.isStatic ? RigidBodyType::Static : 
                                    (rb.isKinematic ? RigidBodyType::Kinematic : RigidBodyType::Dynamic);
-                    desc.position = transform.position.toGLMVec();
-                    desc.rotation = transform.rotation.toQuat();
+                    // Bodies live in world space; children use their parent's cached world matrix
+                    GetWorldPose(e, transform, desc.position, desc.rotation);
                     desc.shape = collider.shapeDesc;
                     
                     // Ensure shape has valid default values if not set
@@ -48,8 +49,9 @@ namespace PhysicsModule
                 else if (rb.isKinematic)
                 {
                     // Update transform for kinematic bodies
-                    glm::vec3 position = transform.position.toGLMVec();
-                    glm::quat rotation = transform.rotation.toQuat();
+                    glm::vec3 position;
+                    glm::quat rotation;
+                    GetWorldPose(e, transform, position, rotation);
                     ctx->updateBodyTransform(e, position, rotation);
                 }
             });
@@ -24,6 +24,12 @@
 
 namespace RenderModule
 {
+namespace
+{
+// Per-entity change logs are rate limited per call site; bulk spawns would otherwise flood the log.
+constexpr uint32_t kEntityLogsPerSecond = 10;
+} // namespace
+
 IRenderer::IRenderer()
     : m_ecsModule(GCM(ECSModule::ECSModule)), m_listManager(m_entityTracker),
       m_transformUpdater(m_entityTracker, m_listManager)
@@ -121,8 +127,12 @@ void IRenderer::setupEventSubscriptions()
 
     m_eventBinder.bind<EntityCreated>([this](const EntityCreated &event) { onEntityCreated(event); });
 
+    m_eventBinder.bind<EntitiesSpawned>([this](const EntitiesSpawned &event) { onEntitiesSpawned(event); });
+
     m_eventBinder.bind<EntityDestroyed>([this](const EntityDestroyed &event) { onEntityDestroyed(event); });
 
+    m_eventBinder.bind<EntitiesDestroyed>([this](const EntitiesDestroyed &event) { onEntitiesDestroyed(event); });
+
     m_eventBinder.bind<ComponentChanged>([this](const ComponentChanged &event) { onComponentChanged(event); });
 
     m_eventBinder.bind<RenderFrameData>([this](const RenderFrameData &event) { onRenderFrameData(event); });
@@ -167,6 +177,12 @@ void IRenderer::onEntityCreated(const Events::ECS::EntityCreated &event)
     LT_LOGI("Renderer", "Entity created: " + event.name + " (id: " + std::to_string(event.id) + ")");
 }
 
+void IRenderer::onEntitiesSpawned(const Events::ECS::EntitiesSpawned &event)
+{
+    // The render observers already queued the renderable ones; this only replaces N created logs
+    LT_LOGFI("Renderer", "Spawned {} entities from prefab {}", event.ids.size(), event.prefab);
+}
+
 void IRenderer::onEntityDestroyed(const Events::ECS::EntityDestroyed &event)
 {
     m_listManager.removeObject(event.id);
@@ -175,6 +191,17 @@ void IRenderer::onEntityDestroyed(const Events::ECS::EntityDestroyed &event)
     LT_LOGI("Renderer", "Entity destroyed (id: " + std::to_string(event.id) + ") - removed from render list");
 }
 
+void IRenderer::onEntitiesDestroyed(const Events::ECS::EntitiesDestroyed &event)
+{
+    for (uint64_t id : event.ids)
+    {
+        m_listManager.removeObject(id);
+        m_entityTracker.removeState(id);
+    }
+
+    LT_LOGFI("Renderer", "Destroyed {} entities - removed from render list", event.ids.size());
+}
+
 void IRenderer::onComponentChanged(const Events::ECS::ComponentChanged &event)
 {
     if (event.componentName == "MeshComponent")
@@ -195,9 +222,8 @@ void IRenderer::onComponentChanged(const Events::ECS::ComponentChanged &event)
         bool hasTransform = entity.has<TransformComponent>();
         bool hasMesh = entity.has<MeshComponent>();
 
-        LT_LOGI("Renderer", "ComponentChanged: MeshComponent for entity " + std::to_string(event.entityId) +
-                                " - transform:" + std::to_string(hasTransform) +
-                                " mesh:" + std::to_string(hasMesh));
+        LT_LOGSI_LIMIT("Renderer", kEntityLogsPerSecond, "ComponentChanged: MeshComponent for entity {} - transform:{} mesh:{}",
+                       event.entityId, static_cast<int>(hasTransform), static_cast<int>(hasMesh));
 
         auto *state = m_entityTracker.getState(event.entityId);
         if (state)
@@ -229,8 +255,7 @@ void IRenderer::onComponentChanged(const Events::ECS::ComponentChanged &event)
 
                 applyRenderDiff(diff);
 
-                LT_LOGI("Renderer",
-                        "ComponentChanged: MeshComponent updated for entity " + std::to_string(event.entityId));
+                LT_LOGSI_LIMIT("Renderer", kEntityLogsPerSecond, "ComponentChanged: MeshComponent updated for entity {}", event.entityId);
             }
         }
         else if (hasTransform && hasMesh)
@@ -260,13 +285,13 @@ void IRenderer::onComponentChanged(const Events::ECS::ComponentChanged &event)
 
             applyRenderDiff(diff);
 
-            LT_LOGI("Renderer", "ComponentChanged: MeshComponent added for entity " + std::to_string(event.entityId) +
-                                    " (observer fallback - all components present)");
+            LT_LOGSI_LIMIT("Renderer", kEntityLogsPerSecond, "ComponentChanged: MeshComponent added for entity {} (observer fallback - all components present)",
+                           event.entityId);
         }
         else
         {
-            LT_LOGI("Renderer", "ComponentChanged: MeshComponent for entity " + std::to_string(event.entityId) +
-                                    " - waiting for missing components");
+            LT_LOGSI_LIMIT("Renderer", kEntityLogsPerSecond, "ComponentChanged: MeshComponent for entity {} - waiting for missing components",
+                           event.entityId);
         }
     }
 }
@@ -274,7 +299,7 @@ void IRenderer::onComponentChanged(const Events::ECS::ComponentChanged &event)
 void IRenderer::onRenderFrameData(const Events::ECS::RenderFrameData &event)
 {
 
-    if (m_cameraUpdater)
+    if (m_cameraUpdater && event.hasCamera)
     {
         m_cameraUpdater->updateFromEvent(event.camera);
     }
@@ -289,6 +314,8 @@ void IRenderer::updateRenderList()
     if (m_needsFullRebuild)
     {
         m_needsFullRebuild = false;
+        // The rebuild reads transforms straight from ECS
+        m_transformUpdater.clear();
         rebuildRenderList();
         return;
     }
@@ -299,6 +326,9 @@ void IRenderer::updateRenderList()
     {
         applyRenderDiff(diff);
     }
+    // Added diffs carry the transform seen when the mesh was attached; newer ones wait here
+    m_transformUpdater.flushPending();
+    LT_METRIC_GAUGE_SET("render_objects", "Objects in the renderer's render list", m_listManager.size());
 
     // ============================================================
     // ============================================================
@@ -560,7 +590,7 @@ void IRenderer::applyRenderDiff(const RenderDiff &diff)
             RenderObject obj = RenderObjectFactory::createFromState(state);
             m_listManager.addObject(obj, change.entityId);
 
-            LT_LOGI("Renderer", "Applied diff: Added entity " + std::to_string(change.entityId));
+            LT_LOGSI_LIMIT("Renderer", kEntityLogsPerSecond, "Applied diff: Added entity {}", change.entityId);
             break;
         }
 
@@ -592,11 +622,10 @@ void IRenderer::applyRenderDiff(const RenderDiff &diff)
             auto &objects = m_listManager.getObjects();
             RenderObjectFactory::updateResources(objects[*pIndex], *state);
 
-            LT_LOGI("Renderer",
-                    "Applied diff: Updated entity " + std::to_string(change.entityId) + " (resources changed)");
+            LT_LOGSI_LIMIT("Renderer", kEntityLogsPerSecond, "Applied diff: Updated entity {} (resources changed)", change.entityId);
             if (!state->material.materialID.empty())
             {
-                LT_LOGI("Renderer", "Material updated: " + state->material.materialID.str());
+                LT_LOGSI_LIMIT("Renderer", kEntityLogsPerSecond, "Material updated: {}", state->material.materialID.str());
             }
             break;
         }
@@ -605,15 +634,14 @@ void IRenderer::applyRenderDiff(const RenderDiff &diff)
             auto *state = m_entityTracker.getState(change.entityId);
             if (!state)
             {
-                LT_LOGI("Renderer",
-                        "Applied diff: Removed entity " + std::to_string(change.entityId) + " (already removed)");
+                LT_LOGSI_LIMIT("Renderer", kEntityLogsPerSecond, "Applied diff: Removed entity {} (already removed)", change.entityId);
                 break;
             }
 
             m_listManager.removeObject(change.entityId);
             m_entityTracker.removeState(change.entityId);
 
-            LT_LOGI("Renderer", "Applied diff: Removed entity " + std::to_string(change.entityId));
+            LT_LOGSI_LIMIT("Renderer", kEntityLogsPerSecond, "Applied diff: Removed entity {}", change.entityId);
             break;
         }
         }
@@ -821,7 +849,7 @@ void IRenderer::rebuildRenderList()
             state.material = *material;
             if (!state.material.materialID.empty())
             {
-                LT_LOGI("Renderer", "Entity " + std::to_string(e.id()) + " has material: " + state.material.materialID.str());
+                LT_LOGSI_LIMIT("Renderer", kEntityLogsPerSecond, "Entity {} has material: {}", e.id(), state.material.materialID.str());
             }
         }
         else
@@ -830,6 +858,8 @@ void IRenderer::rebuildRenderList()
         }
 
         RenderObject obj = RenderObjectFactory::createFromState(state);
+        if (const auto* worldTransform = e.get<WorldTransformComponent>())
+            obj.modelMatrix.model = worldTransform->matrix;
         m_listManager.addObject(obj, e.id());
     });
 
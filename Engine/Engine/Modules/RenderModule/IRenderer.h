@@ -57,7 +57,9 @@ private:
     void onWorldOpened(const Events::ECS::WorldOpened& event);
     void onWorldClosed(const Events::ECS::WorldClosed& event);
     void onEntityCreated(const Events::ECS::EntityCreated& event);
+    void onEntitiesSpawned(const Events::ECS::EntitiesSpawned& event);
     void onEntityDestroyed(const Events::ECS::EntityDestroyed& event);
+    void onEntitiesDestroyed(const Events::ECS::EntitiesDestroyed& event);
     void onComponentChanged(const Events::ECS::ComponentChanged& event);
     void onRenderFrameData(const Events::ECS::RenderFrameData& event);
     void updateLightsFromECS();
@@ -1,6 +1,7 @@
 #include "OpenGLMesh.h"
 #include <GL/glew.h>
 #include "Foundation/Memory/ResourceAllocator.h"
+#include "Foundation/Metrics/MetricsMacros.h"
 
 using EngineCore::Foundation::ResourceAllocator;
 
@@ -64,6 +65,7 @@ void OpenGLMesh::draw() const
 {
     LT_ASSERT_MSG(m_indexCount > 0, "Cannot draw mesh with zero indices");
     bind();
+    LT_METRIC_COUNTER_INC("render_draw_calls_total", "Mesh draw calls submitted to the GPU");
     glDrawElements(GL_TRIANGLES, m_indexCount, GL_UNSIGNED_INT, 0);
     unbind();
 }
@@ -71,6 +73,7 @@ void OpenGLMesh::draw() const
 void OpenGLMesh::drawIndexed(GLsizei instanceCount) const
 {
     bind();
+    LT_METRIC_COUNTER_INC("render_draw_calls_total", "Mesh draw calls submitted to the GPU");
     glDrawElementsInstanced(GL_TRIANGLES, m_indexCount, GL_UNSIGNED_INT, 0, instanceCount);
     unbind();
 }
@@ -85,7 +85,7 @@ unsigned int OpenGLShader::createShaderFromGLSL(const std::string &source, unsig
         char log[512];
         glGetShaderInfoLog(shader, sizeof(log), NULL, log);
 
-        LT_LOGE("OpenGLShader", std::format("GLSL Shader compile error: {}", log));
+        LT_LOGFE("OpenGLShader", "GLSL Shader compile error: {}", log);
     }
 
     return shader;
@@ -111,7 +111,7 @@ void OpenGLShader::scanUniformBlocks()
             glUniformBlockBinding(m_programID, blockIndex, bindingPoint);
 
             m_uniformBlocks[blockName] = bindingPoint;
-            LT_LOGI("OpenGLShader:", std::format("Bound uniform:{} -> bindingPoint {}", blockName, bindingPoint));
+            LT_LOGFI("OpenGLShader:", "Bound uniform:{} -> bindingPoint {}", blockName, bindingPoint);
         }
     }
 }
@@ -142,7 +142,7 @@ void OpenGLShader::scanTextureBindings(const std::unordered_map<std::string, int
             auto it = bindingMap.find(name);
             if (it == bindingMap.end())
             {
-                LT_LOGE("OpenGLShader", std::format("No binding found for sampler:{}", name));
+                LT_LOGFE("OpenGLShader", "No binding found for sampler:{}", name);
                 continue;
             }
 
@@ -159,7 +159,7 @@ void OpenGLShader::scanTextureBindings(const std::unordered_map<std::string, int
             glUniform1i(location, textureUnit);
             glUseProgram(0);
 
-            LT_LOGI("OpenGLShader:", std::format("Bound sampler:{} -> unit {}", name, textureUnit));
+            LT_LOGFI("OpenGLShader:", "Bound sampler:{} -> unit {}", name, textureUnit);
         }
     }
 }
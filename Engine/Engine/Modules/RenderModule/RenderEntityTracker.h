@@ -42,13 +42,7 @@ struct EntityRenderState
         if (!renderObject)
             return;
 
-        glm::mat4 model(1.f);
-        glm::vec3 posVec = position.toGLMVec();
-        model = glm::translate(model, posVec);
-        model *= glm::mat4_cast(rotation.toQuat());
-        glm::vec3 scaleVec = scale.toGLMVec();
-        model = glm::scale(model, scaleVec);
-        renderObject->modelMatrix.model = model;
+        renderObject->modelMatrix.model = Math::TRS(position.toGLMVec(), rotation.toQuat(), scale.toGLMVec());
     }
 };
 
@@ -220,11 +220,7 @@ glm::mat4 RenderObjectFactory::computeModelMatrix(const PositionComponent& pos,
                                                    const RotationComponent& rot, 
                                                    const ScaleComponent& scale)
 {
-    glm::mat4 model(1.f);
-    model = glm::translate(model, pos.toGLMVec());
-    model *= glm::mat4_cast(rot.toQuat());
-    model = glm::scale(model, scale.toGLMVec());
-    return model;
+    return Math::TRS(pos.toGLMVec(), rot.toQuat(), scale.toGLMVec());
 }
 
 } // namespace RenderModule
@@ -5,11 +5,16 @@
 #include <Modules/ObjectCoreModule/ECS/Components/ECSComponents.h>
 #include "RenderEntityTracker.h"
 
+#include <algorithm>
+
 namespace RenderModule
 {
 class RenderSystemObserver
 {
 private:
+    // Observers fire per entity; bulk spawns would otherwise flood the log.
+    static constexpr uint32_t kEntityLogsPerSecond = 10;
+
     flecs::world* m_world = nullptr;
     RenderEntityTracker* m_tracker = nullptr;
     
@@ -46,11 +51,21 @@ private:
             
         flecs::world& world = *m_world;
         
+        // Bulk spawns arrive as one table range: size the diff once and log per range
         world.observer<MeshComponent>()
             .event(flecs::OnAdd)
-            .each([this](flecs::entity e, MeshComponent& mesh) {
-                LT_LOGI("RenderObserver", "OnAdd MeshComponent for entity " + std::to_string(e.id()));
-                onEntityBecameRenderable(e);
+            .run([this](flecs::iter& it) {
+                while (it.next())
+                {
+                    LT_LOGSI_LIMIT("RenderObserver", kEntityLogsPerSecond, "OnAdd MeshComponent for {} entities",
+                                   it.count());
+                    auto& changes = m_currentDiff.changes;
+                    const size_t needed = changes.size() + static_cast<size_t>(it.count());
+                    if (needed > changes.capacity())
+                        changes.reserve(std::max(needed, changes.capacity() * 2));
+                    for (auto i : it)
+                        onEntityBecameRenderable(it.entity(i));
+                }
             });
             
         world.observer<MeshComponent>()
@@ -62,8 +77,8 @@ private:
         world.observer<MeshComponent>()
             .event(flecs::OnSet)
             .each([this](flecs::entity e, MeshComponent& mesh) {
-                LT_LOGI("RenderObserver", "OnSet MeshComponent for entity " + std::to_string(e.id()) + 
-                        " (meshID: " + mesh.meshID.str() + ")");
+                LT_LOGSI_LIMIT("RenderObserver", kEntityLogsPerSecond, "OnSet MeshComponent for entity {} (meshID: {})", e.id(),
+                               mesh.meshID.str());
                 onMeshComponentChanged(e, mesh);
             });
         
@@ -96,9 +111,8 @@ private:
         
         if (!hasTransform || !hasMesh)
         {
-            LT_LOGI("RenderObserver", "Entity " + std::to_string(e.id()) + 
-                    " missing components - transform:" + std::to_string(hasTransform) + 
-                    " mesh:" + std::to_string(hasMesh));
+            LT_LOGSI_LIMIT("RenderObserver", kEntityLogsPerSecond, "Entity {} missing components - transform:{} mesh:{}", e.id(),
+                           static_cast<int>(hasTransform), static_cast<int>(hasMesh));
             return;
         }
         
@@ -133,7 +147,7 @@ private:
         
         m_currentDiff.changes.push_back(std::move(change));
         
-        LT_LOGI("RenderObserver", "Entity " + std::to_string(e.id()) + " became renderable");
+        LT_LOGSI_LIMIT("RenderObserver", kEntityLogsPerSecond, "Entity {} became renderable", e.id());
     }
     
     void onEntityBecameNonRenderable(flecs::entity e)
@@ -149,7 +163,7 @@ private:
         
         m_tracker->removeState(e.id());
         
-        LT_LOGI("RenderObserver", "Entity " + std::to_string(e.id()) + " became non-renderable");
+        LT_LOGSI_LIMIT("RenderObserver", kEntityLogsPerSecond, "Entity {} became non-renderable", e.id());
     }
     
     
@@ -177,7 +191,7 @@ private:
         
         m_currentDiff.changes.push_back(std::move(change));
         
-        LT_LOGI("RenderObserver", "MaterialComponent changed for entity " + std::to_string(e.id()));
+        LT_LOGSI_LIMIT("RenderObserver", kEntityLogsPerSecond, "MaterialComponent changed for entity {}", e.id());
     }
     
     void onMeshComponentChanged(flecs::entity e, const MeshComponent& mesh)
@@ -205,8 +219,8 @@ private:
                 }
                 newState.mesh = mesh;
                 
-                LT_LOGI("RenderObserver", "MeshComponent added to entity " + std::to_string(e.id()) + 
-                        " but not all transform components present yet (meshID: " + mesh.meshID.str() + ")");
+                LT_LOGSI_LIMIT("RenderObserver", kEntityLogsPerSecond, "MeshComponent added to entity {} but not all transform components present yet (meshID: {})",
+                               e.id(), mesh.meshID.str());
             }
             return;
         }
@@ -247,10 +261,9 @@ private:
             
             m_currentDiff.changes.push_back(std::move(change));
             
-            LT_LOGI("RenderObserver", (needsToBecomeRenderable ? "Entity " : "Mesh changed for entity ") + 
-                    std::to_string(e.id()) + 
-                    " (meshID: " + mesh.meshID.str() + 
-                    ", textureID: " + mesh.textureID.str() + ")");
+            LT_LOGSI_LIMIT("RenderObserver", kEntityLogsPerSecond, "{}{} (meshID: {}, textureID: {})",
+                           needsToBecomeRenderable ? "Entity " : "Mesh changed for entity ", e.id(),
+                           mesh.meshID.str(), mesh.textureID.str());
         }
     }
     
@@ -259,7 +272,7 @@ private:
         if (!e.has<MeshComponent>())
             return;
         
-        LT_LOGI("RenderObserver", "checkIfEntityBecameRenderable called for entity " + std::to_string(e.id()));
+        LT_LOGSI_LIMIT("RenderObserver", kEntityLogsPerSecond, "checkIfEntityBecameRenderable called for entity {}", e.id());
         
         auto* state = m_tracker->getState(e.id());
         if (state && !state->isValid)
@@ -4,7 +4,6 @@
 
 namespace RenderModule
 {
-
 TransformUpdater::TransformUpdater(RenderEntityTracker& tracker, RenderListManager& listManager)
     : m_tracker(tracker)
     , m_listManager(listManager)
@@ -14,38 +13,115 @@ TransformUpdater::TransformUpdater(RenderEntityTracker& tracker, RenderListManag
 void TransformUpdater::updateFromEvent(const Events::ECS::RenderFrameData& frameData)
 {
     ZoneScopedN("TransformUpdater::updateFromEvent");
-    
-    for (const auto& transform : frameData.objectsTransforms)
+    if (frameData.simulationSteps == 0)
+    {
+        // Not simulated: shown as sent, and no longer blended if the entity was in motion
+        for (size_t i = 0; i < frameData.size(); ++i)
+            m_motion.erase(frameData.entityIds[i]);
+        applyFrame(frameData, true);
+    }
+    else
     {
-        updateObjectTransform(transform);
+        advanceMotion(frameData);
     }
+    applyMotion(frameData.interpolationAlpha);
 }
 
-bool TransformUpdater::updateObjectTransform(const Events::ECS::ObjectTransformData& transform)
+void TransformUpdater::advanceMotion(const Events::ECS::RenderFrameData& frameData)
 {
-    auto* state = m_tracker.getState(transform.entityId);
-    if (!state)
+    // The latest step becomes the one before. Entities a step did not move settle on it.
+    for (auto it = m_motion.begin(); it != m_motion.end();)
+    {
+        if (it->second.previous == it->second.latest)
+        {
+            it = m_motion.erase(it);
+            continue;
+        }
+        it->second.previous = it->second.latest;
+        ++it;
+    }
+
+    // After several steps, entities the earlier ones moved start the last step from there
+    for (size_t i = 0; i < frameData.stepStartIds.size(); ++i)
+    {
+        const glm::mat4& model = frameData.stepStartMatrices[i];
+        m_motion.insert_or_assign(frameData.stepStartIds[i], Motion{model, model});
+    }
+
+    for (size_t i = 0; i < frameData.size(); ++i)
+    {
+        const uint64_t entityId = frameData.entityIds[i];
+        const glm::mat4& model = frameData.worldMatrices[i];
+        auto it = m_motion.find(entityId);
+        if (it != m_motion.end())
+        {
+            it->second.latest = model;
+            continue;
+        }
+        // At rest the drawn matrix is the previous step's; new objects start where they appear
+        const glm::mat4* drawn = currentModel(entityId);
+        m_motion.emplace(entityId, Motion{drawn ? *drawn : model, model});
+    }
+}
+
+void TransformUpdater::applyMotion(float alpha)
+{
+    if (m_motion.empty())
+        return;
+
+    ZoneScopedN("TransformUpdater::applyMotion");
+    for (const auto& [entityId, motion] : m_motion)
+    {
+        const glm::mat4 model =
+            motion.previous == motion.latest ? motion.latest
+                                             : Math::InterpolateTransform(motion.previous, motion.latest, alpha);
+        if (!updateObjectTransform(entityId, model))
+            keepPending(entityId, model);
+    }
+}
+
+void TransformUpdater::flushPending()
+{
+    if (m_pending.size() == 0)
+        return;
+
+    ZoneScopedN("TransformUpdater::flushPending");
+
+    // One retry: an entity that still has no render object by now is not renderable.
+    applyFrame(m_pending, false);
+    m_pending.clear();
+}
+
+void TransformUpdater::applyFrame(const Events::ECS::RenderFrameData& frameData, bool keepMissing)
+{
+    const size_t count = frameData.size();
+    if (count == 0)
+        return;
+
+    // World matrices come from ECS (TransformHierarchy), so this is a copy per entity
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (!updateObjectTransform(frameData.entityIds[i], frameData.worldMatrices[i]) && keepMissing)
+        {
+            keepPending(frameData.entityIds[i], frameData.worldMatrices[i]);
+        }
+    }
+}
+
+void TransformUpdater::clear()
+{
+    m_pending.clear();
+    m_motion.clear();
+}
+
+bool TransformUpdater::updateObjectTransform(uint64_t entityId, const glm::mat4& model)
+{
+    if (!m_tracker.getState(entityId))
     {
         return false;
     }
     
-    state->position.x = transform.posX;
-    state->position.y = transform.posY;
-    state->position.z = transform.posZ;
-    
-    state->rotation.x = transform.rotX;
-    state->rotation.y = transform.rotY;
-    state->rotation.z = transform.rotZ;
-    state->rotation.qx = transform.rotQX;
-    state->rotation.qy = transform.rotQY;
-    state->rotation.qz = transform.rotQZ;
-    state->rotation.qw = transform.rotQW;
-    
-    state->scale.x = transform.scaleX;
-    state->scale.y = transform.scaleY;
-    state->scale.z = transform.scaleZ;
-    
-    size_t* pIndex = m_listManager.getObjectIndex(transform.entityId);
+    size_t* pIndex = m_listManager.getObjectIndex(entityId);
     if (!pIndex)
     {
         return false;
@@ -54,15 +130,28 @@ bool TransformUpdater::updateObjectTransform(const Events::ECS::ObjectTransformD
     size_t objIndex = *pIndex;
     if (!m_listManager.isValidIndex(objIndex))
     {
-        m_listManager.removeObject(transform.entityId);
+        m_listManager.removeObject(entityId);
         return false;
     }
     
     auto& objects = m_listManager.getObjects();
-    RenderObjectFactory::updateTransform(objects[objIndex], *state);
+    objects[objIndex].modelMatrix.model = model;
     
     return true;
 }
 
-} // namespace RenderModule
+const glm::mat4* TransformUpdater::currentModel(uint64_t entityId)
+{
+    size_t* pIndex = m_listManager.getObjectIndex(entityId);
+    if (!pIndex || !m_listManager.isValidIndex(*pIndex))
+        return nullptr;
+    return &m_listManager.getObjects()[*pIndex].modelMatrix.model;
+}
 
+void TransformUpdater::keepPending(uint64_t entityId, const glm::mat4& model)
+{
+    m_pending.entityIds.push_back(entityId);
+    m_pending.worldMatrices.push_back(model);
+}
+
+} // namespace RenderModule
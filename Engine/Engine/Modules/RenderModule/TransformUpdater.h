@@ -6,6 +6,8 @@
 #include "RenderObjectFactory.h"
 #include <Modules/ObjectCoreModule/ECS/Events.h>
 
+#include <unordered_map>
+
 namespace RenderModule
 {
 class TransformUpdater
@@ -13,15 +15,37 @@ class TransformUpdater
 private:
     RenderEntityTracker& m_tracker;
     RenderListManager& m_listManager;
+
+    // Transforms that arrived before their render object existed. ECS only sends a transform
+    // when it changes, so these are applied once the pending Added diffs went through.
+    Events::ECS::RenderFrameData m_pending;
+
+    // Entities moved by the latest simulation step: drawn between the step before and that one
+    // until a step leaves them where they are.
+    struct Motion
+    {
+        glm::mat4 previous;
+        glm::mat4 latest;
+    };
+    std::unordered_map<uint64_t, Motion> m_motion;
     
 public:
     TransformUpdater(RenderEntityTracker& tracker, RenderListManager& listManager);
     
     void updateFromEvent(const Events::ECS::RenderFrameData& frameData);
+
+    // Re-applies transforms kept by updateFromEvent(); call after applying a render diff.
+    void flushPending();
+    // Drops pending transforms and interpolation state, e.g. before a full rebuild.
+    void clear();
     
 private:
-    bool updateObjectTransform(const Events::ECS::ObjectTransformData& transform);
+    void applyFrame(const Events::ECS::RenderFrameData& frameData, bool keepMissing);
+    void advanceMotion(const Events::ECS::RenderFrameData& frameData);
+    void applyMotion(float alpha);
+    bool updateObjectTransform(uint64_t entityId, const glm::mat4& model);
+    const glm::mat4* currentModel(uint64_t entityId);
+    void keepPending(uint64_t entityId, const glm::mat4& model);
 };
 
 } // namespace RenderModule
-
@@ -20,6 +20,7 @@ enum class AssetType : uint8_t
     Audio,
     Script,
     World,
+    Prefab,
 };
 
 enum class AssetOrigin : uint8_t
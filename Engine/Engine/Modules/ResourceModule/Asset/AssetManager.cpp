@@ -9,6 +9,7 @@
 #include "Importers/ShaderImporter.h"
 #include "Importers/TextureImporter.h"
 #include "Importers/WorldImporter.h"
+#include "Importers/PrefabImporter.h"
 #include "Importers/MaterialImporter.h"
 #include "Importers/ScriptImporter.h"
 #include "Writers/WorldWriter.h"
@@ -175,6 +176,16 @@ namespace
         }
     }
     
+    // Helper deleter for PrefabImporter
+    void deletePrefabImporter(IAssetImporter* p)
+    {
+        if (p)
+        {
+            static_cast<PrefabImporter*>(p)->~PrefabImporter();
+            DeallocateMemory(p, MemoryTag::Resource);
+        }
+    }
+    
     // Helper deleter for MaterialImporter
     void deleteMaterialImporter(IAssetImporter* p)
     {
@@ -322,6 +333,31 @@ void AssetManager::registerDefaultImporters()
         LT_LOGE("AssetManager", "Failed to allocate memory for WorldImporter");
     }
     
+    // Allocate and create PrefabImporter using MemorySystem
+    void* prefabImporterMemory = AllocateMemory(sizeof(PrefabImporter), alignof(PrefabImporter), MemoryTag::Resource);
+    if (prefabImporterMemory)
+    {
+        PrefabImporter* prefabImporter = nullptr;
+        try
+        {
+            prefabImporter = new(prefabImporterMemory) PrefabImporter();
+            using DeleterType = void(*)(IAssetImporter*);
+            DeleterType deleter = deletePrefabImporter;
+            std::unique_ptr<IAssetImporter, DeleterType> importer(prefabImporter, deleter);
+            m_importers.registerImporter(std::move(importer));
+            LT_LOGI("AssetManager", "Registered PrefabImporter");
+        }
+        catch (...)
+        {
+            DeallocateMemory(prefabImporterMemory, MemoryTag::Resource);
+            LT_LOGE("AssetManager", "Failed to create PrefabImporter: constructor threw exception");
+        }
+    }
+    else
+    {
+        LT_LOGE("AssetManager", "Failed to allocate memory for PrefabImporter");
+    }
+    
     // Allocate and create MaterialImporter using MemorySystem
     void* materialImporterMemory = AllocateMemory(sizeof(MaterialImporter), alignof(MaterialImporter), MemoryTag::Resource);
     if (materialImporterMemory)
@@ -478,7 +514,7 @@ void AssetManager::processFileChanges()
     
     if (!files.empty())
     {
-        LT_LOGI("AssetManager", std::format("Processing {} file change(s)...", files.size()));
+        LT_LOGFI("AssetManager", "Processing {} file change(s)...", files.size());
     }
 
     for (const auto& f : files)
@@ -520,7 +556,7 @@ void AssetManager::processFileChanges()
 
             m_database.upsert(info);
             OnAssetImported(info);
-            LT_LOGI("AssetManager", std::format("Reimported [{}] {}", info.guid.str(), info.sourcePath));
+            LT_LOGFI("AssetManager", "Reimported [{}] {}", info.guid.str(), info.sourcePath);
         }
         else
         {
@@ -530,7 +566,7 @@ void AssetManager::processFileChanges()
     
     if (!files.empty())
     {
-        LT_LOGI("AssetManager", std::format("Processed {} file change(s)", files.size()));
+        LT_LOGFI("AssetManager", "Processed {} file change(s)", files.size());
     }
 }
 
@@ -549,7 +585,7 @@ void AssetManager::scanAndImportAllIn(const std::filesystem::path& root)
     
     LT_ASSERT_MSG(std::filesystem::is_directory(root), "Root path is not a directory: " + root.string());
     
-    LT_LOGI("AssetManager", std::format("Scanning directory: {}", root.string()));
+    LT_LOGFI("AssetManager", "Scanning directory: {}", root.string());
 
     size_t filesFound = 0;
     size_t filesImported = 0;
@@ -618,8 +654,8 @@ void AssetManager::scanAndImportAllIn(const std::filesystem::path& root)
             
             if (fileUnchanged)
             {
-                LT_LOGI("AssetManager", std::format("Skipping unchanged asset [{}] {}", 
-                    expectedGuid.str(), rel.generic_string()));
+                LT_LOGSI_LIMIT("AssetManager", 20, "Skipping unchanged asset [{}] {}", expectedGuid.str(),
+                               rel.generic_string());
                 filesSkipped++;
                 continue;
             }
@@ -654,7 +690,7 @@ void AssetManager::scanAndImportAllIn(const std::filesystem::path& root)
         OnAssetImported(info);
         filesImported++;
 
-        LT_LOGI("AssetManager", std::format("Imported [{}] {}", info.guid.str(), info.sourcePath));
+        LT_LOGFI("AssetManager", "Imported [{}] {}", info.guid.str(), info.sourcePath);
     }
     
     LT_LOGI("AssetManager", std::format("Scan completed: {} file(s) found, {} imported, {} skipped", 
@@ -0,0 +1,65 @@
+#pragma once
+#include "../IAssetImporter.h"
+#include <Foundation/Assert/Assert.h>
+#include <fstream>
+
+namespace ResourceModule
+{
+class PrefabImporter final : public IAssetImporter
+{
+public:
+    bool supportsExtension(const std::string& ext) const noexcept override
+    {
+        return ext == ".lprefab";
+    }
+
+    AssetType getAssetType() const noexcept override
+    {
+        return AssetType::Prefab;
+    }
+
+    AssetInfo import(const std::filesystem::path& sourcePath,
+                     const std::filesystem::path& cacheRoot) override
+    {
+        LT_ASSERT_MSG(!sourcePath.empty(), "Source path cannot be empty");
+        LT_ASSERT_MSG(!cacheRoot.empty(), "Cache root cannot be empty");
+
+        AssetInfo info{};
+        info.type       = AssetType::Prefab;
+        info.sourcePath = sourcePath.string();
+        info.guid       = MakeDeterministicIDFromPath(std::filesystem::path(sourcePath).generic_string());
+
+        std::ifstream ifs(sourcePath);
+        if (!ifs.is_open())
+            throw std::runtime_error("Cannot open prefab file: " + sourcePath.string());
+
+        std::string json((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+        ifs.close();
+        if (json.empty())
+            throw std::runtime_error("Prefab file is empty: " + sourcePath.string());
+        LT_ASSERT_MSG(json.size() < 16 * 1024 * 1024, "Prefab JSON file is unreasonably large"); // 16MB limit
+
+        std::filesystem::path outDir = cacheRoot / "Prefabs";
+        std::filesystem::create_directories(outDir);
+
+        // Keyed by GUID: prefabs in different folders often share a file name
+        std::filesystem::path outFile = outDir / (info.guid.str() + ".prefabbin");
+        std::ofstream ofs(outFile, std::ios::binary | std::ios::trunc);
+        LT_ASSERT_MSG(ofs.is_open(), "Failed to open output file: " + outFile.string());
+
+        uint32_t size = static_cast<uint32_t>(json.size());
+        ofs.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        ofs.write(json.data(), json.size());
+        ofs.close();
+
+        info.importedPath      = outFile.string();
+        info.sourceFileSize    = std::filesystem::file_size(sourcePath);
+        info.importedFileSize  = std::filesystem::file_size(outFile);
+        info.sourceTimestamp   = std::filesystem::last_write_time(sourcePath).time_since_epoch().count();
+        info.importedTimestamp = std::filesystem::last_write_time(outFile).time_since_epoch().count();
+
+        LT_LOGI("PrefabImporter", "Imported prefab: " + sourcePath.string());
+        return info;
+    }
+};
+}
@@ -45,7 +45,7 @@ bool WorldWriter::write(const BaseResource &resource, const std::filesystem::pat
 
     if (jsonData.size() >= kMaxWorldSizeBytes)
     {
-        LT_LOGE("WorldWriter", std::format("World JSON data is too large ({} bytes)", jsonData.size()));
+        LT_LOGFE("WorldWriter", "World JSON data is too large ({} bytes)", jsonData.size());
         return false;
     }
 
@@ -127,6 +127,6 @@ RMesh::RMesh(const std::string &path) : BaseResource(path)
         return; // Leave resource empty
     }
 
-    LT_LOGI("RMesh", std::format("Loaded meshbin {} ({} vertices, {} indices)", path, vertexCount, indexCount));
+    LT_LOGFI("RMesh", "Loaded meshbin {} ({} vertices, {} indices)", path, vertexCount, indexCount);
 }
 } // namespace ResourceModule
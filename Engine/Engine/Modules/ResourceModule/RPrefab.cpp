@@ -0,0 +1,38 @@
+#include "RPrefab.h"
+#include "Foundation/Assert/Assert.h"
+#include <fstream>
+
+using namespace ResourceModule;
+
+RPrefab::RPrefab(const std::string& path)
+    : BaseResource(path)
+{
+    LT_ASSERT_MSG(!path.empty(), "Prefab path cannot be empty");
+
+    // Same layout as the world cache: uint32 size, then the JSON text
+    std::ifstream ifs(path, std::ios::binary);
+    if (!ifs.is_open())
+    {
+        LT_LOGE("RPrefab", "Failed to open prefab file: " + path);
+        return;
+    }
+
+    uint32_t size = 0;
+    ifs.read(reinterpret_cast<char*>(&size), sizeof(size));
+    if (ifs.fail() || size == 0 || size >= 16 * 1024 * 1024) // 16MB limit
+    {
+        LT_LOGE("RPrefab", "Invalid prefab file header: " + path);
+        return;
+    }
+
+    m_jsonData.resize(size);
+    ifs.read(m_jsonData.data(), size);
+    if (ifs.fail() || ifs.gcount() != static_cast<std::streamsize>(size))
+    {
+        LT_LOGE("RPrefab", "Failed to read prefab data or file truncated: " + path);
+        m_jsonData.clear();
+        return;
+    }
+
+    LT_LOGI("RPrefab", "Loaded prefab data: " + path + " (" + std::to_string(size) + " bytes)");
+}
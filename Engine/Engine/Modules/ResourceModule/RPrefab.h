@@ -0,0 +1,36 @@
+#pragma once
+#include <EngineMinimal.h>
+#include "BaseResource.h"
+
+namespace ResourceModule
+{
+/// <summary>
+/// Entity template: one entity in the flecs JSON format EntityWorld::serialize() writes per
+/// entity ({"components": {...}}). EntityWorld turns it into a flecs prefab that instances
+/// inherit through IsA.
+/// </summary>
+class RPrefab final : public BaseResource
+{
+  public:
+    explicit RPrefab(const std::string& path);
+    ~RPrefab() noexcept = default;
+
+    const std::string& getJsonData() const noexcept
+    {
+        return m_jsonData;
+    }
+
+    bool isValid() const noexcept
+    {
+        return !m_jsonData.empty();
+    }
+
+    void setJsonData(std::string json) noexcept
+    {
+        m_jsonData = std::move(json);
+    }
+
+  private:
+    std::string m_jsonData;
+};
+} // namespace ResourceModule
@@ -7,6 +7,7 @@
 #include "Texture.h"
 #include "Shader.h"
 #include "Script.h"
+#include "RPrefab.h"
 #include "RWorld.h"
 #include "../../Core/CoreGlobal.h"
 #include "../../Foundation/JobSystem/JobSystem.h"
@@ -121,8 +122,9 @@ void ResourceManager::unload(const AssetID &guid)
     getCache<RShader>().remove(guid);
     getCache<RScript>().remove(guid);
     getCache<RWorld>().remove(guid);
+    getCache<RPrefab>().remove(guid);
     
-    LT_LOGI("ResourceManager", std::format("Unloaded resource [{}]", guid.str()));
+    LT_LOGFI("ResourceManager", "Unloaded resource [{}]", guid.str());
 }
 
 void ResourceManager::clearAll()
@@ -147,6 +149,7 @@ void ResourceManager::clearAll()
     getCache<RShader>().clear();
     getCache<RScript>().clear();
     getCache<RWorld>().clear();
+    getCache<RPrefab>().clear();
     
     // Final cleanup pass to remove any remaining expired entries
     cleanupExpiredCacheEntries();
@@ -162,6 +165,7 @@ void ResourceManager::cleanupExpiredCacheEntries()
     getCache<RShader>().removeUnused();
     getCache<RScript>().removeUnused();
     getCache<RWorld>().removeUnused();
+    getCache<RPrefab>().removeUnused();
 }
 
 EngineCore::Foundation::JobHandle ResourceManager::scheduleCleanupExpiredJob()
@@ -5,6 +5,7 @@
 #include "Material.h"
 #include "Mesh.h"
 #include "Pak/PakReader.h"
+#include "RPrefab.h"
 #include "RWorld.h"
 #include "ResourceCache.h"
 #include "ResourceRegistry.h"
@@ -79,6 +80,7 @@ class ResourceManager : public IModule
     ResourceCache<RShader> m_shaderCache;
     ResourceCache<RScript> m_scriptCache;
     ResourceCache<RWorld> m_worldCache;
+    ResourceCache<RPrefab> m_prefabCache;
 
     WriterContext buildWriterContext();
     std::filesystem::path resolveTargetPath(const AssetInfo &info, const ResourceSaveParams &params) const;
@@ -104,6 +106,8 @@ class ResourceManager : public IModule
             return m_scriptCache;
         else if constexpr (std::is_same_v<T, RWorld>)
             return m_worldCache;
+        else if constexpr (std::is_same_v<T, RPrefab>)
+            return m_prefabCache;
         else
             static_assert(always_false<T>::value, "Unsupported resource cache type");
     }
@@ -184,17 +188,21 @@ template <typename T> std::shared_ptr<T> ResourceManager::load(const AssetID &id
     auto &cache = getCache<T>();
     if (auto cached = cache.find(id))
     {
-        LT_LOGI("ResourceManager", std::format("Resource [{}] found in cache", id.str()));
+        LT_METRIC_COUNTER_INC("resource_cache_hits_total", "ResourceManager::load calls served from the cache");
+        // Cache hits repeat every frame for streamed-in assets; keep the log readable.
+        LT_LOGSI_LIMIT("ResourceManager", 5, "Resource [{}] found in cache", id.str());
         return cached;
     }
 
+    LT_METRIC_COUNTER_INC("resource_cache_misses_total", "ResourceManager::load calls that had to load from disk or PAK");
+
     if (!m_assetDatabase)
     {
         LT_LOGE("ResourceManager", "AssetDatabase not set! Call setDatabase() first");
         return nullptr;
     }
     
-    LT_LOGI("ResourceManager", std::format("Loading resource [{}]...", id.str()));
+    LT_LOGFI("ResourceManager", "Loading resource [{}]...", id.str());
     
     auto infoOpt = m_assetDatabase->get(id);
     if (!infoOpt)
@@ -209,7 +217,7 @@ template <typename T> std::shared_ptr<T> ResourceManager::load(const AssetID &id
 
     if (m_usePak && m_pakReader && m_pakReader->exists(id))
     {
-        LT_LOGI("ResourceManager", std::format("Loading resource [{}] from PAK", id.str()));
+        LT_LOGFI("ResourceManager", "Loading resource [{}] from PAK", id.str());
         auto data = m_pakReader->readAsset(id);
         if (!data)
         {
@@ -223,7 +231,7 @@ template <typename T> std::shared_ptr<T> ResourceManager::load(const AssetID &id
             return nullptr;
         }
         
-        LT_LOGI("ResourceManager", std::format("Read {} bytes from PAK for [{}]", data->size(), id.str()));
+        LT_LOGFI("ResourceManager", "Read {} bytes from PAK for [{}]", data->size(), id.str());
 
         std::filesystem::path tmp = std::filesystem::temp_directory_path() / (id.str() + ".tmp");
         std::ofstream ofs(tmp, std::ios::binary);
@@ -256,11 +264,13 @@ template <typename T> std::shared_ptr<T> ResourceManager::load(const AssetID &id
             LT_LOGE("ResourceManager", "Missing imported file: " + sourcePath.string());
             return nullptr;
         }
-        LT_LOGI("ResourceManager", std::format("Loading resource [{}] from filesystem: {}", id.str(), sourcePath.string()));
+        LT_LOGFI("ResourceManager", "Loading resource [{}] from filesystem: {}", id.str(), sourcePath.string());
     }
 
     std::shared_ptr<T> resource;
     bool isTempFile = (sourcePath.extension() == ".tmp");
+    std::error_code sizeError;
+    const auto sourceBytes = std::filesystem::file_size(sourcePath, sizeError);
     try
     {
         using namespace EngineCore::Foundation;
@@ -301,7 +311,9 @@ template <typename T> std::shared_ptr<T> ResourceManager::load(const AssetID &id
             }
         });
         
-        LT_LOGI("ResourceManager", std::format("Resource [{}] created successfully", id.str()));
+        LT_LOGFI("ResourceManager", "Resource [{}] created successfully", id.str());
+        if (!sizeError)
+            LT_METRIC_COUNTER_ADD("resource_bytes_loaded_total", "Bytes of imported or PAK data read by ResourceManager::load", sourceBytes);
     }
     catch (const std::exception &e)
     {
@@ -343,7 +355,7 @@ template <typename T> std::shared_ptr<T> ResourceManager::load(const AssetID &id
 
     cache.put(id, resource);
     m_registry.registerResource(id, resource);
-    LT_LOGI("ResourceManager", std::format("Resource [{}] registered in cache and registry", id.str()));
+    LT_LOGFI("ResourceManager", "Resource [{}] registered in cache and registry", id.str());
     return resource;
 }
 
@@ -352,7 +364,7 @@ template <typename T> std::shared_ptr<T> ResourceManager::loadBySource(const std
     LT_ASSERT_MSG(!path.empty(), "Source path cannot be empty");
     LT_ASSERT_MSG(m_assetDatabase, "AssetDatabase not set for loadBySource()");
 
-    LT_LOGI("ResourceManager", std::format("Loading resource by source path: {}", path));
+    LT_LOGFI("ResourceManager", "Loading resource by source path: {}", path);
     auto infoOpt = m_assetDatabase->findBySource(path);
     if (!infoOpt)
     {
@@ -361,7 +373,7 @@ template <typename T> std::shared_ptr<T> ResourceManager::loadBySource(const std
     }
 
     LT_ASSERT_MSG(!infoOpt->guid.empty(), "Found AssetInfo has empty GUID");
-    LT_LOGI("ResourceManager", std::format("Found AssetID [{}] for source path: {}", infoOpt->guid.str(), path));
+    LT_LOGFI("ResourceManager", "Found AssetID [{}] for source path: {}", infoOpt->guid.str(), path);
     return load<T>(infoOpt->guid);
 }
 
@@ -74,7 +74,7 @@ bool DevScriptManager::loadScript(ScriptVM& devVM, const ResourceModule::AssetID
         autoInvoke(m_scripts[id]);
     }
 
-    LT_LOGI(kDevManagerCategory.data(), std::format("Loaded dev script {}", instance.key));
+    LT_LOGFI(kDevManagerCategory.data(), "Loaded dev script {}", instance.key);
     return true;
 }
 
@@ -144,7 +144,7 @@ ResourceModule::RScript* DevScriptManager::loadResource(const ResourceModule::As
     auto resource = m_resourceManager->load<ResourceModule::RScript>(id);
     if (!resource)
     {
-        LT_LOGE(kDevManagerCategory.data(), std::format("Failed to load dev script [{}]", id.str()));
+        LT_LOGFE(kDevManagerCategory.data(), "Failed to load dev script [{}]", id.str());
         return nullptr;
     }
 
@@ -157,7 +157,7 @@ bool DevScriptManager::executeChunk(ScriptVM& devVM, ScriptInstance& instance, R
     if (!chunk.valid())
     {
         sol::error err = chunk;
-        LT_LOGE(kDevManagerCategory.data(), std::format("Lua load error in dev script {}: {}", instance.key, err.what()));
+        LT_LOGFE(kDevManagerCategory.data(), "Lua load error in dev script {}: {}", instance.key, err.what());
         return false;
     }
 
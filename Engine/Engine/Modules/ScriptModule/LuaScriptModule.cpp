@@ -174,11 +174,13 @@ bool LuaScriptModule::reloadDevScript(std::string_view name)
 
 void LuaScriptModule::cacheDependencies()
 {
-    m_inputModule     = GCM(InputModule::InputModule);
-    m_audioModule     = GCM(AudioModule::AudioModule);
-    m_ecsModule       = GCM(ECSModule::ECSModule);
-    m_resourceManager = GCM(ResourceModule::ResourceManager);
-    m_assetManager    = GCM(ResourceModule::AssetManager);
+    // Optional: headless hosts (tools, benchmarks) run without input, audio or the asset pipeline.
+    auto& locator     = Core::Locator();
+    m_inputModule     = locator.tryGet<InputModule::InputModule>().get();
+    m_audioModule     = locator.tryGet<AudioModule::AudioModule>().get();
+    m_ecsModule       = locator.tryGet<ECSModule::ECSModule>().get();
+    m_resourceManager = locator.tryGet<ResourceModule::ResourceManager>().get();
+    m_assetManager    = locator.tryGet<ResourceModule::AssetManager>().get();
 }
 
 void LuaScriptModule::initializeServices()
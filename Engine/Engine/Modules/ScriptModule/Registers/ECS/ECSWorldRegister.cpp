@@ -5,6 +5,8 @@
 #include <sol/state.hpp>
 
 #include <optional>
+#include <tuple>
+#include <vector>
 
 namespace ScriptModule
 {
@@ -21,6 +23,39 @@ flecs::world* ResolveWorld(IECSWorldScriptService* service)
 
     return &wrapper->get();
 }
+
+// Spatial queries and prefabs need the EntityWorld that owns @p w; scripts only ever see the current one
+EntityWorld* ResolveEntityWorld(IECSWorldScriptService* service, const flecs::world& w)
+{
+    EntityWorld* wrapper = service ? service->currentWorld() : nullptr;
+    if (!wrapper || wrapper->get().c_ptr() != w.c_ptr())
+        return nullptr;
+    return wrapper;
+}
+
+const ECSModule::SpatialIndex* ResolveSpatialIndex(IECSWorldScriptService* service, const flecs::world& w)
+{
+    EntityWorld* wrapper = ResolveEntityWorld(service, w);
+    return wrapper ? &wrapper->getSpatialIndex() : nullptr;
+}
+
+sol::table ToEntityTable(flecs::world& w, const std::vector<flecs::entity_t>& ids, sol::state_view lua)
+{
+    sol::table list = lua.create_table(static_cast<int>(ids.size()), 0);
+    for (flecs::entity_t id : ids)
+        list.add(w.entity(id));
+    return list;
+}
+
+ECSModule::SpatialIndex::Ray MakeRay(const glm::vec3& origin, const glm::vec3& direction,
+                                     const std::optional<float>& maxDistance)
+{
+    ECSModule::SpatialIndex::Ray ray;
+    ray.origin = origin;
+    ray.direction = glm::length(direction) > 0.0f ? glm::normalize(direction) : direction;
+    ray.maxDistance = maxDistance.value_or(ray.maxDistance);
+    return ray;
+}
 } // namespace
 
 void ECSWorldRegister::registerTypes(sol::state& state, sol::environment& env)
@@ -40,6 +75,25 @@ void ECSWorldRegister::registerTypes(sol::state& state, sol::environment& env)
                                             [](const std::string& str) -> ResourceModule::AssetID { return ResourceModule::AssetID(str); });
     env["AssetID"] = assetIDTable;
 
+    // Recorded now, applied by EntityWorld at its next sync point; safe from systems and batches
+    env.new_usertype<ECSModule::EntityCommandBuffer>(
+        "EntityCommandBuffer", sol::no_constructor,
+        "instantiate",
+        [](ECSModule::EntityCommandBuffer& commands, flecs::entity prefab, sol::optional<TransformComponent> transform)
+        {
+            const flecs::entity_t entity = commands.create(prefab.id());
+            if (transform)
+                commands.set(entity, *transform);
+        },
+        "destroy", [](ECSModule::EntityCommandBuffer& commands, flecs::entity entity) { commands.destroy(entity.id()); },
+        "set_transform",
+        [](ECSModule::EntityCommandBuffer& commands, flecs::entity entity, const TransformComponent& transform)
+        { commands.set(entity.id(), transform); },
+        "remove_transform",
+        [](ECSModule::EntityCommandBuffer& commands, flecs::entity entity)
+        { commands.remove<TransformComponent>(entity.id()); },
+        "size", &ECSModule::EntityCommandBuffer::size);
+
     env.new_usertype<flecs::world>(
         "World",
         "entity",
@@ -66,6 +120,137 @@ void ECSWorldRegister::registerTypes(sol::state& state, sol::environment& env)
         {
             if (entity.is_alive())
                 entity.destruct();
+        },
+        "commands",
+        [service = m_service](flecs::world& w) -> ECSModule::EntityCommandBuffer*
+        {
+            EntityWorld* wrapper = ResolveEntityWorld(service, w);
+            return wrapper ? &wrapper->commands() : nullptr;
+        },
+        "prefab",
+        [service = m_service](flecs::world& w, const std::string& source) -> sol::optional<flecs::entity>
+        {
+            EntityWorld* wrapper = ResolveEntityWorld(service, w);
+            flecs::entity prefab = wrapper ? wrapper->loadPrefab(source) : flecs::entity();
+            if (!prefab)
+                return sol::nullopt;
+            return prefab;
+        },
+        "spawn_batch",
+        [service = m_service](flecs::world& w, flecs::entity prefab, sol::object placement, sol::this_state ts)
+        {
+            std::vector<flecs::entity_t> ids;
+            EntityWorld* wrapper = ResolveEntityWorld(service, w);
+            if (!wrapper || !prefab.is_alive())
+                return ToEntityTable(w, ids, ts);
+
+            // A count keeps the prefab's transform; a list gives a position or a full transform each
+            if (placement.is<size_t>())
+            {
+                wrapper->spawnBatch(prefab, placement.as<size_t>(), nullptr, &ids);
+                return ToEntityTable(w, ids, ts);
+            }
+
+            const TransformComponent* base = prefab.get<TransformComponent>();
+            std::vector<TransformComponent> transforms;
+            if (placement.is<sol::table>())
+            {
+                sol::table list = placement.as<sol::table>();
+                transforms.reserve(list.size());
+                for (const auto& [key, value] : list)
+                {
+                    if (value.is<TransformComponent>())
+                    {
+                        transforms.push_back(value.as<TransformComponent>());
+                    }
+                    else if (value.is<glm::vec3>())
+                    {
+                        TransformComponent& transform = transforms.emplace_back(base ? *base : TransformComponent{});
+                        transform.position.fromGLMVec(value.as<glm::vec3>());
+                    }
+                }
+            }
+            wrapper->spawnBatch(prefab, transforms.size(), transforms.data(), &ids);
+            return ToEntityTable(w, ids, ts);
+        },
+        "query_box",
+        [service = m_service](flecs::world& w, const glm::vec3& min, const glm::vec3& max, sol::this_state ts)
+        {
+            std::vector<flecs::entity_t> ids;
+            if (const auto* index = ResolveSpatialIndex(service, w))
+                index->queryBox(Math::AABB(glm::min(min, max), glm::max(min, max)), ids);
+            return ToEntityTable(w, ids, ts);
+        },
+        "query_sphere",
+        [service = m_service](flecs::world& w, const glm::vec3& center, float radius, sol::this_state ts)
+        {
+            std::vector<flecs::entity_t> ids;
+            if (const auto* index = ResolveSpatialIndex(service, w))
+                index->querySphere(center, radius, ids);
+            return ToEntityTable(w, ids, ts);
+        },
+        "query_spheres",
+        [service = m_service](flecs::world& w, sol::table centers, float radius, sol::this_state ts)
+        {
+            sol::state_view lua(ts);
+            sol::table results = lua.create_table();
+            const auto* index = ResolveSpatialIndex(service, w);
+
+            std::vector<glm::vec4> spheres;
+            for (const auto& [key, value] : centers)
+            {
+                if (value.is<glm::vec3>())
+                    spheres.emplace_back(value.as<glm::vec3>(), radius);
+            }
+            std::vector<std::vector<flecs::entity_t>> ids;
+            if (index)
+                index->querySpheres(spheres, ids);
+            ids.resize(spheres.size());
+            for (const auto& list : ids)
+                results.add(ToEntityTable(w, list, lua));
+            return results;
+        },
+        "query_camera",
+        [service = m_service](flecs::world& w, flecs::entity camera, sol::this_state ts)
+        {
+            std::vector<flecs::entity_t> ids;
+            const auto* index = ResolveSpatialIndex(service, w);
+            const auto* transform = camera.is_alive() ? camera.get<TransformComponent>() : nullptr;
+            const auto* cam = camera.is_alive() ? camera.get<CameraComponent>() : nullptr;
+            if (index && transform && cam)
+            {
+                glm::vec3 position;
+                glm::quat rotation;
+                GetWorldPose(camera, *transform, position, rotation);
+                const glm::mat4 view = glm::inverse(Math::TRS(position, rotation, glm::vec3(1.0f)));
+                const glm::mat4 projection =
+                    glm::perspective(glm::radians(cam->fov), cam->aspect, cam->nearClip, cam->farClip);
+                index->queryFrustum(Math::Frustum::FromMatrix(projection * view), ids);
+            }
+            return ToEntityTable(w, ids, ts);
+        },
+        "raycast",
+        [service = m_service](flecs::world& w, const glm::vec3& origin, const glm::vec3& direction,
+                              std::optional<float> maxDistance) -> std::tuple<sol::optional<flecs::entity>, float>
+        {
+            ECSModule::SpatialIndex::RayHit hit;
+            const auto* index = ResolveSpatialIndex(service, w);
+            if (!index || !index->raycast(MakeRay(origin, direction, maxDistance), hit))
+                return {sol::nullopt, 0.0f};
+            return {w.entity(hit.entity), hit.distance};
+        },
+        "raycast_all",
+        [service = m_service](flecs::world& w, const glm::vec3& origin, const glm::vec3& direction,
+                              std::optional<float> maxDistance, sol::this_state ts)
+        {
+            sol::state_view lua(ts);
+            sol::table results = lua.create_table();
+            std::vector<ECSModule::SpatialIndex::RayHit> hits;
+            if (const auto* index = ResolveSpatialIndex(service, w))
+                index->raycastAll(MakeRay(origin, direction, maxDistance), hits);
+            for (const auto& hit : hits)
+                results.add(lua.create_table_with("entity", w.entity(hit.entity), "distance", hit.distance));
+            return results;
         });
 }
 } // namespace ScriptModule
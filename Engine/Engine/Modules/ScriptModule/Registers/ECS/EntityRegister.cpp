@@ -95,6 +95,49 @@ void EntityRegister::registerTypes(sol::state& state, sol::environment& env)
             e.modified<TransformComponent>();
         },
         "remove_scale", [](flecs::entity& e) { RemoveComponentIfPresent<TransformComponent>(e); },
+        "get_world_position",
+        [](flecs::entity& e) -> sol::optional<glm::vec3>
+        {
+            const TransformComponent* transform = e.get<TransformComponent>();
+            if (!transform)
+                return sol::nullopt;
+            glm::vec3 position;
+            glm::quat rotation;
+            GetWorldPose(e, *transform, position, rotation);
+            return position;
+        },
+        "get_world_rotation",
+        [](flecs::entity& e) -> sol::optional<RotationComponent>
+        {
+            const TransformComponent* transform = e.get<TransformComponent>();
+            if (!transform)
+                return sol::nullopt;
+            glm::vec3 position;
+            glm::quat rotation;
+            GetWorldPose(e, *transform, position, rotation);
+            RotationComponent result{};
+            result.fromQuat(rotation);
+            return result;
+        },
+        "get_parent",
+        [](const flecs::entity& e) -> sol::optional<flecs::entity>
+        {
+            const flecs::entity parent = e.parent();
+            if (parent.is_valid())
+                return parent;
+            return sol::nullopt;
+        },
+        "set_parent",
+        [](flecs::entity& e, sol::optional<flecs::entity> parent)
+        {
+            // The local transform is kept, so the world pose follows the new parent
+            if (parent && parent->is_alive())
+                e.child_of(*parent);
+            else
+                e.remove(flecs::ChildOf, flecs::Wildcard);
+            if (e.has<TransformComponent>())
+                e.modified<TransformComponent>();
+        },
         "has_camera", [](const flecs::entity& e) { return e.has<CameraComponent>(); },
         "get_camera",
         [](flecs::entity& e) -> sol::optional<CameraComponent>
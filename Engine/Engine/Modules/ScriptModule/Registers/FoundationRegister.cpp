@@ -1,18 +1,120 @@
 #include "FoundationRegister.h"
 
-#include "FoundationRegister.h"
-
 #include <Foundation/Log/LogVerbosity.h>
 #include <Foundation/Log/LoggerMacro.h>
+#include <Foundation/Metrics/Metrics.h>
+#include <Foundation/Profiler/FrameStats.h>
+
+#include <algorithm>
+#include <stdexcept>
 
 namespace ScriptModule
 {
 namespace
 {
 constexpr std::string_view kScriptLogCategory = "Script";
+
+std::optional<FrameStage> ParseScriptStage(const std::string& name)
+{
+    auto stage = FrameStats::ParseStage(name);
+    if (!stage)
+        LT_LOGFW_LIMIT(kScriptLogCategory.data(), 1, "Unknown frame stage '{}'", name);
+    return stage;
+}
+
+void RegisterFrameStats(sol::state& state, sol::environment& env)
+{
+    sol::table frameStats = state.create_table();
+    frameStats.set_function("getSummary", [](const std::string& stageName, sol::this_state ts) -> sol::object {
+        sol::state_view lua(ts);
+        auto stage = ParseScriptStage(stageName);
+        if (!stage)
+            return sol::make_object(lua, sol::lua_nil);
+        const FrameStageSummary summary = FrameStats::Instance().getSummary(*stage);
+        return sol::make_object(lua, lua.create_table_with("p50", summary.p50Ms, "p95", summary.p95Ms, "p99",
+                                                           summary.p99Ms, "max", summary.maxMs, "avg", summary.avgMs,
+                                                           "last", summary.lastMs, "budget", summary.budgetMs,
+                                                           "samples", summary.samples, "overruns", summary.overruns));
+    });
+    frameStats.set_function("getPercentile", [](const std::string& stageName, double percentile) {
+        auto stage = ParseScriptStage(stageName);
+        return stage ? FrameStats::Instance().getPercentile(*stage, percentile) : 0.0;
+    });
+    // Script budgets only log; callbacks would outlive the Lua state on reload.
+    frameStats.set_function("setBudget", [](const std::string& stageName, double budgetMs) {
+        if (auto stage = ParseScriptStage(stageName))
+            FrameStats::Instance().setBudget(*stage, budgetMs);
+    });
+    frameStats.set_function("clearBudget", [](const std::string& stageName) {
+        if (auto stage = ParseScriptStage(stageName))
+            FrameStats::Instance().clearBudget(*stage);
+    });
+    frameStats.set_function("getFrameCount", []() { return FrameStats::Instance().getFrameCount(); });
+    env["FrameStats"] = frameStats;
+}
+
+sol::object MetricValue(const Metric& metric, sol::state_view lua)
+{
+    switch (metric.type())
+    {
+    case MetricType::Counter:
+        return sol::make_object(lua, static_cast<const Counter&>(metric).value());
+    case MetricType::Gauge:
+        return sol::make_object(lua, static_cast<const Gauge&>(metric).value());
+    case MetricType::Histogram: {
+        const auto& histogram = static_cast<const Histogram&>(metric);
+        return sol::make_object(lua, lua.create_table_with("count", histogram.count(), "sum", histogram.sum()));
+    }
+    }
+    return sol::make_object(lua, sol::lua_nil);
+}
+
+// Scripts publish through the same registry as C++; a name reused with another type is logged, not thrown into Lua.
+template <typename Fn> void WithScriptMetric(const std::string& name, Fn&& fn)
+{
+    try
+    {
+        fn(MetricsRegistry::Instance());
+    }
+    catch (const std::logic_error& ex)
+    {
+        LT_LOGFW_LIMIT(kScriptLogCategory.data(), 1, "Metric '{}': {}", name, ex.what());
+    }
 }
 
-void FoundationRegister::registerTypes(sol::state&, sol::environment& env)
+void RegisterMetrics(sol::state& state, sol::environment& env)
+{
+    sol::table metrics = state.create_table();
+    metrics.set_function("add", [](const std::string& name, sol::optional<double> amount) {
+        WithScriptMetric(name, [&](MetricsRegistry& registry) {
+            registry.counter(name).add(static_cast<uint64_t>(std::max(amount.value_or(1.0), 0.0)));
+        });
+    });
+    metrics.set_function("set", [](const std::string& name, double value) {
+        WithScriptMetric(name, [&](MetricsRegistry& registry) { registry.gauge(name).set(value); });
+    });
+    metrics.set_function("observe", [](const std::string& name, double value) {
+        WithScriptMetric(name, [&](MetricsRegistry& registry) { registry.histogram(name).observe(value); });
+    });
+    metrics.set_function("get", [](const std::string& name, sol::this_state ts) -> sol::object {
+        sol::state_view lua(ts);
+        const Metric* metric = MetricsRegistry::Instance().find(name);
+        return metric ? MetricValue(*metric, lua) : sol::make_object(lua, sol::lua_nil);
+    });
+    metrics.set_function("list", [](sol::this_state ts) {
+        sol::state_view lua(ts);
+        sol::table list = lua.create_table();
+        MetricsRegistry::Instance().forEach([&](const Metric& metric) {
+            list.add(lua.create_table_with("name", metric.name(), "type", MetricTypeName(metric.type()), "help",
+                                           metric.help(), "value", MetricValue(metric, lua)));
+        });
+        return list;
+    });
+    env["Metrics"] = metrics;
+}
+} // namespace
+
+void FoundationRegister::registerTypes(sol::state& state, sol::environment& env)
 {
     env.set_function("LogInfo", [](const std::string& msg) { LT_LOG(LogVerbosity::Info, kScriptLogCategory.data(), msg); });
     env.set_function("LogDebug",
@@ -23,6 +125,9 @@ void FoundationRegister::registerTypes(sol::state&, sol::environment& env)
                     { LT_LOG(LogVerbosity::Warning, kScriptLogCategory.data(), msg); });
     env.set_function("LogError", [](const std::string& msg) { LT_LOG(LogVerbosity::Error, kScriptLogCategory.data(), msg); });
     env.set_function("LogFatal", [](const std::string& msg) { LT_LOG(LogVerbosity::Fatal, kScriptLogCategory.data(), msg); });
+
+    RegisterFrameStats(state, env);
+    RegisterMetrics(state, env);
 }
 } // namespace ScriptModule
 
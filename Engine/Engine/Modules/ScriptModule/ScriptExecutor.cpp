@@ -61,7 +61,7 @@ void ScriptExecutor::executeStart()
         if (!result.valid())
         {
             sol::error err = result;
-            LT_LOGE(kExecutorCategory.data(), std::format("[{}] Start() error: {}", m_name, err.what()));
+            LT_LOGFE(kExecutorCategory.data(), "[{}] Start() error: {}", m_name, err.what());
         }
         else
         {
@@ -95,7 +95,7 @@ void ScriptExecutor::executeUpdate(float deltaSeconds)
         if (!result.valid())
         {
             sol::error err = result;
-            LT_LOGE(kExecutorCategory.data(), std::format("[{}] Update() error: {}", m_name, err.what()));
+            LT_LOGFE(kExecutorCategory.data(), "[{}] Update() error: {}", m_name, err.what());
         }
         ++it;
     }
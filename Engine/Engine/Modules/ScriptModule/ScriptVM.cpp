@@ -40,7 +40,7 @@ bool ScriptVM::init()
     applySandbox();
 
     m_initialized = true;
-    LT_LOGI(kScriptVMLogCategory.data(), std::format("VM [{}] initialized", m_name));
+    LT_LOGFI(kScriptVMLogCategory.data(), "VM [{}] initialized", m_name);
     return true;
 }
 
@@ -53,7 +53,7 @@ void ScriptVM::shutdown()
     m_state = sol::state{};
     m_registers.clear();
     m_initialized = false;
-    LT_LOGI(kScriptVMLogCategory.data(), std::format("VM [{}] shutdown", m_name));
+    LT_LOGFI(kScriptVMLogCategory.data(), "VM [{}] shutdown", m_name);
 }
 
 bool ScriptVM::runString(const std::string& source)
@@ -190,7 +190,7 @@ bool ScriptVM::handleResult(const sol::protected_function_result& result, std::s
 
 void ScriptVM::logError(std::string_view message)
 {
-    LT_LOGE(kScriptVMLogCategory.data(), std::format("VM [{}] {}", m_name, message));
+    LT_LOGFE(kScriptVMLogCategory.data(), "VM [{}] {}", m_name, message);
 }
 
 } // namespace ScriptModule
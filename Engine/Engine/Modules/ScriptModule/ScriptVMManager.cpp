@@ -80,7 +80,7 @@ ScriptVM& ScriptVMManager::addCustomVM(std::string name, const ScriptVMProfile&
     vm->init();
     auto* raw = vm.get();
     m_customVMs.emplace(std::move(name), std::move(vm));
-    LT_LOGI(kVMManagerLogCategory.data(), std::format("Custom VM [{}] initialized", raw->name()));
+    LT_LOGFI(kVMManagerLogCategory.data(), "Custom VM [{}] initialized", raw->name());
     return *raw;
 }
 
@@ -100,7 +100,7 @@ ScriptVM& ScriptVMManager::createVM(ScriptVMType type, const ScriptVMProfile& pr
     vm->init();
     auto* raw = vm.get();
     m_vms[type] = std::move(vm);
-    LT_LOGI(kVMManagerLogCategory.data(), std::format("{} VM initialized", vmName));
+    LT_LOGFI(kVMManagerLogCategory.data(), "{} VM initialized", vmName);
     return *raw;
 }
 } // namespace ScriptModule
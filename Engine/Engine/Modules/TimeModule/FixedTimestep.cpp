@@ -0,0 +1,31 @@
+#include "FixedTimestep.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace TimeModule
+{
+    void FixedTimestep::configure(const FixedTimestepConfig& config) noexcept
+    {
+        m_config = config;
+        m_config.tickRate = std::max(1.0, config.tickRate);
+        m_config.maxStepsPerFrame = std::max<uint32_t>(1, config.maxStepsPerFrame);
+        m_stepSeconds = 1.0 / m_config.tickRate;
+        m_accumulator = 0.0;
+    }
+
+    uint32_t FixedTimestep::advance(double frameSeconds) noexcept
+    {
+        if (frameSeconds > 0.0)
+            m_accumulator += frameSeconds;
+
+        const double due = std::floor(m_accumulator / m_stepSeconds);
+        const uint32_t steps = static_cast<uint32_t>(std::min(due, static_cast<double>(m_config.maxStepsPerFrame)));
+        m_droppedSteps += static_cast<uint64_t>(due) - steps;
+
+        // Rounding can leave the remainder a hair outside [0, step)
+        m_accumulator = std::clamp(m_accumulator - due * m_stepSeconds, 0.0, std::nextafter(m_stepSeconds, 0.0));
+        m_totalSteps += steps;
+        return steps;
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+
+namespace TimeModule
+{
+    struct FixedTimestepConfig
+    {
+        double tickRate = 60.0;        ///< Simulation steps per second
+        uint32_t maxStepsPerFrame = 5; ///< Catch-up limit; frame time beyond it is dropped
+    };
+
+    /// <summary>
+    /// Turns variable frame times into a whole number of fixed simulation steps.
+    ///
+    /// Frame time goes into an accumulator and advance() returns how many steps of stepSeconds()
+    /// it now covers. What is left is less than a step; alpha() is that remainder as a fraction of
+    /// a step, i.e. how far the frame being rendered lies between the previous and the latest
+    /// simulated state. Steps beyond maxStepsPerFrame are dropped rather than carried over, so a
+    /// hitch slows the simulation down instead of making every following frame longer.
+    /// </summary>
+    class FixedTimestep
+    {
+        FixedTimestepConfig m_config;
+        double m_stepSeconds = 1.0 / 60.0;
+        double m_accumulator = 0.0;
+        uint64_t m_droppedSteps = 0;
+        uint64_t m_totalSteps = 0;
+
+    public:
+        FixedTimestep() noexcept = default;
+        explicit FixedTimestep(const FixedTimestepConfig& config) noexcept
+        {
+            configure(config);
+        }
+
+        /// <summary>
+        /// Tick rates below 1 Hz and a zero step limit are raised to 1. Drops accumulated time.
+        /// </summary>
+        void configure(const FixedTimestepConfig& config) noexcept;
+
+        /// <summary>
+        /// Adds a frame of @p frameSeconds and returns the steps to run for it.
+        /// </summary>
+        uint32_t advance(double frameSeconds) noexcept;
+
+        /// <summary>
+        /// Forgets accumulated time, e.g. when simulation starts, so the first frame does not catch up.
+        /// </summary>
+        void reset() noexcept
+        {
+            m_accumulator = 0.0;
+        }
+
+        const FixedTimestepConfig& getConfig() const noexcept
+        {
+            return m_config;
+        }
+
+        double stepSeconds() const noexcept
+        {
+            return m_stepSeconds;
+        }
+
+        /// <summary>
+        /// Interpolation factor in [0, 1] between the previous step and the latest one.
+        /// </summary>
+        float alpha() const noexcept
+        {
+            return static_cast<float>(m_accumulator / m_stepSeconds);
+        }
+
+        /// <summary>
+        /// Steps thrown away by the catch-up limit since construction.
+        /// </summary>
+        uint64_t droppedSteps() const noexcept
+        {
+            return m_droppedSteps;
+        }
+
+        uint64_t totalSteps() const noexcept
+        {
+            return m_totalSteps;
+        }
+    };
+}
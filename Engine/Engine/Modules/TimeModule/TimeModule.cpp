@@ -25,6 +25,19 @@ namespace TimeModule
         LT_LOGI("TimeModule", "Shutdown");
     }
 
+    void TimeModule::applyConfig(const TimeModuleConfig& config) noexcept
+    {
+        FixedTimestepConfig fixedStep = m_fixedStep.getConfig();
+        if (config.tickRate.has_value())
+            fixedStep.tickRate = *config.tickRate;
+        if (config.maxStepsPerFrame.has_value())
+            fixedStep.maxStepsPerFrame = *config.maxStepsPerFrame;
+        m_fixedStep.configure(fixedStep);
+
+        LT_LOGI("TimeModule", std::format("Fixed timestep: {} Hz, up to {} steps per frame",
+                                          m_fixedStep.getConfig().tickRate, m_fixedStep.getConfig().maxStepsPerFrame));
+    }
+
     void TimeModule::tick(float deltaTime) noexcept
     {
         if (!m_initialized || m_freq == 0)
@@ -4,9 +4,20 @@
 #include <SDL3/SDL.h>
 #include "TimeTimer.h"
 #include "TimeScheduler.h"
+#include "FixedTimestep.h"
+
+#include <optional>
 
 namespace TimeModule
 {
+    struct TimeModuleConfig
+    {
+        /// Fixed simulation rate in Hz, e.g. 30 on a server while clients render faster.
+        std::optional<double> tickRate;
+        /// Simulation steps a single frame may run to catch up.
+        std::optional<uint32_t> maxStepsPerFrame;
+    };
+
     /// <summary>
     /// </summary>
     class TimeModule : public IModule
@@ -20,6 +31,7 @@ namespace TimeModule
         bool m_initialized = false;
 
         TimeScheduler m_scheduler;
+        FixedTimestep m_fixedStep;
 
         struct Scheduled
         {
@@ -46,6 +58,10 @@ namespace TimeModule
         /// </summary>
         void shutdown() override;
 
+        /// <summary>
+        /// </summary>
+        void applyConfig(const TimeModuleConfig& config) noexcept;
+
         /// <summary>
         /// </summary>
         void tick(float deltaTime = 0.0f) noexcept;
@@ -110,6 +126,21 @@ namespace TimeModule
             return m_scheduler;
         }
 
+        /// <summary>
+        /// Accumulator driving the simulation steps of the main loop.
+        /// </summary>
+        FixedTimestep& getFixedTimestep() noexcept
+        {
+            return m_fixedStep;
+        }
+
+        /// <summary>
+        /// </summary>
+        const FixedTimestep& getFixedTimestep() const noexcept
+        {
+            return m_fixedStep;
+        }
+
         /// <summary>
         /// </summary>
         static TimeTimer createTimer() noexcept
@@ -40,7 +40,7 @@ static GLuint compileShader(GLenum type, const char* src)
             std::string log;
             log.resize(static_cast<size_t>(logLen));
             glGetShaderInfoLog(shader, logLen, nullptr, log.data());
-            LT_LOGE("NuklearBackend", std::format("Shader compile error: {}", log));
+            LT_LOGFE("NuklearBackend", "Shader compile error: {}", log);
         }
         glDeleteShader(shader);
         return 0;
@@ -77,7 +77,7 @@ static GLuint createProgram(const char* vsSrc, const char* fsSrc)
             std::string log;
             log.resize(static_cast<size_t>(logLen));
             glGetProgramInfoLog(prog, logLen, nullptr, log.data());
-            LT_LOGE("NuklearBackend", std::format("Program link error: {}", log));
+            LT_LOGFE("NuklearBackend", "Program link error: {}", log);
         }
         glDeleteProgram(prog);
         prog = 0;
@@ -26,6 +26,13 @@
 #include <Modules/WindowModule/Window.h>
 #include <Modules/WindowModule/WindowModule.h>
 #include <Foundation/Diagnostics/ThreadDiagnostics.h>
+#include <Foundation/Log/BinaryLogSink.h>
+#include <Foundation/Metrics/EngineMetrics.h>
+#include <Foundation/Metrics/MetricsExporter.h>
+#include <Foundation/Profiler/FrameStats.h>
+#include <Foundation/Profiler/HitchRecorder.h>
+
+#include <cstdlib>
 
 void Application::run()
 {
@@ -47,6 +54,58 @@ void Application::startupMinor()
 
     LT_LOG(LogVerbosity::Info, "Engine", "StartupMinor");
 
+    // Move sink I/O off the calling threads; crash handlers drain whatever is still queued.
+    LTLogger::Instance().startAsync();
+    InstallLogCrashHandlers();
+
+    // Per-category runtime levels, e.g. LAMPY_LOG_LEVELS="Renderer=Warning,*=Info"
+    if (const char* levels = std::getenv("LAMPY_LOG_LEVELS"))
+    {
+        if (!LogCategoryRegistry::Instance().configure(levels))
+            LT_LOGW("Engine", "LAMPY_LOG_LEVELS contains invalid entries");
+    }
+
+    // Binary log segments for offline decoding (Tools/LogDecoder), e.g. LAMPY_BINARY_LOG=Logs
+    if (const char* binaryLogDir = std::getenv("LAMPY_BINARY_LOG"))
+    {
+        BinaryLogSinkConfig binaryLog;
+        binaryLog.directory = binaryLogDir;
+        LTLogger::Instance().addSink(std::make_shared<BinaryLogSink>(binaryLog));
+    }
+
+    // Headless CPU capture without Tracy, e.g. LAMPY_PROFILE_FRAMES=300 LAMPY_PROFILE_OUTPUT=trace.json
+    CpuProfiler::SetThreadName("Main");
+    if (const char* frames = std::getenv("LAMPY_PROFILE_FRAMES"))
+    {
+        const char* output = std::getenv("LAMPY_PROFILE_OUTPUT");
+        CpuProfiler::RequestCapture(static_cast<uint32_t>(std::strtoul(frames, nullptr, 10)),
+                                    output ? output : "cpu_profile.json");
+    }
+
+    // Flight recorder for rare hitches, e.g. LAMPY_HITCH_BUDGET_MS=50 LAMPY_HITCH_FRAMES=120
+    if (const char* budget = std::getenv("LAMPY_HITCH_BUDGET_MS"))
+    {
+        HitchRecorderConfig hitches;
+        hitches.budgetMs = std::strtod(budget, nullptr);
+        if (const char* frames = std::getenv("LAMPY_HITCH_FRAMES"))
+            hitches.frames = static_cast<uint32_t>(std::strtoul(frames, nullptr, 10));
+        HitchRecorder::Enable(hitches);
+    }
+
+    // OpenMetrics snapshots for a local scraper, e.g. LAMPY_METRICS_SOCKET=/tmp/lampy.metrics
+    // or LAMPY_METRICS_FILE=Logs/metrics.txt, every LAMPY_METRICS_INTERVAL_MS (default 1000)
+    const char* metricsFile = std::getenv("LAMPY_METRICS_FILE");
+    const char* metricsSocket = std::getenv("LAMPY_METRICS_SOCKET");
+    if (metricsFile || metricsSocket)
+    {
+        MetricsExporterConfig metrics;
+        metrics.filePath = metricsFile ? metricsFile : "";
+        metrics.socketPath = metricsSocket ? metricsSocket : "";
+        if (const char* interval = std::getenv("LAMPY_METRICS_INTERVAL_MS"))
+            metrics.intervalMs = static_cast<uint32_t>(std::strtoul(interval, nullptr, 10));
+        MetricsExporter::Start(metrics);
+    }
+
     // Initialize memory system first, before anything else
     using namespace EngineCore::Foundation;
     MemorySystem::startup(1024 * 1024 * 1024);
@@ -74,8 +133,19 @@ void Application::startupMajor()
 
     LT_LOG(LogVerbosity::Info, "Engine", "StartupMajor");
 
-    Core::Register(std::make_shared<JobSystem>(), 0);
-    Core::Register(std::make_shared<TimeModule::TimeModule>(), 1);
+    auto jobSystem = std::make_shared<JobSystem>();
+    Core::Register(jobSystem, 0);
+    AddEngineMetricCollectors(jobSystem.get());
+    auto timeModule = std::make_shared<TimeModule::TimeModule>();
+    m_moduleConfigRegistry.applyConfig(*timeModule);
+    // Simulation rate override on top of the application's config, e.g. LAMPY_TICK_RATE=30 for a server
+    if (const char* tickRate = std::getenv("LAMPY_TICK_RATE"))
+    {
+        TimeModule::TimeModuleConfig timeCfg;
+        timeCfg.tickRate = std::strtod(tickRate, nullptr);
+        timeModule->applyConfig(timeCfg);
+    }
+    Core::Register(timeModule, 1);
 
     using namespace EngineCore::Foundation;
     namespace fs = std::filesystem;
@@ -133,7 +203,9 @@ void Application::startupMajor()
     Core::Register(renderModule, 40);
     Core::Register(std::make_shared<UIModule::UIModule>(), 42);
     Core::Register(std::make_shared<ImGUIModule::ImGUIModule>(), 45);
-    Core::Register(std::make_shared<ECSModule::ECSModule>(), 50);
+    auto ecsModule = std::make_shared<ECSModule::ECSModule>();
+    m_moduleConfigRegistry.applyConfig(*ecsModule);
+    Core::Register(ecsModule, 50);
     Core::Register(std::make_shared<PhysicsModule::PhysicsModule>(), 55);
     Core::Register(std::make_shared<ScriptModule::LuaScriptModule>(), 60);
     Core::StartupAll();
@@ -146,6 +218,8 @@ void Application::shutdown()
     ZoneScopedN("Engine::shutdown");
 
     LT_LOG(LogVerbosity::Info, "Engine", "Shutdown");
+    // Collectors read the job and memory systems; publish the final snapshot while they still exist.
+    MetricsExporter::Stop();
     m_contextLocator->shutdownAll();
     Core::ShutdownAll();
     EngineCore::Foundation::Diagnostics::LogActiveThreads("After Core::ShutdownAll");
@@ -153,6 +227,9 @@ void Application::shutdown()
     // Shutdown memory system last
     using namespace EngineCore::Foundation;
     MemorySystem::shutdown();
+
+    HitchRecorder::Disable();
+    LTLogger::Instance().stopAsync();
 }
 
 void Application::engineTick()
@@ -167,10 +244,14 @@ void Application::engineTick()
     while (!window->shouldClose())
     {
         FrameMark;
+        CpuProfiler::FrameBoundary();
+        HitchRecorder::FrameBoundary();
+        SampleEngineMetrics();
         TracyMessage("BFrame", 5);
 
         {
             ZoneScopedN("Tick");
+            FrameStageTimer frameTimer(FrameStage::Frame);
             auto now = clock::now();
             double rawDt = std::chrono::duration<double>(now - prevTime).count();
             prevTime = now;
@@ -185,45 +266,86 @@ void Application::engineTick()
             if (m_assetManager)
             {
                 ZoneScopedN("Tick/ProcessAssetChanges");
+                FrameStageTimer stageTimer(FrameStage::AssetChanges);
                 m_assetManager->processFileChanges();
             }
 
+            uint32_t simulationSteps = 0;
+            float stepDeltaTime = 0.0f;
+            float interpolationAlpha = 1.0f;
             {
                 ZoneScopedN("Tick/TimeTick");
+                FrameStageTimer stageTimer(FrameStage::Time);
                 auto *timeModule = GCM(TimeModule::TimeModule);
                 timeModule->tick(deltaTime);
                 deltaTime = timeModule->getDeltaTime();
-            }
 
-            {
-                ZoneScopedN("Tick/ECSTick");
-                // ECS tick runs all systems in OnUpdate phase
-                // SyncToPhysics runs (synchronizes ECS -> Physics)
-                // SyncFromPhysics also runs (synchronizes Physics -> ECS from previous frame)
-                m_ecsModule->ecsTick(deltaTime);
+                auto &fixedStep = timeModule->getFixedTimestep();
+                const uint64_t droppedBefore = fixedStep.droppedSteps();
+                simulationSteps = fixedStep.advance(deltaTime);
+                stepDeltaTime = static_cast<float>(fixedStep.stepSeconds());
+                interpolationAlpha = fixedStep.alpha();
+                if (fixedStep.droppedSteps() > droppedBefore)
+                    LT_METRIC_COUNTER_ADD("simulation_dropped_steps", "Fixed steps skipped by the catch-up limit",
+                                          fixedStep.droppedSteps() - droppedBefore);
+                LT_METRIC_GAUGE_SET("simulation_steps_per_frame", "Fixed simulation steps run last frame",
+                                    simulationSteps);
             }
 
             {
-                ZoneScopedN("Tick/PhysicsTick");
-                // Physics step runs after ECS tick
-                // SyncFromPhysics will sync results on next frame
-                m_physicsModule->tick(deltaTime);
+                ZoneScopedN("Tick/Simulation");
+                // Each fixed step runs ECS, then physics. SyncToPhysics runs in the ECS tick
+                // (ECS -> Physics); SyncFromPhysics picks up the previous step's physics results.
+                // The ECS and Physics stages get one sample per frame covering all of its steps.
+                std::chrono::duration<double, std::milli> ecsTime{0.0};
+                std::chrono::duration<double, std::milli> physicsTime{0.0};
+                for (uint32_t step = 0; step < simulationSteps; ++step)
+                {
+                    const auto ecsStart = clock::now();
+                    {
+                        ZoneScopedN("Tick/ECSTick");
+                        // The renderer blends over the last step only
+                        if (step > 0 && step + 1 == simulationSteps)
+                            m_ecsModule->collectStepStart();
+                        m_ecsModule->ecsTick(stepDeltaTime);
+                    }
+                    const auto physicsStart = clock::now();
+                    {
+                        ZoneScopedN("Tick/PhysicsTick");
+                        m_physicsModule->tick(stepDeltaTime);
+                    }
+                    ecsTime += physicsStart - ecsStart;
+                    physicsTime += clock::now() - physicsStart;
+                }
+
+                const auto publishStart = clock::now();
+                m_ecsModule->emitRenderFrameData(simulationSteps, interpolationAlpha);
+                ecsTime += clock::now() - publishStart;
+
+                FrameStats::Instance().record(FrameStage::ECS, ecsTime.count());
+                FrameStats::Instance().record(FrameStage::Physics, physicsTime.count());
             }
 
             {
                 ZoneScopedN("Tick/ContextTick");
+                FrameStageTimer stageTimer(FrameStage::Context);
                 tick(deltaTime);
             }
             {
                 ZoneScopedN("Tick/Render");
+                FrameStageTimer stageTimer(FrameStage::Render);
                 m_renderModule->getRenderer()->render();
             }
             {
                 ZoneScopedN("Tick/ContextRender");
+                FrameStageTimer stageTimer(FrameStage::ContextRender);
                 render();
             }
-            
-            m_windowModule->getWindow()->swapWindow();
+            {
+                ZoneScopedN("Tick/Swap");
+                FrameStageTimer stageTimer(FrameStage::Swap);
+                m_windowModule->getWindow()->swapWindow();
+            }
 
             // Reset frame allocator at end of frame
             MemorySystem::resetFrameAllocator();
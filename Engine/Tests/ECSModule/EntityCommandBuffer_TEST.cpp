@@ -0,0 +1,234 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include <Modules/ObjectCoreModule/ECS/EntityCommandBuffer.h>
+#include <Modules/ObjectCoreModule/ECS/Components/ECSComponents.h>
+#include <Foundation/JobSystem/JobSystem.h>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ECSModule;
+using ECSModuleTest::Helpers::MakeTransform;
+
+namespace
+{
+struct Payload
+{
+    std::shared_ptr<int> counter;
+    std::string label;
+};
+
+struct Marker
+{
+};
+
+struct Big
+{
+    float values[EntityCommandBuffer::kPageSize / sizeof(float) * 2];
+};
+} // namespace
+
+TEST(EntityCommandBufferTest, RecordsWithoutTouchingTheWorld)
+{
+    flecs::world ecs;
+    flecs::entity doomed = ecs.entity().set<TransformComponent>(MakeTransform(1.0f));
+    flecs::entity kept = ecs.entity().set<TransformComponent>(MakeTransform(2.0f)).add<Marker>();
+
+    EntityCommandBuffer commands;
+    const flecs::entity_t created = commands.create();
+    commands.set(created, MakeTransform(5.0f));
+    commands.add<Marker>(created);
+    commands.destroy(doomed.id());
+    commands.remove<Marker>(kept.id());
+    commands.set(kept.id(), Payload{nullptr, "kept"});
+
+    EXPECT_TRUE(EntityCommandBuffer::IsPlaceholder(created));
+    EXPECT_EQ(commands.size(), 6u);
+    EXPECT_TRUE(doomed.is_alive());
+    EXPECT_TRUE(kept.has<Marker>());
+
+    EXPECT_EQ(commands.playback(ecs), 6u);
+    EXPECT_TRUE(commands.empty());
+
+    EXPECT_FALSE(doomed.is_alive());
+    EXPECT_FALSE(kept.has<Marker>());
+    EXPECT_EQ(kept.get<Payload>()->label, "kept");
+
+    int withMarker = 0;
+    ecs.each([&](flecs::entity e, const Marker&) {
+        ++withMarker;
+        EXPECT_FLOAT_EQ(e.get<TransformComponent>()->position.x, 5.0f);
+    });
+    EXPECT_EQ(withMarker, 1);
+}
+
+TEST(EntityCommandBufferTest, CommandsOnDestroyedEntitiesAreSkipped)
+{
+    flecs::world ecs;
+    flecs::entity e = ecs.entity();
+
+    EntityCommandBuffer commands;
+    commands.destroy(e.id());
+    commands.set(e.id(), MakeTransform(1.0f));
+    EXPECT_EQ(commands.playback(ecs), 2u);
+    EXPECT_FALSE(e.is_alive());
+}
+
+TEST(EntityCommandBufferTest, ClearDestroysUnplayedValues)
+{
+    auto counter = std::make_shared<int>(0);
+    EntityCommandBuffer commands;
+    for (int i = 0; i < 100; ++i)
+        commands.set(flecs::entity_t(1), Payload{counter, std::string(200, 'x')});
+    EXPECT_EQ(counter.use_count(), 101);
+    EXPECT_GT(commands.arenaBytes(), 0u);
+
+    commands.clear();
+    EXPECT_EQ(counter.use_count(), 1);
+    EXPECT_EQ(commands.arenaBytes(), 0u);
+}
+
+TEST(EntityCommandBufferTest, LargeValuesGetTheirOwnPage)
+{
+    flecs::world ecs;
+    flecs::entity e = ecs.entity();
+    auto big = std::make_unique<Big>();
+    big->values[0] = 3.0f;
+
+    EntityCommandBuffer commands;
+    commands.set(e.id(), *big);
+    commands.playback(ecs);
+    EXPECT_FLOAT_EQ(e.get<Big>()->values[0], 3.0f);
+}
+
+TEST(EntityCommandQueueTest, SortKeysOrderThreadsDeterministically)
+{
+    flecs::world ecs;
+    flecs::entity target = ecs.entity();
+    EntityCommandQueue queue;
+
+    // Whichever thread records first, the higher key is applied last and wins
+    std::thread late([&] {
+        auto& commands = queue.local();
+        commands.setSortKey(2);
+        commands.set(target.id(), MakeTransform(2.0f));
+    });
+    late.join();
+    std::thread early([&] {
+        auto& commands = queue.local();
+        commands.setSortKey(1);
+        commands.set(target.id(), MakeTransform(1.0f));
+    });
+    early.join();
+
+    EXPECT_EQ(queue.size(), 2u);
+    EXPECT_EQ(queue.playback(ecs), 2u);
+    EXPECT_FLOAT_EQ(target.get<TransformComponent>()->position.x, 2.0f);
+    EXPECT_EQ(queue.size(), 0u);
+}
+
+TEST(EntityCommandQueueTest, PlayingThreadGoesFirstWithinAKey)
+{
+    flecs::world ecs;
+    flecs::entity target = ecs.entity();
+    EntityCommandQueue queue;
+
+    // The job's buffer is created first, but the playing thread's commands lead within key 5
+    std::thread job([&] { queue.local(5).set(target.id(), MakeTransform(2.0f)); });
+    job.join();
+    queue.local(5).set(target.id(), MakeTransform(1.0f));
+
+    EXPECT_EQ(queue.playback(ecs), 2u);
+    EXPECT_FLOAT_EQ(target.get<TransformComponent>()->position.x, 2.0f);
+
+    // Keys do not outlive the playback
+    queue.local().set(target.id(), MakeTransform(3.0f));
+    std::thread later([&] { queue.local(1).set(target.id(), MakeTransform(4.0f)); });
+    later.join();
+    queue.playback(ecs);
+    EXPECT_FLOAT_EQ(target.get<TransformComponent>()->position.x, 4.0f);
+}
+
+TEST(EntityCommandQueueTest, UnkeyedJobCommandsAreDropped)
+{
+    flecs::world ecs;
+    flecs::entity target = ecs.entity();
+    EntityCommandQueue queue;
+
+    // Two jobs without keys would tie on key 0 and apply in thread order; neither is applied
+    std::thread first([&] { queue.local().set(target.id(), MakeTransform(1.0f)); });
+    first.join();
+    std::thread second([&] {
+        auto& commands = queue.local();
+        commands.set(target.id(), MakeTransform(2.0f));
+        commands.add<Marker>(target.id());
+    });
+    second.join();
+    queue.local().add<Marker>(target.id());
+
+    EXPECT_EQ(queue.size(), 4u);
+    EXPECT_EQ(queue.playback(ecs), 1u);
+    EXPECT_TRUE(target.has<Marker>());
+    EXPECT_FALSE(target.has<TransformComponent>());
+    EXPECT_EQ(queue.size(), 0u);
+
+    // Only-unkeyed job commands are still cleared
+    std::thread third([&] { queue.local().set(target.id(), MakeTransform(3.0f)); });
+    third.join();
+    EXPECT_EQ(queue.playback(ecs), 0u);
+    EXPECT_EQ(queue.size(), 0u);
+    EXPECT_FALSE(target.has<TransformComponent>());
+}
+
+TEST(EntityCommandQueueTest, PlaceholdersResolveAcrossBuffers)
+{
+    flecs::world ecs;
+    EntityCommandQueue queue;
+
+    flecs::entity_t placeholder = 0;
+    std::thread creator([&] { placeholder = queue.local(1).create(); });
+    creator.join();
+
+    queue.local().set(placeholder, MakeTransform(7.0f));
+    queue.playback(ecs);
+
+    int count = 0;
+    ecs.each([&](flecs::entity, const TransformComponent& transform) {
+        ++count;
+        EXPECT_FLOAT_EQ(transform.position.x, 7.0f);
+    });
+    EXPECT_EQ(count, 1);
+}
+
+TEST(EntityCommandQueueTest, JobsRecordAndPlaybackFollowsSortKeys)
+{
+    flecs::world ecs;
+    EntityCommandQueue queue;
+
+    EngineCore::Foundation::JobSystem jobs;
+    jobs.setWorkerCount(4);
+    jobs.startup();
+
+    constexpr size_t kCount = 4000;
+    auto record = [&](size_t i) {
+        auto& commands = queue.local();
+        commands.setSortKey(static_cast<uint32_t>(i));
+        commands.set(commands.create(), MakeTransform(static_cast<float>(i)));
+    };
+    jobs.parallel_for(size_t(0), kCount, record, 250);
+    jobs.shutdown();
+
+    EXPECT_EQ(queue.playback(ecs), kCount * 2);
+
+    // Created in key order, so entity ids ascend with the recorded index
+    std::vector<std::pair<flecs::entity_t, float>> created;
+    ecs.each([&](flecs::entity e, const TransformComponent& transform) {
+        created.emplace_back(e.id(), transform.position.x);
+    });
+    ASSERT_EQ(created.size(), kCount);
+    std::sort(created.begin(), created.end());
+    for (size_t i = 0; i < created.size(); ++i)
+        EXPECT_FLOAT_EQ(created[i].second, static_cast<float>(i));
+}
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include <Modules/ObjectCoreModule/ECS/EntityWorld.h>
+#include <Modules/ObjectCoreModule/ECS/FlecsJobBridge.h>
+#include <Modules/ObjectCoreModule/ECS/Components/ECSComponents.h>
+#include <Foundation/JobSystem/JobSystem.h>
+#include <memory>
+#include <string>
+
+using namespace ECSModule;
+using EngineCore::Foundation::JobSystem;
+
+namespace
+{
+struct VisitedTag
+{
+};
+} // namespace
+
+class MultiThreadedSystemsTest : public ECSModuleTest::EntityWorldTestBase
+{
+protected:
+    void SetUp() override
+    {
+        EntityWorldTestBase::SetUp();
+        world = makeWorld();
+    }
+
+    void TearDown() override
+    {
+        world.reset();
+        FlecsJobBridge::Uninstall();
+        if (jobs)
+        {
+            jobs->shutdown();
+            jobs.reset();
+        }
+        EntityWorldTestBase::TearDown();
+    }
+
+    bool startJobs(size_t workers)
+    {
+        jobs = std::make_unique<JobSystem>();
+        jobs->setWorkerCount(workers);
+        jobs->startup();
+        return FlecsJobBridge::Install(jobs.get());
+    }
+
+    std::unique_ptr<EntityWorld> world;
+    std::unique_ptr<JobSystem> jobs;
+};
+
+TEST_F(MultiThreadedSystemsTest, TaskThreadsNeedTheBridge)
+{
+    ASSERT_FALSE(FlecsJobBridge::IsInstalled());
+    world->setTaskThreads(4);
+    EXPECT_EQ(world->getTaskThreads(), 0);
+
+    // Still ticks normally on the calling thread.
+    world->tick(1.0f / 60.0f);
+}
+
+TEST_F(MultiThreadedSystemsTest, MultiThreadedSystemVisitsEveryEntityOnce)
+{
+    if (JobSystem::kJobSystemDisabled)
+        GTEST_SKIP() << "Built with ENGINE_DISABLE_JOB_SYSTEM";
+    ASSERT_TRUE(startJobs(3));
+    EXPECT_EQ(FlecsJobBridge::StageCount(), 4u);
+
+    world->setTaskThreads(static_cast<int32_t>(FlecsJobBridge::StageCount()));
+    EXPECT_EQ(world->getTaskThreads(), 4);
+
+    flecs::world& ecs = world->get();
+    constexpr int kEntities = 10000;
+    for (int i = 0; i < kEntities; ++i)
+        ecs.entity().set<TransformComponent>(TransformComponent{});
+
+    ecs.system<TransformComponent>("TestParallelMove")
+        .kind(flecs::OnUpdate)
+        .multi_threaded()
+        .each([](flecs::entity e, TransformComponent& transform) {
+            transform.position.x += 1.0f;
+            // Structural change from a worker stage; merged at the next sync point.
+            e.add<VisitedTag>();
+        });
+
+    constexpr int kFrames = 3;
+    for (int frame = 0; frame < kFrames; ++frame)
+        world->tick(1.0f / 60.0f);
+
+    int moved = 0;
+    ecs.each([&](flecs::entity e, const TransformComponent& transform) {
+        if (e.name() && std::string(e.name()) == "ViewportCamera")
+            return;
+        EXPECT_FLOAT_EQ(transform.position.x, static_cast<float>(kFrames));
+        EXPECT_TRUE(e.has<VisitedTag>());
+        ++moved;
+    });
+    EXPECT_EQ(moved, kEntities);
+    EXPECT_GT(jobs->getStatistics().jobsExecuted, 0u);
+}
+
+TEST_F(MultiThreadedSystemsTest, TaskThreadsSurviveReset)
+{
+    if (JobSystem::kJobSystemDisabled)
+        GTEST_SKIP() << "Built with ENGINE_DISABLE_JOB_SYSTEM";
+    ASSERT_TRUE(startJobs(2));
+
+    world->setTaskThreads(3);
+    world->reset();
+    EXPECT_EQ(world->getTaskThreads(), 3);
+    EXPECT_EQ(world->get().get_stage_count(), 3);
+    world->tick(1.0f / 60.0f);
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include <Modules/ObjectCoreModule/ECS/PrefabLibrary.h>
+#include <Modules/ObjectCoreModule/ECS/Components/ECSComponents.h>
+#include <vector>
+
+using namespace ECSModule;
+using ECSModuleTest::Helpers::MakeTransform;
+
+namespace
+{
+constexpr const char* kPrefabJson =
+    R"({"components": {"TransformComponent": {"position": {"x": 3, "y": 0, "z": 0}, "scale": {"x": 1, "y": 1, "z": 1}}}})";
+} // namespace
+
+class PrefabLibraryTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // Reflection as EntityWorld registers it, so prefab JSON can be read
+        ecs.component<PositionComponent>().member<float>("x").member<float>("y").member<float>("z");
+        ecs.component<RotationComponent>()
+            .member<float>("x")
+            .member<float>("y")
+            .member<float>("z")
+            .member<float>("qx")
+            .member<float>("qy")
+            .member<float>("qz")
+            .member<float>("qw");
+        ecs.component<ScaleComponent>().member<float>("x").member<float>("y").member<float>("z");
+        ecs.component<TransformComponent>()
+            .member<PositionComponent>("position")
+            .member<RotationComponent>("rotation")
+            .member<ScaleComponent>("scale");
+        ecs.component<TransformComponent>().add(flecs::With, ecs.component<WorldTransformComponent>());
+    }
+
+    flecs::world ecs;
+    PrefabLibrary prefabs;
+};
+
+TEST_F(PrefabLibraryTest, CreateFromJsonAndFind)
+{
+    flecs::entity prefab = prefabs.create(ecs, "Prefabs/projectile.lprefab", kPrefabJson);
+    ASSERT_TRUE(prefab.is_alive());
+    EXPECT_TRUE(prefab.has(flecs::Prefab));
+    EXPECT_FLOAT_EQ(prefab.get<TransformComponent>()->position.x, 3.0f);
+
+    EXPECT_EQ(prefabs.find(ecs, "Prefabs/projectile.lprefab").id(), prefab.id());
+    EXPECT_FALSE(prefabs.find(ecs, "Prefabs/missing.lprefab"));
+
+    prefab.destruct();
+    EXPECT_FALSE(prefabs.find(ecs, "Prefabs/projectile.lprefab"));
+    EXPECT_EQ(prefabs.size(), 0u);
+}
+
+TEST_F(PrefabLibraryTest, SpawnPlacesInstancesInOneTable)
+{
+    flecs::entity prefab = prefabs.create(ecs, "crowd", kPrefabJson);
+
+    std::vector<TransformComponent> transforms;
+    for (int i = 0; i < 1000; ++i)
+        transforms.push_back(MakeTransform(static_cast<float>(i)));
+
+    std::vector<flecs::entity_t> ids;
+    ASSERT_EQ(PrefabLibrary::Spawn(ecs, prefab, transforms.size(), transforms.data(), ids), transforms.size());
+    ASSERT_EQ(ids.size(), transforms.size());
+
+    const ecs_table_t* table = ecs_get_table(ecs.c_ptr(), ids.front());
+    for (size_t i = 0; i < ids.size(); ++i)
+    {
+        flecs::entity e = ecs.entity(ids[i]);
+        ASSERT_TRUE(e.is_alive());
+        EXPECT_TRUE(e.has(flecs::IsA, prefab));
+        EXPECT_TRUE(e.owns<TransformComponent>());
+        EXPECT_TRUE(e.has<WorldTransformComponent>());
+        EXPECT_FLOAT_EQ(e.get<TransformComponent>()->position.x, static_cast<float>(i));
+        EXPECT_EQ(ecs_get_table(ecs.c_ptr(), ids[i]), table);
+    }
+    EXPECT_FLOAT_EQ(prefab.get<TransformComponent>()->position.x, 3.0f);
+}
+
+TEST_F(PrefabLibraryTest, SpawnWithoutTransformsCopiesThePrefabs)
+{
+    flecs::entity prefab = prefabs.create(ecs, "crate", kPrefabJson);
+
+    std::vector<flecs::entity_t> ids;
+    PrefabLibrary::Spawn(ecs, prefab, 3, nullptr, ids);
+    ASSERT_EQ(ids.size(), 3u);
+
+    flecs::entity first = ecs.entity(ids[0]);
+    ASSERT_TRUE(first.owns<TransformComponent>());
+    EXPECT_FLOAT_EQ(first.get<TransformComponent>()->position.x, 3.0f);
+
+    // Instances own their copy
+    first.get_mut<TransformComponent>()->position.x = 8.0f;
+    EXPECT_FLOAT_EQ(ecs.entity(ids[1]).get<TransformComponent>()->position.x, 3.0f);
+    EXPECT_FLOAT_EQ(prefab.get<TransformComponent>()->position.x, 3.0f);
+}
+
+TEST_F(PrefabLibraryTest, ObserversSeeOneRangePerBatch)
+{
+    // No transform on the prefab: the only OnSet comes from the spawned column
+    flecs::entity prefab = prefabs.create(ecs, "marker", R"({"components": {}})");
+    ASSERT_TRUE(prefab.is_alive());
+
+    int ranges = 0;
+    int entities = 0;
+    ecs.observer<const TransformComponent>().event(flecs::OnSet).run([&](flecs::iter& it) {
+        while (it.next())
+        {
+            ++ranges;
+            entities += it.count();
+        }
+    });
+
+    std::vector<TransformComponent> transforms(500, MakeTransform(1.0f));
+    std::vector<flecs::entity_t> ids;
+    PrefabLibrary::Spawn(ecs, prefab, transforms.size(), transforms.data(), ids);
+
+    EXPECT_EQ(entities, 500);
+    EXPECT_EQ(ranges, 1);
+}
+
+TEST_F(PrefabLibraryTest, DeferredSpawnIsQueued)
+{
+    flecs::entity prefab = prefabs.create(ecs, "deferred", kPrefabJson);
+    std::vector<TransformComponent> transforms = {MakeTransform(-1.0f), MakeTransform(-2.0f)};
+    std::vector<flecs::entity_t> ids;
+
+    ecs.defer_begin();
+    EXPECT_EQ(PrefabLibrary::Spawn(ecs, prefab, transforms.size(), transforms.data(), ids), 2u);
+    ecs.defer_end();
+
+    ASSERT_EQ(ids.size(), 2u);
+    EXPECT_TRUE(ecs.entity(ids[1]).has(flecs::IsA, prefab));
+    EXPECT_FLOAT_EQ(ecs.entity(ids[1]).get<TransformComponent>()->position.x, -2.0f);
+}
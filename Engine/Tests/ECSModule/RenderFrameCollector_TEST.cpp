@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include <Modules/ObjectCoreModule/ECS/RenderFrameCollector.h>
+#include <Modules/ObjectCoreModule/ECS/TransformHierarchy.h>
+#include <Modules/ObjectCoreModule/ECS/Components/ECSComponents.h>
+#include <algorithm>
+#include <vector>
+
+using namespace ECSModule;
+using ECSModuleTest::Helpers::MakeTransform;
+using Events::ECS::RenderFrameData;
+
+namespace
+{
+struct OtherTableTag
+{
+};
+
+bool Contains(const RenderFrameData& frame, flecs::entity_t id)
+{
+    return std::find(frame.entityIds.begin(), frame.entityIds.end(), id) != frame.entityIds.end();
+}
+} // namespace
+
+class RenderFrameCollectorTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ecs.component<OtherTableTag>();
+        ecs.component<TransformComponent>().add(flecs::With, ecs.component<WorldTransformComponent>());
+        first = ecs.entity().set<TransformComponent>(MakeTransform(1.0f)).set<MeshComponent>({});
+        second = ecs.entity().set<TransformComponent>(MakeTransform(2.0f)).set<MeshComponent>({}).add<OtherTableTag>();
+        // Transform without a mesh is not rendered
+        ecs.entity().set<TransformComponent>(MakeTransform(3.0f));
+        hierarchy.bind(ecs);
+        collector.bind(ecs);
+    }
+
+    void TearDown() override
+    {
+        collector.unbind();
+        hierarchy.unbind();
+    }
+
+    // What EntityWorld does each frame: propagate, then collect the matrices that changed
+    size_t collect()
+    {
+        hierarchy.update();
+        return collector.collect(frame);
+    }
+
+    flecs::world ecs;
+    TransformHierarchy hierarchy;
+    RenderFrameCollector collector;
+    RenderFrameData frame;
+    flecs::entity first;
+    flecs::entity second;
+};
+
+TEST_F(RenderFrameCollectorTest, FirstCollectPublishesAllThenStaticWorldNothing)
+{
+    EXPECT_EQ(collect(), 2u);
+    EXPECT_TRUE(Contains(frame, first.id()));
+    EXPECT_TRUE(Contains(frame, second.id()));
+    EXPECT_EQ(frame.worldMatrices.size(), 2u);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        frame.clear();
+        EXPECT_EQ(collect(), 0u);
+        EXPECT_EQ(frame.size(), 0u);
+    }
+}
+
+TEST_F(RenderFrameCollectorTest, OnlyModifiedTableIsPublished)
+{
+    collect();
+
+    TransformComponent* transform = second.get_mut<TransformComponent>();
+    transform->position.x = 42.0f;
+    transform->scale.y = 3.0f;
+    second.modified<TransformComponent>();
+
+    frame.clear();
+    ASSERT_EQ(collect(), 1u);
+    EXPECT_EQ(frame.entityIds[0], second.id());
+    EXPECT_EQ(frame.worldMatrices[0][3][0], 42.0f);
+    EXPECT_EQ(frame.worldMatrices[0][1][1], 3.0f);
+    EXPECT_EQ(frame.worldMatrices[0][0][0], 1.0f); // identity rotation
+
+    frame.clear();
+    EXPECT_EQ(collect(), 0u);
+
+    // set() counts as a write too
+    first.set<TransformComponent>(MakeTransform(-1.0f));
+    frame.clear();
+    ASSERT_EQ(collect(), 1u);
+    EXPECT_EQ(frame.entityIds[0], first.id());
+    EXPECT_EQ(frame.worldMatrices[0][3][0], -1.0f);
+}
+
+TEST_F(RenderFrameCollectorTest, CameraIsSentEveryFrame)
+{
+    TransformComponent cameraTransform = MakeTransform(5.0f);
+    ecs.entity().set<TransformComponent>(cameraTransform).set<CameraComponent>({60.0f, 1.5f, 0.1f, 50.0f, true});
+
+    collect();
+    frame.clear();
+    EXPECT_EQ(collect(), 0u);
+    ASSERT_TRUE(frame.hasCamera);
+    EXPECT_EQ(frame.camera.posX, 5.0f);
+    EXPECT_EQ(frame.camera.fov, 60.0f);
+    EXPECT_EQ(frame.camera.farClip, 50.0f);
+}
+
+TEST_F(RenderFrameCollectorTest, ClearKeepsCapacity)
+{
+    collect();
+    const size_t capacity = frame.worldMatrices.capacity();
+    frame.clear();
+    EXPECT_EQ(frame.size(), 0u);
+    EXPECT_FALSE(frame.hasCamera);
+    EXPECT_EQ(frame.worldMatrices.capacity(), capacity);
+}
@@ -0,0 +1,343 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include <Modules/ObjectCoreModule/ECS/EntityWorld.h>
+#include <Modules/ObjectCoreModule/ECS/Components/ECSComponents.h>
+#include <Modules/ObjectCoreModule/ECS/Replication/ReplicationClient.h>
+#include <Modules/ObjectCoreModule/ECS/Replication/ReplicationServer.h>
+#include <Modules/ResourceModule/Asset/AssetID.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace ECSModule;
+
+namespace
+{
+TransformComponent MakeTransform(const Math::Vec3& position, const glm::quat& rotation = glm::quat(1, 0, 0, 0),
+                                 const Math::Vec3& scale = Math::Vec3(1.0f))
+{
+    return TransformComponent::FromTRS(position, rotation, scale);
+}
+} // namespace
+
+class ReplicationTest : public ECSModuleTest::EntityWorldTestBase
+{
+protected:
+    void SetUp() override
+    {
+        EntityWorldTestBase::SetUp();
+        source = makeWorld();
+        target = makeWorld();
+    }
+
+    void TearDown() override
+    {
+        client.reset();
+        server.reset();
+        target.reset();
+        source.reset();
+        EntityWorldTestBase::TearDown();
+    }
+
+    void connect(const ReplicationClientSettings& settings = {}, const ReplicationConfig& config = {})
+    {
+        server = std::make_unique<ReplicationServer>(*source, config);
+        client = std::make_unique<ReplicationClient>(*target, config);
+        clientId = server->addClient(settings);
+    }
+
+    /// Captures the source world and writes the client's snapshot
+    std::vector<uint8_t> step()
+    {
+        source->updateTransforms();
+        server->capture();
+        std::vector<uint8_t> snapshot;
+        EXPECT_TRUE(server->writeSnapshot(clientId, snapshot));
+        return snapshot;
+    }
+
+    /// step(), applied and acknowledged
+    size_t exchange()
+    {
+        const std::vector<uint8_t> snapshot = step();
+        EXPECT_TRUE(client->apply(snapshot)) << client->error();
+        server->acknowledge(clientId, client->lastTick());
+        return snapshot.size();
+    }
+
+    flecs::entity_t ghostId(flecs::entity original)
+    {
+        return client->find(server->getNetId(original.id()));
+    }
+
+    flecs::entity ghost(flecs::entity original)
+    {
+        const flecs::entity_t id = ghostId(original);
+        EXPECT_NE(id, 0u);
+        return target->get().entity(id);
+    }
+
+    std::unique_ptr<EntityWorld> source;
+    std::unique_ptr<EntityWorld> target;
+    std::unique_ptr<ReplicationServer> server;
+    std::unique_ptr<ReplicationClient> client;
+    ReplicationServer::ClientId clientId = 0;
+};
+
+TEST_F(ReplicationTest, BitStreamRoundTrips)
+{
+    BitWriter writer;
+    writer.writeBool(true);
+    writer.writeBits(0x5, 3);
+    writer.writeVarUint(0);
+    writer.writeVarUint(1234567);
+    writer.writeSigned(-42);
+    const uint8_t bytes[3] = {0xAB, 0xCD, 0xEF};
+    writer.writeBytes(bytes, sizeof(bytes));
+    const size_t end = writer.bitCount();
+    writer.writeBits(0xFF, 8);
+    writer.truncate(end);
+    EXPECT_EQ(writer.bitCount(), end);
+
+    BitReader reader(writer.bytes().data(), writer.bytes().size());
+    EXPECT_TRUE(reader.readBool());
+    EXPECT_EQ(reader.readBits(3), 0x5u);
+    EXPECT_EQ(reader.readVarUint(), 0u);
+    EXPECT_EQ(reader.readVarUint(), 1234567u);
+    EXPECT_EQ(reader.readSigned(), -42);
+    uint8_t read[3] = {};
+    EXPECT_TRUE(reader.readBytes(read, sizeof(read)));
+    EXPECT_EQ(read[2], 0xEF);
+    EXPECT_FALSE(reader.overflowed());
+    reader.readBits(16);
+    EXPECT_TRUE(reader.overflowed());
+}
+
+TEST_F(ReplicationTest, FullSnapshotRecreatesReplicatedState)
+{
+    flecs::world& ecs = source->get();
+    const glm::quat rotation = glm::normalize(glm::quat(0.9f, 0.1f, -0.3f, 0.2f));
+    auto moved = ecs.entity().set<TransformComponent>(
+        MakeTransform({12.3456f, -7.5f, 1000.125f}, rotation, {2.0f, 0.5f, 3.0f}));
+    auto lit = ecs.entity()
+                   .set<TransformComponent>(MakeTransform({1.0f, 2.0f, 3.0f}, glm::quat(1, 0, 0, 0), Math::Vec3(4.0f)))
+                   .set<PointLightComponent>({1.0f, 5.0f, 0.75f, {1.0f, 0.5f, 0.25f}})
+                   .set<MaterialComponent>({ResourceModule::AssetID("Materials/brick.lmat")});
+    auto editorOnly = ecs.entity().set<TransformComponent>(MakeTransform({0, 0, 0})).add<EditorOnlyTag>();
+    // Not a replicated component: stays on the server
+    auto scripted = ecs.entity().set<ScriptComponent>({ResourceModule::AssetID("Scripts/ai.lua")});
+
+    connect();
+    exchange();
+
+    // The viewport camera stays on the server too
+    EXPECT_EQ(client->entityCount(), 2u);
+    EXPECT_EQ(ghostId(editorOnly), 0u);
+    EXPECT_EQ(server->getNetId(scripted.id()), 0u);
+
+    const auto* transform = ghost(moved).get<TransformComponent>();
+    ASSERT_NE(transform, nullptr);
+    const float step = ReplicationConfig{}.positionStep;
+    EXPECT_NEAR(transform->position.x, 12.3456f, step * 0.5f);
+    EXPECT_NEAR(transform->position.y, -7.5f, step * 0.5f);
+    EXPECT_NEAR(transform->position.z, 1000.125f, step * 0.5f);
+    EXPECT_GT(std::abs(glm::dot(transform->rotation.toQuat(), rotation)), 0.99999f);
+    EXPECT_NEAR(transform->scale.x, 2.0f, 1e-3f);
+    EXPECT_NEAR(transform->scale.y, 0.5f, 1e-3f);
+    EXPECT_NEAR(transform->scale.z, 3.0f, 1e-3f);
+
+    const flecs::entity litGhost = ghost(lit);
+    ASSERT_TRUE(litGhost.has<PointLightComponent>());
+    EXPECT_FLOAT_EQ(litGhost.get<PointLightComponent>()->outerRadius, 5.0f);
+    EXPECT_FLOAT_EQ(litGhost.get<PointLightComponent>()->color.y, 0.5f);
+    ASSERT_TRUE(litGhost.has<MaterialComponent>());
+    EXPECT_EQ(litGhost.get<MaterialComponent>()->materialID.str(),
+              ResourceModule::AssetID("Materials/brick.lmat").str());
+    EXPECT_FLOAT_EQ(litGhost.get<TransformComponent>()->scale.z, 4.0f);
+}
+
+TEST_F(ReplicationTest, UnchangedEntitiesCostNothing)
+{
+    flecs::world& ecs = source->get();
+    std::vector<flecs::entity> entities;
+    for (int i = 0; i < 50; ++i)
+        entities.push_back(ecs.entity().set<TransformComponent>(MakeTransform({static_cast<float>(i), 0.0f, 0.0f})));
+
+    connect();
+    const size_t full = exchange();
+    EXPECT_EQ(client->entityCount(), 50u);
+
+    // Nothing written: header, empty removal list, end bit
+    const size_t idle = exchange();
+    EXPECT_LE(idle, 14u);
+    EXPECT_EQ(server->getStats().lastSnapshotEntities, 0u);
+
+    // Writing the old value again is not a change
+    entities[3].set<TransformComponent>(*entities[3].get<TransformComponent>());
+    exchange();
+    EXPECT_EQ(server->getStats().changedComponents, 0u);
+    EXPECT_EQ(server->getStats().lastSnapshotEntities, 0u);
+
+    entities[7].set<TransformComponent>(MakeTransform({7.0f, 3.0f, 0.0f}));
+    const size_t delta = exchange();
+    EXPECT_EQ(server->getStats().lastSnapshotEntities, 1u);
+    EXPECT_LT(delta * 10, full);
+    EXPECT_NEAR(ghost(entities[7]).get<TransformComponent>()->position.y, 3.0f, 1e-3f);
+
+    // Components going away travel in the mask
+    entities[9].set<PointLightComponent>({});
+    exchange();
+    EXPECT_TRUE(ghost(entities[9]).has<PointLightComponent>());
+    entities[9].remove<PointLightComponent>();
+    exchange();
+    EXPECT_FALSE(ghost(entities[9]).has<PointLightComponent>());
+    EXPECT_TRUE(ghost(entities[9]).has<TransformComponent>());
+}
+
+TEST_F(ReplicationTest, RelevanceFollowsTheFocus)
+{
+    flecs::world& ecs = source->get();
+    auto near = ecs.entity().set<TransformComponent>(MakeTransform({0.0f, 0.0f, 0.0f}));
+    auto far = ecs.entity().set<TransformComponent>(MakeTransform({100.0f, 0.0f, 0.0f}));
+    // Without a transform an entity is relevant everywhere
+    ecs.entity().set<DirectionalLightComponent>({1.0f});
+
+    connect(ReplicationClientSettings{50.0f, 1200});
+    exchange();
+    EXPECT_EQ(client->entityCount(), 2u);
+    EXPECT_NE(ghostId(near), 0u);
+    const NetId nearId = server->getNetId(near.id());
+    EXPECT_EQ(ghostId(far), 0u);
+
+    int destroyed = 0;
+    auto sub = target->events().subscribe<Events::ECS::EntitiesDestroyed>(
+        [&](const Events::ECS::EntitiesDestroyed& event) { destroyed += static_cast<int>(event.ids.size()); });
+
+    server->setClientFocus(clientId, {100.0f, 0.0f, 0.0f});
+    exchange();
+    EXPECT_EQ(client->entityCount(), 2u);
+    EXPECT_EQ(client->find(nearId), 0u);
+    EXPECT_NE(ghostId(far), 0u);
+    EXPECT_EQ(destroyed, 1);
+
+    // Deleted on the server
+    far.destruct();
+    exchange();
+    EXPECT_EQ(client->entityCount(), 1u);
+    EXPECT_EQ(destroyed, 2);
+}
+
+TEST_F(ReplicationTest, ParentsAreReplicatedAsNetIds)
+{
+    flecs::world& ecs = source->get();
+    auto parent = ecs.entity().set<TransformComponent>(MakeTransform({10.0f, 0.0f, 0.0f}));
+    auto other = ecs.entity().set<TransformComponent>(MakeTransform({-10.0f, 0.0f, 0.0f}));
+    auto child = ecs.entity().set<TransformComponent>(MakeTransform({0.0f, 5.0f, 0.0f}));
+    child.child_of(parent);
+
+    connect();
+    exchange();
+    target->updateTransforms();
+    EXPECT_EQ(ghost(child).parent(), ghost(parent));
+    EXPECT_NEAR(ghost(child).get<TransformComponent>()->position.x, 0.0f, 1e-3f);
+    ASSERT_TRUE(ghost(child).has<WorldTransformComponent>());
+    EXPECT_NEAR(ghost(child).get<WorldTransformComponent>()->position().x, 10.0f, 1e-3f);
+    EXPECT_NEAR(ghost(child).get<WorldTransformComponent>()->position().y, 5.0f, 1e-3f);
+
+    // Reparenting alone is an update
+    child.child_of(other);
+    exchange();
+    EXPECT_EQ(server->getStats().lastSnapshotEntities, 1u);
+    target->updateTransforms();
+    EXPECT_EQ(ghost(child).parent(), ghost(other));
+    EXPECT_NEAR(ghost(child).get<WorldTransformComponent>()->position().x, -10.0f, 1e-3f);
+
+    child.remove(flecs::ChildOf, flecs::Wildcard);
+    exchange();
+    EXPECT_FALSE(ghost(child).parent().is_valid());
+    EXPECT_EQ(client->entityCount(), 3u);
+}
+
+TEST_F(ReplicationTest, ByteBudgetSendsNearestFirstAndCatchesUp)
+{
+    flecs::world& ecs = source->get();
+    for (int i = 0; i < 200; ++i)
+        ecs.entity().set<TransformComponent>(MakeTransform({static_cast<float>(200 - i), 0.0f, 0.0f}));
+    auto nearest = ecs.entity().set<TransformComponent>(MakeTransform({0.5f, 0.0f, 0.0f}));
+
+    connect(ReplicationClientSettings{0.0f, 256});
+    const size_t first = exchange();
+    EXPECT_LE(first, 256u);
+    EXPECT_GT(server->getStats().lastSnapshotDeferred, 0u);
+    EXPECT_NE(ghostId(nearest), 0u);
+
+    int exchanges = 1;
+    while (client->entityCount() < 201 && exchanges < 100)
+    {
+        EXPECT_LE(exchange(), 256u);
+        ++exchanges;
+    }
+    EXPECT_EQ(client->entityCount(), 201u);
+    EXPECT_EQ(server->getStats().lastSnapshotDeferred, 0u);
+}
+
+TEST_F(ReplicationTest, LostSnapshotsAreCoveredByTheAcknowledgedBaseline)
+{
+    flecs::world& ecs = source->get();
+    auto a = ecs.entity().set<TransformComponent>(MakeTransform({1.0f, 0.0f, 0.0f}));
+    auto b = ecs.entity().set<TransformComponent>(MakeTransform({2.0f, 0.0f, 0.0f}));
+    connect();
+    exchange();
+
+    // Lost on the way
+    a.set<TransformComponent>(MakeTransform({1.0f, 5.0f, 0.0f}));
+    step();
+    b.destruct();
+    const std::vector<uint8_t> second = step();
+
+    EXPECT_TRUE(client->apply(second)) << client->error();
+    EXPECT_EQ(client->entityCount(), 1u);
+    EXPECT_NEAR(ghost(a).get<TransformComponent>()->position.y, 5.0f, 1e-3f);
+
+    // Late arrivals are ignored, and a delta needs the baseline it was built on
+    EXPECT_FALSE(client->apply(second));
+    ReplicationClient other(*target);
+    EXPECT_FALSE(other.apply(second));
+}
+
+TEST_F(ReplicationTest, RejectsOtherSchemasAndCorruptSnapshots)
+{
+    source->get().entity().set<TransformComponent>(MakeTransform({1.0f, 2.0f, 3.0f}));
+    ReplicationConfig coarse;
+    coarse.positionStep = 0.5f;
+    server = std::make_unique<ReplicationServer>(*source, coarse);
+    client = std::make_unique<ReplicationClient>(*target);
+    clientId = server->addClient();
+
+    std::vector<uint8_t> snapshot = step();
+    EXPECT_FALSE(client->apply(snapshot));
+
+    ReplicationClient matching(*target, coarse);
+    std::vector<uint8_t> truncated(snapshot.begin(), snapshot.begin() + static_cast<std::ptrdiff_t>(snapshot.size() / 2));
+    EXPECT_FALSE(matching.apply(truncated));
+    EXPECT_EQ(matching.entityCount(), 0u);
+    EXPECT_TRUE(matching.apply(snapshot)) << matching.error();
+    EXPECT_EQ(matching.entityCount(), 1u);
+
+    // A string length whose size in bits wraps around is still past the end of the snapshot
+    ReplicationSchema schema(target->get(), coarse);
+    size_t material = schema.size();
+    for (size_t i = 0; i < schema.size(); ++i)
+    {
+        if (schema.component(i) == target->get().id<MaterialComponent>())
+            material = i;
+    }
+    ASSERT_LT(material, schema.size());
+    BitWriter corrupt;
+    corrupt.writeVarUint(1ull << 61);
+    corrupt.writeBytes(snapshot.data(), snapshot.size());
+    BitReader in(corrupt.bytes().data(), corrupt.byteCount());
+    std::string scratch;
+    EXPECT_FALSE(schema.decode(material, in, nullptr, scratch));
+    EXPECT_TRUE(scratch.empty());
+}
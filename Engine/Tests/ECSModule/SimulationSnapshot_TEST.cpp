@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <Modules/ObjectCoreModule/ECS/EntityWorld.h>
 #include <Modules/ObjectCoreModule/ECS/Components/ECSComponents.h>
+#include <Modules/ObjectCoreModule/ECS/Serialization/WorldSnapshot.h>
 #include <Modules/ResourceModule/ResourceManager.h>
 #include <Modules/ScriptModule/LuaScriptModule.h>
 #include <Modules/PhysicsModule/PhysicsModule.h>
@@ -8,6 +9,7 @@
 #include <Modules/PhysicsModule/PhysicsContext/PhysicsContext.h>
 #include <Modules/PhysicsModule/Components/RigidBodyComponent.h>
 #include <Modules/PhysicsModule/Components/ColliderComponent.h>
+#include <Modules/PhysicsModule/Systems/PhysicsSnapshotSync.h>
 #include <Modules/PhysicsModule/Utils/PhysicsTypes.h>
 #include <Modules/RenderModule/RenderContext.h>
 #include <Foundation/Memory/MemorySystem.h>
@@ -502,3 +504,150 @@ TEST_F(SimulationSnapshotTest, SnapshotWithNoPhysicsComponents)
     }
 }
 
+// ============================================================================
+// In-memory WorldSnapshot (simulate start/stop)
+// ============================================================================
+
+namespace
+{
+PhysicsModule::RigidBodyComponent MakeDynamicBody()
+{
+    PhysicsModule::RigidBodyComponent rb;
+    rb.mass = 1.0f;
+    return rb;
+}
+
+PhysicsModule::ColliderComponent MakeBoxCollider()
+{
+    PhysicsModule::ColliderComponent collider;
+    collider.shapeDesc.type = PhysicsModule::PhysicsShapeType::Box;
+    collider.shapeDesc.size = glm::vec3(1.0f);
+    return collider;
+}
+} // namespace
+
+TEST_F(SimulationSnapshotTest, WorldSnapshotRestoresInPlace)
+{
+    auto& flecsWorld = world->get();
+    auto moved = flecsWorld.entity("MovedEntity");
+    SetEntityPosition(moved, {1.0f, 2.0f, 3.0f});
+    auto untouched = flecsWorld.entity("UntouchedEntity");
+    SetEntityPosition(untouched, {4.0f, 5.0f, 6.0f});
+
+    WorldSnapshot snapshot(world->getSerializedComponents());
+    ASSERT_TRUE(snapshot.capture(flecsWorld));
+    EXPECT_GE(snapshot.entityCount(), 2u);
+    EXPECT_GT(snapshot.arenaBytes(), 0u);
+
+    SetEntityPosition(moved, {10.0f, 20.0f, 30.0f});
+    moved.add<InvisibleTag>();
+    moved.set_name("RenamedDuringPlay");
+
+    const WorldSnapshot::RestoreStats stats = snapshot.restore(flecsWorld);
+    EXPECT_EQ(stats.retyped, 1u);
+    EXPECT_EQ(stats.recreated, 0u);
+    EXPECT_EQ(stats.destroyed, 0u);
+    EXPECT_GE(stats.componentsUnchanged, 1u);
+
+    EXPECT_EQ(flecsWorld.lookup("MovedEntity"), moved);
+    EXPECT_FALSE(flecsWorld.lookup("RenamedDuringPlay").is_valid());
+    EXPECT_FALSE(moved.has<InvisibleTag>());
+    EXPECT_FLOAT_EQ(GetEntityPosition(moved)->x, 1.0f);
+    EXPECT_FLOAT_EQ(GetEntityPosition(moved)->z, 3.0f);
+    EXPECT_FLOAT_EQ(GetEntityPosition(untouched)->y, 5.0f);
+}
+
+TEST_F(SimulationSnapshotTest, WorldSnapshotRemovesSpawnedAndRecreatesDeleted)
+{
+    auto& flecsWorld = world->get();
+    auto kept = flecsWorld.entity("DeletedDuringPlay");
+    SetEntityPosition(kept, {7.0f, 8.0f, 9.0f});
+    kept.add<EditorOnlyTag>();
+    const flecs::entity_t keptId = kept.id();
+
+    WorldSnapshot snapshot(world->getSerializedComponents());
+    ASSERT_TRUE(snapshot.capture(flecsWorld));
+
+    int discarded = 0;
+    snapshot.setDiscardHook([&](flecs::entity) { ++discarded; });
+
+    kept.destruct();
+    auto spawned = flecsWorld.entity("SpawnedDuringPlay");
+    SetEntityPosition(spawned, {0.0f, 0.0f, 0.0f});
+
+    const WorldSnapshot::RestoreStats stats = snapshot.restore(flecsWorld);
+    EXPECT_EQ(stats.destroyed, 1u);
+    EXPECT_EQ(stats.recreated, 1u);
+    EXPECT_EQ(discarded, 1);
+
+    EXPECT_FALSE(flecsWorld.lookup("SpawnedDuringPlay").is_valid());
+    auto restored = flecsWorld.lookup("DeletedDuringPlay");
+    ASSERT_TRUE(restored.is_valid());
+    EXPECT_EQ(restored.id(), keptId);
+    EXPECT_TRUE(restored.has<EditorOnlyTag>());
+    EXPECT_FLOAT_EQ(GetEntityPosition(restored)->y, 8.0f);
+}
+
+TEST_F(SimulationSnapshotTest, WorldSnapshotKeepsPhysicsBodies)
+{
+    auto& flecsWorld = world->get();
+    auto entity = flecsWorld.entity("BodyEntity");
+    SetEntityPosition(entity, {0.0f, 5.0f, 0.0f});
+    entity.set<PhysicsModule::RigidBodyComponent>(MakeDynamicBody());
+    entity.set<PhysicsModule::ColliderComponent>(MakeBoxCollider());
+
+    WorldSnapshot snapshot(world->getSerializedComponents());
+    PhysicsModule::PhysicsSnapshotSync::Install(flecsWorld, snapshot);
+    ASSERT_TRUE(snapshot.capture(flecsWorld));
+
+    // Play: the body is created, then moves.
+    world->tick(1.0f / 60.0f);
+    const auto* rb = entity.get<PhysicsModule::RigidBodyComponent>();
+    ASSERT_NE(rb->bodyHandle, PhysicsModule::InvalidBodyHandle);
+    const PhysicsModule::PhysicsBodyHandle body = rb->bodyHandle;
+    SetEntityPosition(entity, {3.0f, -2.0f, 1.0f});
+    physicsContext->updateBodyTransform(entity, glm::vec3(3.0f, -2.0f, 1.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+
+    snapshot.restore(flecsWorld);
+    PhysicsModule::PhysicsSnapshotSync::ResetBodies(flecsWorld);
+
+    rb = entity.get<PhysicsModule::RigidBodyComponent>();
+    EXPECT_EQ(rb->bodyHandle, body);
+    EXPECT_FALSE(rb->needsCreation);
+    EXPECT_FLOAT_EQ(GetEntityPosition(entity)->y, 5.0f);
+
+    glm::vec3 position;
+    glm::quat rotation;
+    ASSERT_TRUE(physicsContext->getBodyTransform(entity, position, rotation));
+    EXPECT_NEAR(position.x, 0.0f, 1e-4f);
+    EXPECT_NEAR(position.y, 5.0f, 1e-4f);
+}
+
+TEST_F(SimulationSnapshotTest, WorldSnapshotRebuildsBodyWhenShapeChanged)
+{
+    auto& flecsWorld = world->get();
+    auto entity = flecsWorld.entity("ReshapedEntity");
+    SetEntityPosition(entity, {0.0f, 1.0f, 0.0f});
+    entity.set<PhysicsModule::RigidBodyComponent>(MakeDynamicBody());
+    entity.set<PhysicsModule::ColliderComponent>(MakeBoxCollider());
+
+    WorldSnapshot snapshot(world->getSerializedComponents());
+    PhysicsModule::PhysicsSnapshotSync::Install(flecsWorld, snapshot);
+    ASSERT_TRUE(snapshot.capture(flecsWorld));
+
+    world->tick(1.0f / 60.0f);
+    ASSERT_FALSE(entity.get<PhysicsModule::RigidBodyComponent>()->needsCreation);
+    entity.get_mut<PhysicsModule::ColliderComponent>()->shapeDesc.size = glm::vec3(4.0f);
+
+    snapshot.restore(flecsWorld);
+
+    const auto* rb = entity.get<PhysicsModule::RigidBodyComponent>();
+    EXPECT_EQ(rb->bodyHandle, PhysicsModule::InvalidBodyHandle);
+    EXPECT_TRUE(rb->needsCreation);
+    EXPECT_EQ(entity.get<PhysicsModule::ColliderComponent>()->shapeDesc.size, glm::vec3(1.0f));
+    EXPECT_TRUE(entity.get<PhysicsModule::ColliderComponent>()->needsCreation);
+
+    glm::vec3 position;
+    glm::quat rotation;
+    EXPECT_FALSE(physicsContext->getBodyTransform(entity, position, rotation));
+}
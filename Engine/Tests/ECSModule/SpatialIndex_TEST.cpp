@@ -0,0 +1,244 @@
+#include <gtest/gtest.h>
+#include <Modules/ObjectCoreModule/ECS/SpatialIndex.h>
+#include <Modules/ObjectCoreModule/ECS/TransformHierarchy.h>
+#include <Foundation/JobSystem/JobSystem.h>
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace ECSModule;
+
+namespace
+{
+Math::AABB Box(const glm::vec3& center, float halfSize = 0.5f)
+{
+    return Math::AABB::FromCenterExtents(center, glm::vec3(halfSize));
+}
+
+// What the index replaces: test every entity
+std::vector<flecs::entity_t> BruteBox(const std::vector<std::pair<flecs::entity_t, Math::AABB>>& all,
+                                      const Math::AABB& box)
+{
+    std::vector<flecs::entity_t> out;
+    for (const auto& [id, bounds] : all)
+        if (bounds.Intersects(box))
+            out.push_back(id);
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+std::vector<flecs::entity_t> Sorted(std::vector<flecs::entity_t> ids)
+{
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+} // namespace
+
+TEST(SpatialIndexTest, BoxAndSphereQueries)
+{
+    SpatialIndex index(4.0f);
+    index.insertOrUpdate(1, Box({0.0f, 0.0f, 0.0f}));
+    index.insertOrUpdate(2, Box({10.0f, 0.0f, 0.0f}));
+    index.insertOrUpdate(3, Box({-30.0f, 5.0f, 2.0f}));
+    EXPECT_EQ(index.size(), 3u);
+
+    std::vector<flecs::entity_t> hits;
+    index.queryBox(Math::AABB({-1.0f, -1.0f, -1.0f}, {11.0f, 1.0f, 1.0f}), hits);
+    EXPECT_EQ(Sorted(hits), (std::vector<flecs::entity_t>{1, 2}));
+
+    hits.clear();
+    index.querySphere({-30.0f, 5.0f, 0.0f}, 1.6f, hits);
+    EXPECT_EQ(hits, (std::vector<flecs::entity_t>{3}));
+
+    hits.clear();
+    index.querySphere({5.0f, 0.0f, 0.0f}, 1.0f, hits);
+    EXPECT_TRUE(hits.empty());
+}
+
+TEST(SpatialIndexTest, MovingAndRemovingEntries)
+{
+    SpatialIndex index(2.0f);
+    index.insertOrUpdate(7, Box({0.0f, 0.0f, 0.0f}));
+    index.insertOrUpdate(7, Box({100.0f, 0.0f, 0.0f}));
+    EXPECT_EQ(index.size(), 1u);
+
+    std::vector<flecs::entity_t> hits;
+    index.queryBox(Box({0.0f, 0.0f, 0.0f}), hits);
+    EXPECT_TRUE(hits.empty());
+    index.queryBox(Box({100.0f, 0.0f, 0.0f}), hits);
+    EXPECT_EQ(hits, (std::vector<flecs::entity_t>{7}));
+
+    index.remove(7);
+    EXPECT_EQ(index.size(), 0u);
+    EXPECT_EQ(index.bounds(7), nullptr);
+    hits.clear();
+    index.queryBox(Box({100.0f, 0.0f, 0.0f}), hits);
+    EXPECT_TRUE(hits.empty());
+}
+
+TEST(SpatialIndexTest, LargeEntriesAreFoundEverywhere)
+{
+    SpatialIndex index(1.0f);
+    index.insertOrUpdate(1, Box({0.0f, 0.0f, 0.0f}, 500.0f)); // far more cells than kMaxCellsPerEntry
+    index.insertOrUpdate(2, Box({3.0f, 0.0f, 0.0f}));
+
+    std::vector<flecs::entity_t> hits;
+    index.queryBox(Box({-400.0f, 0.0f, 0.0f}), hits);
+    EXPECT_EQ(hits, (std::vector<flecs::entity_t>{1}));
+
+    hits.clear();
+    index.queryBox(Box({3.0f, 0.0f, 0.0f}), hits);
+    EXPECT_EQ(Sorted(hits), (std::vector<flecs::entity_t>{1, 2}));
+}
+
+TEST(SpatialIndexTest, NonFiniteBoundsAreRejected)
+{
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const float inf = std::numeric_limits<float>::infinity();
+
+    SpatialIndex index(1.0f);
+    index.insertOrUpdate(1, Box({0.0f, 0.0f, 0.0f}));
+    index.insertOrUpdate(2, Math::AABB({nan, 0.0f, 0.0f}, {1.0f, nan, 1.0f}));
+    index.insertOrUpdate(3, Math::AABB({-inf, 0.0f, 0.0f}, {inf, 1.0f, 1.0f}));
+    EXPECT_EQ(index.size(), 1u);
+    EXPECT_EQ(index.bounds(2), nullptr);
+    EXPECT_EQ(index.bounds(3), nullptr);
+
+    // An indexed entity whose bounds turn NaN leaves the index
+    index.insertOrUpdate(1, Box({nan, 0.0f, 0.0f}));
+    EXPECT_EQ(index.size(), 0u);
+
+    index.insertOrUpdate(4, Box({0.0f, 0.0f, 0.0f}));
+    std::vector<flecs::entity_t> hits;
+    index.queryBox(Box({nan, 0.0f, 0.0f}), hits);
+    index.querySphere({0.0f, nan, 0.0f}, 1.0f, hits);
+    EXPECT_TRUE(hits.empty());
+
+    SpatialIndex::RayHit hit;
+    EXPECT_FALSE(index.raycast({glm::vec3(nan), glm::vec3(1.0f, 0.0f, 0.0f), 10.0f}, hit));
+}
+
+TEST(SpatialIndexTest, RaycastFindsNearestFirst)
+{
+    SpatialIndex index(4.0f);
+    index.insertOrUpdate(1, Box({0.0f, 0.0f, -20.0f}));
+    index.insertOrUpdate(2, Box({0.0f, 0.0f, -5.0f}));
+    index.insertOrUpdate(3, Box({0.0f, 3.0f, -10.0f})); // off the ray
+    index.insertOrUpdate(4, Box({0.0f, 0.0f, 30.0f}));  // behind the origin
+
+    SpatialIndex::Ray ray;
+    ray.origin = {0.0f, 0.0f, 0.0f};
+    ray.direction = {0.0f, 0.0f, -1.0f};
+    ray.maxDistance = 100.0f;
+
+    SpatialIndex::RayHit hit;
+    ASSERT_TRUE(index.raycast(ray, hit));
+    EXPECT_EQ(hit.entity, 2u);
+    EXPECT_NEAR(hit.distance, 4.5f, 1e-5f);
+
+    std::vector<SpatialIndex::RayHit> all;
+    index.raycastAll(ray, all);
+    ASSERT_EQ(all.size(), 2u);
+    EXPECT_EQ(all[0].entity, 2u);
+    EXPECT_EQ(all[1].entity, 1u);
+
+    ray.maxDistance = 4.0f;
+    EXPECT_FALSE(index.raycast(ray, hit));
+}
+
+TEST(SpatialIndexTest, FrustumQuery)
+{
+    SpatialIndex index(4.0f);
+    index.insertOrUpdate(1, Box({0.0f, 0.0f, -10.0f})); // in front
+    index.insertOrUpdate(2, Box({0.0f, 0.0f, 10.0f}));  // behind
+    index.insertOrUpdate(3, Box({50.0f, 0.0f, -10.0f})); // far to the side
+
+    const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 1.0f, 0.1f, 100.0f);
+    const glm::mat4 view = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+    std::vector<flecs::entity_t> hits;
+    index.queryFrustum(Math::Frustum::FromMatrix(projection * view), hits);
+    EXPECT_EQ(hits, (std::vector<flecs::entity_t>{1}));
+}
+
+TEST(SpatialIndexTest, MatchesBruteForceAndBatchedMatchesSingle)
+{
+    SpatialIndex index(5.0f);
+    std::vector<std::pair<flecs::entity_t, Math::AABB>> all;
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> position(-200.0f, 200.0f);
+    std::uniform_real_distribution<float> size(0.1f, 6.0f);
+    for (flecs::entity_t id = 1; id <= 3000; ++id)
+    {
+        const Math::AABB box = Box({position(rng), position(rng), position(rng)}, size(rng));
+        index.insertOrUpdate(id, box);
+        all.emplace_back(id, box);
+    }
+
+    std::vector<Math::AABB> queries;
+    for (int i = 0; i < 200; ++i)
+        queries.push_back(Box({position(rng), position(rng), position(rng)}, size(rng) * 4.0f));
+
+    EngineCore::Foundation::JobSystem jobs;
+    jobs.setWorkerCount(4);
+    jobs.startup();
+    std::vector<std::vector<flecs::entity_t>> batched;
+    index.queryBoxes(queries, batched, &jobs);
+    jobs.shutdown();
+
+    ASSERT_EQ(batched.size(), queries.size());
+    for (size_t i = 0; i < queries.size(); ++i)
+    {
+        std::vector<flecs::entity_t> single;
+        index.queryBox(queries[i], single);
+        EXPECT_EQ(Sorted(single), BruteBox(all, queries[i])) << "query " << i;
+        EXPECT_EQ(Sorted(batched[i]), Sorted(single)) << "query " << i;
+    }
+}
+
+TEST(SpatialIndexTest, FedFromWorldTransformsAndBounds)
+{
+    flecs::world ecs;
+    ecs.component<TransformComponent>().add(flecs::With, ecs.component<WorldTransformComponent>());
+
+    TransformHierarchy hierarchy;
+    SpatialIndex index(4.0f);
+
+    TransformComponent parentTransform{};
+    parentTransform.position = {10.0f, 0.0f, 0.0f};
+    auto parent = ecs.entity().set<TransformComponent>(parentTransform).set<BoundsComponent>({});
+    TransformComponent childTransform{};
+    childTransform.position = {0.0f, 5.0f, 0.0f};
+    auto child = ecs.entity().child_of(parent).set<TransformComponent>(childTransform).set<BoundsComponent>({});
+    // Bounds without a transform are not indexed
+    ecs.entity().set<BoundsComponent>({});
+
+    hierarchy.bind(ecs);
+    index.bind(ecs);
+    hierarchy.update();
+    EXPECT_EQ(index.update(), 2u);
+    EXPECT_EQ(index.size(), 2u);
+    ASSERT_NE(index.bounds(child.id()), nullptr);
+    EXPECT_NEAR(index.bounds(child.id())->Center().x, 10.0f, 1e-5f);
+    EXPECT_NEAR(index.bounds(child.id())->Center().y, 5.0f, 1e-5f);
+
+    // Static world: nothing to re-read
+    hierarchy.update();
+    EXPECT_EQ(index.update(), 0u);
+
+    // Moving the parent moves the child's entry through its world matrix
+    parent.get_mut<TransformComponent>()->position.x = -10.0f;
+    parent.modified<TransformComponent>();
+    hierarchy.update();
+    index.update();
+    EXPECT_NEAR(index.bounds(child.id())->Center().x, -10.0f, 1e-5f);
+
+    child.destruct();
+    EXPECT_EQ(index.size(), 1u);
+    parent.remove<BoundsComponent>();
+    EXPECT_EQ(index.size(), 0u);
+
+    index.unbind();
+    hierarchy.unbind();
+}
@@ -0,0 +1,42 @@
+#include "TestHelpers.h"
+#include <Foundation/Memory/MemorySystem.h>
+#include <Core/Core.h>
+
+namespace ECSModuleTest
+{
+    void EntityWorldTestBase::SetUp()
+    {
+        EngineCore::Foundation::MemorySystem::startup(1024 * 1024, 4 * 1024 * 1024); // 1MB frame, 4MB persistent
+
+        resourceManager = std::make_shared<ResourceModule::ResourceManager>();
+        scriptModule = std::make_shared<ScriptModule::LuaScriptModule>();
+        physicsModule = std::make_shared<PhysicsModule::PhysicsModule>();
+    }
+
+    void EntityWorldTestBase::TearDown()
+    {
+        physicsModule.reset();
+        scriptModule.reset();
+        resourceManager.reset();
+        EngineCore::Base::Core::ShutdownAll();
+        EngineCore::Foundation::MemorySystem::shutdown();
+    }
+
+    std::unique_ptr<EntityWorld> EntityWorldTestBase::makeWorld()
+    {
+        auto world = std::make_unique<EntityWorld>(resourceManager.get(), scriptModule.get(), physicsModule.get());
+        world->init();
+        return world;
+    }
+
+    namespace Helpers
+    {
+        TransformComponent MakeTransform(float x)
+        {
+            TransformComponent transform{};
+            transform.position = {x, 0.0f, 0.0f};
+            transform.scale = {1.0f, 1.0f, 1.0f};
+            return transform;
+        }
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <Modules/ObjectCoreModule/ECS/EntityWorld.h>
+#include <Modules/ObjectCoreModule/ECS/Components/ECSComponents.h>
+#include <Modules/ResourceModule/ResourceManager.h>
+#include <Modules/ScriptModule/LuaScriptModule.h>
+#include <Modules/PhysicsModule/PhysicsModule.h>
+#include <memory>
+
+namespace ECSModuleTest
+{
+    // Base class for tests on EntityWorlds: the memory system and the modules a world is built on
+    class EntityWorldTestBase : public ::testing::Test
+    {
+    protected:
+        void SetUp() override;
+        // Fixtures release their worlds and jobs first, then call this
+        void TearDown() override;
+
+        // A world on this fixture's modules, initialized
+        std::unique_ptr<EntityWorld> makeWorld();
+
+        std::shared_ptr<ResourceModule::ResourceManager> resourceManager;
+        std::shared_ptr<ScriptModule::LuaScriptModule> scriptModule;
+        std::shared_ptr<PhysicsModule::PhysicsModule> physicsModule;
+    };
+
+    namespace Helpers
+    {
+        // Transform at (x, 0, 0) with unit scale and no rotation
+        TransformComponent MakeTransform(float x);
+    }
+}
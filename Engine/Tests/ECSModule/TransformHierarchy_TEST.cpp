@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <Modules/ObjectCoreModule/ECS/TransformHierarchy.h>
+#include <Modules/ObjectCoreModule/ECS/Components/ECSComponents.h>
+#include <Foundation/JobSystem/JobSystem.h>
+#include <vector>
+
+using namespace ECSModule;
+
+namespace
+{
+TransformComponent MakeTransform(const glm::vec3& position, float yawDegrees = 0.0f, float scale = 1.0f)
+{
+    TransformComponent transform{};
+    transform.position.fromGLMVec(position);
+    transform.rotation.y = yawDegrees;
+    transform.scale = {scale, scale, scale};
+    return transform;
+}
+
+void ExpectNear(const glm::vec3& expected, const glm::vec3& actual)
+{
+    EXPECT_NEAR(expected.x, actual.x, 1e-4f);
+    EXPECT_NEAR(expected.y, actual.y, 1e-4f);
+    EXPECT_NEAR(expected.z, actual.z, 1e-4f);
+}
+
+void ExpectNear(const glm::mat4& expected, const glm::mat4& actual)
+{
+    for (int c = 0; c < 4; ++c)
+        for (int r = 0; r < 4; ++r)
+            ASSERT_NEAR(expected[c][r], actual[c][r], 1e-3f) << "[" << c << "][" << r << "]";
+}
+
+glm::vec3 WorldPosition(flecs::entity e)
+{
+    return e.get<WorldTransformComponent>()->position();
+}
+} // namespace
+
+class TransformHierarchyTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ecs.component<TransformComponent>().add(flecs::With, ecs.component<WorldTransformComponent>());
+        root = ecs.entity().set<TransformComponent>(MakeTransform({10.0f, 0.0f, 0.0f}, 90.0f, 2.0f));
+        child = ecs.entity().child_of(root).set<TransformComponent>(MakeTransform({1.0f, 0.0f, 0.0f}));
+        grandchild = ecs.entity().child_of(child).set<TransformComponent>(MakeTransform({0.0f, 0.0f, 1.0f}));
+        other = ecs.entity().set<TransformComponent>(MakeTransform({-5.0f, 0.0f, 0.0f}));
+        hierarchy.bind(ecs);
+    }
+
+    void TearDown() override
+    {
+        hierarchy.unbind();
+    }
+
+    flecs::world ecs;
+    TransformHierarchy hierarchy;
+    flecs::entity root;
+    flecs::entity child;
+    flecs::entity grandchild;
+    flecs::entity other;
+};
+
+TEST_F(TransformHierarchyTest, WorldMatrixIsParentTimesLocal)
+{
+    EXPECT_EQ(hierarchy.update(), 4u);
+
+    const glm::mat4 rootMatrix = root.get<TransformComponent>()->toMatrix();
+    const glm::mat4 childMatrix = rootMatrix * child.get<TransformComponent>()->toMatrix();
+    const glm::mat4 grandchildMatrix = childMatrix * grandchild.get<TransformComponent>()->toMatrix();
+
+    EXPECT_EQ(root.get<WorldTransformComponent>()->matrix, rootMatrix);
+    ExpectNear(glm::vec3(childMatrix[3]), WorldPosition(child));
+    ExpectNear(glm::vec3(grandchildMatrix[3]), WorldPosition(grandchild));
+    ExpectNear({-5.0f, 0.0f, 0.0f}, WorldPosition(other));
+
+    // Yaw 90 turns the child's +X offset into -Z, scaled by the root's 2
+    ExpectNear({10.0f, 0.0f, -2.0f}, WorldPosition(child));
+}
+
+TEST_F(TransformHierarchyTest, StaticWorldUpdatesNothing)
+{
+    hierarchy.update();
+    for (int i = 0; i < 3; ++i)
+        EXPECT_EQ(hierarchy.update(), 0u);
+}
+
+TEST_F(TransformHierarchyTest, OnlyChangedSubtreeIsRecomputed)
+{
+    hierarchy.update();
+
+    // A leaf moves alone
+    grandchild.set<TransformComponent>(MakeTransform({0.0f, 3.0f, 0.0f}));
+    EXPECT_EQ(hierarchy.update(), 1u);
+    ExpectNear({10.0f, 6.0f, -2.0f}, WorldPosition(grandchild));
+
+    // The root drags its descendants; other shares its table, so it is recomputed as well
+    root.get_mut<TransformComponent>()->position.x = 20.0f;
+    root.modified<TransformComponent>();
+    EXPECT_EQ(hierarchy.update(), 4u); // the root's table (root, other), child, grandchild
+    ExpectNear({20.0f, 0.0f, -2.0f}, WorldPosition(child));
+    ExpectNear({20.0f, 6.0f, -2.0f}, WorldPosition(grandchild));
+
+    EXPECT_EQ(hierarchy.update(), 0u);
+}
+
+TEST_F(TransformHierarchyTest, ReparentingMovesTheSubtree)
+{
+    hierarchy.update();
+
+    child.child_of(other);
+    hierarchy.update();
+    ExpectNear({-4.0f, 0.0f, 0.0f}, WorldPosition(child));
+    ExpectNear({-4.0f, 0.0f, 1.0f}, WorldPosition(grandchild));
+
+    child.remove(flecs::ChildOf, flecs::Wildcard);
+    hierarchy.update();
+    ExpectNear({1.0f, 0.0f, 0.0f}, WorldPosition(child));
+    ExpectNear({1.0f, 0.0f, 1.0f}, WorldPosition(grandchild));
+}
+
+TEST_F(TransformHierarchyTest, ParallelLevelsMatchSerial)
+{
+    EngineCore::Foundation::JobSystem jobs;
+    jobs.setWorkerCount(4);
+    jobs.startup();
+
+    // Wide enough that the first two levels are split over the workers
+    std::vector<flecs::entity> parents;
+    std::vector<flecs::entity> children;
+    for (int i = 0; i < 5000; ++i)
+    {
+        const float x = static_cast<float>(i);
+        parents.push_back(ecs.entity().set<TransformComponent>(MakeTransform({x, 0.0f, 0.0f}, x)));
+        children.push_back(
+            ecs.entity().child_of(parents.back()).set<TransformComponent>(MakeTransform({0.0f, 1.0f, 0.0f})));
+    }
+
+    hierarchy.update(&jobs);
+    jobs.shutdown();
+
+    for (size_t i = 0; i < children.size(); ++i)
+    {
+        const glm::mat4 expected =
+            parents[i].get<TransformComponent>()->toMatrix() * children[i].get<TransformComponent>()->toMatrix();
+        ExpectNear(expected, children[i].get<WorldTransformComponent>()->matrix);
+    }
+}
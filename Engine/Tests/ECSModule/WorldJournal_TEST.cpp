@@ -0,0 +1,314 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include <Modules/ObjectCoreModule/ECS/EntityWorld.h>
+#include <Modules/ObjectCoreModule/ECS/Components/ECSComponents.h>
+#include <Modules/ObjectCoreModule/ECS/Serialization/WorldJournal.h>
+#include <Modules/ObjectCoreModule/ECS/Serialization/WorldSaver.h>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+using namespace ECSModule;
+using ECSModuleTest::Helpers::MakeTransform;
+
+namespace
+{
+int CountUserEntities(flecs::world& ecs)
+{
+    int count = 0;
+    ecs.each([&](flecs::entity e, const TransformComponent&) {
+        if (!e.name() || std::string(e.name()) != "ViewportCamera")
+            ++count;
+    });
+    return count;
+}
+
+float PositionOf(flecs::world& ecs, const char* name)
+{
+    flecs::entity e = ecs.lookup(name);
+    return e.is_valid() && e.has<TransformComponent>() ? e.get<TransformComponent>()->position.x : -1.0f;
+}
+} // namespace
+
+class WorldJournalTest : public ECSModuleTest::EntityWorldTestBase
+{
+protected:
+    void SetUp() override
+    {
+        EntityWorldTestBase::SetUp();
+        world = makeWorld();
+
+        directory = std::filesystem::temp_directory_path() / "lampy_world_journal_test";
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+        path = directory / "world.ljournal";
+    }
+
+    void TearDown() override
+    {
+        journal.reset();
+        world.reset();
+        std::filesystem::remove_all(directory);
+        EntityWorldTestBase::TearDown();
+    }
+
+    /// Crate at x = 1, Lamp at x = 2 and @p unnamed more entities
+    void populate(int unnamed = 0)
+    {
+        flecs::world& ecs = world->get();
+        ecs.entity("Crate").set<TransformComponent>(MakeTransform(1.0f)).add<InvisibleTag>();
+        ecs.entity("Lamp").set<TransformComponent>(MakeTransform(2.0f)).set<PointLightComponent>(PointLightComponent{});
+        for (int i = 0; i < unnamed; ++i)
+            ecs.entity().set<TransformComponent>(MakeTransform(100.0f + static_cast<float>(i)));
+    }
+
+    std::unique_ptr<EntityWorld> recover(WorldJournal::RecoverStats* stats = nullptr)
+    {
+        auto recovered = makeWorld();
+        EXPECT_TRUE(WorldJournal::Recover(*recovered, path, stats));
+        return recovered;
+    }
+
+    std::unique_ptr<EntityWorld> world;
+    std::unique_ptr<WorldJournal> journal;
+    std::filesystem::path directory;
+    std::filesystem::path path;
+};
+
+TEST_F(WorldJournalTest, CaptureWritesTheWorldAsItWasWhenTaken)
+{
+    populate(10);
+    std::stringstream expected;
+    ASSERT_TRUE(world->serializeBinary(expected));
+
+    WorldBinaryCapture capture;
+    WorldBinaryWriter writer(world->get(), world->getSerializedComponents());
+    ASSERT_TRUE(writer.capture(capture));
+    EXPECT_EQ(capture.entities().size(), static_cast<size_t>(CountUserEntities(world->get()) + 1));
+
+    // Changes after the capture do not reach the file
+    world->get().lookup("Crate").set<TransformComponent>(MakeTransform(50.0f));
+    world->get().lookup("Lamp").destruct();
+
+    std::stringstream written;
+    ASSERT_TRUE(capture.write(written));
+    EXPECT_EQ(written.str(), expected.str());
+    auto loaded = makeWorld();
+    ASSERT_TRUE(loaded->deserializeBinary(written));
+    EXPECT_EQ(PositionOf(loaded->get(), "Crate"), 1.0f);
+    EXPECT_EQ(PositionOf(loaded->get(), "Lamp"), 2.0f);
+    EXPECT_EQ(CountUserEntities(loaded->get()), 12);
+}
+
+TEST_F(WorldJournalTest, SaverWritesAtomicallyAndReportsOnce)
+{
+    populate(3);
+    const auto target = directory / "saved.worldbin";
+    std::ofstream(target) << "previous";
+
+    WorldSaver saver(nullptr);
+    ASSERT_TRUE(saver.save(*world, target));
+    EXPECT_TRUE(saver.isSaving());
+    EXPECT_FALSE(saver.save(*world, target)); // Not reported yet
+
+    WorldSaver::Result result;
+    ASSERT_TRUE(saver.poll(result));
+    EXPECT_TRUE(result.ok);
+    EXPECT_EQ(result.path.string(), target.string());
+    EXPECT_FALSE(saver.poll(result));
+    EXPECT_FALSE(saver.isSaving());
+    EXPECT_FALSE(std::filesystem::exists(directory / "saved.worldbin.tmp"));
+
+    std::ifstream in(target, std::ios::binary);
+    auto loaded = makeWorld();
+    ASSERT_TRUE(loaded->deserializeBinary(in));
+    EXPECT_EQ(CountUserEntities(loaded->get()), 5);
+    EXPECT_EQ(PositionOf(loaded->get(), "Lamp"), 2.0f);
+
+    // A directory in the way of the rename; the failure is reported
+    ASSERT_TRUE(saver.save(*world, directory));
+    ASSERT_TRUE(saver.poll(result));
+    EXPECT_FALSE(result.ok);
+    EXPECT_FALSE(result.error.empty());
+}
+
+TEST_F(WorldJournalTest, DeltasRecordOnlyChangedEntities)
+{
+    populate(50);
+    journal = std::make_unique<WorldJournal>(*world, path, nullptr);
+    ASSERT_TRUE(journal->flush());
+    EXPECT_EQ(journal->getStats().records, 1u);
+    EXPECT_EQ(journal->getStats().lastFlushEntities, 52u);
+
+    // Nothing changed, nothing written
+    ASSERT_TRUE(journal->flush());
+    EXPECT_EQ(journal->getStats().records, 1u);
+
+    flecs::world& ecs = world->get();
+    ecs.lookup("Lamp").remove<TransformComponent>();
+    ecs.entity("Barrel").set<PointLightComponent>(PointLightComponent{});
+    ecs.lookup("Crate").destruct();
+    ASSERT_TRUE(journal->flush());
+    EXPECT_EQ(journal->getStats().records, 2u);
+    EXPECT_EQ(journal->getStats().lastFlushEntities, 2u); // Lamp and Barrel; Crate is a removal
+    EXPECT_EQ(std::filesystem::file_size(path), journal->getStats().fileBytes);
+
+    WorldJournal::RecoverStats stats;
+    auto recovered = recover(&stats);
+    EXPECT_EQ(stats.records, 2u);
+    EXPECT_FALSE(stats.tornTail);
+    EXPECT_EQ(stats.entities, 52u);
+    flecs::world& loaded = recovered->get();
+    EXPECT_FALSE(loaded.lookup("Crate").is_valid());
+    ASSERT_TRUE(loaded.lookup("Lamp").is_valid());
+    EXPECT_FALSE(loaded.lookup("Lamp").has<TransformComponent>());
+    EXPECT_TRUE(loaded.lookup("Lamp").has<PointLightComponent>());
+    EXPECT_TRUE(loaded.lookup("Barrel").has<PointLightComponent>());
+    EXPECT_EQ(CountUserEntities(loaded), 50);
+    EXPECT_TRUE(loaded.lookup("ViewportCamera").is_valid());
+}
+
+TEST_F(WorldJournalTest, ValueChangesAreJournaled)
+{
+    populate();
+    journal = std::make_unique<WorldJournal>(*world, path, nullptr);
+    ASSERT_TRUE(journal->flush());
+
+    flecs::world& ecs = world->get();
+    ecs.lookup("Crate").set<TransformComponent>(MakeTransform(7.0f));
+    ASSERT_TRUE(journal->flush());
+    ecs.lookup("Crate").set<TransformComponent>(MakeTransform(9.0f));
+    ASSERT_TRUE(journal->flush());
+    EXPECT_EQ(journal->getStats().records, 3u);
+
+    auto recovered = recover();
+    EXPECT_EQ(PositionOf(recovered->get(), "Crate"), 9.0f);
+    EXPECT_EQ(PositionOf(recovered->get(), "Lamp"), 2.0f);
+    EXPECT_TRUE(recovered->get().lookup("Crate").has<InvisibleTag>());
+}
+
+TEST_F(WorldJournalTest, ParentsSurviveSaveAndRecovery)
+{
+    populate();
+    flecs::world& ecs = world->get();
+    flecs::entity arm = ecs.entity("Arm").child_of(ecs.lookup("Crate")).set<TransformComponent>(MakeTransform(5.0f));
+    ecs.entity("Hand").child_of(arm).set<TransformComponent>(MakeTransform(1.0f));
+
+    const auto target = directory / "saved.worldbin";
+    WorldSaver saver(nullptr);
+    WorldSaver::Result result;
+    ASSERT_TRUE(saver.save(*world, target));
+    ASSERT_TRUE(saver.poll(result));
+    ASSERT_TRUE(result.ok);
+    std::ifstream in(target, std::ios::binary);
+    auto loaded = makeWorld();
+    ASSERT_TRUE(loaded->deserializeBinary(in));
+    loaded->updateTransforms();
+    flecs::entity hand = loaded->get().lookup("Crate::Arm::Hand");
+    ASSERT_TRUE(hand.is_valid());
+    EXPECT_FLOAT_EQ(hand.get<WorldTransformComponent>()->position().x, 7.0f);
+
+    journal = std::make_unique<WorldJournal>(*world, path, nullptr);
+    ASSERT_TRUE(journal->flush());
+    // The parent is replaced by a delta its child is not in
+    ecs.lookup("Crate").set<TransformComponent>(MakeTransform(9.0f));
+    ASSERT_TRUE(journal->flush());
+    EXPECT_EQ(journal->getStats().lastFlushEntities, 1u);
+    // Reparenting alone is a change
+    ecs.lookup("Crate::Arm::Hand").child_of(ecs.lookup("Lamp"));
+    ASSERT_TRUE(journal->flush());
+    EXPECT_EQ(journal->getStats().records, 3u);
+    EXPECT_EQ(journal->getStats().lastFlushEntities, 1u);
+
+    auto recovered = recover();
+    recovered->updateTransforms();
+    flecs::world& rebuilt = recovered->get();
+    flecs::entity recoveredArm = rebuilt.lookup("Crate::Arm");
+    ASSERT_TRUE(recoveredArm.is_valid());
+    EXPECT_EQ(recoveredArm.parent(), rebuilt.lookup("Crate"));
+    EXPECT_FLOAT_EQ(recoveredArm.get<WorldTransformComponent>()->position().x, 14.0f);
+    EXPECT_FALSE(rebuilt.lookup("Crate::Arm::Hand").is_valid());
+    flecs::entity recoveredHand = rebuilt.lookup("Lamp::Hand");
+    ASSERT_TRUE(recoveredHand.is_valid());
+    EXPECT_FLOAT_EQ(recoveredHand.get<WorldTransformComponent>()->position().x, 3.0f);
+    EXPECT_EQ(CountUserEntities(rebuilt), 4);
+}
+
+TEST_F(WorldJournalTest, TornTailIsIgnored)
+{
+    populate();
+    journal = std::make_unique<WorldJournal>(*world, path, nullptr);
+    ASSERT_TRUE(journal->flush());
+    world->get().lookup("Crate").set<TransformComponent>(MakeTransform(5.0f));
+    ASSERT_TRUE(journal->flush());
+    journal.reset();
+
+    // A crash in the middle of the last append
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 3);
+    WorldJournal::RecoverStats stats;
+    auto recovered = recover(&stats);
+    EXPECT_TRUE(stats.tornTail);
+    EXPECT_EQ(stats.records, 1u);
+    EXPECT_EQ(PositionOf(recovered->get(), "Crate"), 1.0f);
+
+    // Without a readable checkpoint nothing is recovered and the world is left alone
+    std::filesystem::resize_file(path, 20);
+    auto untouched = makeWorld();
+    untouched->get().entity("Keep").set<TransformComponent>(MakeTransform(3.0f));
+    EXPECT_FALSE(WorldJournal::Recover(*untouched, path));
+    EXPECT_EQ(PositionOf(untouched->get(), "Keep"), 3.0f);
+    EXPECT_FALSE(WorldJournal::Recover(*untouched, directory / "missing.ljournal"));
+}
+
+TEST_F(WorldJournalTest, CompactionStartsANewCheckpoint)
+{
+    populate(20);
+    WorldJournalConfig config;
+    config.compactRecords = 2;
+    config.compactRatio = 100.0f;
+    journal = std::make_unique<WorldJournal>(*world, path, nullptr, config);
+    ASSERT_TRUE(journal->flush());
+
+    flecs::world& ecs = world->get();
+    for (int i = 0; i < 3; ++i)
+    {
+        ecs.lookup("Crate").set<TransformComponent>(MakeTransform(10.0f + static_cast<float>(i)));
+        ASSERT_TRUE(journal->flush());
+    }
+    EXPECT_EQ(journal->getStats().checkpoints, 2u);
+    EXPECT_EQ(journal->getStats().records, 1u);
+    EXPECT_EQ(std::filesystem::file_size(path), journal->getStats().fileBytes);
+    EXPECT_FALSE(std::filesystem::exists(directory / "world.ljournal.tmp"));
+
+    auto recovered = recover();
+    EXPECT_EQ(PositionOf(recovered->get(), "Crate"), 12.0f);
+    EXPECT_EQ(CountUserEntities(recovered->get()), 22);
+
+    journal->discard();
+    EXPECT_FALSE(std::filesystem::exists(path));
+}
+
+TEST_F(WorldJournalTest, HeaderRecordsTheSourceResource)
+{
+    populate();
+    const auto source = WorldJournalSource::Of("Worlds/level.lworld", "{\"entities\": []}");
+    journal = std::make_unique<WorldJournal>(*world, path, nullptr, WorldJournalConfig{}, source);
+    ASSERT_TRUE(journal->flush());
+    world->get().lookup("Crate").set<TransformComponent>(MakeTransform(4.0f));
+    ASSERT_TRUE(journal->flush());
+    EXPECT_EQ(std::filesystem::file_size(path), journal->getStats().fileBytes);
+
+    WorldJournalSource recorded;
+    ASSERT_TRUE(WorldJournal::ReadSource(path, recorded));
+    EXPECT_EQ(recorded, source);
+    EXPECT_NE(recorded, WorldJournalSource::Of("Worlds/level.lworld", "{\"entities\": [1]}"));
+
+    auto recovered = recover();
+    EXPECT_EQ(PositionOf(recovered->get(), "Crate"), 4.0f);
+
+    EXPECT_FALSE(WorldJournal::ReadSource(directory / "missing.ljournal", recorded));
+    std::ofstream(directory / "foreign.ljournal") << "not a journal";
+    EXPECT_FALSE(WorldJournal::ReadSource(directory / "foreign.ljournal", recorded));
+}
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include <Modules/ObjectCoreModule/ECS/WorldManager.h>
+#include <Modules/ObjectCoreModule/ECS/Components/ECSComponents.h>
+#include <Foundation/JobSystem/JobSystem.h>
+#include <chrono>
+#include <list>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ECSModule;
+using EngineCore::Foundation::JobSystem;
+
+class WorldManagerTest : public ECSModuleTest::EntityWorldTestBase
+{
+protected:
+    void SetUp() override
+    {
+        EntityWorldTestBase::SetUp();
+        manager = std::make_unique<WorldManager>(resourceManager.get(), scriptModule.get(), physicsModule.get());
+    }
+
+    void TearDown() override
+    {
+        manager.reset();
+        if (jobs)
+        {
+            jobs->shutdown();
+            jobs.reset();
+        }
+        EntityWorldTestBase::TearDown();
+    }
+
+    /// Records the dt of every tick of @p name, optionally taking @p cost per tick.
+    std::vector<float>& track(const std::string& name, bool isolated,
+                              std::chrono::milliseconds cost = std::chrono::milliseconds(0))
+    {
+        EntityWorld& world = manager->createWorld(name);
+        world.isolateEvents(isolated);
+        std::vector<float>& deltas = recorded.emplace_back();
+        // Matches the world's ViewportCamera, so it runs once per tick
+        world.get().system<const CameraComponent>().each([&deltas, cost](flecs::iter& it, size_t, const CameraComponent&) {
+            deltas.push_back(it.delta_time());
+            if (cost.count() > 0)
+                std::this_thread::sleep_for(cost);
+        });
+        return deltas;
+    }
+
+    std::unique_ptr<WorldManager> manager;
+    std::unique_ptr<JobSystem> jobs;
+    std::list<std::vector<float>> recorded;
+};
+
+TEST_F(WorldManagerTest, TicksEveryUnpausedWorldOnce)
+{
+    auto& first = track("first", false);
+    auto& second = track("second", true);
+    auto& paused = track("paused", true);
+    manager->setTickSettings("paused", {0.0, true});
+
+    EXPECT_EQ(manager->tickAll(0.1f), 2u);
+    EXPECT_EQ(manager->tickAll(0.1f), 2u);
+
+    EXPECT_EQ(first.size(), 2u);
+    EXPECT_EQ(second.size(), 2u);
+    EXPECT_TRUE(paused.empty());
+    ASSERT_NE(manager->getTickStats("first"), nullptr);
+    EXPECT_EQ(manager->getTickStats("first")->ticks, 2u);
+    EXPECT_EQ(manager->getTickStats("paused")->ticks, 0u);
+    // No job system set: everything ran here
+    EXPECT_FALSE(manager->getTickStats("second")->onJob);
+    EXPECT_EQ(manager->getTickStats("missing"), nullptr);
+
+    manager->destroyWorld("second");
+    EXPECT_EQ(manager->getTickStats("second"), nullptr);
+    EXPECT_EQ(manager->tickAll(0.1f), 1u);
+}
+
+TEST_F(WorldManagerTest, IsolatedWorldsRunAsJobsAndKeepTheirEvents)
+{
+    jobs = std::make_unique<JobSystem>();
+    jobs->setWorkerCount(4);
+    jobs->startup();
+    manager->setJobSystem(jobs.get());
+
+    track("shared", false);
+    std::vector<std::vector<float>*> sessions;
+    for (int i = 0; i < 16; ++i)
+    {
+        const std::string name = "session" + std::to_string(i);
+        sessions.push_back(&track(name, true));
+        EntityWorld& world = *manager->getWorld(name);
+        for (int e = 0; e < 200; ++e)
+            world.get().entity().set<TransformComponent>(TransformComponent{});
+    }
+
+    // A session's events stay on its own bus
+    EntityWorld& session = *manager->getWorld("session0");
+    int onSession = 0;
+    int onCore = 0;
+    auto sessionSub = session.events().subscribe<Events::ECS::EntitiesSpawned>(
+        [&](const Events::ECS::EntitiesSpawned& event) { onSession += static_cast<int>(event.ids.size()); });
+    auto coreSub = GCEB().subscribe<Events::ECS::EntitiesSpawned>(
+        [&](const Events::ECS::EntitiesSpawned& event) { onCore += static_cast<int>(event.ids.size()); });
+    session.spawnBatch(session.createPrefab("crate", R"({"components": {}})"), 3);
+    EXPECT_EQ(onSession, 3);
+    EXPECT_EQ(onCore, 0);
+
+    constexpr int kFrames = 5;
+    for (int frame = 0; frame < kFrames; ++frame)
+        EXPECT_EQ(manager->tickAll(1.0f / 30.0f), sessions.size() + 1);
+
+    for (auto* deltas : sessions)
+        EXPECT_EQ(deltas->size(), static_cast<size_t>(kFrames));
+    EXPECT_TRUE(manager->getTickStats("session3")->onJob);
+    EXPECT_FALSE(manager->getTickStats("shared")->onJob);
+    EXPECT_EQ(manager->getTickStats("session3")->ticks, static_cast<uint64_t>(kFrames));
+}
+
+TEST_F(WorldManagerTest, FrameBudgetDefersWithoutStarving)
+{
+    const auto cost = std::chrono::milliseconds(3);
+    auto& a = track("a", false, cost);
+    auto& b = track("b", false, cost);
+    auto& c = track("c", false, cost);
+
+    // Ticked in name order at first; the budget runs out after the first world
+    EXPECT_EQ(manager->tickAll(0.1f, 1.0), 1u);
+    EXPECT_EQ(a.size(), 1u);
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(manager->getTickStats("b")->deferred, 1u);
+    EXPECT_FLOAT_EQ(manager->getTickStats("c")->pendingDt, 0.1f);
+
+    // The deferred worlds go first and catch up on the time they missed
+    EXPECT_EQ(manager->tickAll(0.1f, 1.0), 2u);
+    ASSERT_EQ(b.size(), 1u);
+    ASSERT_EQ(c.size(), 1u);
+    EXPECT_NEAR(b[0], 0.2f, 1e-5f);
+    EXPECT_NEAR(c[0], 0.2f, 1e-5f);
+    EXPECT_EQ(a.size(), 1u);
+
+    manager->tickAll(0.1f, 1.0);
+    EXPECT_EQ(a.size(), 2u);
+
+    // Every world has been given all of the time so far, or owes the rest
+    for (const char* name : {"a", "b", "c"})
+    {
+        const auto& deltas = name[0] == 'a' ? a : (name[0] == 'b' ? b : c);
+        const float given = std::accumulate(deltas.begin(), deltas.end(), 0.0f);
+        EXPECT_NEAR(given + manager->getTickStats(name)->pendingDt, 0.3f, 1e-5f) << name;
+    }
+    EXPECT_GT(manager->getTickStats("a")->averageMs, 0.0);
+}
+
+TEST_F(WorldManagerTest, BudgetOverrunsAreCounted)
+{
+    track("slow", false, std::chrono::milliseconds(3));
+    manager->setTickSettings("slow", {1.0, false});
+    manager->tickAll(0.1f);
+    manager->tickAll(0.1f);
+
+    const auto* stats = manager->getTickStats("slow");
+    EXPECT_EQ(stats->overruns, 2u);
+    EXPECT_GE(stats->maxMs, 3.0);
+    EXPECT_GE(stats->lastMs, 3.0);
+}
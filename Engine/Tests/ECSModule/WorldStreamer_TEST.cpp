@@ -0,0 +1,272 @@
+#include <gtest/gtest.h>
+#include "TestHelpers.h"
+#include <Modules/ObjectCoreModule/ECS/EntityWorld.h>
+#include <Modules/ObjectCoreModule/ECS/WorldStreamer.h>
+#include <Modules/ObjectCoreModule/ECS/Components/ECSComponents.h>
+#include <Modules/ObjectCoreModule/ECS/Serialization/WorldPartition.h>
+#include <Foundation/JobSystem/JobSystem.h>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <thread>
+
+using namespace ECSModule;
+using CellState = WorldStreamer::CellState;
+
+namespace
+{
+constexpr float kCellSize = 10.0f;
+
+/// Entities with a transform, other than the viewport camera
+int CountPlaced(flecs::world& ecs)
+{
+    int count = 0;
+    ecs.each([&](flecs::entity e, const TransformComponent&) {
+        if (!e.has<CameraComponent>())
+            ++count;
+    });
+    return count;
+}
+
+int CountLights(flecs::world& ecs)
+{
+    int count = 0;
+    ecs.each([&](flecs::entity, const PointLightComponent&) { ++count; });
+    return count;
+}
+
+Math::Vec3 CellCenter(int x, int z)
+{
+    return {(static_cast<float>(x) + 0.5f) * kCellSize, 0.0f, (static_cast<float>(z) + 0.5f) * kCellSize};
+}
+} // namespace
+
+class WorldStreamerTest : public ECSModuleTest::EntityWorldTestBase
+{
+protected:
+    void SetUp() override
+    {
+        EntityWorldTestBase::SetUp();
+        source = makeWorld();
+        target = makeWorld();
+
+        directory = std::filesystem::temp_directory_path() / "lampy_world_streamer_test";
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+        manifest = directory / "open.lpartition";
+    }
+
+    void TearDown() override
+    {
+        streamer.reset();
+        if (jobs)
+            jobs->shutdown();
+        jobs.reset();
+        target.reset();
+        source.reset();
+        std::filesystem::remove_all(directory);
+        EntityWorldTestBase::TearDown();
+    }
+
+    /// @p perCell entities in every cell of a 5x5 grid around the origin, and two lights without a transform
+    void build(int perCell, uint32_t chunkEntities = 256)
+    {
+        flecs::world& ecs = source->get();
+        for (int z = -2; z <= 2; ++z)
+        {
+            for (int x = -2; x <= 2; ++x)
+            {
+                for (int i = 0; i < perCell; ++i)
+                {
+                    TransformComponent transform{};
+                    const Math::Vec3 offset(static_cast<float>(i) * 0.01f, 0.0f, 0.0f);
+                    transform.position.fromGLMVec(CellCenter(x, z) + offset);
+                    transform.scale = {1.0f, 1.0f, 1.0f};
+                    ecs.entity().set<TransformComponent>(transform);
+                }
+            }
+        }
+        ecs.entity().set<PointLightComponent>(PointLightComponent{});
+        ecs.entity().set<PointLightComponent>(PointLightComponent{});
+
+        auto partition = WorldPartition::Build(ecs, source->getSerializedComponents(), kCellSize, manifest, chunkEntities);
+        ASSERT_TRUE(partition.has_value());
+        ASSERT_EQ(partition->getCells().size(), 25u);
+        ASSERT_EQ(partition->getPersistent().entities, 2u);
+    }
+
+    void open(const WorldStreamingConfig& config, const Math::Vec3& at)
+    {
+        streamer = std::make_unique<WorldStreamer>(*target, jobs.get());
+        streamer->configure(config);
+        ASSERT_TRUE(streamer->open(manifest));
+        focus = streamer->addFocus(at);
+    }
+
+    std::unique_ptr<EntityWorld> source;
+    std::unique_ptr<EntityWorld> target;
+    std::unique_ptr<EngineCore::Foundation::JobSystem> jobs;
+    std::unique_ptr<WorldStreamer> streamer;
+    WorldStreamer::FocusId focus = 0;
+    std::filesystem::path directory;
+    std::filesystem::path manifest;
+};
+
+TEST_F(WorldStreamerTest, ManifestRoundTrips)
+{
+    build(2);
+    WorldPartition loaded;
+    ASSERT_TRUE(loaded.load(manifest));
+    EXPECT_FLOAT_EQ(loaded.getCellSize(), kCellSize);
+    EXPECT_EQ(loaded.getCells().size(), 25u);
+
+    const WorldPartition::Cell* cell = loaded.findCell({-2, 1});
+    ASSERT_NE(cell, nullptr);
+    EXPECT_EQ(cell->entities, 2u);
+    EXPECT_GT(cell->bytes, 0u);
+    EXPECT_TRUE(std::filesystem::exists(loaded.resolve(cell->file)));
+    EXPECT_EQ(loaded.findCell({3, 0}), nullptr);
+
+    EXPECT_EQ(loaded.cellAt({-0.5f, 100.0f, 19.0f}), (WorldCellKey{-1, 1}));
+    EXPECT_FLOAT_EQ(loaded.distanceTo({1, 0}, {5.0f, 0.0f, 5.0f}), 5.0f);
+    EXPECT_FLOAT_EQ(loaded.distanceTo({0, 0}, {5.0f, 0.0f, 5.0f}), 0.0f);
+}
+
+TEST_F(WorldStreamerTest, LoadsAroundFocusAndUnloadsPastHysteresis)
+{
+    build(4);
+    open(WorldStreamingConfig{5.0f, 15.0f, 1ull << 30, 1000.0, 4}, CellCenter(0, 0));
+
+    // Persistent entities come with open(), cells with the first update
+    flecs::world& ecs = target->get();
+    EXPECT_EQ(CountLights(ecs), 2);
+    EXPECT_EQ(CountPlaced(ecs), 0);
+
+    int destroyed = 0;
+    auto sub = target->events().subscribe<Events::ECS::EntitiesDestroyed>(
+        [&](const Events::ECS::EntitiesDestroyed& event) { destroyed += static_cast<int>(event.ids.size()); });
+
+    streamer->update();
+    // The cell under the focus and the four sharing an edge with it
+    EXPECT_EQ(streamer->getStats().loadedCells, 5u);
+    EXPECT_EQ(CountPlaced(ecs), 5 * 4);
+    EXPECT_EQ(streamer->getCellState({1, 0}), CellState::Loaded);
+    EXPECT_EQ(streamer->getCellState({1, 1}), CellState::Unloaded);
+
+    // One cell over: (-1, 0) is 12 away, inside the unload radius, so it stays
+    streamer->setFocus(focus, CellCenter(1, 0) - Math::Vec3(3.0f, 0.0f, 0.0f));
+    streamer->update();
+    EXPECT_EQ(streamer->getCellState({-1, 0}), CellState::Loaded);
+    EXPECT_EQ(streamer->getCellState({1, 1}), CellState::Loaded);
+    EXPECT_EQ(destroyed, 0);
+
+    // Far away: everything goes, the persistent entities stay
+    streamer->setFocus(focus, {200.0f, 0.0f, 0.0f});
+    streamer->update();
+    EXPECT_EQ(streamer->getStats().loadedCells, 0u);
+    EXPECT_EQ(CountPlaced(ecs), 0);
+    EXPECT_EQ(destroyed, static_cast<int>(streamer->getStats().cellsUnloaded) * 4);
+    EXPECT_EQ(CountLights(ecs), 2);
+
+    streamer->close();
+    EXPECT_EQ(CountLights(ecs), 0);
+}
+
+TEST_F(WorldStreamerTest, InstantiationIsSlicedByChunk)
+{
+    build(64, 8);
+    // A zero budget still creates one chunk per update
+    open(WorldStreamingConfig{0.0f, 0.0f, 1ull << 30, 0.0, 1}, CellCenter(0, 0));
+
+    streamer->update();
+    EXPECT_EQ(streamer->getStats().entitiesCreated, 8u);
+    EXPECT_EQ(streamer->getCellState({0, 0}), CellState::Instantiating);
+
+    int updates = 1;
+    while (streamer->getCellState({0, 0}) != CellState::Loaded && updates < 100)
+    {
+        streamer->update();
+        ++updates;
+    }
+    EXPECT_EQ(updates, 8);
+    EXPECT_EQ(CountPlaced(target->get()), 64);
+}
+
+TEST_F(WorldStreamerTest, MemoryBudgetEvictsHysteresisCellsFirst)
+{
+    build(16);
+    WorldPartition partition;
+    ASSERT_TRUE(partition.load(manifest));
+    // Room for five cells and a bit; the cells hold the same entities, so their sizes match
+    const uint64_t cellBytes = partition.findCell({0, 0})->bytes;
+    open(WorldStreamingConfig{5.0f, 100.0f, cellBytes * 5 + cellBytes / 2, 1000.0, 8}, CellCenter(0, 0));
+
+    streamer->update();
+    EXPECT_EQ(streamer->getStats().loadedCells, 5u);
+
+    // Two new cells are wanted; the farthest kept ones make room
+    streamer->setFocus(focus, CellCenter(1, 0) - Math::Vec3(3.0f, 0.0f, 0.0f));
+    streamer->update();
+    EXPECT_EQ(streamer->getCellState({1, 1}), CellState::Loaded);
+    EXPECT_EQ(streamer->getCellState({1, -1}), CellState::Loaded);
+    EXPECT_EQ(streamer->getCellState({-1, 0}), CellState::Unloaded);
+    EXPECT_EQ(streamer->getCellState({0, 0}), CellState::Loaded);
+    EXPECT_EQ(streamer->getStats().cellsEvicted, 2u);
+    EXPECT_LE(streamer->getStats().residentBytes, cellBytes * 5 + cellBytes / 2);
+}
+
+TEST_F(WorldStreamerTest, ReadsRunAsJobsAndFailuresAreReported)
+{
+    jobs = std::make_unique<EngineCore::Foundation::JobSystem>();
+    jobs->setWorkerCount(2);
+    jobs->startup();
+    build(4);
+
+    // A truncated cell fails on its job without creating anything
+    WorldPartition partition;
+    ASSERT_TRUE(partition.load(manifest));
+    std::filesystem::resize_file(partition.resolve(partition.findCell({0, 1})->file), 16);
+
+    open(WorldStreamingConfig{5.0f, 15.0f, 1ull << 30, 1000.0, 4}, CellCenter(0, 0));
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (streamer->getStats().loadedCells < 4 && std::chrono::steady_clock::now() < deadline)
+    {
+        streamer->update();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    EXPECT_EQ(streamer->getStats().loadedCells, 4u);
+    EXPECT_EQ(streamer->getCellState({0, 1}), CellState::Failed);
+    EXPECT_EQ(streamer->getStats().failures, 1u);
+    EXPECT_EQ(CountPlaced(target->get()), 4 * 4);
+}
+
+TEST_F(WorldStreamerTest, HierarchiesStreamWithTheirRoot)
+{
+    flecs::world& ecs = source->get();
+    TransformComponent rootTransform{};
+    rootTransform.position.fromGLMVec(CellCenter(0, 0));
+    rootTransform.scale = {1.0f, 1.0f, 1.0f};
+    flecs::entity rig = ecs.entity("Rig").set<TransformComponent>(rootTransform);
+    // A world position two cells over, still streamed with its parent
+    flecs::entity arm =
+        ecs.entity("Arm").child_of(rig).set<TransformComponent>(ECSModuleTest::Helpers::MakeTransform(2.0f * kCellSize));
+    ecs.entity("Hand").child_of(arm).set<PointLightComponent>(PointLightComponent{});
+    source->updateTransforms();
+
+    auto partition = WorldPartition::Build(ecs, source->getSerializedComponents(), kCellSize, manifest);
+    ASSERT_TRUE(partition.has_value());
+    ASSERT_EQ(partition->getCells().size(), 1u);
+    EXPECT_EQ(partition->getCells()[0].key, (WorldCellKey{0, 0}));
+    EXPECT_EQ(partition->getCells()[0].entities, 3u);
+    EXPECT_EQ(partition->getPersistent().entities, 0u);
+
+    open(WorldStreamingConfig{0.0f, 0.0f, 1ull << 30, 1000.0, 1}, CellCenter(0, 0));
+    streamer->update();
+    ASSERT_EQ(streamer->getCellState({0, 0}), CellState::Loaded);
+    flecs::world& loaded = target->get();
+    flecs::entity hand = loaded.lookup("Rig::Arm::Hand");
+    ASSERT_TRUE(hand.is_valid());
+    EXPECT_TRUE(hand.has<PointLightComponent>());
+    EXPECT_EQ(loaded.lookup("Rig::Arm").parent(), loaded.lookup("Rig"));
+}
@@ -439,3 +439,23 @@ TEST_F(JobHandleTest, MoveWhileJobRunning)
     EXPECT_EQ(handle2.counter->load(), 0);
 }
 
+
+TEST(JobHandleHelpTest, WaitInsideJobRunsNestedJobs)
+{
+    // One worker: a job waiting on its children can only finish if the wait runs them itself.
+    JobSystem jobs;
+    jobs.setWorkerCount(1);
+    jobs.startup();
+
+    std::atomic<int> children{0};
+    JobHandle parent = jobs.submit([&]() {
+        JobHandle nested;
+        for (int i = 0; i < 8; ++i)
+            jobs.submit([&children]() { ++children; }, nested);
+        nested.wait();
+    });
+    parent.wait();
+
+    EXPECT_EQ(children.load(), 8);
+    jobs.shutdown();
+}
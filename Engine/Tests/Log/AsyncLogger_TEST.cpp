@@ -0,0 +1,271 @@
+#include <gtest/gtest.h>
+#include <Foundation/Log/Logger.h>
+#include <Foundation/Log/LogRingBuffer.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+using namespace EngineCore::Foundation;
+
+namespace
+{
+class CaptureSink final : public ILogSink
+{
+  public:
+    void write(LogVerbosity level, const std::string& category, const std::string& message) override
+    {
+        std::scoped_lock lock(m_mutex);
+        m_lines.push_back(category + ":" + message);
+        (void)level;
+    }
+
+    void flush() override
+    {
+        ++m_flushes;
+    }
+
+    std::vector<std::string> lines()
+    {
+        std::scoped_lock lock(m_mutex);
+        return m_lines;
+    }
+
+    std::atomic<int> m_flushes{0};
+
+  private:
+    std::mutex m_mutex;
+    std::vector<std::string> m_lines;
+};
+
+// Holds the writer inside a sink call so the ring can be filled deterministically.
+class GateSink final : public ILogSink
+{
+  public:
+    void write(LogVerbosity, const std::string&, const std::string&) override
+    {
+        while (closed.load())
+            std::this_thread::yield();
+        ++written;
+    }
+
+    std::atomic<bool> closed{true};
+    std::atomic<int> written{0};
+};
+} // namespace
+
+class AsyncLoggerTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        LTLogger::Instance().clearSinks();
+        sink = std::make_shared<CaptureSink>();
+        LTLogger::Instance().addSink(sink);
+    }
+
+    void TearDown() override
+    {
+        LTLogger::Instance().stopAsync();
+        LTLogger::Instance().clearSinks();
+        LTLogger::Instance().addSink(std::make_shared<ConsoleSink>());
+    }
+
+    std::shared_ptr<CaptureSink> sink;
+};
+
+// ============================================================================
+// Ring buffer
+// ============================================================================
+
+TEST(LogRingBufferTest, CapacityRoundsUpToPowerOfTwo)
+{
+    LogRingBuffer ring(100);
+    EXPECT_EQ(ring.capacity(), 128u);
+}
+
+TEST(LogRingBufferTest, PushFailsWhenFullAndConsumesInOrder)
+{
+    LogRingBuffer ring(4);
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(ring.tryPush([i](LogRecord& r) {
+            r.assign(LogVerbosity::Info, "Cat", std::to_string(i), 0, 0);
+        }));
+    }
+    EXPECT_FALSE(ring.tryPush([](LogRecord& r) { r.assign(LogVerbosity::Info, "Cat", "overflow", 0, 0); }));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        std::string got;
+        EXPECT_TRUE(ring.tryConsume([&got](const LogRecord& r) { got = std::string(r.messageView()); }));
+        EXPECT_EQ(got, std::to_string(i));
+    }
+    EXPECT_TRUE(ring.empty());
+    EXPECT_FALSE(ring.tryConsume([](const LogRecord&) {}));
+}
+
+TEST(LogRingBufferTest, LongMessagesAreTruncated)
+{
+    LogRecord record;
+    std::string longMessage(LogRecord::kMaxMessageLength * 2, 'x');
+    record.assign(LogVerbosity::Info, std::string(200, 'c'), longMessage, 0, 0);
+
+    EXPECT_EQ(record.messageView().size(), LogRecord::kMaxMessageLength);
+    EXPECT_EQ(record.categoryView().size(), LogRecord::kMaxCategoryLength);
+    EXPECT_EQ(record.messageView().substr(LogRecord::kMaxMessageLength - 3), "...");
+}
+
+TEST(LogRingBufferTest, ConcurrentProducersLoseNothing)
+{
+    LogRingBuffer ring(1024);
+    constexpr int kThreads = 4;
+    constexpr int kPerThread = 5000;
+    std::atomic<int> consumed{0};
+    std::atomic<bool> done{false};
+
+    std::thread consumer([&]() {
+        while (!done.load() || !ring.empty())
+        {
+            if (!ring.tryConsume([&](const LogRecord&) { consumed.fetch_add(1); }))
+                std::this_thread::yield();
+        }
+    });
+
+    std::vector<std::thread> producers;
+    for (int t = 0; t < kThreads; ++t)
+    {
+        producers.emplace_back([&]() {
+            for (int i = 0; i < kPerThread; ++i)
+            {
+                while (!ring.tryPush([](LogRecord& r) { r.assign(LogVerbosity::Info, "T", "m", 0, 0); }))
+                    std::this_thread::yield();
+            }
+        });
+    }
+    for (auto& p : producers)
+        p.join();
+    done = true;
+    consumer.join();
+
+    EXPECT_EQ(consumed.load(), kThreads * kPerThread);
+}
+
+// ============================================================================
+// Logger
+// ============================================================================
+
+TEST_F(AsyncLoggerTest, SynchronousWithoutStartAsync)
+{
+    EXPECT_FALSE(LTLogger::Instance().isAsync());
+    LTLogger::Instance().log(LogVerbosity::Info, "Test", "sync");
+
+    auto lines = sink->lines();
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_EQ(lines[0], "Test:sync");
+}
+
+TEST_F(AsyncLoggerTest, FlushDeliversAllRecordsInOrder)
+{
+    LTLogger::Instance().startAsync({256, LogOverflowPolicy::Block});
+    EXPECT_TRUE(LTLogger::Instance().isAsync());
+
+    for (int i = 0; i < 1000; ++i)
+        LTLogger::Instance().log(LogVerbosity::Info, "Test", std::to_string(i));
+    LTLogger::Instance().flush();
+
+    auto lines = sink->lines();
+    ASSERT_EQ(lines.size(), 1000u);
+    for (int i = 0; i < 1000; ++i)
+        EXPECT_EQ(lines[i], "Test:" + std::to_string(i));
+    EXPECT_EQ(LTLogger::Instance().getDroppedCount(), 0u);
+    EXPECT_GT(sink->m_flushes.load(), 0);
+}
+
+TEST_F(AsyncLoggerTest, StopAsyncDrainsPendingRecords)
+{
+    LTLogger::Instance().startAsync();
+    for (int i = 0; i < 100; ++i)
+        LTLogger::Instance().log(LogVerbosity::Warning, "Test", "pending");
+    LTLogger::Instance().stopAsync();
+
+    EXPECT_FALSE(LTLogger::Instance().isAsync());
+    EXPECT_EQ(sink->lines().size(), 100u);
+}
+
+TEST_F(AsyncLoggerTest, CountPolicyReportsDroppedRecords)
+{
+    auto gate = std::make_shared<GateSink>();
+    LTLogger::Instance().addSink(gate);
+    LTLogger::Instance().startAsync({4, LogOverflowPolicy::Count});
+
+    const uint64_t droppedBefore = LTLogger::Instance().getDroppedCount();
+    for (int i = 0; i < 64; ++i)
+        LTLogger::Instance().log(LogVerbosity::Info, "Test", "flood");
+
+    EXPECT_GT(LTLogger::Instance().getDroppedCount(), droppedBefore);
+
+    gate->closed = false;
+    LTLogger::Instance().stopAsync();
+
+    bool reported = false;
+    for (const auto& line : sink->lines())
+        reported |= line.rfind("Logger:", 0) == 0 && line.find("dropped") != std::string::npos;
+    EXPECT_TRUE(reported);
+}
+
+TEST_F(AsyncLoggerTest, RemovedSinkReceivesNothing)
+{
+    LTLogger::Instance().startAsync();
+    LTLogger::Instance().removeSink(sink);
+    LTLogger::Instance().log(LogVerbosity::Info, "Test", "ignored");
+    LTLogger::Instance().flush();
+
+    EXPECT_TRUE(sink->lines().empty());
+}
+
+TEST_F(AsyncLoggerTest, FlushOnCrashDrainsQueue)
+{
+    auto gate = std::make_shared<GateSink>();
+    gate->closed = false;
+    LTLogger::Instance().addSink(gate);
+    LTLogger::Instance().startAsync();
+    LTLogger::Instance().log(LogVerbosity::Error, "Test", "before crash");
+
+    LTLogger::Instance().flushOnCrash();
+    LTLogger::Instance().flush();
+
+    auto lines = sink->lines();
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_EQ(lines[0], "Test:before crash");
+}
+
+#ifndef _WIN32
+TEST_F(AsyncLoggerTest, DrainOnSignalWritesQueuedRecordsToFd)
+{
+    // The writer blocks in the first record, so the later ones are still queued
+    auto gate = std::make_shared<GateSink>();
+    LTLogger::Instance().addSink(gate);
+    LTLogger::Instance().startAsync();
+    LTLogger::Instance().log(LogVerbosity::Info, "Test", "first");
+    LTLogger::Instance().log(LogVerbosity::Error, "Test", "queued");
+
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    LTLogger::Instance().drainOnSignal(fds[1]);
+    close(fds[1]);
+    std::string written;
+    char chunk[256];
+    for (ssize_t n; (n = read(fds[0], chunk, sizeof(chunk))) > 0;)
+        written.append(chunk, static_cast<size_t>(n));
+    close(fds[0]);
+
+    EXPECT_NE(written.find("[Error] [Test] queued\n"), std::string::npos);
+    gate->closed = false;
+}
+#endif
@@ -0,0 +1,228 @@
+#include <gtest/gtest.h>
+#include <Foundation/Log/BinaryLogReader.h>
+#include <Foundation/Log/BinaryLogSink.h>
+#include <Foundation/Log/LoggerMacro.h>
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace EngineCore::Foundation;
+namespace fs = std::filesystem;
+
+namespace
+{
+class CaptureSink final : public ILogSink
+{
+  public:
+    void write(LogVerbosity, const std::string& category, const std::string& message) override
+    {
+        std::scoped_lock lock(m_mutex);
+        m_lines.push_back(category + ":" + message);
+    }
+
+    std::vector<std::string> lines()
+    {
+        std::scoped_lock lock(m_mutex);
+        return m_lines;
+    }
+
+  private:
+    std::mutex m_mutex;
+    std::vector<std::string> m_lines;
+};
+
+template <typename... Args> std::string RoundTrip(std::string_view format, const Args&... args)
+{
+    char buffer[256];
+    const size_t length = EncodeLogArgs(buffer, sizeof(buffer), args...);
+    std::vector<LogArgValue> decoded;
+    EXPECT_TRUE(DecodeLogArgs(std::string_view(buffer, length), decoded));
+    return FormatLogArgs(format, decoded);
+}
+
+std::vector<fs::path> Segments(const fs::path& dir)
+{
+    std::vector<fs::path> files;
+    for (const auto& entry : fs::directory_iterator(dir))
+        files.push_back(entry.path());
+    std::sort(files.begin(), files.end());
+    return files;
+}
+} // namespace
+
+class BinaryLogTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        dir = fs::temp_directory_path() / ("lampy_binlog_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) +
+                                           "_" + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        fs::remove_all(dir);
+        LTLogger::Instance().clearSinks();
+    }
+
+    void TearDown() override
+    {
+        LTLogger::Instance().stopAsync();
+        LTLogger::Instance().clearSinks();
+        LTLogger::Instance().addSink(std::make_shared<ConsoleSink>());
+        fs::remove_all(dir);
+    }
+
+    BinaryLogSinkConfig config()
+    {
+        BinaryLogSinkConfig cfg;
+        cfg.directory = dir.string();
+        cfg.baseName  = "test";
+        return cfg;
+    }
+
+    fs::path dir;
+};
+
+// ============================================================================
+// Argument encoding
+// ============================================================================
+
+TEST(LogFormatTest, RoundTripFormatsLikeStdFormat)
+{
+    EXPECT_EQ(RoundTrip("{} + {} = {}", 1, 2u, 3.5), "1 + 2 = 3.5");
+    EXPECT_EQ(RoundTrip("{:.2f}|{:>4}|{}", 1.23456, 7, true), "1.23|   7|true");
+    EXPECT_EQ(RoundTrip("[{}] {}", std::string("name"), "literal"), "[name] literal");
+    EXPECT_EQ(RoundTrip("{1}-{0}", 'a', 'b'), "b-a");
+    EXPECT_EQ(RoundTrip("{{literal}} {}", -5), "{literal} -5");
+}
+
+TEST(LogFormatTest, MissingArgumentsRenderPlaceholder)
+{
+    EXPECT_EQ(RoundTrip("{} {}", 1), "1 {?}");
+}
+
+TEST(LogFormatTest, EncodingStopsWhenBufferIsFull)
+{
+    char buffer[16];
+    const size_t length = EncodeLogArgs(buffer, sizeof(buffer), int64_t{1}, int64_t{2}, int64_t{3});
+    std::vector<LogArgValue> decoded;
+    ASSERT_TRUE(DecodeLogArgs(std::string_view(buffer, length), decoded));
+    EXPECT_EQ(decoded.size(), 1u);
+}
+
+TEST(LogFormatTest, RegistryInternsOnce)
+{
+    auto& registry  = LogFormatRegistry::Instance();
+    const uint32_t a = registry.intern("Interned {}");
+    EXPECT_NE(a, 0u);
+    EXPECT_EQ(registry.intern("Interned {}"), a);
+    EXPECT_EQ(registry.lookup(a), "Interned {}");
+    EXPECT_TRUE(registry.lookup(0).empty());
+}
+
+// ============================================================================
+// Structured records
+// ============================================================================
+
+TEST_F(BinaryLogTest, StructuredRecordsReachTextSinksFormatted)
+{
+    auto sink = std::make_shared<CaptureSink>();
+    LTLogger::Instance().addSink(sink);
+
+    LT_LOGSI("Structured", "sync {} {}", 1, "one");
+    LTLogger::Instance().startAsync();
+    LT_LOGSW("Structured", "async {:.1f}", 2.25);
+    LTLogger::Instance().flush();
+
+    auto lines = sink->lines();
+    ASSERT_EQ(lines.size(), 2u);
+    EXPECT_EQ(lines[0], "Structured:sync 1 one");
+    EXPECT_EQ(lines[1], "Structured:async 2.2");
+}
+
+TEST_F(BinaryLogTest, SinkWritesDecodableSegment)
+{
+    std::string path;
+    {
+        auto binary = std::make_shared<BinaryLogSink>(config());
+        ASSERT_TRUE(binary->isOpen());
+        path = binary->currentPath();
+        LTLogger::Instance().addSink(binary);
+
+        LT_LOGSI("Physics", "Step {} took {:.3f} ms", 42, 1.5);
+        LT_LOGW("Renderer", "plain text");
+        LT_LOGSE("Physics", "Body {} lost", std::string("crate"));
+        LTLogger::Instance().clearSinks();
+    }
+
+    std::vector<BinaryLogEntry> entries;
+    std::string error;
+    ASSERT_TRUE(BinaryLogReader::ReadFile(path, entries, &error)) << error;
+    ASSERT_EQ(entries.size(), 3u);
+
+    EXPECT_EQ(entries[0].category, "Physics");
+    EXPECT_EQ(entries[0].message, "Step 42 took 1.500 ms");
+    EXPECT_EQ(entries[0].format, "Step {} took {:.3f} ms");
+    EXPECT_EQ(entries[0].args.size(), 2u);
+
+    EXPECT_EQ(entries[1].level, LogVerbosity::Warning);
+    EXPECT_EQ(entries[1].formatId, 0u);
+    EXPECT_EQ(entries[1].message, "plain text");
+
+    EXPECT_EQ(entries[2].level, LogVerbosity::Error);
+    EXPECT_EQ(entries[2].message, "Body crate lost");
+
+    const std::string json = BinaryLogReader::ToJson(entries[0]);
+    EXPECT_NE(json.find("\"message\":\"Step 42 took 1.500 ms\""), std::string::npos);
+    EXPECT_NE(json.find("\"args\":[42,1.5]"), std::string::npos);
+}
+
+TEST_F(BinaryLogTest, RotatesAndKeepsSegmentsSelfContained)
+{
+    BinaryLogSinkConfig cfg = config();
+    cfg.segmentBytes        = 64 * 1024;
+    cfg.maxSegments         = 3;
+    {
+        BinaryLogSink binary(cfg);
+        const std::string payload(500, 'x');
+        for (int i = 0; i < 1000; ++i)
+            binary.write(LogVerbosity::Info, "Rotate", payload + std::to_string(i));
+    }
+
+    const auto files = Segments(dir);
+    ASSERT_EQ(files.size(), 3u);
+
+    // The newest segment holds the last record and decodes without its predecessors.
+    std::vector<BinaryLogEntry> entries;
+    ASSERT_TRUE(BinaryLogReader::ReadFile(files.back().string(), entries));
+    ASSERT_FALSE(entries.empty());
+    EXPECT_EQ(entries.front().category, "Rotate");
+    EXPECT_EQ(entries.back().message, std::string(500, 'x') + "999");
+}
+
+TEST_F(BinaryLogTest, NewSinkContinuesNumberingAfterExistingSegments)
+{
+    std::string first;
+    {
+        BinaryLogSink binary(config());
+        first = binary.currentPath();
+    }
+    BinaryLogSink binary(config());
+    EXPECT_NE(binary.currentPath(), first);
+    EXPECT_TRUE(fs::exists(first));
+}
+
+TEST(BinaryLogReaderTest, TruncatedTailIsNotAnError)
+{
+    std::string data(BinaryLog::kMagic, sizeof(BinaryLog::kMagic));
+    data.append(reinterpret_cast<const char*>(&BinaryLog::kVersion), sizeof(BinaryLog::kVersion));
+    data.resize(BinaryLog::kHeaderSize, '\0');
+    data += static_cast<char>(BinaryLog::Chunk::Record);
+    data += "\x02\x00"; // record cut short
+
+    std::vector<BinaryLogEntry> entries;
+    EXPECT_TRUE(BinaryLogReader::Parse(data, entries));
+    EXPECT_TRUE(entries.empty());
+
+    EXPECT_FALSE(BinaryLogReader::Parse("garbage", entries));
+}
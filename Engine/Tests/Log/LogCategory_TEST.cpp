@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <Foundation/Log/LoggerMacro.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace EngineCore::Foundation;
+
+namespace
+{
+class CaptureSink final : public ILogSink
+{
+  public:
+    void write(LogVerbosity, const std::string& category, const std::string& message) override
+    {
+        std::scoped_lock lock(m_mutex);
+        m_lines.push_back(category + ":" + message);
+    }
+
+    std::vector<std::string> lines()
+    {
+        std::scoped_lock lock(m_mutex);
+        return m_lines;
+    }
+
+  private:
+    std::mutex m_mutex;
+    std::vector<std::string> m_lines;
+};
+
+int g_evaluations = 0;
+
+std::string Expensive(const char* text)
+{
+    ++g_evaluations;
+    return text;
+}
+} // namespace
+
+class LogCategoryTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        LTLogger::Instance().clearSinks();
+        sink = std::make_shared<CaptureSink>();
+        LTLogger::Instance().addSink(sink);
+        g_evaluations = 0;
+    }
+
+    void TearDown() override
+    {
+        LogCategoryRegistry::Instance().setDefaultLevel(LogVerbosity::Verbose);
+        LTLogger::Instance().clearSinks();
+        LTLogger::Instance().addSink(std::make_shared<ConsoleSink>());
+    }
+
+    std::shared_ptr<CaptureSink> sink;
+};
+
+TEST(LogCategoryRegistryTest, ParseVerbosityIsCaseInsensitive)
+{
+    LogVerbosity level{};
+    EXPECT_TRUE(LogCategoryRegistry::ParseVerbosity("warning", level));
+    EXPECT_EQ(level, LogVerbosity::Warning);
+    EXPECT_TRUE(LogCategoryRegistry::ParseVerbosity("ERROR", level));
+    EXPECT_EQ(level, LogVerbosity::Error);
+    EXPECT_FALSE(LogCategoryRegistry::ParseVerbosity("Loud", level));
+}
+
+TEST(LogCategoryRegistryTest, GetReturnsSameInstance)
+{
+    auto& registry = LogCategoryRegistry::Instance();
+    EXPECT_EQ(&registry.get("Test.Same"), &registry.get("Test.Same"));
+    EXPECT_EQ(registry.get("Test.Same").name(), "Test.Same");
+}
+
+TEST(LogCategoryRegistryTest, ConfigureAppliesOverridesAndDefault)
+{
+    auto& registry = LogCategoryRegistry::Instance();
+    EXPECT_TRUE(registry.configure(" Test.Cfg.A = Error , *=Info "));
+
+    EXPECT_EQ(registry.get("Test.Cfg.A").getLevel(), LogVerbosity::Error);
+    EXPECT_EQ(registry.get("Test.Cfg.B").getLevel(), LogVerbosity::Info);
+
+    // Explicit overrides survive later default changes
+    registry.setDefaultLevel(LogVerbosity::Verbose);
+    EXPECT_EQ(registry.get("Test.Cfg.A").getLevel(), LogVerbosity::Error);
+    EXPECT_EQ(registry.get("Test.Cfg.B").getLevel(), LogVerbosity::Verbose);
+
+    EXPECT_FALSE(registry.configure("Test.Cfg.C=Nope,Test.Cfg.D=Warning,=Info"));
+    EXPECT_EQ(registry.get("Test.Cfg.D").getLevel(), LogVerbosity::Warning);
+}
+
+TEST_F(LogCategoryTest, DisabledCategorySkipsMessageEvaluation)
+{
+    LogCategoryRegistry::Instance().setLevel("Test.Quiet", LogVerbosity::Warning);
+
+    LT_LOGI("Test.Quiet", Expensive("hidden"));
+    LT_LOGFI("Test.Quiet", "{}", Expensive("hidden"));
+    EXPECT_EQ(g_evaluations, 0);
+    EXPECT_TRUE(sink->lines().empty());
+
+    LT_LOGW("Test.Quiet", Expensive("shown"));
+    EXPECT_EQ(g_evaluations, 1);
+    ASSERT_EQ(sink->lines().size(), 1u);
+    EXPECT_EQ(sink->lines()[0], "Test.Quiet:shown");
+}
+
+TEST_F(LogCategoryTest, RuntimeLevelChangeAppliesToCachedCallSites)
+{
+    auto logOnce = []() { LT_LOGFD("Test.Toggle", "value {}", 42); };
+
+    logOnce();
+    LogCategoryRegistry::Instance().setLevel("Test.Toggle", LogVerbosity::Error);
+    logOnce();
+    LogCategoryRegistry::Instance().setLevel("Test.Toggle", LogVerbosity::Debug);
+    logOnce();
+
+    auto lines = sink->lines();
+    ASSERT_EQ(lines.size(), 2u);
+    EXPECT_EQ(lines[0], "Test.Toggle:value 42");
+}
+
+TEST_F(LogCategoryTest, FormatMacroTruncatesLongMessages)
+{
+    const std::string longText(LogRecord::kMaxMessageLength * 2, 'x');
+    LT_LOGFI("Test.Long", "{}", longText);
+
+    auto lines = sink->lines();
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_EQ(lines[0].size(), std::string("Test.Long:").size() + LogRecord::kMaxMessageLength);
+}
+
+TEST(LogVerbosityTest, CompileTimeFloorMatchesBuildDefault)
+{
+    EXPECT_EQ(IsLogLevelCompiledIn(LogVerbosity::Verbose), LT_LOG_MIN_LEVEL == 0);
+    EXPECT_TRUE(IsLogLevelCompiledIn(LogVerbosity::Fatal));
+}
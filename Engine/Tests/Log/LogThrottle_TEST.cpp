@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include <Foundation/Log/LoggerMacro.h>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace EngineCore::Foundation;
+
+namespace
+{
+class CaptureSink final : public ILogSink
+{
+  public:
+    void write(LogVerbosity, const std::string& category, const std::string& message) override
+    {
+        std::scoped_lock lock(m_mutex);
+        m_lines.push_back(category + ":" + message);
+    }
+
+    std::vector<std::string> lines()
+    {
+        std::scoped_lock lock(m_mutex);
+        return m_lines;
+    }
+
+  private:
+    std::mutex m_mutex;
+    std::vector<std::string> m_lines;
+};
+
+int g_evaluations = 0;
+
+int Counted(int value)
+{
+    ++g_evaluations;
+    return value;
+}
+} // namespace
+
+class LogThrottleTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        LTLogger::Instance().clearSinks();
+        sink = std::make_shared<CaptureSink>();
+        LTLogger::Instance().addSink(sink);
+        g_evaluations = 0;
+    }
+
+    void TearDown() override
+    {
+        LTLogger::Instance().clearSinks();
+        LTLogger::Instance().addSink(std::make_shared<ConsoleSink>());
+    }
+
+    std::shared_ptr<CaptureSink> sink;
+};
+
+TEST_F(LogThrottleTest, RateLimitCapsRecordsAndSkipsFormatting)
+{
+    const uint64_t before = LT_LOG_CATEGORY_REF("Test.Limit").getSuppressed();
+    for (int i = 0; i < 100; ++i)
+        LT_LOGFI_LIMIT("Test.Limit", 5, "tick {}", Counted(i));
+
+    auto lines = sink->lines();
+    ASSERT_EQ(lines.size(), 5u);
+    EXPECT_EQ(lines[0], "Test.Limit:tick 0");
+    EXPECT_EQ(g_evaluations, 5);
+    EXPECT_EQ(LT_LOG_CATEGORY_REF("Test.Limit").getSuppressed() - before, 95u);
+}
+
+TEST_F(LogThrottleTest, StructuredRateLimitCapsRecords)
+{
+    for (int i = 0; i < 100; ++i)
+        LT_LOGSW_LIMIT("Test.StructuredLimit", 3, "entity {} took {:.1f} ms", Counted(i), 0.5);
+
+    auto lines = sink->lines();
+    ASSERT_EQ(lines.size(), 3u);
+    EXPECT_EQ(lines[0], "Test.StructuredLimit:entity 0 took 0.5 ms");
+    EXPECT_EQ(g_evaluations, 3);
+}
+
+TEST_F(LogThrottleTest, RateLimitReportsSuppressedCountInNextWindow)
+{
+    auto logOnce = []() { LT_LOGI_LIMIT("Test.Window", 1, "event"); };
+
+    logOnce();
+    logOnce();
+    logOnce();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1050));
+    logOnce();
+
+    auto lines = sink->lines();
+    ASSERT_EQ(lines.size(), 3u);
+    EXPECT_EQ(lines[0], "Test.Window:event");
+    EXPECT_EQ(lines[1], "Test.Window:(2 similar message(s) suppressed)");
+    EXPECT_EQ(lines[2], "Test.Window:event");
+}
+
+TEST_F(LogThrottleTest, DedupCollapsesRepeatedMessages)
+{
+    auto logValue = [](int value) { LT_LOGFW_DEDUP("Test.Dedup", "value {}", value); };
+
+    for (int i = 0; i < 10; ++i)
+        logValue(7);
+    logValue(8);
+
+    auto lines = sink->lines();
+    ASSERT_EQ(lines.size(), 3u);
+    EXPECT_EQ(lines[0], "Test.Dedup:value 7");
+    EXPECT_EQ(lines[1], "Test.Dedup:(previous message repeated 9 more time(s))");
+    EXPECT_EQ(lines[2], "Test.Dedup:value 8");
+}
+
+TEST(LogThrottleUnitTest, DeduplicatorReemitsAfterInterval)
+{
+    LogDeduplicator dedup(20);
+    uint64_t repeats = 0;
+    EXPECT_TRUE(dedup.shouldLog("same", repeats));
+    EXPECT_FALSE(dedup.shouldLog("same", repeats));
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    EXPECT_TRUE(dedup.shouldLog("same", repeats));
+    EXPECT_EQ(repeats, 1u);
+    EXPECT_EQ(dedup.getSuppressedTotal(), 1u);
+}
+
+TEST_F(LogThrottleTest, RegistryReportsSuppressedCategories)
+{
+    for (int i = 0; i < 20; ++i)
+        LT_LOGI_LIMIT("Test.Report", 2, "flood");
+
+    bool found = false;
+    for (const auto& [name, count] : LogCategoryRegistry::Instance().getSuppressedCounts())
+    {
+        if (name == "Test.Report")
+        {
+            found = true;
+            EXPECT_EQ(count, 18u);
+        }
+    }
+    EXPECT_TRUE(found);
+    EXPECT_GE(LogCategoryRegistry::Instance().getSuppressedTotal(), 18u);
+}
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include <Foundation/Math/TransformBatch.h>
+#include <Foundation/JobSystem/JobSystem.h>
+#include <Modules/ObjectCoreModule/ECS/Components/ECSComponents.h>
+#include <random>
+#include <vector>
+
+using namespace EngineCore::Foundation;
+
+namespace
+{
+constexpr size_t kStride = 10; // position xyz, quat xyzw, scale xyz
+
+std::vector<float> MakeRecords(size_t count, uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> value(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> scale(0.01f, 8.0f);
+    std::vector<float> records(count * kStride);
+    for (size_t i = 0; i < count; ++i)
+    {
+        float* r = &records[i * kStride];
+        r[0] = value(rng);
+        r[1] = value(rng);
+        r[2] = value(rng);
+        const glm::quat q = glm::normalize(glm::quat(value(rng), value(rng), value(rng), value(rng)));
+        r[3] = q.x;
+        r[4] = q.y;
+        r[5] = q.z;
+        r[6] = q.w;
+        r[7] = scale(rng);
+        r[8] = -scale(rng); // mirrored axis
+        r[9] = scale(rng);
+    }
+    return records;
+}
+
+Math::TRSView View(const std::vector<float>& records)
+{
+    return Math::TRSView::Interleaved(&records[0], kStride, &records[3], kStride, &records[7], kStride);
+}
+
+// The per-entity path the kernels replace
+glm::mat4 GlmTRS(const float* r)
+{
+    const glm::quat q(r[6], r[3], r[4], r[5]);
+    return glm::translate(glm::mat4(1.0f), glm::vec3(r[0], r[1], r[2])) * glm::mat4_cast(q) *
+           glm::scale(glm::mat4(1.0f), glm::vec3(r[7], r[8], r[9]));
+}
+
+void ExpectSame(const glm::mat4& expected, const glm::mat4& actual, size_t index)
+{
+    for (int c = 0; c < 4; ++c)
+        for (int r = 0; r < 4; ++r)
+            ASSERT_EQ(expected[c][r], actual[c][r]) << "matrix " << index << " [" << c << "][" << r << "]";
+}
+} // namespace
+
+TEST(TransformBatchTest, TRSMatchesGlmProduct)
+{
+    const std::vector<float> records = MakeRecords(257, 1);
+    for (size_t i = 0; i < 257; ++i)
+    {
+        const float* r = &records[i * kStride];
+        const glm::mat4 m = Math::TRS(glm::vec3(r[0], r[1], r[2]), glm::quat(r[6], r[3], r[4], r[5]),
+                                      glm::vec3(r[7], r[8], r[9]));
+        ExpectSame(GlmTRS(r), m, i);
+    }
+}
+
+TEST(TransformBatchTest, EveryLevelMatchesGlm)
+{
+    // Odd sizes and offsets exercise the SSE and scalar tails after the wide loop
+    constexpr size_t kCount = 1003;
+    const std::vector<float> records = MakeRecords(kCount, 2);
+
+    for (Math::SimdLevel level : {Math::SimdLevel::Scalar, Math::SimdLevel::Sse2, Math::SimdLevel::Avx2})
+    {
+        SCOPED_TRACE(Math::ToString(level));
+        std::vector<glm::mat4> out(kCount, glm::mat4(0.0f));
+        Math::ComposeTRS(View(records), 3, kCount, out.data(), level);
+
+        EXPECT_EQ(out[2], glm::mat4(0.0f)) << "wrote before begin";
+        for (size_t i = 3; i < kCount; ++i)
+            ExpectSame(GlmTRS(&records[i * kStride]), out[i], i);
+    }
+}
+
+TEST(TransformBatchTest, PlanarArrays)
+{
+    constexpr size_t kCount = 37;
+    const std::vector<float> records = MakeRecords(kCount, 3);
+
+    std::vector<std::vector<float>> planes(kStride, std::vector<float>(kCount));
+    for (size_t i = 0; i < kCount; ++i)
+        for (size_t c = 0; c < kStride; ++c)
+            planes[c][i] = records[i * kStride + c];
+
+    Math::TRSView view;
+    view.px = planes[0].data();
+    view.py = planes[1].data();
+    view.pz = planes[2].data();
+    view.qx = planes[3].data();
+    view.qy = planes[4].data();
+    view.qz = planes[5].data();
+    view.qw = planes[6].data();
+    view.sx = planes[7].data();
+    view.sy = planes[8].data();
+    view.sz = planes[9].data();
+
+    std::vector<glm::mat4> out(kCount);
+    Math::ComposeTRS(view, 0, kCount, out.data());
+    for (size_t i = 0; i < kCount; ++i)
+        ExpectSame(GlmTRS(&records[i * kStride]), out[i], i);
+}
+
+TEST(TransformBatchTest, ParallelMatchesSerial)
+{
+    constexpr size_t kCount = 20000;
+    const std::vector<float> records = MakeRecords(kCount, 4);
+
+    JobSystem jobs;
+    jobs.setWorkerCount(4);
+    jobs.startup();
+
+    std::vector<glm::mat4> serial(kCount);
+    std::vector<glm::mat4> parallel(kCount);
+    Math::ComposeTRS(View(records), 0, kCount, serial.data());
+    Math::ComposeTRSParallel(&jobs, View(records), kCount, parallel.data(), 1000);
+    jobs.shutdown();
+
+    for (size_t i = 0; i < kCount; ++i)
+        ExpectSame(serial[i], parallel[i], i);
+}
+
+TEST(TransformBatchTest, TransformComponentMatrices)
+{
+    TransformComponent transform{};
+    transform.position = {1.0f, -2.0f, 3.5f};
+    transform.rotation.fromEulerDegrees(glm::vec3(30.0f, -45.0f, 10.0f));
+    transform.scale = {2.0f, 0.5f, 1.5f};
+
+    const glm::quat q = transform.rotation.toQuat();
+    const glm::mat4 expected = glm::translate(glm::mat4(1.0f), transform.position.toGLMVec()) * glm::mat4_cast(q) *
+                               glm::scale(glm::mat4(1.0f), transform.scale.toGLMVec());
+    ExpectSame(expected, transform.toMatrix(), 0);
+    ExpectSame(glm::translate(glm::mat4(1.0f), transform.position.toGLMVec()) * glm::mat4_cast(q),
+               transform.toMatrixNoScale(), 0);
+}
+
+TEST(TransformBatchTest, EulerOnlyRotationMatchesAngleAxisProduct)
+{
+    for (const glm::vec3 euler : {glm::vec3(0.0f), glm::vec3(90.0f, 0.0f, 0.0f), glm::vec3(-30.0f, 45.0f, 170.0f),
+                                  glm::vec3(12.5f, -200.0f, 33.0f)})
+    {
+        RotationComponent rotation{};
+        rotation.x = euler.x;
+        rotation.y = euler.y;
+        rotation.z = euler.z;
+
+        const glm::quat expected = glm::normalize(glm::angleAxis(glm::radians(euler.y), glm::vec3(0.f, 1.f, 0.f)) *
+                                                  glm::angleAxis(glm::radians(euler.x), glm::vec3(1.f, 0.f, 0.f)) *
+                                                  glm::angleAxis(glm::radians(euler.z), glm::vec3(0.f, 0.f, 1.f)));
+        const glm::quat actual = rotation.toQuat();
+        EXPECT_NEAR(actual.w, expected.w, 1e-6f);
+        EXPECT_NEAR(actual.x, expected.x, 1e-6f);
+        EXPECT_NEAR(actual.y, expected.y, 1e-6f);
+        EXPECT_NEAR(actual.z, expected.z, 1e-6f);
+    }
+}
@@ -0,0 +1,213 @@
+#include <gtest/gtest.h>
+#include <Foundation/Metrics/Metrics.h>
+#include <Foundation/Metrics/MetricsExporter.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+using namespace EngineCore::Foundation;
+
+namespace
+{
+std::filesystem::path TempPath(const std::string& name)
+{
+    auto path = std::filesystem::temp_directory_path() /
+                ("lampy_metrics_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) + "_" + name);
+    std::filesystem::remove(path);
+    return path;
+}
+
+std::string ReadFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+bool EndsWith(const std::string& text, const std::string& suffix)
+{
+    return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+template <typename Predicate> bool WaitFor(Predicate predicate)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        if (predicate())
+            return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return predicate();
+}
+
+#if !defined(_WIN32)
+/// Stand-in for a local scraping agent: connect, read to EOF.
+std::string Scrape(const std::filesystem::path& socketPath)
+{
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    const std::string path = socketPath.string();
+    std::copy(path.begin(), path.end(), address.sun_path);
+    if (::connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        ::close(fd);
+        return {};
+    }
+
+    std::string response;
+    char buffer[4096];
+    ssize_t received = 0;
+    while ((received = ::recv(fd, buffer, sizeof(buffer), 0)) > 0)
+        response.append(buffer, static_cast<size_t>(received));
+    ::close(fd);
+    return response;
+}
+#endif
+
+class MetricsExporterTest : public ::testing::Test
+{
+  protected:
+    void TearDown() override
+    {
+        MetricsExporter::Stop();
+        MetricsExporter::ClearCollectors();
+    }
+};
+} // namespace
+
+TEST_F(MetricsExporterTest, SerializesRegistryInOpenMetricsFormat)
+{
+    auto& registry = MetricsRegistry::Instance();
+    registry.counter("test_export_requests_total", "Requests seen").add(3);
+    registry.gauge("test_export_level", "Current level").set(2.5);
+    Histogram& histogram = registry.histogram("test_export_latency_ms", "Latency", {1.0, 10.0});
+    histogram.observe(0.5);
+    histogram.observe(5.0);
+    histogram.observe(50.0);
+
+    std::string text;
+    MetricsExporter::Serialize(text);
+
+    EXPECT_NE(text.find("# TYPE test_export_requests counter\n# HELP test_export_requests Requests seen\n"
+                        "test_export_requests_total 3\n"),
+              std::string::npos);
+    EXPECT_NE(text.find("# TYPE test_export_level gauge\n"), std::string::npos);
+    EXPECT_NE(text.find("test_export_level 2.5\n"), std::string::npos);
+    EXPECT_NE(text.find("test_export_latency_ms_bucket{le=\"1.0\"} 1\n"
+                        "test_export_latency_ms_bucket{le=\"10.0\"} 2\n"
+                        "test_export_latency_ms_bucket{le=\"+Inf\"} 3\n"
+                        "test_export_latency_ms_sum 55.5\n"
+                        "test_export_latency_ms_count 3\n"),
+              std::string::npos);
+    EXPECT_TRUE(EndsWith(text, "\n# EOF\n"));
+}
+
+TEST_F(MetricsExporterTest, CollectorLabelsAreEscaped)
+{
+    MetricsExporter::AddCollector([](OpenMetricsWriter& writer) {
+        writer.family("test_export_labeled", "gauge", "Help with \\ and\nnewline");
+        writer.sample("test_export_labeled", {{"path", "C:\\dir \"x\""}}, 1.0);
+    });
+
+    std::string text;
+    MetricsExporter::Serialize(text);
+    EXPECT_NE(text.find("# HELP test_export_labeled Help with \\\\ and\\nnewline\n"), std::string::npos);
+    EXPECT_NE(text.find("test_export_labeled{path=\"C:\\\\dir \\\"x\\\"\"} 1.0\n"), std::string::npos);
+}
+
+TEST_F(MetricsExporterTest, SteadyStateReusesBuffer)
+{
+    std::string text;
+    MetricsExporter::Serialize(text);
+    text.reserve(text.size() * 2);
+    const char* data      = text.data();
+    const size_t capacity = text.capacity();
+
+    for (int i = 0; i < 10; ++i)
+        MetricsExporter::Serialize(text);
+    EXPECT_EQ(text.data(), data);
+    EXPECT_EQ(text.capacity(), capacity);
+}
+
+TEST_F(MetricsExporterTest, FileRotatesAtSizeLimit)
+{
+    const auto path = TempPath("rotate.txt");
+    std::filesystem::remove(path.string() + ".1");
+    std::filesystem::remove(path.string() + ".2");
+
+    MetricsExporterConfig config;
+    config.intervalMs   = 1;
+    config.filePath     = path.string();
+    config.fileMaxBytes = 1; // Every snapshot rotates the previous one out
+    config.fileKeep     = 2;
+    ASSERT_TRUE(MetricsExporter::Start(config));
+    EXPECT_FALSE(MetricsExporter::Start(config));
+
+    const uint64_t before = MetricsExporter::GetSnapshotCount();
+    EXPECT_TRUE(WaitFor([&] { return MetricsExporter::GetSnapshotCount() >= before + 4; }));
+    MetricsExporter::Stop();
+
+    EXPECT_TRUE(std::filesystem::exists(path.string() + ".1"));
+    EXPECT_TRUE(std::filesystem::exists(path.string() + ".2"));
+    EXPECT_FALSE(std::filesystem::exists(path.string() + ".3"));
+    const std::string latest = ReadFile(path);
+    EXPECT_EQ(latest.find("# EOF\n"), latest.size() - 6); // Exactly one snapshot per file
+    EXPECT_TRUE(EndsWith(ReadFile(path.string() + ".1"), "# EOF\n"));
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(path.string() + ".1");
+    std::filesystem::remove(path.string() + ".2");
+}
+
+#if !defined(_WIN32)
+TEST_F(MetricsExporterTest, ServesLatestSnapshotOverUnixSocket)
+{
+    MetricsRegistry::Instance().counter("test_export_scraped_total", "Scraped").add(7);
+    MetricsExporter::AddCollector([](OpenMetricsWriter& writer) {
+        writer.family("test_export_collector", "gauge", "From a collector");
+        writer.sample("test_export_collector", {}, {}, uint64_t{42});
+    });
+
+    const auto socketPath = TempPath("scrape.sock");
+    MetricsExporterConfig config;
+    config.intervalMs = 20;
+    config.socketPath = socketPath.string();
+    ASSERT_TRUE(MetricsExporter::Start(config));
+
+    std::string scraped;
+    EXPECT_TRUE(WaitFor([&] {
+        scraped = Scrape(socketPath);
+        return !scraped.empty();
+    }));
+    EXPECT_NE(scraped.find("test_export_scraped_total 7\n"), std::string::npos);
+    EXPECT_NE(scraped.find("test_export_collector 42\n"), std::string::npos);
+    EXPECT_NE(scraped.find("# TYPE metrics_export_duration_ms gauge\n"), std::string::npos);
+    EXPECT_TRUE(EndsWith(scraped, "# EOF\n"));
+
+    // Several scrapers in a row each get a complete snapshot.
+    for (int i = 0; i < 3; ++i)
+        EXPECT_TRUE(EndsWith(Scrape(socketPath), "# EOF\n"));
+
+    MetricsExporter::Stop();
+    EXPECT_FALSE(std::filesystem::exists(socketPath));
+}
+#endif
+
+TEST_F(MetricsExporterTest, StartWithoutOutputFails)
+{
+    EXPECT_FALSE(MetricsExporter::Start(MetricsExporterConfig{}));
+    EXPECT_FALSE(MetricsExporter::IsRunning());
+}
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include <Foundation/Metrics/MetricsMacros.h>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace EngineCore::Foundation;
+
+namespace
+{
+void IncrementFromCallSite()
+{
+    LT_METRIC_COUNTER_INC("test_macro_calls_total", "Calls through the test macro");
+}
+} // namespace
+
+TEST(MetricsTest, SameNameReturnsSameMetric)
+{
+    auto& registry = MetricsRegistry::Instance();
+    Counter& first = registry.counter("test_same_name_total", "help");
+    Counter& again = registry.counter("test_same_name_total");
+    EXPECT_EQ(&first, &again);
+    EXPECT_EQ(registry.find("test_same_name_total"), &first);
+    EXPECT_EQ(first.help(), "help");
+}
+
+TEST(MetricsTest, TypeMismatchThrows)
+{
+    auto& registry = MetricsRegistry::Instance();
+    registry.gauge("test_type_mismatch");
+    EXPECT_THROW(registry.counter("test_type_mismatch"), std::logic_error);
+}
+
+TEST(MetricsTest, CounterIsExactUnderContention)
+{
+    constexpr int kThreads    = 4;
+    constexpr int kIterations = 10000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t)
+    {
+        threads.emplace_back([]() {
+            for (int i = 0; i < kIterations; ++i)
+                IncrementFromCallSite();
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    auto* counter = static_cast<Counter*>(MetricsRegistry::Instance().find("test_macro_calls_total"));
+    ASSERT_NE(counter, nullptr);
+    EXPECT_EQ(counter->value(), static_cast<uint64_t>(kThreads * kIterations));
+}
+
+TEST(MetricsTest, GaugeSetAndAdd)
+{
+    LT_METRIC_GAUGE_SET("test_gauge_level", "Gauge under test", 10);
+    LT_METRIC_GAUGE_ADD("test_gauge_level", "Gauge under test", -2.5);
+    EXPECT_DOUBLE_EQ(MetricsRegistry::Instance().gauge("test_gauge_level").value(), 7.5);
+}
+
+TEST(MetricsTest, HistogramBucketsAreInclusiveUpperBounds)
+{
+    Histogram& histogram = MetricsRegistry::Instance().histogram("test_histogram_ms", "", {1.0, 5.0, 10.0});
+    for (double value : {0.5, 1.0, 3.0, 5.0, 7.0, 50.0})
+        histogram.observe(value);
+
+    ASSERT_EQ(histogram.bounds().size(), 3u);
+    EXPECT_EQ(histogram.bucketCount(0), 2u); // 0.5, 1.0
+    EXPECT_EQ(histogram.bucketCount(1), 2u); // 3.0, 5.0
+    EXPECT_EQ(histogram.bucketCount(2), 1u); // 7.0
+    EXPECT_EQ(histogram.bucketCount(3), 1u); // +Inf
+    EXPECT_EQ(histogram.count(), 6u);
+    EXPECT_DOUBLE_EQ(histogram.sum(), 66.5);
+}
+
+TEST(MetricsTest, ForEachVisitsInRegistrationOrder)
+{
+    auto& registry = MetricsRegistry::Instance();
+    registry.counter("test_order_a_total");
+    registry.gauge("test_order_b");
+
+    std::vector<std::string> names;
+    registry.forEach([&](const Metric& metric) { names.push_back(metric.name()); });
+    const auto a = std::find(names.begin(), names.end(), "test_order_a_total");
+    const auto b = std::find(names.begin(), names.end(), "test_order_b");
+    ASSERT_NE(a, names.end());
+    ASSERT_NE(b, names.end());
+    EXPECT_LT(a, b);
+    EXPECT_EQ(names.size(), registry.size());
+}
+
+TEST(MetricsTest, ScopedTimerAccumulatesNanoseconds)
+{
+    {
+        LT_METRIC_SCOPED_TIME_NS("test_scoped_time_ns_total", "Scoped timer under test");
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    EXPECT_GE(MetricsRegistry::Instance().counter("test_scoped_time_ns_total").value(), 2'000'000u);
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <Foundation/Profiler/ProfilerMacros.h>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace EngineCore::Foundation;
+
+namespace
+{
+size_t CountOccurrences(const std::string& text, const std::string& needle)
+{
+    size_t count = 0;
+    for (size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + needle.size()))
+        ++count;
+    return count;
+}
+
+void NestedWork()
+{
+    ZoneScopedN("Test/Outer");
+    {
+        ZoneScopedN("Test/Inner");
+    }
+}
+
+std::string ExportTrace()
+{
+    std::ostringstream out;
+    EXPECT_TRUE(CpuProfiler::WriteChromeTrace(out));
+    return out.str();
+}
+} // namespace
+
+TEST(CpuProfilerTest, ZonesOutsideCaptureAreNotRecorded)
+{
+    CpuProfiler::StartCapture();
+    CpuProfiler::StopCapture();
+    NestedWork();
+
+    const std::string trace = ExportTrace();
+    EXPECT_EQ(trace.find("Test/Outer"), std::string::npos);
+}
+
+TEST(CpuProfilerTest, CapturesNestedZonesFromSeveralThreads)
+{
+    CpuProfiler::StartCapture();
+    NestedWork();
+    std::thread worker([]() {
+        CpuProfiler::SetThreadName("TestWorker");
+        NestedWork();
+    });
+    worker.join();
+    CpuProfiler::StopCapture();
+
+    const std::string trace = ExportTrace();
+    EXPECT_EQ(CountOccurrences(trace, "\"name\":\"Test/Outer\",\"ph\":\"X\""), 2u);
+    EXPECT_EQ(CountOccurrences(trace, "\"name\":\"Test/Inner\",\"ph\":\"X\""), 2u);
+    EXPECT_NE(trace.find("\"args\":{\"name\":\"TestWorker\"}"), std::string::npos);
+    EXPECT_EQ(trace.rfind("{\"displayTimeUnit\"", 0), 0u);
+}
+
+TEST(CpuProfilerTest, RequestCaptureRecordsRequestedFrames)
+{
+    CpuProfiler::RequestCapture(2);
+    EXPECT_TRUE(CpuProfiler::IsCapturePending());
+    EXPECT_FALSE(CpuProfiler::IsCapturing());
+
+    CpuProfiler::FrameBoundary(); // capture starts
+    EXPECT_TRUE(CpuProfiler::IsCapturing());
+    NestedWork();
+    CpuProfiler::FrameBoundary();
+    NestedWork();
+    CpuProfiler::FrameBoundary(); // second frame done
+    EXPECT_FALSE(CpuProfiler::IsCapturing());
+    NestedWork();
+
+    const std::string trace = ExportTrace();
+    EXPECT_EQ(CountOccurrences(trace, "\"name\":\"Test/Outer\""), 2u);
+    EXPECT_NE(trace.find("\"name\":\"Frame 0\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"Frame 1\""), std::string::npos);
+    EXPECT_EQ(trace.find("\"name\":\"Frame 2\""), std::string::npos);
+}
+
+TEST(CpuProfilerTest, ZoneOpenAtStopIsClosedAtCaptureEnd)
+{
+    CpuProfiler::StartCapture();
+    {
+        ZoneScopedN("Test/Unfinished");
+        CpuProfiler::StopCapture();
+    }
+
+    const std::string trace = ExportTrace();
+    EXPECT_EQ(CountOccurrences(trace, "\"name\":\"Test/Unfinished\""), 1u);
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <Foundation/Profiler/FrameStats.h>
+#include <vector>
+
+using namespace EngineCore::Foundation;
+
+class FrameStatsTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        stats.reset();
+    }
+
+    FrameStats stats;
+};
+
+TEST_F(FrameStatsTest, ReportsNearestRankPercentiles)
+{
+    for (int i = 1; i <= 100; ++i)
+        stats.record(FrameStage::Render, static_cast<double>(i));
+
+    const FrameStageSummary summary = stats.getSummary(FrameStage::Render);
+    EXPECT_EQ(summary.samples, 100u);
+    EXPECT_DOUBLE_EQ(summary.p50Ms, 50.0);
+    EXPECT_DOUBLE_EQ(summary.p95Ms, 95.0);
+    EXPECT_DOUBLE_EQ(summary.p99Ms, 99.0);
+    EXPECT_DOUBLE_EQ(summary.maxMs, 100.0);
+    EXPECT_DOUBLE_EQ(summary.avgMs, 50.5);
+    EXPECT_DOUBLE_EQ(summary.lastMs, 100.0);
+    EXPECT_DOUBLE_EQ(stats.getPercentile(FrameStage::Render, 10.0), 10.0);
+}
+
+TEST_F(FrameStatsTest, WindowKeepsOnlyRecentSamples)
+{
+    for (size_t i = 0; i < FrameStats::kWindowSize; ++i)
+        stats.record(FrameStage::ECS, 100.0);
+    for (size_t i = 0; i < FrameStats::kWindowSize; ++i)
+        stats.record(FrameStage::ECS, 1.0);
+
+    EXPECT_DOUBLE_EQ(stats.getSummary(FrameStage::ECS).maxMs, 1.0);
+
+    stats.record(FrameStage::ECS, 2.0);
+    const std::vector<float> history = stats.getHistory(FrameStage::ECS);
+    ASSERT_EQ(history.size(), FrameStats::kWindowSize);
+    EXPECT_FLOAT_EQ(history.back(), 2.0f);
+    EXPECT_FLOAT_EQ(history.front(), 1.0f);
+}
+
+TEST_F(FrameStatsTest, BudgetCallbackFiresOnOverrun)
+{
+    std::vector<double> overruns;
+    stats.setBudget(FrameStage::Physics, 5.0, [&](FrameStage stage, double elapsedMs, double budgetMs) {
+        EXPECT_EQ(stage, FrameStage::Physics);
+        EXPECT_DOUBLE_EQ(budgetMs, 5.0);
+        overruns.push_back(elapsedMs);
+    });
+
+    stats.record(FrameStage::Physics, 4.0);
+    stats.record(FrameStage::Physics, 7.5);
+    stats.record(FrameStage::Render, 50.0);
+    stats.record(FrameStage::Physics, 5.0);
+
+    ASSERT_EQ(overruns.size(), 1u);
+    EXPECT_DOUBLE_EQ(overruns[0], 7.5);
+    EXPECT_EQ(stats.getSummary(FrameStage::Physics).overruns, 1u);
+
+    stats.clearBudget(FrameStage::Physics);
+    stats.record(FrameStage::Physics, 9.0);
+    EXPECT_EQ(overruns.size(), 1u);
+    EXPECT_DOUBLE_EQ(stats.getSummary(FrameStage::Physics).budgetMs, 0.0);
+}
+
+TEST_F(FrameStatsTest, CountsFramesAndParsesStageNames)
+{
+    stats.record(FrameStage::Frame, 16.0);
+    stats.record(FrameStage::Frame, 17.0);
+    stats.record(FrameStage::Swap, 1.0);
+    EXPECT_EQ(stats.getFrameCount(), 2u);
+
+    for (size_t i = 0; i < FrameStats::kStageCount; ++i)
+    {
+        const auto stage = static_cast<FrameStage>(i);
+        EXPECT_EQ(FrameStats::ParseStage(FrameStats::StageName(stage)), stage);
+    }
+    EXPECT_FALSE(FrameStats::ParseStage("NotAStage").has_value());
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <Foundation/Log/LoggerMacro.h>
+#include <Foundation/Profiler/HitchRecorder.h>
+#include <Foundation/Profiler/ProfilerMacros.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace EngineCore::Foundation;
+
+namespace
+{
+void SlowWork(int ms)
+{
+    ZoneScopedN("Test/HitchWork");
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+std::string ReadFile(const std::string& path)
+{
+    std::ifstream file(path);
+    std::stringstream text;
+    text << file.rdbuf();
+    return text.str();
+}
+} // namespace
+
+class HitchRecorderTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        directory = std::filesystem::temp_directory_path() / "lampy_hitch_test";
+        std::filesystem::remove_all(directory);
+
+        HitchRecorderConfig config;
+        config.budgetMs        = 40.0;
+        config.frames          = 4;
+        config.directory       = directory.string();
+        config.cooldownSeconds = 0.0;
+        HitchRecorder::Enable(config);
+    }
+
+    void TearDown() override
+    {
+        HitchRecorder::Disable();
+        std::filesystem::remove_all(directory);
+    }
+
+    std::filesystem::path directory;
+};
+
+TEST_F(HitchRecorderTest, FastFramesDoNotDump)
+{
+    const uint64_t before = HitchRecorder::GetHitchCount();
+    for (int i = 0; i < 5; ++i)
+    {
+        HitchRecorder::FrameBoundary();
+        SlowWork(1);
+    }
+    EXPECT_EQ(HitchRecorder::GetHitchCount(), before);
+    EXPECT_FALSE(CpuProfiler::IsCapturing());
+    EXPECT_TRUE(CpuProfiler::IsRecording());
+}
+
+TEST_F(HitchRecorderTest, SlowFrameDumpsRecentHistory)
+{
+    const uint64_t before = HitchRecorder::GetHitchCount();
+    HitchRecorder::FrameBoundary();
+    SlowWork(1);
+    HitchRecorder::Count(HitchCounter::Events, 3);
+    HitchRecorder::FrameBoundary();
+    SlowWork(60);
+    HitchRecorder::FrameBoundary();
+
+    ASSERT_EQ(HitchRecorder::GetHitchCount(), before + 1);
+    HitchRecorder::WaitForDump();
+    const std::string path = HitchRecorder::GetLastDumpPath();
+    ASSERT_FALSE(path.empty());
+    ASSERT_TRUE(std::filesystem::exists(path));
+
+    const std::string trace = ReadFile(path);
+    EXPECT_NE(trace.find("\"name\":\"Test/HitchWork\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"Events\",\"ph\":\"C\""), std::string::npos);
+    EXPECT_NE(trace.find("\"per frame\":3.000"), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"Frames\""), std::string::npos);
+}
+
+TEST(HitchRecorderDisabledTest, DisablingStopsFlightRecording)
+{
+    HitchRecorder::Enable({});
+    EXPECT_TRUE(CpuProfiler::IsRecording());
+    HitchRecorder::Disable();
+    EXPECT_FALSE(HitchRecorder::IsEnabled());
+    EXPECT_FALSE(CpuProfiler::IsRecording());
+}
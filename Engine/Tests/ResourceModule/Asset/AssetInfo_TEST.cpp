@@ -117,7 +117,8 @@ TEST_F(AssetInfoTest, DifferentAssetTypes)
         AssetType::Shader,
         AssetType::Material,
         AssetType::Script,
-        AssetType::World
+        AssetType::World,
+        AssetType::Prefab
     };
     
     for (auto type : types)
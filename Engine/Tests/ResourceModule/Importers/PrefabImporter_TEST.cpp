@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <Modules/ResourceModule/Asset/Importers/PrefabImporter.h>
+#include <Modules/ResourceModule/Asset/AssetInfo.h>
+#include <Modules/ResourceModule/RPrefab.h>
+#include "../TestHelpers.h"
+#include <filesystem>
+#include <fstream>
+
+using namespace ResourceModule;
+using namespace ResourceModuleTest;
+
+class PrefabImporterTest : public ResourceModuleTestBase
+{
+protected:
+    void SetUp() override
+    {
+        ResourceModuleTestBase::SetUp();
+
+        tempDir = std::make_unique<TempDirectory>("PrefabImporterTest");
+        resourcesDir = tempDir->createSubdir("Resources");
+        cacheDir = tempDir->createSubdir("Cache");
+    }
+
+    void TearDown() override
+    {
+        tempDir.reset();
+        ResourceModuleTestBase::TearDown();
+    }
+
+    std::filesystem::path writePrefab(const std::filesystem::path& relative, const std::string& json)
+    {
+        std::filesystem::path path = resourcesDir / relative;
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream file(path);
+        file << json;
+        return path;
+    }
+
+    std::unique_ptr<TempDirectory> tempDir;
+    std::filesystem::path resourcesDir;
+    std::filesystem::path cacheDir;
+};
+
+TEST_F(PrefabImporterTest, SupportsExtension)
+{
+    PrefabImporter importer;
+
+    EXPECT_TRUE(importer.supportsExtension(".lprefab"));
+    EXPECT_FALSE(importer.supportsExtension(".lworld"));
+    EXPECT_EQ(importer.getAssetType(), AssetType::Prefab);
+}
+
+TEST_F(PrefabImporterTest, ImportRoundTripsThroughRPrefab)
+{
+    const std::string json = R"({"components": {"TransformComponent": {"position": {"x": 1, "y": 2, "z": 3}}}})";
+    std::filesystem::path path = writePrefab("projectile.lprefab", json);
+
+    PrefabImporter importer;
+    AssetInfo info = importer.import(path, cacheDir);
+
+    EXPECT_FALSE(info.guid.empty());
+    EXPECT_EQ(info.type, AssetType::Prefab);
+    ASSERT_TRUE(std::filesystem::exists(info.importedPath));
+
+    RPrefab prefab(info.importedPath);
+    EXPECT_TRUE(prefab.isValid());
+    EXPECT_EQ(prefab.getJsonData(), json);
+}
+
+TEST_F(PrefabImporterTest, SameFileNameInDifferentFoldersDoesNotCollide)
+{
+    PrefabImporter importer;
+    AssetInfo a = importer.import(writePrefab("Enemies/unit.lprefab", R"({"components": {}})"), cacheDir);
+    AssetInfo b = importer.import(writePrefab("Allies/unit.lprefab", R"({"components": {}})"), cacheDir);
+
+    EXPECT_NE(a.guid, b.guid);
+    EXPECT_NE(a.importedPath, b.importedPath);
+}
+
+TEST_F(PrefabImporterTest, EmptyFileThrows)
+{
+    PrefabImporter importer;
+    std::filesystem::path path = writePrefab("empty.lprefab", "");
+
+    EXPECT_THROW(importer.import(path, cacheDir), std::runtime_error);
+}
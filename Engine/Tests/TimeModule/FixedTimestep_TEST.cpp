@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <Foundation/Math/Math.h>
+#include <Modules/TimeModule/FixedTimestep.h>
+
+using namespace TimeModule;
+
+TEST(FixedTimestepTests, AccumulatesFrameTimeIntoWholeSteps)
+{
+    FixedTimestep fixedStep(FixedTimestepConfig{50.0, 5});
+    EXPECT_DOUBLE_EQ(fixedStep.stepSeconds(), 0.02);
+
+    // A fast renderer: most frames run no step and only move alpha
+    EXPECT_EQ(fixedStep.advance(0.005), 0u);
+    EXPECT_NEAR(fixedStep.alpha(), 0.25f, 1e-5f);
+    EXPECT_EQ(fixedStep.advance(0.010), 0u);
+    EXPECT_NEAR(fixedStep.alpha(), 0.75f, 1e-5f);
+    EXPECT_EQ(fixedStep.advance(0.010), 1u);
+    EXPECT_NEAR(fixedStep.alpha(), 0.25f, 1e-5f);
+
+    // A slow one runs several per frame
+    EXPECT_EQ(fixedStep.advance(0.045), 2u);
+    EXPECT_NEAR(fixedStep.alpha(), 0.5f, 1e-4f);
+    EXPECT_EQ(fixedStep.totalSteps(), 3u);
+    EXPECT_EQ(fixedStep.droppedSteps(), 0u);
+}
+
+TEST(FixedTimestepTests, StepsMatchElapsedTimeOverManyFrames)
+{
+    FixedTimestep fixedStep(FixedTimestepConfig{30.0, 8});
+    for (int frame = 0; frame < 144 * 10; ++frame)
+        fixedStep.advance(1.0 / 144.0);
+    // Ten seconds at 30 Hz, give or take the step still accumulating
+    EXPECT_GE(fixedStep.totalSteps(), 299u);
+    EXPECT_LE(fixedStep.totalSteps(), 300u);
+    EXPECT_GE(fixedStep.alpha(), 0.0f);
+    EXPECT_LE(fixedStep.alpha(), 1.0f);
+}
+
+TEST(FixedTimestepTests, HitchesAreCappedAndDropped)
+{
+    FixedTimestep fixedStep(FixedTimestepConfig{60.0, 4});
+    EXPECT_EQ(fixedStep.advance(0.25), 4u);
+    EXPECT_EQ(fixedStep.droppedSteps(), 11u);
+    EXPECT_LE(fixedStep.alpha(), 1.0f);
+
+    // The next frame does not inherit the backlog
+    EXPECT_EQ(fixedStep.advance(1.0 / 60.0), 1u);
+}
+
+TEST(FixedTimestepTests, ConfigureClampsAndResets)
+{
+    FixedTimestep fixedStep;
+    fixedStep.advance(0.01);
+    fixedStep.configure(FixedTimestepConfig{0.0, 0});
+    EXPECT_DOUBLE_EQ(fixedStep.getConfig().tickRate, 1.0);
+    EXPECT_EQ(fixedStep.getConfig().maxStepsPerFrame, 1u);
+    EXPECT_FLOAT_EQ(fixedStep.alpha(), 0.0f);
+
+    fixedStep.advance(0.5);
+    fixedStep.reset();
+    EXPECT_FLOAT_EQ(fixedStep.alpha(), 0.0f);
+}
+
+TEST(FixedTimestepTests, InterpolatedTransformKeepsScaleWhileTurning)
+{
+    const Math::Mat4 from = Math::TRS({0.0f, 0.0f, 0.0f}, Math::Quat(1.0f, 0.0f, 0.0f, 0.0f), {2.0f, 2.0f, 2.0f});
+    const Math::Mat4 to = Math::TRS({10.0f, 0.0f, 0.0f},
+                                    glm::angleAxis(Math::HALF_PI, Math::Vec3(0.0f, 1.0f, 0.0f)), {2.0f, 2.0f, 2.0f});
+
+    const Math::Mat4 half = Math::InterpolateTransform(from, to, 0.5f);
+    EXPECT_NEAR(half[3].x, 5.0f, 1e-5f);
+    EXPECT_NEAR(glm::length(Math::Vec3(half[0])), 2.0f, 1e-5f);
+    EXPECT_NEAR(glm::length(Math::Vec3(half[2])), 2.0f, 1e-5f);
+
+    // 45 degrees about Y takes +X halfway to -Z
+    const Math::Vec3 axis = glm::normalize(Math::Vec3(half[0]));
+    EXPECT_NEAR(axis.x, glm::cos(Math::PI / 4.0f), 1e-5f);
+    EXPECT_NEAR(axis.z, -glm::sin(Math::PI / 4.0f), 1e-5f);
+
+    const Math::Mat4 end = Math::InterpolateTransform(from, to, 1.0f);
+    for (int c = 0; c < 4; ++c)
+        for (int r = 0; r < 4; ++r)
+            EXPECT_NEAR(end[c][r], to[c][r], 1e-5f);
+}
@@ -0,0 +1,102 @@
+// Converts .ltlog segments written by BinaryLogSink back to text or JSON Lines.
+//
+//   LampyLogDecoder [--json] [--out <file>] <segment.ltlog | directory>...
+//
+// Directories expand to their .ltlog files in segment order.
+
+#include <Foundation/Log/BinaryLogReader.h>
+#include <Foundation/Log/BinaryLogSink.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace EngineCore::Foundation;
+namespace fs = std::filesystem;
+
+namespace
+{
+int PrintUsage()
+{
+    std::cerr << "Usage: LampyLogDecoder [--json] [--out <file>] <segment.ltlog | directory>...\n";
+    return 2;
+}
+
+std::vector<fs::path> ExpandInputs(const std::vector<std::string>& inputs)
+{
+    std::vector<fs::path> files;
+    for (const auto& input : inputs)
+    {
+        std::error_code ec;
+        if (!fs::is_directory(input, ec))
+        {
+            files.emplace_back(input);
+            continue;
+        }
+
+        std::vector<fs::path> segments;
+        for (const auto& entry : fs::directory_iterator(input, ec))
+        {
+            if (entry.is_regular_file(ec) && entry.path().extension() == BinaryLog::kExtension)
+                segments.push_back(entry.path());
+        }
+        // Segment names are zero-padded, so lexical order is write order.
+        std::sort(segments.begin(), segments.end());
+        files.insert(files.end(), segments.begin(), segments.end());
+    }
+    return files;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    std::string outPath;
+    std::vector<std::string> inputs;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--json")
+            json = true;
+        else if (arg == "--out" && i + 1 < argc)
+            outPath = argv[++i];
+        else if (arg == "--help" || arg == "-h")
+            return PrintUsage();
+        else
+            inputs.push_back(arg);
+    }
+    if (inputs.empty())
+        return PrintUsage();
+
+    std::ofstream outFile;
+    if (!outPath.empty())
+    {
+        outFile.open(outPath, std::ios::binary);
+        if (!outFile)
+        {
+            std::cerr << "Cannot write " << outPath << "\n";
+            return 1;
+        }
+    }
+    std::ostream& out = outPath.empty() ? std::cout : outFile;
+
+    int result = 0;
+    for (const auto& path : ExpandInputs(inputs))
+    {
+        std::vector<BinaryLogEntry> entries;
+        std::string error;
+        if (!BinaryLogReader::ReadFile(path.string(), entries, &error))
+        {
+            std::cerr << path.string() << ": " << error << "\n";
+            result = 1;
+        }
+
+        for (const auto& entry : entries)
+            out << (json ? BinaryLogReader::ToJson(entry) : BinaryLogReader::ToText(entry)) << '\n';
+    }
+    return result;
+}
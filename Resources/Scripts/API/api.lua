@@ -24,6 +24,84 @@ function LogError(message) end -- Write error-level message to engine log.
 ---@param message string
 function LogFatal(message) end -- Write fatal-level message to engine log.
 
+-- ---------------------------------------------------------------------------
+-- Frame statistics
+-- ---------------------------------------------------------------------------
+
+---@alias FrameStage "Frame"|"AssetChanges"|"Time"|"ECS"|"Physics"|"Context"|"Render"|"ContextRender"|"Swap"
+
+---@class FrameStageSummary
+---@field p50 number -- Milliseconds over the recent frame window.
+---@field p95 number
+---@field p99 number
+---@field max number
+---@field avg number
+---@field last number
+---@field budget number -- 0 when no budget is set.
+---@field samples integer
+---@field overruns integer -- Frames over budget since the budget was set.
+local FrameStageSummary = {}
+
+---@class FrameStats
+FrameStats = {}
+
+---@param stage FrameStage
+---@return FrameStageSummary|nil -- nil (and a warning) for an unknown stage.
+function FrameStats.getSummary(stage) return nil end
+
+---@param stage FrameStage
+---@param percentile number -- 0..100
+---@return number ms
+function FrameStats.getPercentile(stage, percentile) return 0 end
+
+---@param stage FrameStage
+---@param budgetMs number
+function FrameStats.setBudget(stage, budgetMs) end -- Overruns are logged, rate limited.
+
+---@param stage FrameStage
+function FrameStats.clearBudget(stage) end
+
+---@return integer
+function FrameStats.getFrameCount() return 0 end
+
+-- ---------------------------------------------------------------------------
+-- Metrics (shared with the engine's MetricsRegistry)
+-- ---------------------------------------------------------------------------
+
+---@class HistogramValue
+---@field count integer
+---@field sum number
+local HistogramValue = {}
+
+---@class MetricInfo
+---@field name string
+---@field type "counter"|"gauge"|"histogram"
+---@field help string
+---@field value number|HistogramValue
+local MetricInfo = {}
+
+---@class Metrics
+Metrics = {}
+
+---@param name string
+---@param amount? number -- Default 1; negative amounts count as 0.
+function Metrics.add(name, amount) end -- Increment a counter, creating it on first use.
+
+---@param name string
+---@param value number
+function Metrics.set(name, value) end -- Set a gauge.
+
+---@param name string
+---@param value number -- Milliseconds for the default bucket bounds.
+function Metrics.observe(name, value) end -- Record a histogram sample.
+
+---@param name string
+---@return number|HistogramValue|nil
+function Metrics.get(name) return nil end
+
+---@return MetricInfo[]
+function Metrics.list() return {} end
+
 -- ---------------------------------------------------------------------------
 -- Asset identifiers
 -- ---------------------------------------------------------------------------
@@ -291,6 +369,20 @@ function Entity:set_scale(value) end
 
 function Entity:remove_scale() end
 
+-- Hierarchy --------------------------------------------------------------
+
+---@return Vec3|nil
+function Entity:get_world_position() return nil end
+
+---@return RotationComponent|nil
+function Entity:get_world_rotation() return nil end
+
+---@return Entity|nil
+function Entity:get_parent() return nil end
+
+---@param parent Entity|nil
+function Entity:set_parent(parent) end
+
 -- Camera -----------------------------------------------------------------
 
 ---@return boolean
@@ -391,6 +483,69 @@ function World:find(name) return Entity end -- Finds an existing entity by name.
 ---@param entity Entity
 function World:destroy(entity) end -- Destroys the given entity instance if alive.
 
+---@return EntityCommandBuffer|nil
+function World:commands() return EntityCommandBuffer end -- This thread's command buffer, applied after the world's systems ran.
+
+---@param source string
+---@return Entity|nil
+function World:prefab(source) return Entity end -- Prefab for a .lprefab asset, loaded on first use.
+
+---@param prefab Entity
+---@param placement integer|(Vec3|TransformComponent)[]
+---@return Entity[]
+function World:spawn_batch(prefab, placement) return {} end -- Instances of prefab in one bulk operation: a count, or one position/transform each.
+
+---@param min Vec3
+---@param max Vec3
+---@return Entity[]
+function World:query_box(min, max) return {} end -- Entities whose bounds overlap the box.
+
+---@param center Vec3
+---@param radius number
+---@return Entity[]
+function World:query_sphere(center, radius) return {} end -- Entities whose bounds overlap the sphere.
+
+---@param centers Vec3[]
+---@param radius number
+---@return Entity[][]
+function World:query_spheres(centers, radius) return {} end -- One query_sphere result per center.
+
+---@param camera Entity
+---@return Entity[]
+function World:query_camera(camera) return {} end -- Entities whose bounds touch the camera's view frustum.
+
+---@param origin Vec3
+---@param direction Vec3
+---@param maxDistance number|nil
+---@return Entity|nil, number
+function World:raycast(origin, direction, maxDistance) return nil, 0 end -- Closest entity bounds hit and the distance.
+
+---@param origin Vec3
+---@param direction Vec3
+---@param maxDistance number|nil
+---@return { entity: Entity, distance: number }[]
+function World:raycast_all(origin, direction, maxDistance) return {} end -- Every entity bounds hit, nearest first.
+
+---@class EntityCommandBuffer
+local EntityCommandBuffer = {}
+
+---@param prefab Entity
+---@param transform TransformComponent|nil
+function EntityCommandBuffer:instantiate(prefab, transform) end -- Queues an instance of prefab.
+
+---@param entity Entity
+function EntityCommandBuffer:destroy(entity) end -- Queues destroying entity.
+
+---@param entity Entity
+---@param transform TransformComponent
+function EntityCommandBuffer:set_transform(entity, transform) end -- Queues a transform write.
+
+---@param entity Entity
+function EntityCommandBuffer:remove_transform(entity) end -- Queues removing the transform.
+
+---@return integer
+function EntityCommandBuffer:size() return 0 end -- Commands waiting for playback.
+
 ---@class PositionComponent
 ---@field x number
 ---@field y number